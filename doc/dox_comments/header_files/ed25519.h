@@ -145,6 +145,31 @@ int wc_ed25519_verify_msg(const byte* sig, word32 siglen, const byte* msg,
 WOLFSSL_API
 int wc_ed25519_init(ed25519_key* key);
 
+/*!
+    \ingroup ED25519
+
+    \brief This function initializes an ed25519_key object for future use
+    with a heap hint for the memory that operations on the key allocate.
+
+    \return 0 Returned upon successfully initializing the ed25519_key object
+    \return BAD_FUNC_ARG Returned if key is NULL
+
+    \param key pointer to the ed25519_key object to initialize
+    \param heap heap hint for dynamic memory allocation
+    \param devId device identifier, INVALID_DEVID when not used
+
+    _Example_
+    \code
+    ed25519_key key;
+    wc_ed25519_init_ex(&key, NULL, INVALID_DEVID);
+    \endcode
+
+    \sa wc_ed25519_init
+    \sa wc_ed25519_free
+*/
+WOLFSSL_API
+int wc_ed25519_init_ex(ed25519_key* key, void* heap, int devId);
+
 /*!
     \ingroup ED25519
 
@@ -113,6 +113,14 @@ bench_tls(args);
         /* MAX_UDP_SIZE in interna.h */
         #define TEST_DTLS_PACKET_SIZE   (8092)
     #endif
+    /* DTLS throughput mode writes several records per call */
+    #ifndef TEST_DTLS_THROUGHPUT_SIZE
+        #define TEST_DTLS_THROUGHPUT_SIZE   (8 * TEST_DTLS_PACKET_SIZE)
+    #endif
+    /* Reordering simulator maximum depth and datagram size, record header,
+     * IV, MAC and padding on top of the packet size */
+    #define BENCH_REORDER_MAX       4096
+    #define BENCH_REORDER_DGRAM_SZ  (TEST_DTLS_PACKET_SIZE + 1024)
 #endif
 
 /* In memory transfer buffer maximum size */
@@ -272,6 +280,14 @@ typedef struct {
     int shutdown;
     int sockFd;
     int ret;
+#ifdef WOLFSSL_DTLS
+    /* reordering simulator, datagrams received and not yet read */
+    void* ioCtx;
+    unsigned char* reorderBuf;
+    int reorderSz[BENCH_REORDER_MAX];
+    int reorderCount;
+    int reorderDepth;
+#endif
 } side_t;
 
 typedef struct {
@@ -288,6 +304,8 @@ typedef struct {
 #endif
 #ifdef WOLFSSL_DTLS
     int doDTLS;
+    int doDTLSThroughput; /* library socket I/O, multi record writes */
+    int reorderDepth;     /* datagrams received delivered last first */
     struct sockaddr_in serverAddr;
     struct sockaddr_in clientAddr;
 #ifdef HAVE_PTHREAD
@@ -525,7 +543,7 @@ static int ReceiveFrom(WOLFSSL *ssl, int sd, char *buf, int sz)
     int recvd;
     int dtls_timeout = wolfSSL_dtls_get_current_timeout(ssl);
     struct sockaddr peer;
-    socklen_t peerSz;
+    socklen_t peerSz = sizeof(peer);
     
     if (DoneHandShake) dtls_timeout = 0;
 
@@ -614,6 +632,61 @@ static int myDoneHsCb(WOLFSSL* ssl, void* user_ctx)
 }
 #endif /* WOLFSSL_DTLS && !NO_WOLFSSL_CLIENT */
 
+#ifdef WOLFSSL_DTLS
+/* Datagram reordering simulator for the throughput mode: takes the datagrams
+ * that have arrived, up to the reorder depth, and hands them to the library
+ * last first. Handshake flights are passed as received. */
+static int ReorderRecv(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    side_t* side = (side_t*)ctx;
+    int ret;
+
+    if (side->reorderCount == 0) {
+        ret = EmbedReceiveFrom(ssl, buf, sz, side->ioCtx);
+        if (ret <= 0 || !wolfSSL_is_init_finished(ssl))
+            return ret;
+        if (ret > BENCH_REORDER_DGRAM_SZ)
+            return ret;
+
+        XMEMCPY(side->reorderBuf, buf, ret);
+        side->reorderSz[side->reorderCount++] = ret;
+        while (side->reorderCount < side->reorderDepth) {
+            ret = (int)recv(side->sockFd, side->reorderBuf +
+                    side->reorderCount * BENCH_REORDER_DGRAM_SZ,
+                    BENCH_REORDER_DGRAM_SZ, MSG_DONTWAIT);
+            if (ret <= 0)
+                break;
+            side->reorderSz[side->reorderCount++] = ret;
+        }
+    }
+
+    side->reorderCount--;
+    ret = min(sz, side->reorderSz[side->reorderCount]);
+    XMEMCPY(buf, side->reorderBuf +
+            side->reorderCount * BENCH_REORDER_DGRAM_SZ, ret);
+
+    return ret;
+}
+
+/* Put the reordering simulator in front of the library's socket I/O */
+static int ReorderSetup(WOLFSSL* ssl, side_t* side, int depth)
+{
+    if (side->reorderBuf == NULL) {
+        side->reorderBuf = (unsigned char*)XMALLOC(
+            depth * BENCH_REORDER_DGRAM_SZ, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+        if (side->reorderBuf == NULL)
+            return MEMORY_E;
+    }
+    side->reorderDepth = depth;
+    side->reorderCount = 0;
+    side->ioCtx = wolfSSL_GetIOReadCtx(ssl);
+    wolfSSL_SSLSetIORecv(ssl, ReorderRecv);
+    wolfSSL_SetIOReadCtx(ssl, side);
+
+    return 0;
+}
+#endif /* WOLFSSL_DTLS */
+
 #ifndef NO_WOLFSSL_SERVER
 static int ServerSend(WOLFSSL* ssl, char* buf, int sz, void* ctx)
 {
@@ -831,8 +904,14 @@ static int bench_tls_client(info_t* info)
     }
 #endif
 
-    wolfSSL_CTX_SetIOSend(cli_ctx, ClientSend);
-    wolfSSL_CTX_SetIORecv(cli_ctx, ClientRecv);
+#ifdef WOLFSSL_DTLS
+    /* throughput mode sends with the library's batched datagram output */
+    if (!info->doDTLSThroughput)
+#endif
+    {
+        wolfSSL_CTX_SetIOSend(cli_ctx, ClientSend);
+        wolfSSL_CTX_SetIORecv(cli_ctx, ClientRecv);
+    }
 
     /* set cipher suite */
     ret = wolfSSL_CTX_set_cipher_list(cli_ctx, info->cipher);
@@ -901,9 +980,26 @@ static int bench_tls_client(info_t* info)
                 goto exit;
             }
         }
+        if (info->doDTLSThroughput) {
+            ret = wolfSSL_set_fd(cli_ssl, info->client.sockFd);
+            if (ret != WOLFSSL_SUCCESS) {
+                printf("error setting client fd\n");
+                goto exit;
+            }
+            if (info->reorderDepth > 0) {
+                ret = ReorderSetup(cli_ssl, &info->client, info->reorderDepth);
+                if (ret != 0) {
+                    printf("error setting client reordering\n");
+                    goto exit;
+                }
+            }
+        }
+        else
 #endif
-        wolfSSL_SetIOReadCtx(cli_ssl, info);
-        wolfSSL_SetIOWriteCtx(cli_ssl, info);
+        {
+            wolfSSL_SetIOReadCtx(cli_ssl, info);
+            wolfSSL_SetIOWriteCtx(cli_ssl, info);
+        }
 
 #if defined(HAVE_PTHREAD) && defined(WOLFSSL_DTLS)
         /* synchronize with server */ 
@@ -1000,6 +1096,18 @@ static int bench_tls_client(info_t* info)
                 err = wolfSSL_get_error(cli_ssl, ret);
             }
             while (err == WOLFSSL_ERROR_WANT_READ);
+        #endif
+        #ifdef WOLFSSL_DTLS
+            /* the echo of a multi record write takes a read per record */
+            while (info->doDTLSThroughput && ret > 0 && ret < writeSz) {
+                int rdSz = wolfSSL_read(cli_ssl, readBuf + ret,
+                                        readBufSz - ret);
+                if (rdSz < 0) {
+                    ret = rdSz;
+                    break;
+                }
+                ret += rdSz;
+            }
         #endif
             info->client_stats.rxTime += gettime_secs(0) - start;
             if (ret < 0) {
@@ -1010,8 +1118,12 @@ static int bench_tls_client(info_t* info)
             info->client_stats.rxTotal += ret;
             ret = 0; /* reset return code */
 
-            /* validate echo */
-            if (XMEMCMP((char*)writeBuf, (char*)readBuf, writeSz) != 0) {
+            /* validate echo, reordered records are echoed out of order */
+            if (
+            #ifdef WOLFSSL_DTLS
+                info->reorderDepth == 0 &&
+            #endif
+                XMEMCMP((char*)writeBuf, (char*)readBuf, writeSz) != 0) {
                 printf("echo check failed!\n");
                 ret = wolfSSL_get_error(cli_ssl, ret);
                 goto exit;
@@ -1039,6 +1151,10 @@ exit:
         wolfSSL_CTX_free(cli_ctx);
     XFREE(readBuf, NULL, DYNAMIC_TYPE_TMP_BUFFER);
     XFREE(writeBuf, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#ifdef WOLFSSL_DTLS
+    XFREE(info->client.reorderBuf, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    info->client.reorderBuf = NULL;
+#endif
     info->client.ret = ret;
 
     return ret;
@@ -1245,8 +1361,14 @@ static int bench_tls_server(info_t* info)
     }
 #endif /* !NO_CERTS */
 
-    wolfSSL_CTX_SetIOSend(srv_ctx, ServerSend);
-    wolfSSL_CTX_SetIORecv(srv_ctx, ServerRecv);
+#ifdef WOLFSSL_DTLS
+    /* throughput mode sends with the library's batched datagram output */
+    if (!info->doDTLSThroughput)
+#endif
+    {
+        wolfSSL_CTX_SetIOSend(srv_ctx, ServerSend);
+        wolfSSL_CTX_SetIORecv(srv_ctx, ServerRecv);
+    }
 
     /* set cipher suite */
     ret = wolfSSL_CTX_set_cipher_list(srv_ctx, info->cipher);
@@ -1308,10 +1430,26 @@ static int bench_tls_server(info_t* info)
                 goto exit;
             }
         }
+        if (info->doDTLSThroughput) {
+            ret = wolfSSL_set_fd(srv_ssl, info->server.sockFd);
+            if (ret != WOLFSSL_SUCCESS) {
+                printf("error setting server fd\n");
+                goto exit;
+            }
+            if (info->reorderDepth > 0) {
+                ret = ReorderSetup(srv_ssl, &info->server, info->reorderDepth);
+                if (ret != 0) {
+                    printf("error setting server reordering\n");
+                    goto exit;
+                }
+            }
+        }
+        else
 #endif
-
-        wolfSSL_SetIOReadCtx(srv_ssl, info);
-        wolfSSL_SetIOWriteCtx(srv_ssl, info);
+        {
+            wolfSSL_SetIOReadCtx(srv_ssl, info);
+            wolfSSL_SetIOWriteCtx(srv_ssl, info);
+        }
     #ifndef NO_DH
         wolfSSL_SetTmpDH(srv_ssl, dhp, sizeof(dhp), dhg, sizeof(dhg));
     #endif
@@ -1354,6 +1492,19 @@ static int bench_tls_server(info_t* info)
                 err = wolfSSL_get_error(srv_ssl, ret);
             }
             while (err == WOLFSSL_ERROR_WANT_READ);
+        #endif
+        #ifdef WOLFSSL_DTLS
+            /* read all records of the client's write to echo them at once */
+            while (info->doDTLSThroughput && ret > 0 && ret < readBufSz &&
+                    XSTRSTR((const char*)readBuf, kShutdown) == NULL) {
+                int rdSz = wolfSSL_read(srv_ssl, readBuf + ret,
+                                        readBufSz - ret);
+                if (rdSz < 0) {
+                    ret = rdSz;
+                    break;
+                }
+                ret += rdSz;
+            }
         #endif
             rxTime = gettime_secs(0) - start;
 
@@ -1424,6 +1575,10 @@ exit:
     if (srv_ctx != NULL)
         wolfSSL_CTX_free(srv_ctx);
     XFREE(readBuf, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#ifdef WOLFSSL_DTLS
+    XFREE(info->server.reorderBuf, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    info->server.reorderBuf = NULL;
+#endif
     info->server.ret = ret;
 
     return ret;
@@ -1513,6 +1668,7 @@ static void Usage(void)
     printf("-p <num>    The packet size <num> in bytes [1-16kB] (default %d)\n", TEST_PACKET_SIZE);
 #ifdef WOLFSSL_DTLS
     printf("            In the case of DTLS, [1-8kB] (default %d)\n", TEST_DTLS_PACKET_SIZE);
+    printf("            In the case of DTLS throughput, [1-64kB] (default %d)\n", TEST_DTLS_THROUGHPUT_SIZE);
 #endif
     printf("-S <num>    The total size <num> in bytes (default %d)\n", TEST_MAX_SIZE);
     printf("-v          Show verbose output\n");
@@ -1525,6 +1681,9 @@ static void Usage(void)
 #endif
 #ifdef WOLFSSL_DTLS
     printf("-u          Use DTLS\n");
+    printf("-U          Use DTLS throughput mode, library socket I/O and multi record packets\n");
+    printf("-R <num>    DTLS throughput mode with received datagrams reordered, up to <num>\n");
+    printf("            [1-%d] deep, must be within the replay window\n", BENCH_REORDER_MAX);
 #endif
 }
 
@@ -1577,6 +1736,8 @@ int bench_tls(void* args)
 #endif
 #ifdef WOLFSSL_DTLS
     int doDTLS = 0;
+    int doDTLSThroughput = 0;
+    int reorderDepth = 0;
 #endif
     if (args != NULL) {
         argc = ((func_args*)args)->argc;
@@ -1588,7 +1749,7 @@ int bench_tls(void* args)
     wolfSSL_Init();
 
     /* Parse command line arguments */
-    while ((ch = mygetopt(argc, argv, "?" "udeil:p:t:vT:sch:P:mS:")) != -1) {
+    while ((ch = mygetopt(argc, argv, "?" "uUR:deil:p:t:vT:sch:P:mS:")) != -1) {
         switch (ch) {
             case '?' :
                 Usage();
@@ -1630,7 +1791,7 @@ int bench_tls(void* args)
 
             case 'p' :
                 argTestPacketSize = atoi(myoptarg);
-                if (argTestPacketSize > (16 * 1024)) {
+                if (argTestPacketSize > (64 * 1024)) {
                     printf("Invalid packet size %d\n", argTestPacketSize);
                     Usage();
                     ret = MY_EX_USAGE; goto exit;
@@ -1663,6 +1824,21 @@ int bench_tls(void* args)
                 argLocalMem = 1;
             #endif
                 break;
+            case 'R':
+            #ifdef WOLFSSL_DTLS
+                reorderDepth = atoi(myoptarg);
+                if (reorderDepth < 1 || reorderDepth > BENCH_REORDER_MAX) {
+                    printf("Invalid reorder depth %d\n", reorderDepth);
+                    Usage();
+                    ret = MY_EX_USAGE; goto exit;
+                }
+            #endif
+                FALL_THROUGH;
+            case 'U':
+            #ifdef WOLFSSL_DTLS
+                doDTLSThroughput = 1;
+            #endif
+                FALL_THROUGH;
             case 'u':
             #ifdef WOLFSSL_DTLS
                 doDTLS = 1;
@@ -1736,17 +1912,24 @@ int bench_tls(void* args)
             printf("tls_bench hasn't yet supported DTLS with local memory.\n");
             ret = MY_EX_USAGE; goto exit;
         }
-        if (option_p && argTestPacketSize > TEST_DTLS_PACKET_SIZE){
+        if (option_p && argTestPacketSize > (doDTLSThroughput ?
+                        TEST_DTLS_THROUGHPUT_SIZE : TEST_DTLS_PACKET_SIZE)) {
             printf("Invalid packet size %d\n", argTestPacketSize);
             Usage();
             ret = MY_EX_USAGE; goto exit;
-        } else {
+        } else if (!option_p) {
             /* argTestPacketSize would be default for tcp packet */
-            if (argTestPacketSize >= TEST_PACKET_SIZE)
-                argTestPacketSize = TEST_DTLS_PACKET_SIZE;
+            argTestPacketSize = doDTLSThroughput ? TEST_DTLS_THROUGHPUT_SIZE :
+                                                   TEST_DTLS_PACKET_SIZE;
         }
     }
+    else
 #endif
+    if (argTestPacketSize > (16 * 1024)) {
+        printf("Invalid packet size %d\n", argTestPacketSize);
+        Usage();
+        ret = MY_EX_USAGE; goto exit;
+    }
     printf("Running TLS Benchmarks...\n");
 
     /* parse by : */
@@ -1781,6 +1964,8 @@ int bench_tls(void* args)
 
         #ifdef WOLFSSL_DTLS
             info->doDTLS = doDTLS;
+            info->doDTLSThroughput = doDTLSThroughput;
+            info->reorderDepth = reorderDepth;
         #ifdef HAVE_PTHREAD
             info->serverReady = 0;
             if (argServerOnly || argClientOnly) {
@@ -719,40 +719,43 @@ static int ImportKeyState(WOLFSSL* ssl, byte* exp, word32 len, byte ver)
     keys->decryptedCur = exp[idx++];
 
     {
-        word16 i, wordCount, wordAdj = 0;
+        word16 i, wordCount;
+        int    ring;
 
-        /* do window */
+        /* do window, the bits of a window of another size or of a sliding
+         * window from an older version are not at the same ring position so
+         * all records in it are taken as received */
         ato16(exp + idx, &wordCount);
         idx += OPAQUE16_LEN;
-
-        if (wordCount > WOLFSSL_DTLS_WINDOW_WORDS) {
-            wordCount = WOLFSSL_DTLS_WINDOW_WORDS;
-            wordAdj = (WOLFSSL_DTLS_WINDOW_WORDS - wordCount) * sizeof(word32);
+        if (idx + wordCount * OPAQUE32_LEN + OPAQUE16_LEN > len) {
+            return BUFFER_E;
         }
+        ring = (ver >= DTLS_EXPORT_VERSION &&
+                wordCount == WOLFSSL_DTLS_WINDOW_WORDS);
 
         XMEMSET(keys->peerSeq[0].window, 0xFF, DTLS_SEQ_SZ);
         for (i = 0; i < wordCount; i++) {
-            ato32(exp + idx, &keys->peerSeq[0].window[i]);
+            if (ring)
+                ato32(exp + idx, &keys->peerSeq[0].window[i]);
             idx += OPAQUE32_LEN;
         }
-        idx += wordAdj;
 
         /* do prevWindow */
         ato16(exp + idx, &wordCount);
         idx += OPAQUE16_LEN;
-
-        if (wordCount > WOLFSSL_DTLS_WINDOW_WORDS) {
-            wordCount = WOLFSSL_DTLS_WINDOW_WORDS;
-            wordAdj = (WOLFSSL_DTLS_WINDOW_WORDS - wordCount) * sizeof(word32);
+        if (idx + wordCount * OPAQUE32_LEN > len) {
+            return BUFFER_E;
         }
 
+        ring = (ver >= DTLS_EXPORT_VERSION &&
+                wordCount == WOLFSSL_DTLS_WINDOW_WORDS);
+
         XMEMSET(keys->peerSeq[0].prevWindow, 0xFF, DTLS_SEQ_SZ);
         for (i = 0; i < wordCount; i++) {
-            ato32(exp + idx, &keys->peerSeq[0].prevWindow[i]);
+            if (ring)
+                ato32(exp + idx, &keys->peerSeq[0].prevWindow[i]);
             idx += OPAQUE32_LEN;
         }
-        idx += wordAdj;
-
     }
 
 #ifdef HAVE_TRUNCATED_HMAC
@@ -810,7 +813,6 @@ static int ImportKeyState(WOLFSSL* ssl, byte* exp, word32 len, byte ver)
     }
 
     WOLFSSL_LEAVE("ImportKeyState", idx);
-    (void)ver;
     return idx;
 }
 
@@ -973,6 +975,7 @@ static int dtls_export_load(WOLFSSL* ssl, byte* exp, word32 len, byte ver)
 
     switch (ver) {
         case DTLS_EXPORT_VERSION:
+        case DTLS_EXPORT_VERSION_4:
             if (len < DTLS_EXPORT_OPT_SZ) {
                 WOLFSSL_MSG("Sanity check on buffer size failed");
                 return BAD_FUNC_ARG;
@@ -1156,7 +1159,8 @@ static int ImportPeerInfo(WOLFSSL* ssl, byte* buf, word32 len, byte ver)
     word16 port;
     char   ip[DTLS_EXPORT_IP];
 
-    if (ver != DTLS_EXPORT_VERSION && ver != DTLS_EXPORT_VERSION_3) {
+    if (ver != DTLS_EXPORT_VERSION && ver != DTLS_EXPORT_VERSION_4 &&
+            ver != DTLS_EXPORT_VERSION_3) {
         WOLFSSL_MSG("Export version not supported");
         return BAD_FUNC_ARG;
     }
@@ -1391,6 +1395,7 @@ int wolfSSL_dtls_import_state_internal(WOLFSSL* ssl, byte* buf, word32 sz)
     /* perform sanity checks and extract Options information used */
     switch (version) {
         case DTLS_EXPORT_VERSION:
+        case DTLS_EXPORT_VERSION_4:
             break;
 
         default:
@@ -1468,6 +1473,11 @@ int wolfSSL_dtls_import_internal(WOLFSSL* ssl, byte* buf, word32 sz)
             optSz = DTLS_EXPORT_OPT_SZ;
             break;
 
+        case DTLS_EXPORT_VERSION_4:
+            WOLFSSL_MSG("Importing older version 4");
+            optSz = DTLS_EXPORT_OPT_SZ;
+            break;
+
         case DTLS_EXPORT_VERSION_3:
             WOLFSSL_MSG("Importing older version 3");
             optSz = DTLS_EXPORT_OPT_SZ_3;
@@ -1804,6 +1814,11 @@ void SSL_CtxResourceFree(WOLFSSL_CTX* ctx)
     wolfEventQueue_Free(&ctx->event_queue);
 #endif /* HAVE_WOLF_EVENT */
 
+#ifdef WOLFSSL_KEY_SHARE_POOL
+    TLSX_KeySharePool_Free(ctx->keySharePool);
+    ctx->keySharePool = NULL;
+#endif
+
 #ifdef WOLFSSL_STATIC_MEMORY
     if (ctx->onHeap == 1) {
         XFREE(ctx->method, ctx->heap, DYNAMIC_TYPE_METHOD);
@@ -6058,8 +6073,8 @@ int AllocKey(WOLFSSL* ssl, int type, void** pKey)
     #endif /* HAVE_ECC */
     #ifdef HAVE_ED25519
         case DYNAMIC_TYPE_ED25519:
-            wc_ed25519_init((ed25519_key*)*pKey);
-            ret = 0;
+            ret = wc_ed25519_init_ex((ed25519_key*)*pKey, ssl->heap,
+                                                                  ssl->devId);
             break;
     #endif /* HAVE_CURVE25519 */
     #ifdef HAVE_CURVE25519
@@ -6121,7 +6136,8 @@ static int ReuseKey(WOLFSSL* ssl, int type, void* pKey)
     #ifdef HAVE_ED25519
         case DYNAMIC_TYPE_ED25519:
             wc_ed25519_free((ed25519_key*)pKey);
-            ret = wc_ed25519_init((ed25519_key*)pKey);
+            ret = wc_ed25519_init_ex((ed25519_key*)pKey, ssl->heap,
+                                                                  ssl->devId);
             break;
     #endif /* HAVE_CURVE25519 */
     #ifdef HAVE_CURVE25519
@@ -6270,11 +6286,7 @@ void SSL_ResourceFree(WOLFSSL* ssl)
 #endif
 #ifdef WOLFSSL_DTLS
     DtlsMsgPoolReset(ssl);
-    if (ssl->dtls_rx_msg_list != NULL) {
-        DtlsMsgListDelete(ssl->dtls_rx_msg_list, ssl->heap);
-        ssl->dtls_rx_msg_list = NULL;
-        ssl->dtls_rx_msg_list_sz = 0;
-    }
+    DtlsMsgRingFree(ssl);
     XFREE(ssl->buffers.dtlsCtx.peer.sa, ssl->heap, DYNAMIC_TYPE_SOCKADDR);
     ssl->buffers.dtlsCtx.peer.sa = NULL;
 #ifndef NO_WOLFSSL_SERVER
@@ -6514,9 +6526,7 @@ void FreeHandshakeResources(WOLFSSL* ssl)
     /* DTLS_POOL */
     if (ssl->options.dtls) {
         DtlsMsgPoolReset(ssl);
-        DtlsMsgListDelete(ssl->dtls_rx_msg_list, ssl->heap);
-        ssl->dtls_rx_msg_list = NULL;
-        ssl->dtls_rx_msg_list_sz = 0;
+        DtlsMsgRingFree(ssl);
     }
 #endif
 
@@ -6854,12 +6864,6 @@ void DtlsMsgDelete(DtlsMsg* item, void* heap)
     (void)heap;
 
     if (item != NULL) {
-        DtlsFrag* cur = item->fragList;
-        while (cur != NULL) {
-            DtlsFrag* next = cur->next;
-            XFREE(cur, heap, DYNAMIC_TYPE_DTLS_FRAG);
-            cur = next;
-        }
         if (item->buf != NULL)
             XFREE(item->buf, heap, DYNAMIC_TYPE_DTLS_BUFFER);
         XFREE(item, heap, DYNAMIC_TYPE_DTLS_MSG);
@@ -6878,225 +6882,147 @@ void DtlsMsgListDelete(DtlsMsg* head, void* heap)
 }
 
 
-/* Create a DTLS Fragment from *begin - end, adjust new *begin and bytesLeft */
-static DtlsFrag* CreateFragment(word32* begin, word32 end, const byte* data,
-                                byte* buf, word32* bytesLeft, void* heap)
+/* Free the buffers of the receive ring */
+void DtlsMsgRingFree(WOLFSSL* ssl)
 {
-    DtlsFrag* newFrag;
-    word32 added = end - *begin + 1;
-
-    (void)heap;
-    newFrag = (DtlsFrag*)XMALLOC(sizeof(DtlsFrag), heap,
-                                 DYNAMIC_TYPE_DTLS_FRAG);
-    if (newFrag != NULL) {
-        newFrag->next = NULL;
-        newFrag->begin = *begin;
-        newFrag->end = end;
+    int i;
 
-        XMEMCPY(buf + *begin, data, added);
-        *bytesLeft -= added;
-        *begin = newFrag->end + 1;
+    for (i = 0; i < DTLS_RX_MSG_RING_SZ; i++) {
+        if (ssl->dtls_rx_msg[i].buf != NULL) {
+            XFREE(ssl->dtls_rx_msg[i].buf, ssl->heap,
+                  DYNAMIC_TYPE_DTLS_FRAG);
+        }
+        XMEMSET(&ssl->dtls_rx_msg[i], 0, sizeof(DtlsMsg));
     }
-
-    return newFrag;
+    ssl->dtls_rx_msg_sz = 0;
 }
 
 
-int DtlsMsgSet(DtlsMsg* msg, word32 seq, const byte* data, byte type,
-                                   word32 fragOffset, word32 fragSz, void* heap)
+/* Mark bytes begin to end - 1 of a message received in the fragment map
+ * returns the number of bytes not received before */
+static word32 DtlsFragMark(byte* map, word32 begin, word32 end)
 {
-    if (msg != NULL && data != NULL && msg->fragSz <= msg->sz &&
-                                             (fragOffset + fragSz) <= msg->sz) {
-        DtlsFrag* cur = msg->fragList;
-        DtlsFrag* prev = cur;
-        DtlsFrag* newFrag;
-        word32 bytesLeft = fragSz; /* could be overlapping fragment */
-        word32 startOffset = fragOffset;
-        word32 added;
-
-        msg->seq = seq;
-        msg->type = type;
+    word32 added = 0;
 
-        if (fragOffset == 0) {
-            XMEMCPY(msg->buf, data - DTLS_HANDSHAKE_HEADER_SZ,
-                    DTLS_HANDSHAKE_HEADER_SZ);
-            c32to24(msg->sz, msg->msg - DTLS_HANDSHAKE_FRAG_SZ);
+    while (begin < end && (begin & 7) != 0) {
+        byte bit = (byte)(1 << (begin & 7));
+        if ((map[begin >> 3] & bit) == 0) {
+            map[begin >> 3] |= bit;
+            added++;
         }
-
-        /* if no message data, just return */
-        if (fragSz == 0)
-            return 0;
-
-        /* if list is empty add full fragment to front */
-        if (cur == NULL) {
-            newFrag = CreateFragment(&fragOffset, fragOffset + fragSz - 1, data,
-                                     msg->msg, &bytesLeft, heap);
-            if (newFrag == NULL)
-                return MEMORY_E;
-
-            msg->fragSz = fragSz;
-            msg->fragList = newFrag;
-
-            return 0;
+        begin++;
+    }
+    for (; begin + 8 <= end; begin += 8) {
+        byte b = map[begin >> 3];
+        if (b != 0xff) {
+            added += 8;
+            for (; b != 0; b &= (byte)(b - 1))
+                added--;
+            map[begin >> 3] = 0xff;
         }
-
-        /* add to front if before current front, up to next->begin */
-        if (fragOffset < cur->begin) {
-            word32 end = fragOffset + fragSz - 1;
-
-            if (end >= cur->begin)
-                end = cur->begin - 1;
-
-            added = end - fragOffset + 1;
-            newFrag = CreateFragment(&fragOffset, end, data, msg->msg,
-                                     &bytesLeft, heap);
-            if (newFrag == NULL)
-                return MEMORY_E;
-
-            msg->fragSz += added;
-
-            newFrag->next = cur;
-            msg->fragList = newFrag;
+    }
+    while (begin < end) {
+        byte bit = (byte)(1 << (begin & 7));
+        if ((map[begin >> 3] & bit) == 0) {
+            map[begin >> 3] |= bit;
+            added++;
         }
+        begin++;
+    }
 
-        /* while we have bytes left, try to find a gap to fill */
-        while (bytesLeft > 0) {
-            /* get previous packet in list */
-            while (cur && (fragOffset >= cur->begin)) {
-                prev = cur;
-                cur = cur->next;
-            }
-
-            /* don't add duplicate data */
-            if (prev->end >= fragOffset) {
-                if ( (fragOffset + bytesLeft - 1) <= prev->end)
-                    return 0;
-                fragOffset = prev->end + 1;
-                bytesLeft = startOffset + fragSz - fragOffset;
-            }
+    return added;
+}
 
-            if (cur == NULL)
-                /* we're at the end */
-                added = bytesLeft;
-            else
-                /* we're in between two frames */
-                added = min(bytesLeft, cur->begin - fragOffset);
 
-            /* data already there */
-            if (added == 0)
-                continue;
+/* Copy a fragment into msg, overlaps with data already received are
+ * counted once */
+int DtlsMsgSet(DtlsMsg* msg, word32 seq, const byte* data, byte type,
+                                   word32 fragOffset, word32 fragSz, void* heap)
+{
+    (void)heap;
 
-            newFrag = CreateFragment(&fragOffset, fragOffset + added - 1,
-                                     data + fragOffset - startOffset,
-                                     msg->msg, &bytesLeft, heap);
-            if (newFrag == NULL)
-                return MEMORY_E;
+    if (msg == NULL || data == NULL || msg->fragMap == NULL ||
+            fragOffset > msg->sz || fragSz > msg->sz - fragOffset)
+        return BAD_FUNC_ARG;
 
-            msg->fragSz += added;
+    msg->seq = seq;
+    msg->type = type;
 
-            newFrag->next = prev->next;
-            prev->next = newFrag;
-        }
+    if (fragOffset == 0) {
+        XMEMCPY(msg->buf, data - DTLS_HANDSHAKE_HEADER_SZ,
+                DTLS_HANDSHAKE_HEADER_SZ);
+        c32to24(msg->sz, msg->msg - DTLS_HANDSHAKE_FRAG_SZ);
     }
 
+    /* if no message data, just return */
+    if (fragSz == 0)
+        return 0;
+
+    XMEMCPY(msg->msg + fragOffset, data, fragSz);
+    msg->fragSz += DtlsFragMark(msg->fragMap, fragOffset, fragOffset + fragSz);
+
     return 0;
 }
 
 
-DtlsMsg* DtlsMsgFind(DtlsMsg* head, word32 seq)
+/* Receive ring slot of message seq, NULL when not stored */
+DtlsMsg* DtlsMsgFind(WOLFSSL* ssl, word32 seq)
 {
-    while (head != NULL && head->seq != seq) {
-        head = head->next;
-    }
-    return head;
+    DtlsMsg* msg = &ssl->dtls_rx_msg[seq & (DTLS_RX_MSG_RING_SZ - 1)];
+
+    return (msg->used && msg->seq == seq) ? msg : NULL;
 }
 
 
 void DtlsMsgStore(WOLFSSL* ssl, word32 seq, const byte* data,
         word32 dataSz, byte type, word32 fragOffset, word32 fragSz, void* heap)
 {
-    /* See if seq exists in the list. If it isn't in the list, make
-     * a new item of size dataSz, copy fragSz bytes from data to msg->msg
-     * starting at offset fragOffset, and add fragSz to msg->fragSz. If
-     * the seq is in the list and it isn't full, copy fragSz bytes from
-     * data to msg->msg starting at offset fragOffset, and add fragSz to
-     * msg->fragSz. Insertions take into account data already in the list
-     * in case there are overlaps in the handshake message due to retransmit
-     * messages. The new item should be inserted into the list in its
-     * proper position.
-     *
-     * 1. Find seq in list, or where seq should go in list. If seq not in
-     *    list, create new item and insert into list. Either case, keep
-     *    pointer to item.
-     * 2. Copy the data from the message to the stored message where it
-     *    belongs without overlaps.
-     */
-
-    DtlsMsg* head = ssl->dtls_rx_msg_list;
+    /* Messages from the expected seq up to DTLS_RX_MSG_RING_SZ - 1 ahead are
+     * kept in the receive ring at index seq, later ones are dropped and will
+     * be retransmitted. A slot has one buffer for the handshake header, the
+     * message and a bitmap of the message bytes received, so fragments are
+     * copied in place in any order and overlaps from retransmits are counted
+     * once. Slot buffers are reused for the following messages. */
+    DtlsMsg* msg;
+    word32   need;
 
-    if (head != NULL) {
-        DtlsMsg* cur = DtlsMsgFind(head, seq);
-        if (cur == NULL) {
-            cur = DtlsMsgNew(dataSz, heap);
-            if (cur != NULL) {
-                if (DtlsMsgSet(cur, seq, data, type,
-                                                fragOffset, fragSz, heap) < 0) {
-                    DtlsMsgDelete(cur, heap);
-                }
-                else {
-                    ssl->dtls_rx_msg_list_sz++;
-                    head = DtlsMsgInsert(head, cur);
-                }
-            }
-        }
-        else {
-            /* If this fails, the data is just dropped. */
-            DtlsMsgSet(cur, seq, data, type, fragOffset, fragSz, heap);
-        }
-    }
-    else {
-        head = DtlsMsgNew(dataSz, heap);
-        if (DtlsMsgSet(head, seq, data, type, fragOffset, fragSz, heap) < 0) {
-            DtlsMsgDelete(head, heap);
-            head = NULL;
-        }
-        else {
-            ssl->dtls_rx_msg_list_sz++;
-        }
+    if (seq - ssl->keys.dtls_expected_peer_handshake_number >=
+                                                         DTLS_RX_MSG_RING_SZ) {
+        WOLFSSL_MSG("DTLS message beyond reassembly ring, dropped");
+        return;
     }
 
-    ssl->dtls_rx_msg_list = head;
-}
-
-
-/* DtlsMsgInsert() is an in-order insert. */
-DtlsMsg* DtlsMsgInsert(DtlsMsg* head, DtlsMsg* item)
-{
-    if (head == NULL || item->seq < head->seq) {
-        item->next = head;
-        head = item;
-    }
-    else if (head->next == NULL) {
-        head->next = item;
-    }
-    else {
-        DtlsMsg* cur = head->next;
-        DtlsMsg* prev = head;
-        while (cur) {
-            if (item->seq < cur->seq) {
-                item->next = cur;
-                prev->next = item;
-                break;
-            }
-            prev = cur;
-            cur = cur->next;
-        }
-        if (cur == NULL) {
-            prev->next = item;
-        }
+    msg = &ssl->dtls_rx_msg[seq & (DTLS_RX_MSG_RING_SZ - 1)];
+    if (!msg->used || msg->seq != seq) {
+        /* slot is free or holds a message already processed */
+        need = DTLS_HANDSHAKE_HEADER_SZ + dataSz + (dataSz + 7) / 8;
+        if (msg->bufSz < need) {
+            if (msg->buf != NULL)
+                XFREE(msg->buf, heap, DYNAMIC_TYPE_DTLS_FRAG);
+            msg->buf = (byte*)XMALLOC(need, heap, DYNAMIC_TYPE_DTLS_FRAG);
+            msg->bufSz = (msg->buf != NULL) ? need : 0;
+            if (msg->buf == NULL) {
+                if (msg->used)
+                    ssl->dtls_rx_msg_sz--;
+                msg->used = 0;
+                return;
+            }
+        }
+        if (!msg->used)
+            ssl->dtls_rx_msg_sz++;
+
+        msg->msg = msg->buf + DTLS_HANDSHAKE_HEADER_SZ;
+        msg->fragMap = msg->msg + dataSz;
+        XMEMSET(msg->fragMap, 0, (dataSz + 7) / 8);
+        msg->sz = dataSz;
+        msg->fragSz = 0;
+        msg->seq = seq;
+        msg->type = no_shake;
+        msg->used = 1;
     }
 
-    return head;
+    /* If this fails, the data is just dropped. */
+    DtlsMsgSet(msg, seq, data, type, fragOffset, fragSz, heap);
 }
 
 
@@ -7232,10 +7158,9 @@ int DtlsMsgPoolSend(WOLFSSL* ssl, int sendOnlyFirstPacket)
                     return ret;
                 }
 
-                XMEMCPY(ssl->buffers.outputBuffer.buffer,
-                        pool->buf, pool->sz);
-                ssl->buffers.outputBuffer.idx = 0;
-                ssl->buffers.outputBuffer.length = pool->sz;
+                XMEMCPY(ssl->buffers.outputBuffer.buffer +
+                        ssl->buffers.outputBuffer.length, pool->buf, pool->sz);
+                ssl->buffers.outputBuffer.length += pool->sz;
             }
             else if (pool->seq == ssl->keys.dtls_epoch) {
                 byte*  input;
@@ -7263,7 +7188,12 @@ int DtlsMsgPoolSend(WOLFSSL* ssl, int sendOnlyFirstPacket)
                 ssl->buffers.outputBuffer.length += sendSz;
             }
 
-            ret = SendBuffered(ssl);
+            /* the rest of the flight follows, send it all at once */
+            if (pool->next != NULL && !(sendOnlyFirstPacket &&
+                                  ssl->options.side == WOLFSSL_SERVER_END))
+                ret = DtlsQueueBuffered(ssl);
+            else
+                ret = SendBuffered(ssl);
             if (ret < 0) {
                 WOLFSSL_ERROR(ret);
                 return ret;
@@ -7977,6 +7907,9 @@ void ShrinkOutputBuffer(WOLFSSL* ssl)
     ssl->buffers.outputBuffer.bufferSize  = STATIC_BUFFER_LEN;
     ssl->buffers.outputBuffer.dynamicFlag = 0;
     ssl->buffers.outputBuffer.offset      = 0;
+#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_SENDMMSG)
+    ssl->buffers.dtlsTxCount = 0;
+#endif
 }
 
 
@@ -8006,6 +7939,98 @@ void ShrinkInputBuffer(WOLFSSL* ssl, int forcedFree)
     ssl->buffers.inputBuffer.length = usedLength;
 }
 
+#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_SENDMMSG)
+/* Close the datagram of output buffer data not yet queued
+ * returns number of queued datagrams */
+static int DtlsTxClose(WOLFSSL* ssl)
+{
+    word32 queued = 0;
+    int    i;
+
+    for (i = 0; i < ssl->buffers.dtlsTxCount; i++)
+        queued += ssl->buffers.dtlsTxSz[i];
+
+    if (ssl->buffers.outputBuffer.length > queued)
+        ssl->buffers.dtlsTxSz[ssl->buffers.dtlsTxCount++] =
+                                     ssl->buffers.outputBuffer.length - queued;
+
+    return ssl->buffers.dtlsTxCount;
+}
+
+
+/* Send the queued datagrams, all at once with the default socket IO */
+static int SendBufferedDatagrams(WOLFSSL* ssl)
+{
+    DtlsTxClose(ssl);
+
+    while (ssl->buffers.dtlsTxCount > 0) {
+        char* buf = (char*)ssl->buffers.outputBuffer.buffer +
+                                                 ssl->buffers.outputBuffer.idx;
+        int   sent;
+        int   i;
+
+    #ifdef USE_WOLFSSL_IO
+        if (ssl->CBIOSend == EmbedSendTo && IsDtlsNotSctpMode(ssl) &&
+                                              ssl->buffers.dtlsTxCount > 1) {
+            sent = EmbedSendToBatch(ssl, buf, ssl->buffers.dtlsTxSz,
+                              ssl->buffers.dtlsTxCount, ssl->IOCB_WriteCtx);
+        }
+        else
+    #endif
+        {
+            sent = ssl->CBIOSend(ssl, buf, (int)ssl->buffers.dtlsTxSz[0],
+                                 ssl->IOCB_WriteCtx);
+        }
+        if (sent < 0) {
+            switch (sent) {
+                case WOLFSSL_CBIO_ERR_WANT_WRITE:        /* would block */
+                    return WANT_WRITE;
+
+                case WOLFSSL_CBIO_ERR_ISR:               /* interrupt */
+                    continue;
+
+                case WOLFSSL_CBIO_ERR_CONN_RST:          /* connection reset */
+                case WOLFSSL_CBIO_ERR_CONN_CLOSE:        /* epipe / closed */
+                    ssl->options.connReset = 1;
+                    break;
+
+                default:
+                    break;
+            }
+
+            return SOCKET_ERROR_E;
+        }
+
+        if (sent > (int)ssl->buffers.outputBuffer.length) {
+            WOLFSSL_MSG("SendBuffered() out of bounds read");
+            return SEND_OOB_READ_E;
+        }
+
+        ssl->buffers.outputBuffer.idx += sent;
+        ssl->buffers.outputBuffer.length -= sent;
+
+        /* drop the datagrams sent, a user callback may send part of one */
+        for (i = 0; i < ssl->buffers.dtlsTxCount &&
+                    sent >= (int)ssl->buffers.dtlsTxSz[i]; i++) {
+            sent -= (int)ssl->buffers.dtlsTxSz[i];
+        }
+        ssl->buffers.dtlsTxCount -= (byte)i;
+        XMEMMOVE(ssl->buffers.dtlsTxSz, ssl->buffers.dtlsTxSz + i,
+                 ssl->buffers.dtlsTxCount * sizeof(word32));
+        if (ssl->buffers.dtlsTxCount > 0)
+            ssl->buffers.dtlsTxSz[0] -= (word32)sent;
+    }
+
+    ssl->buffers.outputBuffer.idx = 0;
+
+    if (ssl->buffers.outputBuffer.dynamicFlag)
+        ShrinkOutputBuffer(ssl);
+
+    return 0;
+}
+#endif /* WOLFSSL_DTLS && WOLFSSL_DTLS_SENDMMSG */
+
+
 int SendBuffered(WOLFSSL* ssl)
 {
     if (ssl->CBIOSend == NULL) {
@@ -8021,6 +8046,11 @@ int SendBuffered(WOLFSSL* ssl)
     }
 #endif
 
+#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_SENDMMSG)
+    if (ssl->options.dtls)
+        return SendBufferedDatagrams(ssl);
+#endif
+
     while (ssl->buffers.outputBuffer.length > 0) {
         int sent = ssl->CBIOSend(ssl,
                                       (char*)ssl->buffers.outputBuffer.buffer +
@@ -8078,6 +8108,9 @@ int SendBuffered(WOLFSSL* ssl)
     }
 
     ssl->buffers.outputBuffer.idx = 0;
+#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_SENDMMSG)
+    ssl->buffers.dtlsTxCount = 0;
+#endif
 
     if (ssl->buffers.outputBuffer.dynamicFlag)
         ShrinkOutputBuffer(ssl);
@@ -8086,6 +8119,22 @@ int SendBuffered(WOLFSSL* ssl)
 }
 
 
+#ifdef WOLFSSL_DTLS
+/* Queue the output buffer data as one datagram when more will follow, the
+ * queue is sent by the next SendBuffered() or when full. Without
+ * WOLFSSL_DTLS_SENDMMSG the datagram is sent now. */
+int DtlsQueueBuffered(WOLFSSL* ssl)
+{
+#ifdef WOLFSSL_DTLS_SENDMMSG
+    if (DtlsTxClose(ssl) < WOLFSSL_DTLS_TX_BATCH)
+        return 0;
+#endif
+
+    return SendBuffered(ssl);
+}
+#endif /* WOLFSSL_DTLS */
+
+
 /* Grow the output buffer */
 static WC_INLINE int GrowOutputBuffer(WOLFSSL* ssl, int size)
 {
@@ -12692,6 +12741,54 @@ static int DoHandShakeMsg(WOLFSSL* ssl, byte* input, word32* inOutIdx,
 
 #ifdef WOLFSSL_DTLS
 
+/* The replay window is a ring of DTLS_SEQ_BITS bits, a record's bit is at its
+ * sequence number modulo DTLS_SEQ_BITS. The bits of next - DTLS_SEQ_BITS up to
+ * next - 1 are in the window, so moving it forward only clears the bits of
+ * the skipped records instead of shifting all words. */
+#define DTLS_WINDOW_WORD(w, seq) \
+    (w)[((seq) / DTLS_WORD_BITS) % WOLFSSL_DTLS_WINDOW_WORDS]
+#define DTLS_WINDOW_BIT(seq)     ((word32)1 << ((seq) % DTLS_WORD_BITS))
+
+/* Distance between the record sequence number cur and next, the next expected.
+ * Returns (word32)-1 when 2^32 or more apart. */
+static WC_INLINE word32 DtlsWindowDiff(word16 cur_hi, word32 cur_lo,
+                                       word16 next_hi, word32 next_lo,
+                                       int* curLT)
+{
+    if (cur_hi == next_hi) {
+        *curLT = cur_lo < next_lo;
+    }
+    else {
+        *curLT = cur_hi < next_hi;
+        /* the low words have to wrap to be less than 2^32 apart */
+        if (*curLT ? (cur_lo <= next_lo) : (cur_lo >= next_lo))
+            return (word32)-1;
+    }
+
+    return *curLT ? next_lo - cur_lo : cur_lo - next_lo;
+}
+
+/* Clear the bits of count records from seq on */
+static WC_INLINE void DtlsWindowClear(word32* window, word32 seq, word32 count)
+{
+    if (count >= DTLS_SEQ_BITS) {
+        XMEMSET(window, 0, DTLS_SEQ_SZ);
+        return;
+    }
+
+    while (count > 0) {
+        word32 bit = seq % DTLS_WORD_BITS;
+        word32 n = min(count, DTLS_WORD_BITS - bit);
+
+        if (n == DTLS_WORD_BITS)
+            DTLS_WINDOW_WORD(window, seq) = 0;
+        else
+            DTLS_WINDOW_WORD(window, seq) &= ~((((word32)1 << n) - 1) << bit);
+        seq += n;
+        count -= n;
+    }
+}
+
 static WC_INLINE int DtlsCheckWindow(WOLFSSL* ssl)
 {
     word32* window;
@@ -12747,22 +12844,11 @@ static WC_INLINE int DtlsCheckWindow(WOLFSSL* ssl)
         return 0;
     }
 
-    if (cur_hi == next_hi) {
-        curLT = cur_lo < next_lo;
-        diff = curLT ? next_lo - cur_lo : cur_lo - next_lo;
-    }
-    else {
-        curLT = cur_hi < next_hi;
-        diff = curLT ? cur_lo - next_lo : next_lo - cur_lo;
-    }
-
-    /* Check to see that the next value is greater than the number of messages
-     * trackable in the window, and that the difference between the next
-     * expected sequence number and the received sequence number is inside the
-     * window. */
-    if ((next_hi || next_lo > DTLS_SEQ_BITS) &&
-        curLT && (diff > DTLS_SEQ_BITS)) {
+    diff = DtlsWindowDiff(cur_hi, cur_lo, next_hi, next_lo, &curLT);
 
+    /* Check that the difference between the next expected sequence number
+     * and the received sequence number is inside the window. */
+    if (curLT && (diff > DTLS_SEQ_BITS)) {
         WOLFSSL_MSG("Current record sequence number from the past.");
         return 0;
     }
@@ -12773,16 +12859,7 @@ static WC_INLINE int DtlsCheckWindow(WOLFSSL* ssl)
     }
 #endif
     else if (curLT) {
-        word32 idx = diff / DTLS_WORD_BITS;
-        word32 newDiff = diff % DTLS_WORD_BITS;
-
-        /* verify idx is valid for window array */
-        if (idx >= WOLFSSL_DTLS_WINDOW_WORDS) {
-            WOLFSSL_MSG("Invalid DTLS windows index");
-            return 0;
-        }
-
-        if (window[idx] & (1 << newDiff)) {
+        if (DTLS_WINDOW_WORD(window, cur_lo) & DTLS_WINDOW_BIT(cur_lo)) {
             WOLFSSL_MSG("Current record sequence number already received.");
             return 0;
         }
@@ -12875,47 +12952,17 @@ static WC_INLINE int DtlsUpdateWindow(WOLFSSL* ssl)
         window = peerSeq->prevWindow;
     }
 
-    if (cur_hi == *next_hi) {
-        curLT = cur_lo < *next_lo;
-        diff = curLT ? *next_lo - cur_lo : cur_lo - *next_lo;
-    }
-    else {
-        curLT = cur_hi < *next_hi;
-        diff = curLT ? cur_lo - *next_lo : *next_lo - cur_lo;
-    }
+    diff = DtlsWindowDiff(cur_hi, cur_lo, *next_hi, *next_lo, &curLT);
 
     if (curLT) {
-        word32 idx = diff / DTLS_WORD_BITS;
-        word32 newDiff = diff % DTLS_WORD_BITS;
-
-        if (idx < WOLFSSL_DTLS_WINDOW_WORDS)
-            window[idx] |= (1 << newDiff);
+        if (diff <= DTLS_SEQ_BITS)
+            DTLS_WINDOW_WORD(window, cur_lo) |= DTLS_WINDOW_BIT(cur_lo);
     }
     else {
-        if (diff >= DTLS_SEQ_BITS)
-            XMEMSET(window, 0, DTLS_SEQ_SZ);
-        else {
-            word32 idx, newDiff, temp, i;
-            word32 oldWindow[WOLFSSL_DTLS_WINDOW_WORDS];
-
-            temp = 0;
-            diff++;
-            idx = diff / DTLS_WORD_BITS;
-            newDiff = diff % DTLS_WORD_BITS;
-
-            XMEMCPY(oldWindow, window, sizeof(oldWindow));
-
-            for (i = 0; i < WOLFSSL_DTLS_WINDOW_WORDS; i++) {
-                if (i < idx)
-                    window[i] = 0;
-                else {
-                    temp |= (oldWindow[i-idx] << newDiff);
-                    window[i] = temp;
-                    temp = oldWindow[i-idx] >> (DTLS_WORD_BITS - newDiff - 1);
-                }
-            }
-        }
-        window[0] |= 1;
+        /* records skipped up to cur replace those leaving the window */
+        DtlsWindowClear(window, *next_lo, diff);
+        DTLS_WINDOW_WORD(window, cur_lo) |= DTLS_WINDOW_BIT(cur_lo);
+        *next_hi = cur_hi;
         *next_lo = cur_lo + 1;
         if (*next_lo < cur_lo)
             (*next_hi)++;
@@ -12927,18 +12974,17 @@ static WC_INLINE int DtlsUpdateWindow(WOLFSSL* ssl)
 
 static int DtlsMsgDrain(WOLFSSL* ssl)
 {
-    DtlsMsg* item = ssl->dtls_rx_msg_list;
+    DtlsMsg* item;
     int ret = 0;
 
     WOLFSSL_ENTER("DtlsMsgDrain()");
 
-    /* While there is an item in the store list, and it is the expected
-     * message, and it is complete, and there hasn't been an error in the
-     * last message... */
-    while (item != NULL &&
-            ssl->keys.dtls_expected_peer_handshake_number == item->seq &&
-            item->fragSz == item->sz &&
-            ret == 0) {
+    /* While the expected message is in the ring, and it is complete, and
+     * there hasn't been an error in the last message... */
+    while (ret == 0 &&
+            (item = DtlsMsgFind(ssl,
+                   ssl->keys.dtls_expected_peer_handshake_number)) != NULL &&
+            item->fragSz == item->sz) {
         word32 idx = 0;
         ssl->keys.dtls_expected_peer_handshake_number++;
         ret = DoHandShakeMsgType(ssl, item->msg,
@@ -12949,10 +12995,8 @@ static int DtlsMsgDrain(WOLFSSL* ssl)
             break;
         }
     #endif
-        ssl->dtls_rx_msg_list = item->next;
-        DtlsMsgDelete(item, ssl->heap);
-        item = ssl->dtls_rx_msg_list;
-        ssl->dtls_rx_msg_list_sz--;
+        item->used = 0;
+        ssl->dtls_rx_msg_sz--;
     }
 
     WOLFSSL_LEAVE("DtlsMsgDrain()", ret);
@@ -12971,7 +13015,7 @@ static int DoDtlsHandShakeMsg(WOLFSSL* ssl, byte* input, word32* inOutIdx,
     WOLFSSL_ENTER("DoDtlsHandShakeMsg()");
 
     /* process any pending DTLS messages - this flow can happen with async */
-    if (ssl->dtls_rx_msg_list != NULL) {
+    if (ssl->dtls_rx_msg_sz > 0) {
         ret = DtlsMsgDrain(ssl);
         if (ret != 0)
             return ret;
@@ -13023,11 +13067,9 @@ static int DoDtlsHandShakeMsg(WOLFSSL* ssl, byte* input, word32* inOutIdx,
          * the client could be sending multiple new client hello messages
          * with newer and newer cookies.) */
         if (type != client_hello) {
-            if (ssl->dtls_rx_msg_list_sz < DTLS_POOL_SZ) {
-                DtlsMsgStore(ssl, ssl->keys.dtls_peer_handshake_number,
-                             input + *inOutIdx, size, type,
-                             fragOffset, fragSz, ssl->heap);
-            }
+            DtlsMsgStore(ssl, ssl->keys.dtls_peer_handshake_number,
+                         input + *inOutIdx, size, type,
+                         fragOffset, fragSz, ssl->heap);
             *inOutIdx += fragSz;
             ret = 0;
         }
@@ -13068,19 +13110,14 @@ static int DoDtlsHandShakeMsg(WOLFSSL* ssl, byte* input, word32* inOutIdx,
         }
     }
     else if (fragSz < size) {
-        /* Since this branch is in order, but fragmented, dtls_rx_msg_list will
-         * be pointing to the message with this fragment in it. Check it to see
-         * if it is completed. */
-        if (ssl->dtls_rx_msg_list_sz < DTLS_POOL_SZ) {
-            DtlsMsgStore(ssl, ssl->keys.dtls_peer_handshake_number,
-                         input + *inOutIdx, size, type,
-                         fragOffset, fragSz, ssl->heap);
-        }
+        /* Since this branch is in order, but fragmented, the ring slot of
+         * the expected message has this fragment in it. Drain it if it is
+         * completed. */
+        DtlsMsgStore(ssl, ssl->keys.dtls_peer_handshake_number,
+                     input + *inOutIdx, size, type,
+                     fragOffset, fragSz, ssl->heap);
         *inOutIdx += fragSz;
-        ret = 0;
-        if (ssl->dtls_rx_msg_list != NULL &&
-            ssl->dtls_rx_msg_list->fragSz >= ssl->dtls_rx_msg_list->sz)
-            ret = DtlsMsgDrain(ssl);
+        ret = DtlsMsgDrain(ssl);
     }
     else {
         /* This branch is in order next, and a complete message. */
@@ -13088,7 +13125,7 @@ static int DoDtlsHandShakeMsg(WOLFSSL* ssl, byte* input, word32* inOutIdx,
         if (ret == 0) {
             if (type != client_hello || !IsDtlsNotSctpMode(ssl))
                 ssl->keys.dtls_expected_peer_handshake_number++;
-            if (ssl->dtls_rx_msg_list != NULL) {
+            if (ssl->dtls_rx_msg_sz > 0) {
                 ret = DtlsMsgDrain(ssl);
             }
         }
@@ -15807,6 +15844,95 @@ static void FreeBuildMsgArgs(WOLFSSL* ssl, void* pArgs)
         args->iv = NULL;
     }
 }
+
+#if defined(WOLFSSL_AESNI) && defined(USE_INTEL_SPEEDUP) && \
+    defined(BUILD_AES) && defined(HAVE_AES_CBC) && !defined(NO_HMAC) && \
+    !defined(NO_TLS) && !defined(WOLFSSL_AEAD_ONLY) && \
+    !defined(HAVE_FIPS) && !defined(HAVE_SELFTEST) && \
+    !defined(WOLFSSL_ASYNC_CRYPT) && !defined(HAVE_FUZZER)
+    #define BUILD_MSG_CBC_HMAC_STITCH
+
+/* Returns 1 when the record is protected with AES-CBC and HMAC-SHA or
+ * HMAC-SHA256 that can be computed together in one pass over the data.
+ */
+static int BuildMsgCanStitch(WOLFSSL* ssl)
+{
+    if (ssl->hmac != TLS_hmac || !ssl->encrypt.setup)
+        return 0;
+#ifdef HAVE_TRUNCATED_HMAC
+    if (ssl->truncated_hmac)
+        return 0;
+#endif
+    return ssl->specs.cipher_type == block &&
+           ssl->specs.bulk_cipher_algorithm == wolfssl_aes &&
+           (ssl->specs.mac_algorithm == sha_mac ||
+            ssl->specs.mac_algorithm == sha256_mac);
+}
+
+/* MAC and encrypt an AES-CBC record in one pass.
+ * Mac-then-encrypt hashes the plaintext as it is encrypted and
+ * encrypt-then-MAC hashes the ciphertext as it is produced.
+ */
+static int BuildMsgCbcHmac(WOLFSSL* ssl, byte* output, BuildMsgArgs* args,
+                           int inSz, int type)
+{
+    Hmac   hmac;
+    byte   myInner[WOLFSSL_TLS_HMAC_INNER_SZ];
+    byte*  data = output + args->headerSz;
+    word32 sz = (word32)inSz;
+    word32 blocks;
+    int    etm = 0;
+    int    ret;
+
+#ifdef HAVE_ENCRYPT_THEN_MAC
+    etm = ssl->options.startedETMWrite;
+    if (etm)
+        sz = args->ivSz + inSz + args->pad + 1;
+#endif
+
+    wolfSSL_SetTlsHmacInner(ssl, myInner, sz, type, 0);
+
+    ret = wc_HmacInit(&hmac, ssl->heap, ssl->devId);
+    if (ret != 0)
+        return ret;
+
+    ret = wc_HmacSetKey(&hmac, wolfSSL_GetHmacType(ssl),
+                        wolfSSL_GetMacSecret(ssl, 0), ssl->specs.hash_size);
+    if (ret == 0)
+        ret = wc_HmacUpdate(&hmac, myInner, sizeof(myInner));
+    if (ret == 0 && etm) {
+        /* IV, data and padding are encrypted and MAC follows */
+        ret = wc_AesCbcEncrypt_HmacUpdate(ssl->encrypt.aes, &hmac, data, data,
+                                          sz);
+        if (ret == 0)
+            ret = wc_HmacFinal(&hmac, data + sz);
+    }
+    else if (ret == 0) {
+        /* MAC of data is encrypted with the padding after the data */
+        if (args->ivSz > 0)
+            ret = wc_AesCbcEncrypt(ssl->encrypt.aes, data, data, args->ivSz);
+        data += args->ivSz;
+        blocks = sz & ~(AES_BLOCK_SIZE - 1);
+        if (ret == 0 && blocks > 0) {
+            ret = wc_HmacUpdate_AesCbcEncrypt(&hmac, ssl->encrypt.aes, data,
+                                              data, blocks);
+        }
+        if (ret == 0)
+            ret = wc_HmacUpdate(&hmac, data + blocks, sz - blocks);
+        if (ret == 0)
+            ret = wc_HmacFinal(&hmac, data + sz);
+        if (ret == 0) {
+            ret = wc_AesCbcEncrypt(ssl->encrypt.aes, data + blocks,
+                                   data + blocks,
+                                   args->size - args->ivSz - blocks);
+        }
+    }
+
+    wc_HmacFree(&hmac);
+
+    return ret;
+}
+#endif
 #endif
 
 /* Build SSL Message, encrypted */
@@ -16040,6 +16166,13 @@ int BuildMessage(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
             }
     #endif
 
+        #ifdef BUILD_MSG_CBC_HMAC_STITCH
+            if (BuildMsgCanStitch(ssl)) {
+                ret = BuildMsgCbcHmac(ssl, output, args, inSz, type);
+                goto exit_buildmsg;
+            }
+        #endif
+
         #ifndef WOLFSSL_AEAD_ONLY
             if (ssl->specs.cipher_type != aead
             #if defined(HAVE_ENCRYPT_THEN_MAC) && !defined(WOLFSSL_AEAD_ONLY)
@@ -16688,8 +16821,14 @@ int SendCertificate(WOLFSSL* ssl)
     #endif
 
         ssl->buffers.outputBuffer.length += sendSz;
-        if (!ssl->options.groupMessages)
-            ret = SendBuffered(ssl);
+        if (!ssl->options.groupMessages) {
+        #ifdef WOLFSSL_DTLS
+            if (ssl->options.dtls && length > 0)
+                ret = DtlsQueueBuffered(ssl);
+            else
+        #endif
+                ret = SendBuffered(ssl);
+        }
     }
 
     if (ret != WANT_WRITE) {
@@ -17310,7 +17449,15 @@ int SendData(WOLFSSL* ssl, const void* data, int sz)
 
         ssl->buffers.outputBuffer.length += sendSz;
 
-        if ( (ssl->error = SendBuffered(ssl)) < 0) {
+    #ifdef WOLFSSL_DTLS
+        /* queue all but the last record, one datagram each */
+        if (ssl->options.dtls && sent + len < sz &&
+                                           !ssl->options.partialWrite)
+            ssl->error = DtlsQueueBuffered(ssl);
+        else
+    #endif
+            ssl->error = SendBuffered(ssl);
+        if (ssl->error < 0) {
             WOLFSSL_ERROR(ssl->error);
             /* store for next call if WANT_WRITE or user embedSend() that
                doesn't present like WANT_WRITE */
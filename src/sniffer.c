@@ -96,7 +96,10 @@ enum {
     MAX_INPUT_SZ       = MAX_RECORD_SIZE + COMP_EXTRA + MAX_MSG_EXTRA +
                          MTU_EXTRA,  /* Max input sz of reassembly */
     EXT_MASTER_SECRET  = 0x17, /* Extended Master Secret Extension ID */
-    TICKET_EXT_ID      = 0x23 /* Session Ticket Extension ID */
+    TICKET_EXT_ID      = 0x23, /* Session Ticket Extension ID */
+    SUPPORTED_VERSIONS_EXT_ID = 0x2b, /* Supported Versions Extension ID */
+    KEYLOG_HASH_SIZE   = 1021, /* Key Log Hash Table Rows */
+    KEYLOG_LINE_MAX    = 256   /* longest key log line, label + hex values */
 };
 
 
@@ -275,7 +278,16 @@ static const char* const msgTable[] =
     /* 91 */
     "No data destination Error",
     "Store data callback failed",
-    "Loading chain input"
+    "Loading chain input",
+    "Bad Key Log File",
+    "Key Log Line Malformed",
+
+    /* 96 */
+    "Secrets Not Found in Key Log",
+    "Using Secrets from Key Log",
+    "Got Encrypted Extensions msg",
+    "Got Key Update msg",
+    "TLS v1.3 Key Derivation Error"
 };
 
 
@@ -361,6 +373,7 @@ typedef struct Flags {
     byte           srvAckFault;     /* server acked unseen data from client */
     byte           cliSkipPartial;  /* client skips partial data to catch up */
     byte           srvSkipPartial;  /* server skips partial data to catch up */
+    byte           ephemeral;       /* ephemeral key exchange, use key log */
 #ifdef HAVE_EXTENDED_MASTER
     byte           expectEms;       /* expect extended master secret */
 #endif
@@ -426,6 +439,27 @@ typedef struct SnifferSession {
 } SnifferSession;
 
 
+/* Secrets from the key log, index of each kind */
+enum KeyLogSecret {
+    KEYLOG_MASTER_SECRET = SNIFFER_SECRET_CLIENT_RANDOM,
+    KEYLOG_CLIENT_HS_SECRET = SNIFFER_SECRET_CLIENT_HANDSHAKE_TRAFFIC,
+    KEYLOG_SERVER_HS_SECRET = SNIFFER_SECRET_SERVER_HANDSHAKE_TRAFFIC,
+    KEYLOG_CLIENT_TRAFFIC_SECRET = SNIFFER_SECRET_CLIENT_TRAFFIC_0,
+    KEYLOG_SERVER_TRAFFIC_SECRET = SNIFFER_SECRET_SERVER_TRAFFIC_0,
+    KEYLOG_SECRET_COUNT
+};
+
+
+/* Key Log Entry holds the secrets of one session, found by client random */
+typedef struct KeyLogEntry {
+    byte    clientRandom[RAN_LEN];
+    byte    secret[KEYLOG_SECRET_COUNT][SECRET_LEN];
+    byte    secretSz[KEYLOG_SECRET_COUNT];  /* 0 is not present */
+    time_t  lastUsed;                       /* added or last used ticks */
+    struct KeyLogEntry* next;               /* for hash table list */
+} KeyLogEntry;
+
+
 /* Sniffer Server List and mutex */
 static WOLFSSL_GLOBAL SnifferServer* ServerList = 0;
 static WOLFSSL_GLOBAL wolfSSL_Mutex ServerListMutex;
@@ -465,6 +499,16 @@ static WOLFSSL_GLOBAL void* WatchCbCtx = NULL;
 static WOLFSSL_GLOBAL SSLStoreDataCb StoreDataCb;
 #endif
 
+/* Key Log Hash Table, mutex, count, streamed file and callback */
+static WOLFSSL_GLOBAL KeyLogEntry* KeyLogTable[KEYLOG_HASH_SIZE];
+static WOLFSSL_GLOBAL wolfSSL_Mutex KeyLogMutex;
+static WOLFSSL_GLOBAL int KeyLogCount = 0;
+static WOLFSSL_GLOBAL XFILE KeyLogFile = XBADFILE;
+static WOLFSSL_GLOBAL char KeyLogPartial[KEYLOG_LINE_MAX]; /* unfinished line */
+static WOLFSSL_GLOBAL int KeyLogPartialSz = 0;
+static WOLFSSL_GLOBAL SSLKeyLogCb KeyLogCb;
+static WOLFSSL_GLOBAL void* KeyLogCbCtx = NULL;
+
 
 static void UpdateMissedDataSessions(void)
 {
@@ -498,6 +542,7 @@ void ssl_InitSniffer(void)
     wc_InitMutex(&ServerListMutex);
     wc_InitMutex(&SessionMutex);
     wc_InitMutex(&RecoveryMutex);
+    wc_InitMutex(&KeyLogMutex);
 #ifdef WOLFSSL_SNIFFER_STATS
     XMEMSET(&SnifferStats, 0, sizeof(SSLStats));
     wc_InitMutex(&StatsMutex);
@@ -609,6 +654,36 @@ static void FreeSnifferSession(SnifferSession* session)
 }
 
 
+/* Free all Key Log entries and close the streamed file, have a lock */
+static void FreeKeyLog(void)
+{
+    KeyLogEntry* entry;
+    KeyLogEntry* removeEntry;
+    int i;
+
+    for (i = 0; i < KEYLOG_HASH_SIZE; i++) {
+        entry = KeyLogTable[i];
+        while (entry) {
+            removeEntry = entry;
+            entry = entry->next;
+            ForceZero(removeEntry, sizeof(KeyLogEntry));
+            XFREE(removeEntry, NULL, DYNAMIC_TYPE_SNIFFER_KEYLOG);
+        }
+        KeyLogTable[i] = NULL;
+    }
+    KeyLogCount = 0;
+
+    if (KeyLogFile != XBADFILE) {
+        XFCLOSE(KeyLogFile);
+        KeyLogFile = XBADFILE;
+    }
+    ForceZero(KeyLogPartial, sizeof(KeyLogPartial));
+    KeyLogPartialSz = 0;
+    KeyLogCb = NULL;
+    KeyLogCbCtx = NULL;
+}
+
+
 /* Free overall Sniffer */
 void ssl_FreeSniffer(void)
 {
@@ -640,6 +715,11 @@ void ssl_FreeSniffer(void)
     wc_UnLockMutex(&SessionMutex);
     wc_UnLockMutex(&ServerListMutex);
 
+    wc_LockMutex(&KeyLogMutex);
+    FreeKeyLog();
+    wc_UnLockMutex(&KeyLogMutex);
+
+    wc_FreeMutex(&KeyLogMutex);
     wc_FreeMutex(&RecoveryMutex);
     wc_FreeMutex(&SessionMutex);
     wc_FreeMutex(&ServerListMutex);
@@ -923,7 +1003,7 @@ static void TraceSetServer(const char* srv, int port, const char* keyFile)
     if (TraceOn) {
         fprintf(TraceFile, "\tTrying to install a new Sniffer Server with\n");
         fprintf(TraceFile, "\tserver: %s, port: %d, keyFile: %s\n", srv, port,
-                                                                    keyFile);
+                                     keyFile != NULL ? keyFile : "(key log)");
     }
 }
 
@@ -1550,7 +1630,7 @@ static int SetNamedPrivateKey(const char* name, const char* address, int port,
         }
     }
 
-    if (name == NULL) {
+    if (name == NULL && keyFile != NULL) {
         if (password) {
     #ifdef WOLFSSL_ENCRYPTED_KEYS
             SSL_CTX_set_default_passwd_cb(sniffer->ctx, SetPassword);
@@ -1637,6 +1717,438 @@ int ssl_SetPrivateKey(const char* address, int port, const char* keyFile,
 }
 
 
+/* Key Log row from client random, last bytes are random in all versions */
+static word32 KeyLogHash(const byte* clientRandom)
+{
+    word32 hash;
+
+    ato32(clientRandom + RAN_LEN - OPAQUE32_LEN, &hash);
+
+    return hash % KEYLOG_HASH_SIZE;
+}
+
+
+/* Find Key Log entry for client random, have a lock */
+static KeyLogEntry* KeyLogFind(const byte* clientRandom, word32 row)
+{
+    KeyLogEntry* entry = KeyLogTable[row];
+
+    while (entry) {
+        if (XMEMCMP(entry->clientRandom, clientRandom, RAN_LEN) == 0)
+            break;
+        entry = entry->next;
+    }
+
+    return entry;
+}
+
+
+/* Remove stale entries from the Key Log, have a lock */
+static void RemoveStaleKeyLog(void)
+{
+    time_t now = time(NULL);
+    int i;
+
+    for (i = 0; i < KEYLOG_HASH_SIZE; i++) {
+        KeyLogEntry** prev = &KeyLogTable[i];
+
+        while (*prev) {
+            KeyLogEntry* entry = *prev;
+            if (now >= entry->lastUsed + WOLFSSL_SNIFFER_TIMEOUT) {
+                *prev = entry->next;
+                ForceZero(entry, sizeof(KeyLogEntry));
+                XFREE(entry, NULL, DYNAMIC_TYPE_SNIFFER_KEYLOG);
+                KeyLogCount--;
+            }
+            else
+                prev = &entry->next;
+        }
+    }
+}
+
+
+/* Add a secret to the Key Log, have a lock */
+/* returns 0 on success, -1 on error */
+static int KeyLogAdd(const byte* clientRandom, int type, const byte* secret,
+                     word32 secretSz)
+{
+    word32       row = KeyLogHash(clientRandom);
+    KeyLogEntry* entry;
+
+    if (type < 0 || type >= KEYLOG_SECRET_COUNT || secretSz == 0 ||
+                                                       secretSz > SECRET_LEN) {
+        return -1;
+    }
+
+    entry = KeyLogFind(clientRandom, row);
+    if (entry == NULL) {
+        entry = (KeyLogEntry*)XMALLOC(sizeof(KeyLogEntry), NULL,
+                                      DYNAMIC_TYPE_SNIFFER_KEYLOG);
+        if (entry == NULL)
+            return -1;
+        XMEMSET(entry, 0, sizeof(KeyLogEntry));
+        XMEMCPY(entry->clientRandom, clientRandom, RAN_LEN);
+
+        entry->next = KeyLogTable[row];
+        KeyLogTable[row] = entry;
+
+        KeyLogCount++;
+        if ((KeyLogCount % KEYLOG_HASH_SIZE) == 0)
+            RemoveStaleKeyLog();
+    }
+
+    XMEMCPY(entry->secret[type], secret, secretSz);
+    entry->secretSz[type] = (byte)secretSz;
+    entry->lastUsed = time(NULL);
+
+    return 0;
+}
+
+
+/* Convert hex string to binary, returns size or -1 on error */
+static int KeyLogHexToBin(const char* hex, int hexSz, byte* out, int outSz)
+{
+    int i;
+
+    if ((hexSz & 1) || hexSz / 2 > outSz)
+        return -1;
+
+    for (i = 0; i < hexSz; i++) {
+        char c = hex[i];
+        byte nibble;
+
+        if (c >= '0' && c <= '9')
+            nibble = (byte)(c - '0');
+        else if (c >= 'a' && c <= 'f')
+            nibble = (byte)(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F')
+            nibble = (byte)(c - 'A' + 10);
+        else
+            return -1;
+
+        if (i & 1)
+            out[i / 2] |= nibble;
+        else
+            out[i / 2] = (byte)(nibble << 4);
+    }
+
+    return hexSz / 2;
+}
+
+
+/* Parse one key log line "LABEL <client random> <secret>", have a lock */
+/* returns 0 on success or ignored line, -1 on malformed line */
+static int KeyLogParseLine(const char* line, int lineSz)
+{
+    static const struct {
+        const char* label;
+        int         type;
+    } labels[] = {
+        { "CLIENT_RANDOM",                   KEYLOG_MASTER_SECRET },
+        { "CLIENT_HANDSHAKE_TRAFFIC_SECRET", KEYLOG_CLIENT_HS_SECRET },
+        { "SERVER_HANDSHAKE_TRAFFIC_SECRET", KEYLOG_SERVER_HS_SECRET },
+        { "CLIENT_TRAFFIC_SECRET_0",         KEYLOG_CLIENT_TRAFFIC_SECRET },
+        { "SERVER_TRAFFIC_SECRET_0",         KEYLOG_SERVER_TRAFFIC_SECRET },
+    };
+    byte clientRandom[RAN_LEN];
+    byte secret[SECRET_LEN];
+    int  secretSz;
+    int  labelSz = 0;
+    int  randomSz = 0;
+    int  type = -1;
+    int  ret;
+    int  i;
+
+    /* blank lines, comments and windows line ends */
+    while (lineSz > 0 && (line[lineSz - 1] == '\r' || line[lineSz - 1] == ' '))
+        lineSz--;
+    if (lineSz == 0 || line[0] == '#')
+        return 0;
+
+    while (labelSz < lineSz && line[labelSz] != ' ')
+        labelSz++;
+    for (i = 0; i < (int)(sizeof(labels) / sizeof(labels[0])); i++) {
+        if ((int)XSTRLEN(labels[i].label) == labelSz &&
+                              XMEMCMP(labels[i].label, line, labelSz) == 0) {
+            type = labels[i].type;
+            break;
+        }
+    }
+    if (type < 0) {
+        /* exporter, early data and RSA pre master secrets aren't needed */
+        return 0;
+    }
+
+    line   += labelSz + 1;
+    lineSz -= labelSz + 1;
+    while (randomSz < lineSz && line[randomSz] != ' ')
+        randomSz++;
+    if (randomSz >= lineSz ||
+        KeyLogHexToBin(line, randomSz, clientRandom, RAN_LEN) != RAN_LEN) {
+        return -1;
+    }
+
+    line   += randomSz + 1;
+    lineSz -= randomSz + 1;
+    secretSz = KeyLogHexToBin(line, lineSz, secret, SECRET_LEN);
+    if (secretSz <= 0)
+        return -1;
+
+    ret = KeyLogAdd(clientRandom, type, secret, (word32)secretSz);
+    ForceZero(secret, sizeof(secret));
+
+    return ret;
+}
+
+
+/* Parse all complete lines of buffer, have a lock */
+/* returns bytes used, unfinished trailing line is left, -1 on malformed */
+static int KeyLogParse(const char* buf, int sz, int* malformed)
+{
+    int used = 0;
+    int i;
+
+    for (i = 0; i < sz; i++) {
+        if (buf[i] == '\n') {
+            if (i - used >= KEYLOG_LINE_MAX ||
+                    KeyLogParseLine(buf + used, i - used) != 0) {
+                *malformed = 1;
+            }
+            used = i + 1;
+        }
+    }
+
+    return used;
+}
+
+
+/* Read lines added to the streamed key log file since last read, have lock */
+static void KeyLogReadFile(void)
+{
+    char buf[KEYLOG_LINE_MAX * 4];
+    int  malformed = 0;
+    int  sz;
+
+    if (KeyLogFile == XBADFILE)
+        return;
+
+    /* a writer may have appended since we hit the end */
+    clearerr(KeyLogFile);
+
+    XMEMCPY(buf, KeyLogPartial, KeyLogPartialSz);
+    sz = KeyLogPartialSz;
+
+    for (;;) {
+        int got = (int)XFREAD(buf + sz, 1, sizeof(buf) - sz, KeyLogFile);
+        int used;
+
+        if (got <= 0)
+            break;
+        sz += got;
+
+        used = KeyLogParse(buf, sz, &malformed);
+        if (used == 0 && sz == (int)sizeof(buf)) {
+            /* drop overlong line */
+            used = sz;
+        }
+        XMEMMOVE(buf, buf + used, sz - used);
+        sz -= used;
+    }
+
+    if (sz >= KEYLOG_LINE_MAX)
+        sz = 0;
+    XMEMCPY(KeyLogPartial, buf, sz);
+    KeyLogPartialSz = sz;
+    ForceZero(buf, sizeof(buf));
+
+    if (malformed)
+        Trace(KEYLOG_PARSE_STR);
+}
+
+
+/* Copy secret from the Key Log, look in the streamed file and ask the
+ * callback when missing */
+/* returns secret size on success, 0 if not found */
+static int KeyLogGetSecret(const byte* clientRandom, int type, byte* secret)
+{
+    word32       row = KeyLogHash(clientRandom);
+    KeyLogEntry* entry;
+    SSLKeyLogCb  cb;
+    void*        cbCtx;
+    int          sz = 0;
+    int          tries;
+
+    for (tries = 0; tries < 2 && sz == 0; tries++) {
+        if (tries == 1) {
+            /* callback adds the secret so is called without the lock held */
+            wc_LockMutex(&KeyLogMutex);
+            cb = KeyLogCb;
+            cbCtx = KeyLogCbCtx;
+            wc_UnLockMutex(&KeyLogMutex);
+            if (cb == NULL || cb(clientRandom, RAN_LEN, cbCtx) != 0) {
+                break;
+            }
+        }
+
+        wc_LockMutex(&KeyLogMutex);
+        entry = KeyLogFind(clientRandom, row);
+        if ((entry == NULL || entry->secretSz[type] == 0) &&
+                                                    KeyLogFile != XBADFILE) {
+            KeyLogReadFile();
+            entry = KeyLogFind(clientRandom, row);
+        }
+        if (entry != NULL && entry->secretSz[type] != 0) {
+            sz = entry->secretSz[type];
+            XMEMCPY(secret, entry->secret[type], sz);
+            entry->lastUsed = time(NULL);
+        }
+        wc_UnLockMutex(&KeyLogMutex);
+    }
+
+    if (sz != 0)
+        Trace(GOT_KEYLOG_SECRET_STR);
+
+    return sz;
+}
+
+
+/* Remove the secrets of a session once all are used */
+static void KeyLogRemove(const byte* clientRandom)
+{
+    word32        row = KeyLogHash(clientRandom);
+    KeyLogEntry** prev;
+
+    wc_LockMutex(&KeyLogMutex);
+    prev = &KeyLogTable[row];
+    while (*prev) {
+        KeyLogEntry* entry = *prev;
+        if (XMEMCMP(entry->clientRandom, clientRandom, RAN_LEN) == 0) {
+            *prev = entry->next;
+            ForceZero(entry, sizeof(KeyLogEntry));
+            XFREE(entry, NULL, DYNAMIC_TYPE_SNIFFER_KEYLOG);
+            KeyLogCount--;
+            break;
+        }
+        prev = &entry->next;
+    }
+    wc_UnLockMutex(&KeyLogMutex);
+}
+
+
+/* Is any source of key log secrets set up */
+static int KeyLogEnabled(void)
+{
+    int enabled;
+
+    wc_LockMutex(&KeyLogMutex);
+    enabled = KeyLogCount != 0 || KeyLogFile != XBADFILE || KeyLogCb != NULL;
+    wc_UnLockMutex(&KeyLogMutex);
+
+    return enabled;
+}
+
+
+/* Loads secrets from an NSS key log file, the file is kept open and lines
+ * appended later are read when a session's secrets are missing */
+/* returns 0 on success, -1 on error */
+int ssl_LoadKeyLogFile(const char* keyLogFile, char* error)
+{
+    XFILE file;
+
+    if (keyLogFile == NULL) {
+        SetError(KEYLOG_FILE_STR, error, NULL, 0);
+        return -1;
+    }
+
+    file = XFOPEN(keyLogFile, "rb");
+    if (file == XBADFILE) {
+        SetError(KEYLOG_FILE_STR, error, NULL, 0);
+        return -1;
+    }
+
+    wc_LockMutex(&KeyLogMutex);
+    if (KeyLogFile != XBADFILE)
+        XFCLOSE(KeyLogFile);
+    KeyLogFile = file;
+    KeyLogPartialSz = 0;
+    KeyLogReadFile();
+    wc_UnLockMutex(&KeyLogMutex);
+
+    return 0;
+}
+
+
+/* Adds secrets from NSS key log lines, e.g. streamed from a socket */
+/* returns 0 on success, -1 on error, good lines are added regardless */
+int ssl_AddKeyLog(const char* keyLog, int keyLogSz, char* error)
+{
+    int malformed = 0;
+    int used;
+
+    if (keyLog == NULL || keyLogSz < 0) {
+        SetError(BAD_INPUT_STR, error, NULL, 0);
+        return -1;
+    }
+
+    wc_LockMutex(&KeyLogMutex);
+    used = KeyLogParse(keyLog, keyLogSz, &malformed);
+    if (used < keyLogSz) {
+        /* last line doesn't need a line end */
+        if (keyLogSz - used >= KEYLOG_LINE_MAX ||
+                    KeyLogParseLine(keyLog + used, keyLogSz - used) != 0) {
+            malformed = 1;
+        }
+    }
+    wc_UnLockMutex(&KeyLogMutex);
+
+    if (malformed) {
+        SetError(KEYLOG_PARSE_STR, error, NULL, 0);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* Adds one secret for client random, type is a SNIFFER_SECRET_ value */
+/* returns 0 on success, -1 on error */
+int ssl_AddKeyLogSecret(const byte* clientRandom, word32 clientRandomSz,
+                        int type, const byte* secret, word32 secretSz,
+                        char* error)
+{
+    int ret;
+
+    if (clientRandom == NULL || clientRandomSz != RAN_LEN || secret == NULL) {
+        SetError(BAD_INPUT_STR, error, NULL, 0);
+        return -1;
+    }
+
+    wc_LockMutex(&KeyLogMutex);
+    ret = KeyLogAdd(clientRandom, type, secret, secretSz);
+    wc_UnLockMutex(&KeyLogMutex);
+
+    if (ret != 0)
+        SetError(KEYLOG_PARSE_STR, error, NULL, 0);
+
+    return ret;
+}
+
+
+/* Sets the callback asked for secrets that aren't in the key log */
+/* returns 0 on success */
+int ssl_SetKeyLogCallback(SSLKeyLogCb cb, void* ctx, char* error)
+{
+    (void)error;
+
+    wc_LockMutex(&KeyLogMutex);
+    KeyLogCb = cb;
+    KeyLogCbCtx = ctx;
+    wc_UnLockMutex(&KeyLogMutex);
+
+    return 0;
+}
+
+
 /* Check IP Header for IPV6, TCP, and a registered server address */
 /* returns 0 on success, -1 on error */
 static int CheckIp6Hdr(Ip6Hdr* iphdr, IpInfo* info, int length, char* error)
@@ -1826,7 +2338,63 @@ static void CallConnectionCb(SnifferSession* session)
 }
 
 
-/* Process Client Key Exchange, RSA or static ECDH */
+/* Derive keys for both sides from the master secret */
+static int DeriveSessionKeys(SnifferSession* session, char* error)
+{
+    int ret;
+
+    if (SetCipherSpecs(session->sslServer) != 0) {
+        SetError(BAD_CIPHER_SPEC_STR, error, session, FATAL_ERROR_STATE);
+        return -1;
+    }
+
+    if (SetCipherSpecs(session->sslClient) != 0) {
+        SetError(BAD_CIPHER_SPEC_STR, error, session, FATAL_ERROR_STATE);
+        return -1;
+    }
+
+    if (session->sslServer->options.tls) {
+        ret =  DeriveTlsKeys(session->sslServer);
+        ret += DeriveTlsKeys(session->sslClient);
+    }
+    else {
+        ret =  DeriveKeys(session->sslServer);
+        ret += DeriveKeys(session->sslClient);
+    }
+    ret += SetKeysSide(session->sslServer, ENCRYPT_AND_DECRYPT_SIDE);
+    ret += SetKeysSide(session->sslClient, ENCRYPT_AND_DECRYPT_SIDE);
+
+    if (ret != 0) {
+        SetError(BAD_DERIVE_STR, error, session, FATAL_ERROR_STATE);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* Get the master secret for both sides from the key log */
+/* returns 1 if found, 0 if not */
+static int KeyLogMasterSecret(SnifferSession* session)
+{
+    const byte* clientRandom = session->sslServer->arrays->clientRandom;
+    byte*       masterSecret = session->sslServer->arrays->masterSecret;
+
+    if (!KeyLogEnabled() ||
+        KeyLogGetSecret(clientRandom, KEYLOG_MASTER_SECRET,
+                        masterSecret) != SECRET_LEN) {
+        return 0;
+    }
+
+    XMEMCPY(session->sslClient->arrays->masterSecret, masterSecret,
+            SECRET_LEN);
+    KeyLogRemove(clientRandom);
+
+    return 1;
+}
+
+
+/* Process Client Key Exchange, key log, RSA or static ECDH */
 static int ProcessClientKeyExchange(const byte* input, int* sslBytes,
                                     SnifferSession* session, char* error)
 {
@@ -1834,6 +2402,22 @@ static int ProcessClientKeyExchange(const byte* input, int* sslBytes,
     int tryEcc = 0;
     int ret;
 
+    /* key log secrets work for any key exchange, no private key needed */
+    if (KeyLogMasterSecret(session)) {
+        ret = DeriveSessionKeys(session, error);
+        if (ret == 0)
+            CallConnectionCb(session);
+        return ret;
+    }
+
+    if (session->flags.ephemeral) {
+#ifdef WOLFSSL_SNIFFER_STATS
+        INC_STAT(SnifferStats.sslEphemeralMisses);
+#endif
+        SetError(KEYLOG_MISSING_STR, error, session, FATAL_ERROR_STATE);
+        return -1;
+    }
+
     if (session->sslServer->buffers.key == NULL ||
         session->sslServer->buffers.key->buffer == NULL ||
         session->sslServer->buffers.key->length == 0) {
@@ -2079,6 +2663,93 @@ static int ProcessSessionTicket(const byte* input, int* sslBytes,
 }
 
 
+#ifdef WOLFSSL_TLS13
+
+/* ServerHello random of a TLS v1.3 HelloRetryRequest */
+static const byte Tls13HrrRandom[RAN_LEN] = {
+    0xCF, 0x21, 0xAD, 0x74, 0xE5, 0x9A, 0x61, 0x11,
+    0xBE, 0x1D, 0x8C, 0x02, 0x1E, 0x65, 0xB8, 0x91,
+    0xC2, 0xA2, 0x11, 0x16, 0x7A, 0xBB, 0x8C, 0x5E,
+    0x07, 0x9E, 0x09, 0xE2, 0xC8, 0xA8, 0x33, 0x9C
+};
+
+
+/* Set the peer's TLS v1.3 secret from the key log and derive decrypt keys */
+static int SetTls13Keys(SnifferSession* session, SSL* ssl, int type,
+                        char* error)
+{
+    /* server side decodes client data, client side decodes server data */
+    byte* secret = (ssl->options.side == WOLFSSL_SERVER_END) ?
+                                          ssl->clientSecret : ssl->serverSecret;
+    int   secretSz;
+
+    secretSz = KeyLogGetSecret(session->sslServer->arrays->clientRandom, type,
+                               secret);
+    if (secretSz == 0 || secretSz != ssl->specs.hash_size) {
+#ifdef WOLFSSL_SNIFFER_STATS
+        INC_STAT(SnifferStats.sslEphemeralMisses);
+#endif
+        SetError(KEYLOG_MISSING_STR, error, session, FATAL_ERROR_STATE);
+        return -1;
+    }
+
+    if (DeriveTls13Keys(ssl, no_key, DECRYPT_SIDE_ONLY, 1) != 0 ||
+                                    SetKeysSide(ssl, DECRYPT_SIDE_ONLY) != 0) {
+        SetError(TLS13_DERIVE_STR, error, session, FATAL_ERROR_STATE);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/* Process TLS v1.3 ServerHello, handshake traffic is encrypted from here */
+static int ProcessTls13ServerHello(SnifferSession* session, char* error)
+{
+    ProtocolVersion pv;
+
+    /* HelloRetryRequest, keys are set by the next ServerHello */
+    if (XMEMCMP(session->sslServer->arrays->serverRandom, Tls13HrrRandom,
+                RAN_LEN) == 0)
+        return 0;
+
+    pv.major = SSLv3_MAJOR;
+    pv.minor = TLSv1_3_MINOR;
+
+    session->sslServer->version = pv;
+    session->sslClient->version = pv;
+    session->sslServer->options.tls1_3 = 1;
+    session->sslClient->options.tls1_3 = 1;
+
+    /* legacy session id echo only, TLS v1.3 resumes with PSK */
+    session->sslServer->options.haveSessionId = 0;
+
+    if (SetCipherSpecs(session->sslServer) != 0 ||
+        SetCipherSpecs(session->sslClient) != 0) {
+        SetError(BAD_CIPHER_SPEC_STR, error, session, FATAL_ERROR_STATE);
+        return -1;
+    }
+
+    if (SetTls13Keys(session, session->sslServer, KEYLOG_CLIENT_HS_SECRET,
+                     error) != 0 ||
+        SetTls13Keys(session, session->sslClient, KEYLOG_SERVER_HS_SECRET,
+                     error) != 0)
+        return -1;
+
+    session->flags.serverCipherOn = 1;
+    session->flags.clientCipherOn = 1;
+
+#ifdef WOLFSSL_SNIFFER_STATS
+    INC_STAT(SnifferStats.sslStandardConns);
+#endif
+    CallConnectionCb(session);
+
+    return 0;
+}
+
+#endif /* WOLFSSL_TLS13 */
+
+
 /* Process Server Hello */
 static int ProcessServerHello(int msgSz, const byte* input, int* sslBytes,
                               SnifferSession* session, char* error)
@@ -2088,9 +2759,9 @@ static int ProcessServerHello(int msgSz, const byte* input, int* sslBytes,
     int             toRead = VERSION_SZ + RAN_LEN + ENUM_LEN;
     int             doResume     = 0;
     int             initialBytes = *sslBytes;
-
-    (void)msgSz;
-    (void)initialBytes;
+#ifdef WOLFSSL_TLS13
+    int             tls13        = 0;
+#endif
 
     /* make sure we didn't miss ClientHello */
     if (session->flags.clientHello == 0) {
@@ -2168,12 +2839,11 @@ static int ProcessServerHello(int msgSz, const byte* input, int* sslBytes,
         return -1;
     }
 
-#ifdef HAVE_EXTENDED_MASTER
     /* extensions */
     if ((initialBytes - *sslBytes) < msgSz) {
         word16 len;
 
-        /* skip extensions until extended master secret */
+        /* skip extensions except extended master secret, supported versions */
         /* make sure can read len */
         if (SUITE_LEN > *sslBytes) {
             SetError(SERVER_HELLO_INPUT_STR, error, session, FATAL_ERROR_STATE);
@@ -2208,9 +2878,19 @@ static int ProcessServerHello(int msgSz, const byte* input, int* sslBytes,
                 return -1;
             }
 
+#ifdef HAVE_EXTENDED_MASTER
             if (extType[0] == 0x00 && extType[1] == EXT_MASTER_SECRET) {
                 session->flags.expectEms = 1;
             }
+#endif
+#ifdef WOLFSSL_TLS13
+            if (extType[0] == 0x00 &&
+                extType[1] == SUPPORTED_VERSIONS_EXT_ID &&
+                extLen == VERSION_SZ && input[0] == SSLv3_MAJOR &&
+                input[1] == TLSv1_3_MINOR) {
+                tls13 = 1;
+            }
+#endif
 
             input     += extLen;
             *sslBytes -= extLen;
@@ -2218,12 +2898,18 @@ static int ProcessServerHello(int msgSz, const byte* input, int* sslBytes,
         }
     }
 
+#ifdef HAVE_EXTENDED_MASTER
     if (!session->flags.expectEms) {
         XFREE(session->hash, NULL, DYNAMIC_TYPE_HASHES);
         session->hash = NULL;
     }
 #endif
 
+#ifdef WOLFSSL_TLS13
+    if (tls13)
+        return ProcessTls13ServerHello(session, error);
+#endif
+
     if (session->sslServer->options.haveSessionId) {
         if (XMEMCMP(session->sslServer->arrays->sessionID,
                     session->sslClient->arrays->sessionID, ID_LEN) == 0)
@@ -2242,10 +2928,9 @@ static int ProcessServerHello(int msgSz, const byte* input, int* sslBytes,
     }
 
     if (doResume ) {
-        int ret = 0;
         SSL_SESSION* resume = GetSession(session->sslServer,
                                   session->sslServer->arrays->masterSecret, 0);
-        if (resume == NULL) {
+        if (resume == NULL && KeyLogMasterSecret(session) == 0) {
 #ifdef WOLFSSL_SNIFFER_STATS
             INC_STAT(SnifferStats.sslResumeMisses);
 #endif
@@ -2262,31 +2947,8 @@ static int ProcessServerHello(int msgSz, const byte* input, int* sslBytes,
         INC_STAT(SnifferStats.sslResumedConns);
         INC_STAT(SnifferStats.sslResumptionValid);
 #endif
-        if (SetCipherSpecs(session->sslServer) != 0) {
-            SetError(BAD_CIPHER_SPEC_STR, error, session, FATAL_ERROR_STATE);
-            return -1;
-        }
-
-        if (SetCipherSpecs(session->sslClient) != 0) {
-            SetError(BAD_CIPHER_SPEC_STR, error, session, FATAL_ERROR_STATE);
-            return -1;
-        }
-
-        if (session->sslServer->options.tls) {
-            ret =  DeriveTlsKeys(session->sslServer);
-            ret += DeriveTlsKeys(session->sslClient);
-        }
-        else {
-            ret =  DeriveKeys(session->sslServer);
-            ret += DeriveKeys(session->sslClient);
-        }
-        ret += SetKeysSide(session->sslServer, ENCRYPT_AND_DECRYPT_SIDE);
-        ret += SetKeysSide(session->sslClient, ENCRYPT_AND_DECRYPT_SIDE);
-
-        if (ret != 0) {
-            SetError(BAD_DERIVE_STR, error, session, FATAL_ERROR_STATE);
+        if (DeriveSessionKeys(session, error) != 0)
             return -1;
-        }
     }
     else {
 #ifdef WOLFSSL_SNIFFER_STATS
@@ -2622,6 +3284,59 @@ static int ProcessFinished(const byte* input, int size, int* sslBytes,
 }
 
 
+#ifdef WOLFSSL_TLS13
+
+/* Process TLS v1.3 Finished, sender switches to application traffic keys */
+static int ProcessTls13Finished(SnifferSession* session, char* error)
+{
+    SSL* ssl;
+    int  type;
+
+    if (session->flags.side == WOLFSSL_SERVER_END) {
+        ssl  = session->sslServer;
+        type = KEYLOG_CLIENT_TRAFFIC_SECRET;
+    }
+    else {
+        ssl  = session->sslClient;
+        type = KEYLOG_SERVER_TRAFFIC_SECRET;
+    }
+
+    if (SetTls13Keys(session, ssl, type, error) != 0)
+        return -1;
+
+    ssl->options.handShakeState = HANDSHAKE_DONE;
+    ssl->options.handShakeDone  = 1;
+
+    /* both directions have traffic keys, secrets no longer needed */
+    if (session->sslServer->options.handShakeDone &&
+        session->sslClient->options.handShakeDone) {
+        KeyLogRemove(session->sslServer->arrays->clientRandom);
+        FreeHandshakeResources(session->sslServer);
+        FreeHandshakeResources(session->sslClient);
+    }
+
+    return 0;
+}
+
+
+/* Process TLS v1.3 KeyUpdate, sender's next records use the updated keys */
+static int ProcessTls13KeyUpdate(SnifferSession* session, char* error)
+{
+    SSL* ssl = (session->flags.side == WOLFSSL_SERVER_END) ?
+                                        session->sslServer : session->sslClient;
+
+    if (DeriveTls13Keys(ssl, update_traffic_key, DECRYPT_SIDE_ONLY, 1) != 0 ||
+                                    SetKeysSide(ssl, DECRYPT_SIDE_ONLY) != 0) {
+        SetError(TLS13_DERIVE_STR, error, session, FATAL_ERROR_STATE);
+        return -1;
+    }
+
+    return 0;
+}
+
+#endif /* WOLFSSL_TLS13 */
+
+
 /* Process HandShake input */
 static int DoHandShake(const byte* input, int* sslBytes,
                        SnifferSession* session, char* error)
@@ -2630,6 +3345,11 @@ static int DoHandShake(const byte* input, int* sslBytes,
     int  size;
     int  ret = 0;
     int  startBytes;
+    int  tls13 = 0;
+
+#ifdef WOLFSSL_TLS13
+    tls13 = IsAtLeastTLSv1_3(session->sslServer->version);
+#endif
 
     if (*sslBytes < HANDSHAKE_HEADER_SZ) {
         SetError(HANDSHAKE_INPUT_STR, error, session, FATAL_ERROR_STATE);
@@ -2648,9 +3368,10 @@ static int DoHandShake(const byte* input, int* sslBytes,
         return ret;
     }
 
-    /* A session's arrays are released when the handshake is completed. */
+    /* A session's arrays are released when the handshake is completed,
+     * TLS v1.3 has post-handshake messages instead of renegotiation. */
     if (session->sslServer->arrays == NULL &&
-        session->sslClient->arrays == NULL) {
+        session->sslClient->arrays == NULL && !tls13) {
 
         SetError(NO_SECURE_RENEGOTIATION, error, session, FATAL_ERROR_STATE);
         return -1;
@@ -2675,7 +3396,9 @@ static int DoHandShake(const byte* input, int* sslBytes,
             break;
         case session_ticket:
             Trace(GOT_SESSION_TICKET_STR);
-            ret = ProcessSessionTicket(input, sslBytes, session, error);
+            /* TLS v1.3 tickets are for PSK resumption, not supported */
+            if (!tls13)
+                ret = ProcessSessionTicket(input, sslBytes, session, error);
             break;
         case server_hello:
             Trace(GOT_SERVER_HELLO_STR);
@@ -2685,10 +3408,15 @@ static int DoHandShake(const byte* input, int* sslBytes,
             Trace(GOT_CERT_REQ_STR);
             break;
         case server_key_exchange:
+            Trace(GOT_SERVER_KEY_EX_STR);
+            if (KeyLogEnabled()) {
+                /* master secret from key log at client key exchange */
+                session->flags.ephemeral = 1;
+                break;
+            }
 #ifdef WOLFSSL_SNIFFER_STATS
             INC_STAT(SnifferStats.sslEphemeralMisses);
 #endif
-            Trace(GOT_SERVER_KEY_EX_STR);
             /* can't know temp key passively */
             SetError(BAD_CIPHER_SPEC_STR, error, session, FATAL_ERROR_STATE);
             ret = -1;
@@ -2701,7 +3429,8 @@ static int DoHandShake(const byte* input, int* sslBytes,
 #endif
             }
 #ifdef WOLFSSL_SNIFFER_WATCH
-            ret = ProcessCertificate(input, sslBytes, session, error);
+            if (!tls13)
+                ret = ProcessCertificate(input, sslBytes, session, error);
 #endif
             break;
         case server_hello_done:
@@ -2709,6 +3438,12 @@ static int DoHandShake(const byte* input, int* sslBytes,
             break;
         case finished:
             Trace(GOT_FINISHED_STR);
+#ifdef WOLFSSL_TLS13
+            if (tls13) {
+                ret = ProcessTls13Finished(session, error);
+                break;
+            }
+#endif
             ret = ProcessFinished(input, size, sslBytes, session, error);
             break;
         case client_hello:
@@ -2750,6 +3485,15 @@ static int DoHandShake(const byte* input, int* sslBytes,
         case certificate_status:
             Trace(GOT_CERT_STATUS_STR);
             break;
+#ifdef WOLFSSL_TLS13
+        case encrypted_extensions:
+            Trace(GOT_ENC_EXT_STR);
+            break;
+        case key_update:
+            Trace(GOT_KEY_UPDATE_STR);
+            ret = ProcessTls13KeyUpdate(session, error);
+            break;
+#endif
         default:
             SetError(GOT_UNKNOWN_HANDSHAKE_STR, error, session, 0);
             return -1;
@@ -2891,6 +3635,55 @@ static const byte* DecryptMessage(SSL* ssl, const byte* input, word32 sz,
 }
 
 
+#ifdef WOLFSSL_TLS13
+
+/* Decrypt TLS v1.3 record into output, return inner content type in type */
+static const byte* DecryptTls13Message(SSL* ssl, const byte* input, word32 sz,
+                                       byte* output, byte* type, int* error)
+{
+    byte aad[RECORD_HEADER_SZ];
+    int  ret;
+    int  i;
+
+    if (sz <= ssl->specs.aead_mac_size || sz > MAX_TLS13_ENC_SZ) {
+        Trace(BAD_DECRYPT_SIZE);
+        *error = -1;
+        return NULL;
+    }
+
+    /* additional data is the record header */
+    aad[0] = application_data;
+    aad[1] = SSLv3_MAJOR;
+    aad[2] = TLSv1_2_MINOR;
+    c16toa((word16)sz, aad + OPAQUE8_LEN + VERSION_SZ);
+
+    ret = DecryptTls13(ssl, output, input, (word16)sz, aad, RECORD_HEADER_SZ);
+    if (ret != 0) {
+        Trace(BAD_DECRYPT);
+        *error = ret;
+        return NULL;
+    }
+
+    /* inner plaintext is content, type then zero padding */
+    i = (int)sz - ssl->specs.aead_mac_size - 1;
+    while (i >= 0 && output[i] == 0)
+        i--;
+    if (i < 0) {
+        Trace(BAD_DECRYPT);
+        *error = -1;
+        return NULL;
+    }
+    *type = output[i];
+
+    ssl->keys.encryptSz = sz;
+    ssl->keys.padSz     = sz - (word32)i;
+
+    return output;
+}
+
+#endif /* WOLFSSL_TLS13 */
+
+
 /* remove session from table, use rowHint if no info (means we have a lock) */
 static void RemoveSession(SnifferSession* session, IpInfo* ipInfo,
                         TcpInfo* tcpInfo, word32 rowHint)
@@ -3903,6 +4696,7 @@ static int ProcessMessage(const byte* sslFrame, SnifferSession* session,
     int               decoded = 0;      /* bytes stored for user in data */
     int               notEnough;        /* notEnough bytes yet flag */
     int               decrypted = 0;    /* was current msg decrypted */
+    int               tls13 = 0;        /* TLS v1.3 record protection */
     SSL*              ssl = (session->flags.side == WOLFSSL_SERVER_END) ?
                                         session->sslServer : session->sslClient;
 doMessage:
@@ -3944,11 +4738,16 @@ doMessage:
     recordEnd = sslFrame + rhSize;   /* may have more than one record */
     inRecordEnd = recordEnd;
 
-    /* decrypt if needed */
-    if ((session->flags.side == WOLFSSL_SERVER_END &&
+#ifdef WOLFSSL_TLS13
+    tls13 = IsAtLeastTLSv1_3(ssl->version);
+#endif
+
+    /* decrypt if needed, TLS v1.3 change cipher spec is never encrypted */
+    if (((session->flags.side == WOLFSSL_SERVER_END &&
                                                session->flags.serverCipherOn)
-     || (session->flags.side == WOLFSSL_CLIENT_END &&
-                                               session->flags.clientCipherOn)) {
+      || (session->flags.side == WOLFSSL_CLIENT_END &&
+                                               session->flags.clientCipherOn))
+     && (!tls13 || rh.type == application_data)) {
         int ivAdvance = 0;  /* TLSv1.1 advance amount */
         if (ssl->decrypt.setup != 1) {
             SetError(DECRYPT_KEYS_NOT_SETUP, error, session, FATAL_ERROR_STATE);
@@ -3958,11 +4757,24 @@ doMessage:
             SetError(MEMORY_STR, error, session, FATAL_ERROR_STATE);
             return -1;
         }
-        sslFrame = DecryptMessage(ssl, sslFrame, rhSize,
-                                  ssl->buffers.outputBuffer.buffer, &errCode,
-                                  &ivAdvance);
-        recordEnd = sslFrame - ivAdvance + rhSize;  /* sslFrame moved so
-                                                       should recordEnd */
+#ifdef WOLFSSL_TLS13
+        if (tls13) {
+            sslFrame = DecryptTls13Message(ssl, sslFrame, rhSize,
+                                           ssl->buffers.outputBuffer.buffer,
+                                           &rh.type, &errCode);
+            /* handshake messages end at the inner content type */
+            if (sslFrame != NULL)
+                recordEnd = sslFrame + rhSize - ssl->keys.padSz;
+        }
+        else
+#endif
+        {
+            sslFrame = DecryptMessage(ssl, sslFrame, rhSize,
+                                      ssl->buffers.outputBuffer.buffer,
+                                      &errCode, &ivAdvance);
+            recordEnd = sslFrame - ivAdvance + rhSize;  /* sslFrame moved so
+                                                           should recordEnd */
+        }
         decrypted = 1;
 
 #ifdef WOLFSSL_SNIFFER_STATS
@@ -4002,11 +4814,18 @@ doPart:
                 /* DoHandShake now fully decrements sslBytes to remaining */
                 used = startIdx - sslBytes;
                 sslFrame += used;
-                if (decrypted)
+                if (decrypted && !tls13)
                     sslFrame += ssl->keys.padSz;
             }
             break;
         case change_cipher_spec:
+            if (tls13) {
+                /* middlebox compatibility only, keys change with handshake */
+                Trace(GOT_CHANGE_CIPHER_STR);
+                sslFrame += 1;
+                sslBytes -= 1;
+                break;
+            }
             if (session->flags.side == WOLFSSL_SERVER_END)
                 session->flags.serverCipherOn = 1;
             else
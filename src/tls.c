@@ -61,7 +61,8 @@
 
 #if (!defined(NO_WOLFSSL_SERVER) && defined(WOLFSSL_TLS13) && \
         !defined(WOLFSSL_NO_SERVER_GROUPS_EXT)) || \
-    (defined(WOLFSSL_TLS13) && defined(HAVE_SUPPORTED_CURVES))
+    (defined(WOLFSSL_TLS13) && defined(HAVE_SUPPORTED_CURVES)) || \
+    defined(WOLFSSL_KEY_SHARE_POOL)
 static int TLSX_KeyShare_IsSupported(int namedGroup);
 #endif
 
@@ -886,8 +887,40 @@ static int Hmac_OuterHash(Hmac* hmac, unsigned char* mac)
     return ret;
 }
 
+/* Constant time - mask a word of the last blocks of HMAC data.
+ * Bytes before the end of the message are kept, the byte at the end of the
+ * message is set to the EOC byte (0x80) and all bytes after are zeroed.
+ *
+ * w  Word of message data.
+ * d  Number of message bytes left at the start of the word. May be negative.
+ * returns the masked word.
+ */
+static WC_INLINE wolfssl_word Hmac_MaskWord(wolfssl_word w, int d)
+{
+    word32 neg = (word32)0 - ((word32)d >> 31);
+    word32 full = (word32)0 - ((word32)(WOLFSSL_WORD_SIZE - 1 - d) >> 31);
+    word32 n = ((word32)d & ~neg & ~full) | (WOLFSSL_WORD_SIZE & full);
+    wolfssl_word keep, eoc;
+
+    /* Shift in two halves as n may be the number of bytes in the word. */
+#ifndef BIG_ENDIAN_ORDER
+    keep = ((wolfssl_word)1 << (4 * n) << (4 * n)) - 1;
+    eoc = (wolfssl_word)0x80 << (4 * n) << (4 * n);
+#else
+    keep = ~((wolfssl_word)~(wolfssl_word)0 >> (4 * n) >> (4 * n));
+    eoc = ((wolfssl_word)0x80 << (WOLFSSL_WORD_BITS - 8)) >> (4 * n) >>
+                                                                      (4 * n);
+#endif
+    eoc &= (wolfssl_word)0 - (wolfssl_word)(~neg & 1);
+
+    return (w & keep) | eoc;
+}
+
 /* Calculate the HMAC of the header + message data.
  * Constant time implementation using wc_Sha*FinalRaw().
+ * Only the blocks that the padding length can affect are processed in
+ * constant time. These blocks are built a word at a time from masks based on
+ * the message length rather than selecting each byte.
  *
  * hmac    HMAC object.
  * digest  MAC result.
@@ -899,15 +932,18 @@ static int Hmac_OuterHash(Hmac* hmac, unsigned char* mac)
 static int Hmac_UpdateFinal_CT(Hmac* hmac, byte* digest, const byte* in,
                                word32 sz, byte* header)
 {
+    wolfssl_word hashBlock[WC_MAX_BLOCK_SIZE / WOLFSSL_WORD_SIZE];
+    wolfssl_word lenWords[8 / WOLFSSL_WORD_SIZE];
+    word32 rawHash[WC_MAX_DIGEST_SIZE / sizeof(word32)];
     byte lenBytes[8];
     int  i, j, k;
-    int  blockBits, blockMask;
-    int  lastBlockLen, macLen, extraLen, eocIndex;
-    int  blocks, safeBlocks, lenBlock, eocBlock;
-    int  maxLen;
+    int  blockBits, blockMask, blockWords, lenWordIdx;
+    int  lastBlockLen, macLen, extraLen;
+    int  blocks, safeBlocks, lenBlock;
+    int  maxLen, realLen;
     int  blockSz, padSz;
+    int  start, end;
     int  ret;
-    word32 realLen;
     byte extraBlock;
 
     switch (hmac->macType) {
@@ -951,6 +987,8 @@ static int Hmac_UpdateFinal_CT(Hmac* hmac, byte* digest, const byte* in,
             return BAD_FUNC_ARG;
     }
     blockMask = blockSz - 1;
+    blockWords = blockSz / WOLFSSL_WORD_SIZE;
+    lenWordIdx = blockWords - (int)(sizeof(lenWords) / WOLFSSL_WORD_SIZE);
 
     /* Size of data to HMAC if padding length byte is zero. */
     maxLen = WOLFSSL_TLS_HMAC_INNER_SZ + sz - 1 - macLen;
@@ -958,27 +996,27 @@ static int Hmac_UpdateFinal_CT(Hmac* hmac, byte* digest, const byte* in,
     extraBlock = ctSetLTE((maxLen + padSz) & blockMask, padSz);
     /* Total number of blocks for data including padding. */
     blocks = ((maxLen + blockSz - 1) >> blockBits) + extraBlock;
-    /* Up to last 6 blocks can be hashed safely. */
-    safeBlocks = blocks - 6;
+    /* Padding length byte is at most TLS_MAX_PAD_SZ - blocks before that can
+     * only contain message data and are hashed safely. */
+    safeBlocks = 0;
+    if (maxLen > TLS_MAX_PAD_SZ)
+        safeBlocks = (maxLen - TLS_MAX_PAD_SZ) >> blockBits;
 
-    /* Length of message data. */
+    /* Length of message data - zero when padding length byte is too big. */
     realLen = maxLen - in[sz - 1];
+    realLen &= ctMaskIntGTE(realLen, 0);
     /* Number of message bytes in last block. */
     lastBlockLen = realLen & blockMask;
     /* Number of padding bytes in last block. */
     extraLen = ((blockSz * 2 - padSz - lastBlockLen) & blockMask) + 1;
     /* Number of blocks to create for hash. */
     lenBlock = (realLen + extraLen) >> blockBits;
-    /* Block containing EOC byte. */
-    eocBlock = realLen >> blockBits;
-    /* Index of EOC byte in block. */
-    eocIndex = realLen & blockMask;
 
-    /* Add length of hmac's ipad to total length. */
-    realLen += blockSz;
-    /* Length as bits - 8 bytes bigendian. */
-    c32toa(realLen >> ((sizeof(word32) * 8) - 3), lenBytes);
-    c32toa(realLen << 3, lenBytes + sizeof(word32));
+    /* Length as bits, including hmac's ipad - 8 bytes bigendian. */
+    c32toa((word32)(realLen + blockSz) >> ((sizeof(word32) * 8) - 3),
+                                                                     lenBytes);
+    c32toa((word32)(realLen + blockSz) << 3, lenBytes + sizeof(word32));
+    XMEMCPY(lenWords, lenBytes, sizeof(lenWords));
 
     ret = Hmac_HashUpdate(hmac, (unsigned char*)hmac->ipad, blockSz);
     if (ret != 0)
@@ -995,45 +1033,50 @@ static int Hmac_UpdateFinal_CT(Hmac* hmac, byte* digest, const byte* in,
         if (ret != 0)
             return ret;
     }
-    else
-        safeBlocks = 0;
 
     XMEMSET(digest, 0, macLen);
-    k = safeBlocks * blockSz;
     for (i = safeBlocks; i < blocks; i++) {
-        unsigned char hashBlock[WC_MAX_BLOCK_SIZE];
-        unsigned char isEocBlock = ctMaskEq(i, eocBlock);
-        unsigned char isOutBlock = ctMaskEq(i, lenBlock);
-
-        for (j = 0; j < blockSz; j++, k++) {
-            unsigned char atEoc = ctMaskEq(j, eocIndex) & isEocBlock;
-            unsigned char pastEoc = ctMaskGT(j, eocIndex) & isEocBlock;
-            unsigned char b = 0;
-
-            if (k < WOLFSSL_TLS_HMAC_INNER_SZ)
-                b = header[k];
-            else if (k < maxLen)
-                b = in[k - WOLFSSL_TLS_HMAC_INNER_SZ];
-
-            b = ctMaskSel(atEoc, 0x80, b);
-            b &= (unsigned char)~(word32)pastEoc;
-            b &= ((unsigned char)~(word32)isOutBlock) | isEocBlock;
-
-            if (j >= blockSz - 8) {
-                b = ctMaskSel(isOutBlock, lenBytes[j - (blockSz - 8)], b);
-            }
-
-            hashBlock[j] = b;
-        }
-
-        ret = Hmac_HashUpdate(hmac, hashBlock, blockSz);
+        word32 isOutBlock = (word32)0 - (ctMaskEq(i, lenBlock) & 1);
+        wolfssl_word outMask = (wolfssl_word)0 - (isOutBlock & 1);
+
+        /* Copy in the header and message data that may be in this block.
+         * Range depends only on the record size. */
+        XMEMSET(hashBlock, 0, blockSz);
+        start = i * blockSz;
+        if (start < WOLFSSL_TLS_HMAC_INNER_SZ) {
+            XMEMCPY((byte*)hashBlock, header + start,
+                                            WOLFSSL_TLS_HMAC_INNER_SZ - start);
+        }
+        end = start + blockSz;
+        if (end > maxLen)
+            end = maxLen;
+        k = start;
+        if (k < WOLFSSL_TLS_HMAC_INNER_SZ)
+            k = WOLFSSL_TLS_HMAC_INNER_SZ;
+        if (end > k) {
+            XMEMCPY((byte*)hashBlock + k - start,
+                                in + k - WOLFSSL_TLS_HMAC_INNER_SZ, end - k);
+        }
+
+        /* Keep message data, put in EOC and zero the rest. */
+        for (j = 0; j < blockWords; j++) {
+            hashBlock[j] = Hmac_MaskWord(hashBlock[j],
+                                    realLen - start - j * WOLFSSL_WORD_SIZE);
+        }
+        /* Put in length when block is the last one to hash. */
+        for (j = lenWordIdx; j < blockWords; j++) {
+            hashBlock[j] = (hashBlock[j] & ~outMask) |
+                           (lenWords[j - lenWordIdx] & outMask);
+        }
+
+        ret = Hmac_HashUpdate(hmac, (byte*)hashBlock, blockSz);
         if (ret != 0)
             return ret;
-        ret = Hmac_HashFinalRaw(hmac, hashBlock);
+        ret = Hmac_HashFinalRaw(hmac, (byte*)rawHash);
         if (ret != 0)
             return ret;
-        for (j = 0; j < macLen; j++)
-            ((unsigned char*)hmac->innerHash)[j] |= hashBlock[j] & isOutBlock;
+        for (j = 0; j < macLen / (int)sizeof(word32); j++)
+            hmac->innerHash[j] |= rawHash[j] & isOutBlock;
     }
 
     ret = Hmac_OuterHash(hmac, digest);
@@ -6593,11 +6636,14 @@ static int TLSX_SetSignatureAlgorithmsCert(TLSX** extensions, const void* data,
 /* Create a key share entry using named Diffie-Hellman parameters group.
  * Generates a key pair.
  *
- * ssl   The SSL/TLS object.
- * kse   The key share entry object.
+ * rng    Random number generator.
+ * heap   The heap used for allocation.
+ * devId  The device id to use with the key.
+ * kse    The key share entry object.
  * returns 0 on success, otherwise failure.
  */
-static int TLSX_KeyShare_GenDhKey(WOLFSSL *ssl, KeyShareEntry* kse)
+static int TLSX_KeyShare_GenDhKey(WC_RNG* rng, void* heap, int devId,
+                                  KeyShareEntry* kse)
 {
     int             ret;
 #ifndef NO_DH
@@ -6650,28 +6696,28 @@ static int TLSX_KeyShare_GenDhKey(WOLFSSL *ssl, KeyShareEntry* kse)
     }
 
 #ifdef WOLFSSL_SMALL_STACK
-    dhKey = (DhKey*)XMALLOC(sizeof(DhKey), ssl->heap, DYNAMIC_TYPE_DH);
+    dhKey = (DhKey*)XMALLOC(sizeof(DhKey), heap, DYNAMIC_TYPE_DH);
     if (dhKey == NULL)
         return MEMORY_E;
 #endif
 
-    ret = wc_InitDhKey_ex(dhKey, ssl->heap, ssl->devId);
+    ret = wc_InitDhKey_ex(dhKey, heap, devId);
     if (ret != 0) {
     #ifdef WOLFSSL_SMALL_STACK
-        XFREE(dhKey, ssl->heap, DYNAMIC_TYPE_DH);
+        XFREE(dhKey, heap, DYNAMIC_TYPE_DH);
     #endif
         return ret;
     }
 
     /* Allocate space for the public key. */
     dataSz = params->p_len;
-    keyData = (byte*)XMALLOC(dataSz, ssl->heap, DYNAMIC_TYPE_PUBLIC_KEY);
+    keyData = (byte*)XMALLOC(dataSz, heap, DYNAMIC_TYPE_PUBLIC_KEY);
     if (keyData == NULL) {
         ret = MEMORY_E;
         goto end;
     }
     /* Allocate space for the private key. */
-    key = (byte*)XMALLOC(keySz, ssl->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+    key = (byte*)XMALLOC(keySz, heap, DYNAMIC_TYPE_PRIVATE_KEY);
     if (key == NULL) {
         ret = MEMORY_E;
         goto end;
@@ -6685,7 +6731,7 @@ static int TLSX_KeyShare_GenDhKey(WOLFSSL *ssl, KeyShareEntry* kse)
         goto end;
 
     /* Generate a new key pair. */
-    ret = wc_DhGenerateKeyPair(dhKey, ssl->rng, (byte*)key, &keySz, keyData,
+    ret = wc_DhGenerateKeyPair(dhKey, rng, (byte*)key, &keySz, keyData,
                                &dataSz);
 #ifdef WOLFSSL_ASYNC_CRYPT
     /* TODO: Make this function non-blocking */
@@ -6716,18 +6762,20 @@ end:
 
     wc_FreeDhKey(dhKey);
 #ifdef WOLFSSL_SMALL_STACK
-    XFREE(dhKey, ssl->heap, DYNAMIC_TYPE_DH);
+    XFREE(dhKey, heap, DYNAMIC_TYPE_DH);
 #endif
 
     if (ret != 0) {
         /* Data owned by key share entry otherwise. */
         if (keyData != NULL)
-            XFREE(keyData, ssl->heap, DYNAMIC_TYPE_PUBLIC_KEY);
+            XFREE(keyData, heap, DYNAMIC_TYPE_PUBLIC_KEY);
         if (key != NULL)
-            XFREE(key, ssl->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+            XFREE(key, heap, DYNAMIC_TYPE_PRIVATE_KEY);
     }
 #else
-    (void)ssl;
+    (void)rng;
+    (void)heap;
+    (void)devId;
     (void)kse;
 
     ret = NOT_COMPILED_IN;
@@ -6739,11 +6787,14 @@ end:
 /* Create a key share entry using X25519 parameters group.
  * Generates a key pair.
  *
- * ssl   The SSL/TLS object.
- * kse   The key share entry object.
+ * rng    Random number generator.
+ * heap   The heap used for allocation.
+ * devId  The device id to use with the key.
+ * kse    The key share entry object.
  * returns 0 on success, otherwise failure.
  */
-static int TLSX_KeyShare_GenX25519Key(WOLFSSL *ssl, KeyShareEntry* kse)
+static int TLSX_KeyShare_GenX25519Key(WC_RNG* rng, void* heap, int devId,
+                                      KeyShareEntry* kse)
 {
     int             ret;
 #ifdef HAVE_CURVE25519
@@ -6751,8 +6802,10 @@ static int TLSX_KeyShare_GenX25519Key(WOLFSSL *ssl, KeyShareEntry* kse)
     word32          dataSize = CURVE25519_KEYSIZE;
     curve25519_key* key;
 
+    (void)devId;
+
     /* Allocate an ECC key to hold private key. */
-    key = (curve25519_key*)XMALLOC(sizeof(curve25519_key), ssl->heap,
+    key = (curve25519_key*)XMALLOC(sizeof(curve25519_key), heap,
                                                       DYNAMIC_TYPE_PRIVATE_KEY);
     if (key == NULL) {
         WOLFSSL_MSG("EccTempKey Memory error");
@@ -6763,12 +6816,12 @@ static int TLSX_KeyShare_GenX25519Key(WOLFSSL *ssl, KeyShareEntry* kse)
     ret = wc_curve25519_init(key);
     if (ret != 0)
         goto end;
-    ret = wc_curve25519_make_key(ssl->rng, CURVE25519_KEYSIZE, key);
+    ret = wc_curve25519_make_key(rng, CURVE25519_KEYSIZE, key);
     if (ret != 0)
         goto end;
 
     /* Allocate space for the public key. */
-    keyData = (byte*)XMALLOC(CURVE25519_KEYSIZE, ssl->heap,
+    keyData = (byte*)XMALLOC(CURVE25519_KEYSIZE, heap,
                                                        DYNAMIC_TYPE_PUBLIC_KEY);
     if (keyData == NULL) {
         WOLFSSL_MSG("Key data Memory error");
@@ -6796,12 +6849,14 @@ end:
     if (ret != 0) {
         /* Data owned by key share entry otherwise. */
         if (keyData != NULL)
-            XFREE(keyData, ssl->heap, DYNAMIC_TYPE_PUBLIC_KEY);
+            XFREE(keyData, heap, DYNAMIC_TYPE_PUBLIC_KEY);
         wc_curve25519_free(key);
-        XFREE(key, ssl->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+        XFREE(key, heap, DYNAMIC_TYPE_PRIVATE_KEY);
     }
 #else
-    (void)ssl;
+    (void)rng;
+    (void)heap;
+    (void)devId;
     (void)kse;
 
     ret = NOT_COMPILED_IN;
@@ -6813,11 +6868,14 @@ end:
 /* Create a key share entry using X448 parameters group.
  * Generates a key pair.
  *
- * ssl   The SSL/TLS object.
- * kse   The key share entry object.
+ * rng    Random number generator.
+ * heap   The heap used for allocation.
+ * devId  The device id to use with the key.
+ * kse    The key share entry object.
  * returns 0 on success, otherwise failure.
  */
-static int TLSX_KeyShare_GenX448Key(WOLFSSL *ssl, KeyShareEntry* kse)
+static int TLSX_KeyShare_GenX448Key(WC_RNG* rng, void* heap, int devId,
+                                    KeyShareEntry* kse)
 {
     int             ret;
 #ifdef HAVE_CURVE448
@@ -6825,8 +6883,10 @@ static int TLSX_KeyShare_GenX448Key(WOLFSSL *ssl, KeyShareEntry* kse)
     word32          dataSize = CURVE448_KEY_SIZE;
     curve448_key*   key;
 
+    (void)devId;
+
     /* Allocate an ECC key to hold private key. */
-    key = (curve448_key*)XMALLOC(sizeof(curve448_key), ssl->heap,
+    key = (curve448_key*)XMALLOC(sizeof(curve448_key), heap,
                                                       DYNAMIC_TYPE_PRIVATE_KEY);
     if (key == NULL) {
         WOLFSSL_MSG("EccTempKey Memory error");
@@ -6837,12 +6897,12 @@ static int TLSX_KeyShare_GenX448Key(WOLFSSL *ssl, KeyShareEntry* kse)
     ret = wc_curve448_init(key);
     if (ret != 0)
         goto end;
-    ret = wc_curve448_make_key(ssl->rng, CURVE448_KEY_SIZE, key);
+    ret = wc_curve448_make_key(rng, CURVE448_KEY_SIZE, key);
     if (ret != 0)
         goto end;
 
     /* Allocate space for the public key. */
-    keyData = (byte*)XMALLOC(CURVE448_KEY_SIZE, ssl->heap,
+    keyData = (byte*)XMALLOC(CURVE448_KEY_SIZE, heap,
                                                        DYNAMIC_TYPE_PUBLIC_KEY);
     if (keyData == NULL) {
         WOLFSSL_MSG("Key data Memory error");
@@ -6870,12 +6930,14 @@ end:
     if (ret != 0) {
         /* Data owned by key share entry otherwise. */
         if (keyData != NULL)
-            XFREE(keyData, ssl->heap, DYNAMIC_TYPE_PUBLIC_KEY);
+            XFREE(keyData, heap, DYNAMIC_TYPE_PUBLIC_KEY);
         wc_curve448_free(key);
-        XFREE(key, ssl->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+        XFREE(key, heap, DYNAMIC_TYPE_PRIVATE_KEY);
     }
 #else
-    (void)ssl;
+    (void)rng;
+    (void)heap;
+    (void)devId;
     (void)kse;
 
     ret = NOT_COMPILED_IN;
@@ -6887,11 +6949,14 @@ end:
 /* Create a key share entry using named elliptic curve parameters group.
  * Generates a key pair.
  *
- * ssl   The SSL/TLS object.
- * kse   The key share entry object.
+ * rng    Random number generator.
+ * heap   The heap used for allocation.
+ * devId  The device id to use with the key.
+ * kse    The key share entry object.
  * returns 0 on success, otherwise failure.
  */
-static int TLSX_KeyShare_GenEccKey(WOLFSSL *ssl, KeyShareEntry* kse)
+static int TLSX_KeyShare_GenEccKey(WC_RNG* rng, void* heap, int devId,
+                                   KeyShareEntry* kse)
 {
     int      ret;
 #ifdef HAVE_ECC
@@ -6943,7 +7008,7 @@ static int TLSX_KeyShare_GenEccKey(WOLFSSL *ssl, KeyShareEntry* kse)
     }
 
     /* Allocate an ECC key to hold private key. */
-    keyPtr = (byte*)XMALLOC(sizeof(ecc_key), ssl->heap,
+    keyPtr = (byte*)XMALLOC(sizeof(ecc_key), heap,
                                                       DYNAMIC_TYPE_PRIVATE_KEY);
     if (keyPtr == NULL) {
         WOLFSSL_MSG("EccTempKey Memory error");
@@ -6952,10 +7017,10 @@ static int TLSX_KeyShare_GenEccKey(WOLFSSL *ssl, KeyShareEntry* kse)
     eccKey = (ecc_key*)keyPtr;
 
     /* Make an ECC key. */
-    ret = wc_ecc_init_ex(eccKey, ssl->heap, ssl->devId);
+    ret = wc_ecc_init_ex(eccKey, heap, devId);
     if (ret != 0)
         goto end;
-    ret = wc_ecc_make_key_ex(ssl->rng, keySize, eccKey, curveId);
+    ret = wc_ecc_make_key_ex(rng, keySize, eccKey, curveId);
 #ifdef WOLFSSL_ASYNC_CRYPT
     /* TODO: Make this function non-blocking */
     if (ret == WC_PENDING_E) {
@@ -6966,7 +7031,7 @@ static int TLSX_KeyShare_GenEccKey(WOLFSSL *ssl, KeyShareEntry* kse)
         goto end;
 
     /* Allocate space for the public key. */
-    keyData = (byte*)XMALLOC(dataSize, ssl->heap, DYNAMIC_TYPE_PUBLIC_KEY);
+    keyData = (byte*)XMALLOC(dataSize, heap, DYNAMIC_TYPE_PUBLIC_KEY);
     if (keyData == NULL) {
         WOLFSSL_MSG("Key data Memory error");
         ret = MEMORY_E;
@@ -6992,12 +7057,14 @@ end:
     if (ret != 0) {
         /* Data owned by key share entry otherwise. */
         if (keyPtr != NULL)
-            XFREE(keyPtr, ssl->heap, DYNAMIC_TYPE_PRIVATE_KEY);
+            XFREE(keyPtr, heap, DYNAMIC_TYPE_PRIVATE_KEY);
         if (keyData != NULL)
-            XFREE(keyData, ssl->heap, DYNAMIC_TYPE_PUBLIC_KEY);
+            XFREE(keyData, heap, DYNAMIC_TYPE_PUBLIC_KEY);
     }
 #else
-    (void)ssl;
+    (void)rng;
+    (void)heap;
+    (void)devId;
     (void)kse;
 
     ret = NOT_COMPILED_IN;
@@ -7006,54 +7073,606 @@ end:
     return ret;
 }
 
-/* Generate a secret/key using the key share entry.
+/* Generate a key pair for the group of the key share entry.
  *
- * ssl  The SSL/TLS object.
- * kse  The key share entry holding peer data.
+ * rng    Random number generator.
+ * heap   The heap used for allocation.
+ * devId  The device id to use with the key.
+ * kse    The key share entry object.
+ * returns 0 on success, otherwise failure.
  */
-static int TLSX_KeyShare_GenKey(WOLFSSL *ssl, KeyShareEntry *kse)
+static int TLSX_KeyShare_MakeKey(WC_RNG* rng, void* heap, int devId,
+                                 KeyShareEntry* kse)
 {
     /* Named FFHE groups have a bit set to identify them. */
     if ((kse->group & NAMED_DH_MASK) == NAMED_DH_MASK)
-        return TLSX_KeyShare_GenDhKey(ssl, kse);
+        return TLSX_KeyShare_GenDhKey(rng, heap, devId, kse);
     if (kse->group == WOLFSSL_ECC_X25519)
-        return TLSX_KeyShare_GenX25519Key(ssl, kse);
+        return TLSX_KeyShare_GenX25519Key(rng, heap, devId, kse);
     if (kse->group == WOLFSSL_ECC_X448)
-        return TLSX_KeyShare_GenX448Key(ssl, kse);
-    return TLSX_KeyShare_GenEccKey(ssl, kse);
+        return TLSX_KeyShare_GenX448Key(rng, heap, devId, kse);
+    return TLSX_KeyShare_GenEccKey(rng, heap, devId, kse);
 }
 
-/* Free the key share dynamic data.
+/* Free the private and public key of the key share entry.
  *
- * list  The linked list of key share entry objects.
+ * kse   The key share entry object.
  * heap  The heap used for allocation.
  */
-static void TLSX_KeyShare_FreeAll(KeyShareEntry* list, void* heap)
+static void TLSX_KeyShare_FreeKey(KeyShareEntry* kse, void* heap)
 {
-    KeyShareEntry* current;
-
-    while ((current = list) != NULL) {
-        list = current->next;
-        if ((current->group & NAMED_DH_MASK) == 0) {
-            if (current->group == WOLFSSL_ECC_X25519) {
+    if ((kse->group & NAMED_DH_MASK) == 0) {
+        if (kse->group == WOLFSSL_ECC_X25519) {
 #ifdef HAVE_CURVE25519
-                wc_curve25519_free((curve25519_key*)current->key);
+            wc_curve25519_free((curve25519_key*)kse->key);
 #endif
-            }
-            else if (current->group == WOLFSSL_ECC_X448) {
+        }
+        else if (kse->group == WOLFSSL_ECC_X448) {
 #ifdef HAVE_CURVE448
-                wc_curve448_free((curve448_key*)current->key);
+            wc_curve448_free((curve448_key*)kse->key);
 #endif
-            }
-            else {
+        }
+        else {
 #ifdef HAVE_ECC
-                wc_ecc_free((ecc_key*)(current->key));
+            wc_ecc_free((ecc_key*)(kse->key));
 #endif
-            }
         }
-        if (current->key != NULL)
-            XFREE(current->key, heap, DYNAMIC_TYPE_PRIVATE_KEY);
-        XFREE(current->pubKey, heap, DYNAMIC_TYPE_PUBLIC_KEY);
+    }
+    if (kse->key != NULL)
+        XFREE(kse->key, heap, DYNAMIC_TYPE_PRIVATE_KEY);
+    XFREE(kse->pubKey, heap, DYNAMIC_TYPE_PUBLIC_KEY);
+    kse->key = NULL;
+    kse->pubKey = NULL;
+
+    (void)heap;
+}
+
+#ifdef WOLFSSL_KEY_SHARE_POOL
+/* Find the pool's ring of key pairs for the named group.
+ * Call with the pool locked.
+ *
+ * pool   The key share pool.
+ * group  The named group.
+ * returns the group's ring or NULL when the group is not pooled.
+ */
+static KeySharePoolGroup* KeySharePool_Find(KeySharePool* pool, word16 group)
+{
+    int i;
+
+    for (i = 0; i < pool->numGroups; i++) {
+        if (pool->groups[i].group == group)
+            return &pool->groups[i];
+    }
+
+    return NULL;
+}
+
+/* Find the group that has the least of its depth available or being
+ * generated.
+ * Call with the pool locked.
+ *
+ * pool  The key share pool.
+ * returns the group's ring or NULL when all groups are full.
+ */
+static KeySharePoolGroup* KeySharePool_Neediest(KeySharePool* pool)
+{
+    int                i;
+    word32             have;
+    word32             needHave = 0;
+    KeySharePoolGroup* g;
+    KeySharePoolGroup* need = NULL;
+
+    for (i = 0; i < pool->numGroups; i++) {
+        g = &pool->groups[i];
+        have = (word32)g->count + g->pending;
+        if (have >= g->depth)
+            continue;
+        /* Compare have / depth without dividing. */
+        if (need == NULL || have * need->depth < needHave * g->depth) {
+            need = g;
+            needHave = have;
+        }
+    }
+
+    return need;
+}
+
+/* Generate one key pair for the group that needs it most.
+ * Call with the pool locked. The lock is released while generating.
+ *
+ * pool  The key share pool.
+ * rng   Random number generator of the calling thread.
+ * returns 0 when a key pair was generated, 1 when all groups are full,
+ * BAD_MUTEX_E when the pool could not be locked again and otherwise failure.
+ */
+static int KeySharePool_Generate(KeySharePool* pool, WC_RNG* rng)
+{
+    int                ret;
+    KeySharePoolGroup* g;
+    KeyShareEntry      kse;
+
+    g = KeySharePool_Neediest(pool);
+    if (g == NULL)
+        return 1;
+
+    XMEMSET(&kse, 0, sizeof(kse));
+    kse.group = g->group;
+    g->pending++;
+    wc_UnLockMutex(&pool->lock);
+
+    ret = TLSX_KeyShare_MakeKey(rng, pool->heap, pool->devId, &kse);
+
+    if (wc_LockMutex(&pool->lock) != 0) {
+        TLSX_KeyShare_FreeKey(&kse, pool->heap);
+        return BAD_MUTEX_E;
+    }
+    g->pending--;
+    if (ret == 0) {
+        /* Depth may have been reduced while generating. */
+        if (g->count < g->depth) {
+            g->entries[(g->head + g->count) % g->depth] = kse;
+            g->count++;
+            g->generated++;
+        }
+        else {
+            TLSX_KeyShare_FreeKey(&kse, pool->heap);
+        }
+    }
+
+    return ret;
+}
+
+#ifdef WOLFSSL_KEY_SHARE_POOL_FORK_CHECK
+/* Free the key pairs when the pool was copied into a child process by fork().
+ * The child must not use the same ephemeral keys as the parent or its other
+ * children. Refill threads are not copied into the child.
+ * Call with the pool locked.
+ *
+ * pool  The key share pool.
+ */
+static void KeySharePool_CheckFork(KeySharePool* pool)
+{
+    int                i;
+    int                j;
+    KeySharePoolGroup* g;
+    pid_t              pid = getpid();
+
+    if (pool->pid == pid)
+        return;
+
+    if (pool->pid != 0) {
+        WOLFSSL_MSG("Key share pool used after fork - flushing");
+        for (i = 0; i < pool->numGroups; i++) {
+            g = &pool->groups[i];
+            for (j = 0; j < g->count; j++)
+                TLSX_KeyShare_FreeKey(&g->entries[(g->head + j) % g->depth],
+                                      pool->heap);
+            g->head = 0;
+            g->count = 0;
+            g->pending = 0;
+        }
+        pool->numThreads = 0;
+        pool->running = 0;
+    }
+    pool->pid = pid;
+}
+#else
+    #define KeySharePool_CheckFork(pool)
+#endif /* WOLFSSL_KEY_SHARE_POOL_FORK_CHECK */
+
+#ifdef WOLFSSL_KEY_SHARE_POOL_THREADS
+/* Refill thread. Generates key pairs whenever a group is below its depth
+ * until the pool is stopped. A failed generation is tried again when the
+ * thread is next woken.
+ *
+ * arg  The key share pool.
+ */
+static void* KeySharePool_Refill(void* arg)
+{
+    int           ret;
+    KeySharePool* pool = (KeySharePool*)arg;
+    WC_RNG        rng;
+
+    ret = wc_InitRng_ex(&rng, pool->heap, pool->devId);
+    if (wc_LockMutex(&pool->lock) != 0) {
+        if (ret == 0)
+            wc_FreeRng(&rng);
+        return NULL;
+    }
+    if (ret != 0) {
+        WOLFSSL_MSG("Key share pool RNG init failed");
+        pool->running--;
+        wc_UnLockMutex(&pool->lock);
+        return NULL;
+    }
+
+    while (!pool->stop) {
+        ret = KeySharePool_Generate(pool, &rng);
+        if (ret == BAD_MUTEX_E) {
+            wc_FreeRng(&rng);
+            return NULL;
+        }
+        if (ret < 0) {
+            WOLFSSL_MSG("Key share pool key generation failed");
+            ret = 1;
+        }
+        if (ret == 1 && pthread_cond_wait(&pool->cond, &pool->lock) != 0)
+            break;
+    }
+
+    pool->running--;
+    wc_UnLockMutex(&pool->lock);
+    wc_FreeRng(&rng);
+
+    return NULL;
+}
+
+/* Stop and wait for the refill threads.
+ *
+ * pool  The key share pool.
+ */
+static void KeySharePool_StopThreads(KeySharePool* pool)
+{
+    int i;
+
+    if (pool->numThreads == 0)
+        return;
+
+    if (wc_LockMutex(&pool->lock) != 0) {
+        WOLFSSL_MSG("wc_LockMutex failed");
+        return;
+    }
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->cond);
+    wc_UnLockMutex(&pool->lock);
+
+    for (i = 0; i < pool->numThreads; i++)
+        pthread_join(pool->tid[i], NULL);
+    pool->numThreads = 0;
+    pool->stop = 0;
+}
+#endif /* WOLFSSL_KEY_SHARE_POOL_THREADS */
+
+/* Get the key share pool of the context, creating it when needed.
+ *
+ * ctx   The SSL/TLS CTX object.
+ * pool  The key share pool.
+ * returns 0 on success, otherwise failure.
+ */
+static int KeySharePool_Get(WOLFSSL_CTX* ctx, KeySharePool** pool)
+{
+    KeySharePool* p = ctx->keySharePool;
+
+    if (p == NULL) {
+        p = (KeySharePool*)XMALLOC(sizeof(KeySharePool), ctx->heap,
+                                   DYNAMIC_TYPE_TLSX);
+        if (p == NULL)
+            return MEMORY_E;
+        XMEMSET(p, 0, sizeof(KeySharePool));
+        p->heap = ctx->heap;
+        p->devId = ctx->devId;
+
+        if (wc_InitMutex(&p->lock) != 0) {
+            XFREE(p, ctx->heap, DYNAMIC_TYPE_TLSX);
+            return BAD_MUTEX_E;
+        }
+    #ifdef WOLFSSL_KEY_SHARE_POOL_THREADS
+        if (pthread_cond_init(&p->cond, NULL) != 0) {
+            wc_FreeMutex(&p->lock);
+            XFREE(p, ctx->heap, DYNAMIC_TYPE_TLSX);
+            return BAD_COND_E;
+        }
+    #endif
+        ctx->keySharePool = p;
+    }
+
+    *pool = p;
+    return 0;
+}
+
+/* Take a pre-generated key pair for the group of the key share entry.
+ * Wakes a refill thread to replace it.
+ *
+ * pool  The key share pool.
+ * kse   The key share entry object.
+ * returns 1 when a key pair was taken and 0 when one must be generated.
+ */
+static int KeySharePool_Take(KeySharePool* pool, KeyShareEntry* kse)
+{
+    int                ret = 0;
+    KeySharePoolGroup* g;
+    KeyShareEntry*     e;
+
+    if (wc_LockMutex(&pool->lock) != 0)
+        return 0;
+
+    KeySharePool_CheckFork(pool);
+    g = KeySharePool_Find(pool, kse->group);
+    if (g != NULL) {
+        if (g->count > 0) {
+            e = &g->entries[g->head];
+            kse->key = e->key;
+            kse->keyLen = e->keyLen;
+            kse->pubKey = e->pubKey;
+            kse->pubKeyLen = e->pubKeyLen;
+            g->head = (word16)((g->head + 1) % g->depth);
+            g->count--;
+            g->hits++;
+            ret = 1;
+        }
+        else {
+            g->misses++;
+        }
+    #ifdef WOLFSSL_KEY_SHARE_POOL_THREADS
+        pthread_cond_signal(&pool->cond);
+    #endif
+    }
+
+    wc_UnLockMutex(&pool->lock);
+
+    return ret;
+}
+
+/* Pool pre-generated key pairs of a named group on the context.
+ * Changes the depth when the group is already pooled.
+ *
+ * ctx    The SSL/TLS CTX object.
+ * group  The named group.
+ * depth  The number of key pairs to keep generated.
+ * returns 0 on success, otherwise failure.
+ */
+int TLSX_KeySharePool_Use(WOLFSSL_CTX* ctx, word16 group, int depth)
+{
+    int                ret;
+    int                i;
+    KeySharePool*      pool;
+    KeySharePoolGroup* g;
+    KeyShareEntry*     entries;
+    KeyShareEntry*     e;
+
+    if (depth <= 0 || depth > WOLFSSL_KEY_SHARE_POOL_MAX_DEPTH)
+        return BAD_FUNC_ARG;
+    if (!TLSX_KeyShare_IsSupported(group))
+        return BAD_FUNC_ARG;
+
+    ret = KeySharePool_Get(ctx, &pool);
+    if (ret != 0)
+        return ret;
+
+    entries = (KeyShareEntry*)XMALLOC(sizeof(KeyShareEntry) * depth,
+                                      pool->heap, DYNAMIC_TYPE_TLSX);
+    if (entries == NULL)
+        return MEMORY_E;
+
+    if (wc_LockMutex(&pool->lock) != 0) {
+        XFREE(entries, pool->heap, DYNAMIC_TYPE_TLSX);
+        return BAD_MUTEX_E;
+    }
+
+    g = KeySharePool_Find(pool, group);
+    if (g == NULL) {
+        if (pool->numGroups == WOLFSSL_KEY_SHARE_POOL_GROUPS) {
+            wc_UnLockMutex(&pool->lock);
+            XFREE(entries, pool->heap, DYNAMIC_TYPE_TLSX);
+            return BUFFER_E;
+        }
+        g = &pool->groups[pool->numGroups++];
+        XMEMSET(g, 0, sizeof(KeySharePoolGroup));
+        g->group = group;
+    }
+
+    /* Move the available key pairs into the new ring. */
+    for (i = 0; i < g->count; i++) {
+        e = &g->entries[(g->head + i) % g->depth];
+        if (i < depth)
+            entries[i] = *e;
+        else
+            TLSX_KeyShare_FreeKey(e, pool->heap);
+    }
+    if (g->count > depth)
+        g->count = (word16)depth;
+    XFREE(g->entries, pool->heap, DYNAMIC_TYPE_TLSX);
+    g->entries = entries;
+    g->depth = (word16)depth;
+    g->head = 0;
+
+#ifdef WOLFSSL_KEY_SHARE_POOL_THREADS
+    pthread_cond_broadcast(&pool->cond);
+#endif
+    wc_UnLockMutex(&pool->lock);
+
+    return 0;
+}
+
+/* Set the number of threads refilling the key share pool of the context.
+ * Running threads are stopped first.
+ *
+ * ctx      The SSL/TLS CTX object.
+ * threads  The number of refill threads. 0 stops refilling in the
+ *          background.
+ * returns 0 on success, otherwise failure.
+ */
+int TLSX_KeySharePool_SetThreads(WOLFSSL_CTX* ctx, int threads)
+{
+    int           ret;
+    KeySharePool* pool;
+
+    if (threads < 0 || threads > WOLFSSL_KEY_SHARE_POOL_MAX_THREADS)
+        return BAD_FUNC_ARG;
+
+    ret = KeySharePool_Get(ctx, &pool);
+    if (ret != 0)
+        return ret;
+
+#ifdef WOLFSSL_KEY_SHARE_POOL_THREADS
+    /* Threads of the parent are not in a forked child - don't join them. */
+    if (wc_LockMutex(&pool->lock) != 0)
+        return BAD_MUTEX_E;
+    KeySharePool_CheckFork(pool);
+    wc_UnLockMutex(&pool->lock);
+
+    KeySharePool_StopThreads(pool);
+
+    while (pool->numThreads < threads) {
+        if (wc_LockMutex(&pool->lock) != 0) {
+            ret = BAD_MUTEX_E;
+            break;
+        }
+        pool->running++;
+        if (pthread_create(&pool->tid[pool->numThreads], NULL,
+                           KeySharePool_Refill, pool) != 0) {
+            WOLFSSL_MSG("Thread creation error");
+            pool->running--;
+            wc_UnLockMutex(&pool->lock);
+            ret = THREAD_CREATE_E;
+            break;
+        }
+        pool->numThreads++;
+        wc_UnLockMutex(&pool->lock);
+    }
+#else
+    if (threads > 0)
+        ret = NOT_COMPILED_IN;
+#endif
+
+    return ret;
+}
+
+/* Fill the key share pool of the context to depth in the calling thread.
+ *
+ * ctx  The SSL/TLS CTX object.
+ * returns 0 on success, otherwise failure.
+ */
+int TLSX_KeySharePool_Fill(WOLFSSL_CTX* ctx)
+{
+    int           ret;
+    KeySharePool* pool;
+    WC_RNG        rng;
+
+    ret = KeySharePool_Get(ctx, &pool);
+    if (ret != 0)
+        return ret;
+
+    ret = wc_InitRng_ex(&rng, pool->heap, pool->devId);
+    if (ret != 0)
+        return ret;
+
+    if (wc_LockMutex(&pool->lock) != 0) {
+        wc_FreeRng(&rng);
+        return BAD_MUTEX_E;
+    }
+    KeySharePool_CheckFork(pool);
+    do {
+        ret = KeySharePool_Generate(pool, &rng);
+    }
+    while (ret == 0);
+    if (ret != BAD_MUTEX_E)
+        wc_UnLockMutex(&pool->lock);
+
+    wc_FreeRng(&rng);
+
+    return (ret == 1) ? 0 : ret;
+}
+
+/* Get the statistics of a named group in the key share pool of the context.
+ *
+ * ctx    The SSL/TLS CTX object.
+ * group  The named group.
+ * stats  The statistics.
+ * returns 0 on success, BAD_FUNC_ARG when the group is not pooled and
+ * otherwise failure.
+ */
+int TLSX_KeySharePool_Stats(WOLFSSL_CTX* ctx, word16 group,
+                            WOLFSSL_KEY_SHARE_POOL_STATS* stats)
+{
+    int                ret = 0;
+    KeySharePool*      pool = ctx->keySharePool;
+    KeySharePoolGroup* g;
+
+    if (pool == NULL)
+        return BAD_FUNC_ARG;
+
+    if (wc_LockMutex(&pool->lock) != 0)
+        return BAD_MUTEX_E;
+
+    g = KeySharePool_Find(pool, group);
+    if (g == NULL) {
+        ret = BAD_FUNC_ARG;
+    }
+    else {
+        stats->depth = g->depth;
+        stats->available = g->count;
+        stats->hits = g->hits;
+        stats->misses = g->misses;
+        stats->generated = g->generated;
+        stats->threads = pool->running;
+    }
+
+    wc_UnLockMutex(&pool->lock);
+
+    return ret;
+}
+
+/* Stop the refill threads and free the key share pool.
+ *
+ * pool  The key share pool.
+ */
+void TLSX_KeySharePool_Free(KeySharePool* pool)
+{
+    int                i;
+    int                j;
+    KeySharePoolGroup* g;
+
+    if (pool == NULL)
+        return;
+
+#ifdef WOLFSSL_KEY_SHARE_POOL_THREADS
+    KeySharePool_StopThreads(pool);
+    pthread_cond_destroy(&pool->cond);
+#endif
+
+    for (i = 0; i < pool->numGroups; i++) {
+        g = &pool->groups[i];
+        for (j = 0; j < g->count; j++)
+            TLSX_KeyShare_FreeKey(&g->entries[(g->head + j) % g->depth],
+                                  pool->heap);
+        XFREE(g->entries, pool->heap, DYNAMIC_TYPE_TLSX);
+    }
+
+    wc_FreeMutex(&pool->lock);
+    XFREE(pool, pool->heap, DYNAMIC_TYPE_TLSX);
+}
+#endif /* WOLFSSL_KEY_SHARE_POOL */
+
+/* Generate a secret/key using the key share entry.
+ * Uses a pre-generated key pair from the context's pool when available.
+ *
+ * ssl  The SSL/TLS object.
+ * kse  The key share entry holding peer data.
+ */
+static int TLSX_KeyShare_GenKey(WOLFSSL *ssl, KeyShareEntry *kse)
+{
+#ifdef WOLFSSL_KEY_SHARE_POOL
+    if (ssl->ctx->keySharePool != NULL &&
+                                KeySharePool_Take(ssl->ctx->keySharePool, kse))
+        return 0;
+#endif
+
+    return TLSX_KeyShare_MakeKey(ssl->rng, ssl->heap, ssl->devId, kse);
+}
+
+/* Free the key share dynamic data.
+ *
+ * list  The linked list of key share entry objects.
+ * heap  The heap used for allocation.
+ */
+static void TLSX_KeyShare_FreeAll(KeyShareEntry* list, void* heap)
+{
+    KeyShareEntry* current;
+
+    while ((current = list) != NULL) {
+        list = current->next;
+        TLSX_KeyShare_FreeKey(current, heap);
         XFREE(current->ke, heap, DYNAMIC_TYPE_PUBLIC_KEY);
         XFREE(current, heap, DYNAMIC_TYPE_TLSX);
     }
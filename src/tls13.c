@@ -434,6 +434,8 @@ static int DeriveKey(WOLFSSL* ssl, byte* output, int outputLen,
         outputLen = hashSz;
     if (includeMsgs)
         hashOutSz = hashSz;
+    else
+        XMEMSET(hash, 0, sizeof(hash));
 
     return HKDF_Expand_Label(output, outputLen, secret, hashSz,
                              protocol, protocolLen, label, labelLen,
@@ -1055,7 +1057,8 @@ static const byte writeIVLabel[WRITE_IV_LABEL_SZ+1]   = "iv";
 /* Derive the keys and IVs for TLS v1.3.
  *
  * ssl      The SSL/TLS object.
- * sercret  early_data_key when deriving the key and IV for encrypting early
+ * sercret  no_key when the client and server secrets are already set.
+ *          early_data_key when deriving the key and IV for encrypting early
  *          data application data and end_of_early_data messages.
  *          handshake_key when deriving keys and IVs for encrypting handshake
  *          messages.
@@ -1070,7 +1073,7 @@ static const byte writeIVLabel[WRITE_IV_LABEL_SZ+1]   = "iv";
  *          store ready for provisioning.
  * returns 0 on success, otherwise failure.
  */
-static int DeriveTls13Keys(WOLFSSL* ssl, int secret, int side, int store)
+int DeriveTls13Keys(WOLFSSL* ssl, int secret, int side, int store)
 {
     int   ret = BAD_FUNC_ARG; /* Assume failure */
     int   i = 0;
@@ -1098,6 +1101,10 @@ static int DeriveTls13Keys(WOLFSSL* ssl, int secret, int side, int store)
 
     /* Derive the appropriate secret to use in the HKDF. */
     switch (secret) {
+        case no_key:
+            ret = 0;
+            break;
+
 #ifdef WOLFSSL_EARLY_DATA
         case early_data_key:
             ret = DeriveEarlyTrafficSecret(ssl, ssl->clientSecret);
@@ -8471,6 +8478,104 @@ int wolfSSL_set_groups(WOLFSSL* ssl, int* groups, int count)
     return WOLFSSL_SUCCESS;
 }
 
+#ifdef WOLFSSL_KEY_SHARE_POOL
+/* Pre-generate key pairs of a named group for the key shares of the
+ * context's handshakes.
+ * A key pair is used by one handshake only. When the pool is empty the key
+ * pair is generated during the handshake.
+ * Changes the depth when the group is already pooled.
+ *
+ * ctx    SSL/TLS context object.
+ * group  The named group.
+ * depth  The number of key pairs to keep generated.
+ * returns BAD_FUNC_ARG when ctx is NULL, the group is not supported or depth
+ * is out of range, BUFFER_E when too many groups are pooled and
+ * WOLFSSL_SUCCESS on success.
+ */
+int wolfSSL_CTX_UseKeySharePool(WOLFSSL_CTX* ctx, word16 group, int depth)
+{
+    int ret;
+
+    if (ctx == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = TLSX_KeySharePool_Use(ctx, group, depth);
+    if (ret != 0)
+        return ret;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Set the number of threads that refill the context's key share pool in
+ * the background. Running threads are stopped first.
+ * Stop the threads, with 0, before calling fork(). A forked child frees the
+ * key pairs of the parent and starts its own threads.
+ *
+ * ctx      SSL/TLS context object.
+ * threads  The number of refill threads. 0 stops background refilling.
+ * returns BAD_FUNC_ARG when ctx is NULL or threads is out of range,
+ * NOT_COMPILED_IN when threads are not available and WOLFSSL_SUCCESS on
+ * success.
+ */
+int wolfSSL_CTX_SetKeySharePoolThreads(WOLFSSL_CTX* ctx, int threads)
+{
+    int ret;
+
+    if (ctx == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = TLSX_KeySharePool_SetThreads(ctx, threads);
+    if (ret != 0)
+        return ret;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Fill the context's key share pool in the calling thread.
+ * Use without refill threads to generate key pairs when idle.
+ * Key pairs generated before fork() are freed, not used, by the child.
+ *
+ * ctx  SSL/TLS context object.
+ * returns BAD_FUNC_ARG when ctx is NULL and WOLFSSL_SUCCESS on success.
+ */
+int wolfSSL_CTX_FillKeySharePool(WOLFSSL_CTX* ctx)
+{
+    int ret;
+
+    if (ctx == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = TLSX_KeySharePool_Fill(ctx);
+    if (ret != 0)
+        return ret;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Get the statistics of a named group in the context's key share pool.
+ *
+ * ctx    SSL/TLS context object.
+ * group  The named group.
+ * stats  The statistics.
+ * returns BAD_FUNC_ARG when ctx or stats is NULL or the group is not pooled
+ * and WOLFSSL_SUCCESS on success.
+ */
+int wolfSSL_CTX_GetKeySharePoolStats(WOLFSSL_CTX* ctx, word16 group,
+                                     WOLFSSL_KEY_SHARE_POOL_STATS* stats)
+{
+    int ret;
+
+    if (ctx == NULL || stats == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = TLSX_KeySharePool_Stats(ctx, group, stats);
+    if (ret != 0)
+        return ret;
+
+    return WOLFSSL_SUCCESS;
+}
+#endif /* WOLFSSL_KEY_SHARE_POOL */
+
 #ifndef NO_PSK
 void wolfSSL_CTX_set_psk_client_tls13_callback(WOLFSSL_CTX* ctx,
                                                wc_psk_client_tls13_callback cb)
@@ -25,6 +25,11 @@
     #include <config.h>
 #endif
 
+#if (defined(WOLFSSL_DTLS_DEMUX) || defined(WOLFSSL_DTLS_SENDMMSG)) && \
+    defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE /* recvmmsg(), sendmmsg() */
+#endif
+
 #include <wolfssl/wolfcrypt/settings.h>
 
 #ifndef WOLFCRYPT_ONLY
@@ -38,6 +43,15 @@
 #include <wolfssl/error-ssl.h>
 #include <wolfssl/wolfio.h>
 
+#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_DEMUX)
+    #ifdef NO_INLINE
+        #include <wolfssl/wolfcrypt/misc.h>
+    #else
+        #define WOLFSSL_MISC_INCLUDED
+        #include <wolfcrypt/src/misc.c>
+    #endif
+#endif
+
 #if defined(HAVE_HTTP_CLIENT)
     #include <stdlib.h>   /* strtol() */
 #endif
@@ -51,6 +65,14 @@ Possible IO enable options:
  * HAVE_HTTP_CLIENT:    Enables HTTP client API's                 default: off
                                      (unless HAVE_OCSP or HAVE_CRL_IO defined)
  * HAVE_IO_TIMEOUT:     Enables support for connect timeout       default: off
+ * WOLFSSL_DTLS_DEMUX:  Enables DTLS server demultiplexing of a   default: off
+                        single UDP socket, wolfSSL_dtls_demux_new
+ * WOLFSSL_NO_RECVMMSG: Disables batch reads with recvmmsg        default: off
+ * WOLFSSL_DTLS_SENDMMSG: Enables queueing DTLS datagrams and     default: off
+                        sending them together, with sendmmsg
+                        on Linux
+ * WOLFSSL_NO_SENDMMSG: Disables batch sends with sendmmsg        default: off
+ * WOLFSSL_NO_DTLS_GSO: Disables UDP_SEGMENT (GSO) batch sends    default: off
  */
 
 
@@ -432,6 +454,750 @@ int EmbedSendTo(WOLFSSL* ssl, char *buf, int sz, void *ctx)
 }
 
 
+#ifdef WOLFSSL_DTLS_SENDMMSG
+
+#if defined(__linux__) && !defined(WOLFSSL_NO_SENDMMSG)
+    #include <netinet/udp.h>
+    #define DTLS_SENDMMSG
+    #if defined(UDP_SEGMENT) && !defined(WOLFSSL_NO_DTLS_GSO)
+        #define DTLS_SENDMMSG_GSO
+        #define DTLS_GSO_MAX_SEGS 64    /* UDP_MAX_SEGMENTS */
+        #define DTLS_GSO_MAX_SZ   65000 /* below the IP datagram maximum */
+    #endif
+#endif
+
+#ifdef DTLS_SENDMMSG
+/* translate errno of a failed batch send to an IO callback error */
+static int EmbedSendToBatchError(void)
+{
+    int err = wolfSSL_LastError();
+
+    WOLFSSL_MSG("Embed Send To Batch error");
+
+    if (err == SOCKET_EWOULDBLOCK || err == SOCKET_EAGAIN) {
+        WOLFSSL_MSG("\tWould Block");
+        return WOLFSSL_CBIO_ERR_WANT_WRITE;
+    }
+    else if (err == SOCKET_ECONNRESET) {
+        WOLFSSL_MSG("\tConnection reset");
+        return WOLFSSL_CBIO_ERR_CONN_RST;
+    }
+    else if (err == SOCKET_EINTR) {
+        WOLFSSL_MSG("\tSocket interrupted");
+        return WOLFSSL_CBIO_ERR_ISR;
+    }
+    else if (err == SOCKET_EPIPE) {
+        WOLFSSL_MSG("\tSocket EPIPE");
+        return WOLFSSL_CBIO_ERR_CONN_CLOSE;
+    }
+
+    WOLFSSL_MSG("\tGeneral error");
+    return WOLFSSL_CBIO_ERR_GENERAL;
+}
+#endif /* DTLS_SENDMMSG */
+
+
+/* Send count datagrams of sz[] bytes each, laid out back to back in buf.
+ * On Linux datagrams of equal size go out in one UDP_SEGMENT (GSO) send,
+ * otherwise all of them in one sendmmsg(). Elsewhere one sendto() each.
+ *  return : bytes of the whole datagrams sent, or error */
+int EmbedSendToBatch(WOLFSSL* ssl, char* buf, const word32* sz, int count,
+                     void* ctx)
+{
+    WOLFSSL_DTLS_CTX* dtlsCtx = (WOLFSSL_DTLS_CTX*)ctx;
+    int total = 0;
+#ifdef DTLS_SENDMMSG
+    struct mmsghdr msgs[WOLFSSL_DTLS_TX_BATCH];
+    struct iovec   iov[WOLFSSL_DTLS_TX_BATCH];
+    int            sd = dtlsCtx->wfd;
+    int            sent;
+    int            i;
+#endif
+
+    WOLFSSL_ENTER("EmbedSendToBatch()");
+
+    if (count > WOLFSSL_DTLS_TX_BATCH)
+        count = WOLFSSL_DTLS_TX_BATCH;
+
+#ifdef DTLS_SENDMMSG
+#ifdef DTLS_SENDMMSG_GSO
+    /* segments of sz[0] bytes, only the last one may be shorter */
+    if (!dtlsCtx->noGso) {
+        int segs = 1;
+
+        total = (int)sz[0];
+        while (segs < count && segs < DTLS_GSO_MAX_SEGS &&
+               sz[segs] <= sz[0] && total + (int)sz[segs] <= DTLS_GSO_MAX_SZ) {
+            total += (int)sz[segs];
+            if (sz[segs++] != sz[0])
+                break;
+        }
+
+        if (segs > 1) {
+            struct msghdr   msg;
+            struct cmsghdr* cmsg;
+            char            control[CMSG_SPACE(sizeof(word16))];
+            word16          gsoSz = (word16)sz[0];
+
+            XMEMSET(&msg, 0, sizeof(msg));
+            XMEMSET(control, 0, sizeof(control));
+            iov[0].iov_base    = buf;
+            iov[0].iov_len     = (size_t)total;
+            msg.msg_name       = (void*)dtlsCtx->peer.sa;
+            msg.msg_namelen    = dtlsCtx->peer.sz;
+            msg.msg_iov        = iov;
+            msg.msg_iovlen     = 1;
+            msg.msg_control    = control;
+            msg.msg_controllen = sizeof(control);
+            cmsg = CMSG_FIRSTHDR(&msg);
+            cmsg->cmsg_level = SOL_UDP;
+            cmsg->cmsg_type  = UDP_SEGMENT;
+            cmsg->cmsg_len   = CMSG_LEN(sizeof(word16));
+            XMEMCPY(CMSG_DATA(cmsg), &gsoSz, sizeof(gsoSz));
+
+            sent = (int)sendmsg(sd, &msg, ssl->wflags);
+            if (sent >= 0)
+                return total;
+
+            /* no segmentation offload on this socket or route */
+            sent = wolfSSL_LastError();
+            if (sent != EINVAL && sent != EIO && sent != ENOPROTOOPT &&
+                                                      sent != EOPNOTSUPP) {
+                return EmbedSendToBatchError();
+            }
+            WOLFSSL_MSG("\tUDP_SEGMENT not supported, using sendmmsg");
+            dtlsCtx->noGso = 1;
+        }
+        total = 0;
+    }
+#endif /* DTLS_SENDMMSG_GSO */
+
+    XMEMSET(msgs, 0, sizeof(msgs[0]) * count);
+    for (i = 0; i < count; i++) {
+        iov[i].iov_base = buf + total;
+        iov[i].iov_len  = sz[i];
+        msgs[i].msg_hdr.msg_name    = (void*)dtlsCtx->peer.sa;
+        msgs[i].msg_hdr.msg_namelen = dtlsCtx->peer.sz;
+        msgs[i].msg_hdr.msg_iov     = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen  = 1;
+        total += (int)sz[i];
+    }
+
+    sent = sendmmsg(sd, msgs, (unsigned int)count, ssl->wflags);
+    if (sent < 0)
+        return EmbedSendToBatchError();
+
+    for (total = 0, i = 0; i < sent; i++)
+        total += (int)sz[i];
+#else
+    /* stop at the first datagram not sent */
+    for (; count > 0; count--, sz++) {
+        int sent = EmbedSendTo(ssl, buf + total, (int)*sz, ctx);
+        if (sent < 0)
+            return (total > 0) ? total : sent;
+        total += (int)*sz;
+    }
+    (void)dtlsCtx;
+#endif /* DTLS_SENDMMSG */
+
+    return total;
+}
+
+#endif /* WOLFSSL_DTLS_SENDMMSG */
+
+
+#if defined(WOLFSSL_DTLS_DEMUX) && !defined(NO_WOLFSSL_SERVER)
+
+#if defined(__linux__) && !defined(WOLFSSL_NO_RECVMMSG)
+    #define DTLS_DEMUX_RECVMMSG
+#endif
+
+/* hash peer address into demux table row */
+static word32 DtlsDemuxHash(const SOCKADDR_S* addr, XSOCKLENT addrSz,
+                            word32 rows)
+{
+    const byte* p = (const byte*)addr;
+    word32      hash = 2166136261U;      /* FNV-1a */
+    XSOCKLENT   i;
+
+    for (i = 0; i < addrSz; i++) {
+        hash ^= p[i];
+        hash *= 16777619U;
+    }
+
+    return hash % rows;
+}
+
+
+/* find peer by address in row */
+static DtlsDemuxPeer* DtlsDemuxFind(WOLFSSL_DEMUX* demux,
+                          const SOCKADDR_S* addr, XSOCKLENT addrSz, word32 row)
+{
+    DtlsDemuxPeer* peer = demux->table[row];
+
+    while (peer) {
+        if (peer->addrSz == addrSz && XMEMCMP(&peer->addr, addr, addrSz) == 0)
+            break;
+        peer = peer->next;
+    }
+
+    return peer;
+}
+
+
+/* The demultiplexed receive callback, reads datagrams queued by the demux
+ *  return : nb bytes read, or error
+ */
+static int DtlsDemuxReceive(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    DtlsDemuxPeer* peer = (DtlsDemuxPeer*)ctx;
+    DtlsDemuxMsg*  msg;
+    int            recvd;
+
+    /* read context must still be the peer the demux attached to ssl */
+    if (peer == NULL || peer->ssl != ssl)
+        return WOLFSSL_CBIO_ERR_GENERAL;
+
+    msg = peer->head;
+    if (msg == NULL)
+        return WOLFSSL_CBIO_ERR_WANT_READ;
+
+    peer->head = msg->next;
+    if (peer->head == NULL)
+        peer->tail = NULL;
+    peer->count--;
+
+    /* datagram semantics, excess is dropped */
+    recvd = min(sz, (int)msg->sz);
+    XMEMCPY(buf, msg->buf, recvd);
+    XFREE(msg, ssl->heap, DYNAMIC_TYPE_DTLS_BUFFER);
+
+    return recvd;
+}
+
+
+/* queue datagram for peer's WOLFSSL, returns 0 on success */
+static int DtlsDemuxQueue(WOLFSSL_DEMUX* demux, DtlsDemuxPeer* peer,
+                          const byte* data, word32 sz)
+{
+    DtlsDemuxMsg* msg;
+
+    if (peer->count >= WOLFSSL_DTLS_DEMUX_QUEUE) {
+        WOLFSSL_MSG("DTLS demux peer queue full, dropping datagram");
+        return WANT_READ;
+    }
+
+    /* single allocation, data follows header */
+    msg = (DtlsDemuxMsg*)XMALLOC(sizeof(DtlsDemuxMsg) + sz, demux->heap,
+                                 DYNAMIC_TYPE_DTLS_BUFFER);
+    if (msg == NULL)
+        return MEMORY_E;
+
+    msg->next = NULL;
+    msg->buf  = (byte*)(msg + 1);
+    msg->sz   = sz;
+    XMEMCPY(msg->buf, data, sz);
+
+    if (peer->tail)
+        peer->tail->next = msg;
+    else
+        peer->head = msg;
+    peer->tail = msg;
+    peer->count++;
+
+    return 0;
+}
+
+
+/* free peer, its queued datagrams and WOLFSSL, peer must be unlinked */
+static void DtlsDemuxFreePeer(WOLFSSL_DEMUX* demux, DtlsDemuxPeer* peer)
+{
+    DtlsDemuxMsg* msg = peer->head;
+
+    while (msg) {
+        DtlsDemuxMsg* next = msg->next;
+        XFREE(msg, demux->heap, DYNAMIC_TYPE_DTLS_BUFFER);
+        msg = next;
+    }
+
+    wolfSSL_free(peer->ssl);
+    XFREE(peer, demux->heap, DYNAMIC_TYPE_DTLS_DEMUX);
+    (void)demux;
+}
+
+
+/* Calculate the cookie the same way as DoClientHello(), HMAC of the peer
+ * address and the ClientHello version, random, session id, cipher suites and
+ * compression methods. Sets the cookie the client sent in peerCookie.
+ * returns cookie size, 0 on malformed ClientHello or negative on error */
+static int DtlsDemuxCookie(WOLFSSL_DEMUX* demux, const SOCKADDR_S* addr,
+                           XSOCKLENT addrSz, const byte* hello, word32 helloSz,
+                           byte* cookie, const byte** peerCookie,
+                           byte* peerCookieSz)
+{
+    Hmac   hmac;
+    word32 i = 0;
+    word16 suiteSz;
+    byte   b;
+    int    cookieType;
+    int    cookieSz;
+    int    ret;
+
+#if !defined(NO_SHA) && defined(NO_SHA256)
+    cookieType = WC_SHA;
+    cookieSz   = WC_SHA_DIGEST_SIZE;
+#endif
+#ifndef NO_SHA256
+    cookieType = WC_SHA256;
+    cookieSz   = WC_SHA256_DIGEST_SIZE;
+#endif
+
+    if (VERSION_SZ + RAN_LEN + ENUM_LEN > helloSz)
+        return 0;
+
+    ret = wc_HmacInit(&hmac, demux->heap, INVALID_DEVID);
+    if (ret != 0)
+        return ret;
+
+    ret = wc_HmacSetKey(&hmac, cookieType, demux->cookieSecret,
+                        sizeof(demux->cookieSecret));
+    if (ret == 0)
+        ret = wc_HmacUpdate(&hmac, (const byte*)addr, (word32)addrSz);
+    /* version and random */
+    if (ret == 0)
+        ret = wc_HmacUpdate(&hmac, hello, VERSION_SZ + RAN_LEN);
+    i += VERSION_SZ + RAN_LEN;
+
+    /* session id */
+    if (ret == 0) {
+        b = hello[i];
+        if (b > ID_LEN || i + ENUM_LEN + b + ENUM_LEN > helloSz)
+            ret = 1;
+        else if (b > 0)
+            ret = wc_HmacUpdate(&hmac, hello + i, ENUM_LEN + b);
+        i += ENUM_LEN + b;
+    }
+
+    /* cookie, not part of HMAC */
+    if (ret == 0) {
+        b = hello[i];
+        if (b > MAX_COOKIE_LEN || i + ENUM_LEN + b + OPAQUE16_LEN > helloSz)
+            ret = 1;
+        *peerCookie   = hello + i + ENUM_LEN;
+        *peerCookieSz = b;
+        i += ENUM_LEN + b;
+    }
+
+    /* cipher suites */
+    if (ret == 0) {
+        ato16(hello + i, &suiteSz);
+        if (i + OPAQUE16_LEN + suiteSz + ENUM_LEN > helloSz)
+            ret = 1;
+        else
+            ret = wc_HmacUpdate(&hmac, hello + i, OPAQUE16_LEN + suiteSz);
+        i += OPAQUE16_LEN + suiteSz;
+    }
+
+    /* compression methods */
+    if (ret == 0) {
+        b = hello[i];
+        if (i + ENUM_LEN + b > helloSz)
+            ret = 1;
+        else
+            ret = wc_HmacUpdate(&hmac, hello + i, ENUM_LEN + b);
+    }
+
+    if (ret == 0)
+        ret = wc_HmacFinal(&hmac, cookie);
+    wc_HmacFree(&hmac);
+
+    if (ret == 1)
+        return 0;   /* malformed */
+    if (ret != 0)
+        return ret;
+
+    return cookieSz;
+}
+
+
+/* Send HelloVerifyRequest without keeping any state, the record and message
+ * sequence numbers echo the ClientHello */
+static void DtlsDemuxSendVerify(WOLFSSL_DEMUX* demux,
+                    const SOCKADDR_S* addr, XSOCKLENT addrSz,
+                    const byte* record, const byte* cookie, byte cookieSz)
+{
+    byte            out[DTLS_RECORD_HEADER_SZ + DTLS_HANDSHAKE_HEADER_SZ +
+                        VERSION_SZ + ENUM_LEN + MAX_COOKIE_LEN];
+    word32          length = VERSION_SZ + ENUM_LEN + cookieSz;
+    word32          idx = 0;
+    ProtocolVersion pv = demux->ctx->method->version;
+
+    /* record header, epoch and sequence number of the ClientHello */
+    out[idx++] = handshake;
+    out[idx++] = pv.major;
+    out[idx++] = pv.minor;
+    XMEMCPY(out + idx, record + ENUM_LEN + VERSION_SZ, DTLS_RECORD_EXTRA);
+    idx += DTLS_RECORD_EXTRA;
+    c16toa((word16)(DTLS_HANDSHAKE_HEADER_SZ + length), out + idx);
+    idx += OPAQUE16_LEN;
+
+    /* handshake header, message sequence of the ClientHello */
+    out[idx++] = hello_verify_request;
+    c32to24(length, out + idx);
+    idx += OPAQUE24_LEN;
+    XMEMCPY(out + idx, record + DTLS_RECORD_HEADER_SZ + ENUM_LEN + OPAQUE24_LEN,
+            DTLS_HANDSHAKE_SEQ_SZ);
+    idx += DTLS_HANDSHAKE_SEQ_SZ;
+    c32to24(0, out + idx);
+    idx += DTLS_HANDSHAKE_FRAG_SZ;
+    c32to24(length, out + idx);
+    idx += DTLS_HANDSHAKE_FRAG_SZ;
+
+    out[idx++] = pv.major;
+    out[idx++] = pv.minor;
+    out[idx++] = cookieSz;
+    XMEMCPY(out + idx, cookie, cookieSz);
+    idx += cookieSz;
+
+    if ((int)SENDTO_FUNCTION(demux->sfd, (char*)out, idx, 0,
+                             (const SOCKADDR*)addr, addrSz) != (int)idx) {
+        WOLFSSL_MSG("DTLS demux HelloVerifyRequest send failed");
+    }
+}
+
+
+/* create peer with WOLFSSL that continues the stateless cookie exchange */
+static DtlsDemuxPeer* DtlsDemuxAddPeer(WOLFSSL_DEMUX* demux,
+                     const SOCKADDR_S* addr, XSOCKLENT addrSz, word32 row,
+                     const byte* record)
+{
+    DtlsDemuxPeer* peer;
+    WOLFSSL*       ssl;
+    int            ret;
+
+    peer = (DtlsDemuxPeer*)XMALLOC(sizeof(DtlsDemuxPeer), demux->heap,
+                                   DYNAMIC_TYPE_DTLS_DEMUX);
+    if (peer == NULL)
+        return NULL;
+    XMEMSET(peer, 0, sizeof(DtlsDemuxPeer));
+
+    ssl = wolfSSL_new(demux->ctx);
+    if (ssl == NULL) {
+        XFREE(peer, demux->heap, DYNAMIC_TYPE_DTLS_DEMUX);
+        return NULL;
+    }
+    peer->ssl    = ssl;
+    peer->row    = row;
+    peer->addrSz = addrSz;
+    XMEMCPY(&peer->addr, addr, addrSz);
+
+    ret = wolfSSL_dtls_set_peer(ssl, (void*)addr, (unsigned int)addrSz);
+    if (ret == WOLFSSL_SUCCESS)
+        ret = wolfSSL_set_write_fd(ssl, (int)demux->sfd);
+    if (ret == WOLFSSL_SUCCESS)
+        ret = wolfSSL_DTLS_SetCookieSecret(ssl, demux->cookieSecret,
+                                           sizeof(demux->cookieSecret));
+    else
+        ret = WOLFSSL_FATAL_ERROR;
+    if (ret != 0) {
+        DtlsDemuxFreePeer(demux, peer);
+        return NULL;
+    }
+
+    wolfSSL_SSLSetIORecv(ssl, DtlsDemuxReceive);
+    wolfSSL_SetIOReadCtx(ssl, peer);
+    wolfSSL_dtls_set_using_nonblock(ssl, 1);
+
+    /* HelloVerifyRequest went out with the first ClientHello's numbers,
+     * continue from the second ClientHello's */
+    ato16(record + ENUM_LEN + VERSION_SZ + OPAQUE16_LEN,
+          &ssl->keys.dtls_sequence_number_hi);
+    ato32(record + ENUM_LEN + VERSION_SZ + OPAQUE16_LEN + OPAQUE16_LEN,
+          &ssl->keys.dtls_sequence_number_lo);
+    ato16(record + DTLS_RECORD_HEADER_SZ + ENUM_LEN + OPAQUE24_LEN,
+          &ssl->keys.dtls_handshake_number);
+
+    peer->next = demux->table[row];
+    demux->table[row] = peer;
+    demux->peers++;
+
+    return peer;
+}
+
+
+/* Route datagram to its peer, unknown peers must start with a ClientHello
+ * that has a valid cookie.
+ * returns peer the datagram was queued for, otherwise NULL */
+static DtlsDemuxPeer* DtlsDemuxDispatch(WOLFSSL_DEMUX* demux,
+                         const byte* data, word32 sz,
+                         const SOCKADDR_S* addr, XSOCKLENT addrSz)
+{
+    word32         row = DtlsDemuxHash(addr, addrSz, demux->rows);
+    DtlsDemuxPeer* peer = DtlsDemuxFind(demux, addr, addrSz, row);
+    const byte*    hs = data + DTLS_RECORD_HEADER_SZ;
+    const byte*    peerCookie = NULL;
+    byte           peerCookieSz = 0;
+    byte           cookie[MAX_COOKIE_LEN];
+    word16         recordSz;
+    word32         helloSz, fragOffset, fragSz;
+    int            cookieSz;
+
+    if (peer == NULL) {
+        /* single fragment ClientHello in epoch 0 */
+        if (sz < DTLS_RECORD_HEADER_SZ + DTLS_HANDSHAKE_HEADER_SZ ||
+                data[0] != handshake || data[ENUM_LEN + VERSION_SZ] != 0 ||
+                data[ENUM_LEN + VERSION_SZ + 1] != 0 || hs[0] != client_hello)
+            return NULL;
+
+        ato16(data + DTLS_RECORD_HEADER_SZ - OPAQUE16_LEN, &recordSz);
+        c24to32(hs + ENUM_LEN, &helloSz);
+        c24to32(hs + ENUM_LEN + OPAQUE24_LEN + DTLS_HANDSHAKE_SEQ_SZ,
+                &fragOffset);
+        c24to32(hs + DTLS_HANDSHAKE_HEADER_SZ - DTLS_HANDSHAKE_FRAG_SZ,
+                &fragSz);
+        if (DTLS_RECORD_HEADER_SZ + (word32)recordSz > sz ||
+                DTLS_HANDSHAKE_HEADER_SZ + helloSz > recordSz ||
+                fragOffset != 0 || fragSz != helloSz)
+            return NULL;
+
+        cookieSz = DtlsDemuxCookie(demux, addr, addrSz,
+                                   hs + DTLS_HANDSHAKE_HEADER_SZ, helloSz,
+                                   cookie, &peerCookie, &peerCookieSz);
+        if (cookieSz <= 0)
+            return NULL;
+
+        if (peerCookieSz != cookieSz ||
+                ConstantCompare(peerCookie, cookie, cookieSz) != 0) {
+            DtlsDemuxSendVerify(demux, addr, addrSz, data, cookie,
+                                (byte)cookieSz);
+            return NULL;
+        }
+
+        if (demux->peers >= demux->maxPeers) {
+            WOLFSSL_MSG("DTLS demux peer limit reached");
+            return NULL;
+        }
+
+        peer = DtlsDemuxAddPeer(demux, addr, addrSz, row, data);
+        if (peer == NULL)
+            return NULL;
+    }
+
+    if (DtlsDemuxQueue(demux, peer, data, sz) != 0)
+        return NULL;
+
+    return peer;
+}
+
+
+/* Create demultiplexer for DTLS server ctx on bound UDP socket sfd, with at
+ * most maxPeers peers at once, ctx must not be freed before the demux
+ * returns demux on success, otherwise NULL */
+WOLFSSL_DEMUX* wolfSSL_dtls_demux_new(WOLFSSL_CTX* ctx, SOCKET_T sfd,
+                                      int maxPeers)
+{
+    WOLFSSL_DEMUX* demux;
+    WC_RNG         rng;
+    int            ret;
+
+    WOLFSSL_ENTER("wolfSSL_dtls_demux_new");
+
+    if (ctx == NULL || maxPeers <= 0 ||
+            ctx->method->version.major != DTLS_MAJOR ||
+            ctx->method->side != WOLFSSL_SERVER_END)
+        return NULL;
+
+    demux = (WOLFSSL_DEMUX*)XMALLOC(sizeof(WOLFSSL_DEMUX), ctx->heap,
+                                         DYNAMIC_TYPE_DTLS_DEMUX);
+    if (demux == NULL)
+        return NULL;
+    XMEMSET(demux, 0, sizeof(WOLFSSL_DEMUX));
+
+    demux->ctx      = ctx;
+    demux->heap     = ctx->heap;
+    demux->sfd      = sfd;
+    demux->maxPeers = (word32)maxPeers;
+    demux->rows     = (word32)maxPeers;
+
+    demux->table = (DtlsDemuxPeer**)XMALLOC(demux->rows *
+                    sizeof(DtlsDemuxPeer*), demux->heap, DYNAMIC_TYPE_DTLS_DEMUX);
+    demux->rxBuf = (byte*)XMALLOC(WOLFSSL_DTLS_DEMUX_BATCH * MAX_UDP_SIZE,
+                                  demux->heap, DYNAMIC_TYPE_DTLS_BUFFER);
+    if (demux->table == NULL || demux->rxBuf == NULL) {
+        wolfSSL_dtls_demux_free(demux);
+        return NULL;
+    }
+    XMEMSET(demux->table, 0, demux->rows * sizeof(DtlsDemuxPeer*));
+
+    /* cookie secret shared by all peers */
+    ret = wc_InitRng_ex(&rng, demux->heap, INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_RNG_GenerateBlock(&rng, demux->cookieSecret,
+                                   sizeof(demux->cookieSecret));
+        wc_FreeRng(&rng);
+    }
+    if (ret != 0) {
+        wolfSSL_dtls_demux_free(demux);
+        return NULL;
+    }
+
+    WOLFSSL_LEAVE("wolfSSL_dtls_demux_new", 0);
+
+    return demux;
+}
+
+
+/* Free demux and the WOLFSSL of all its peers, the socket is not closed */
+void wolfSSL_dtls_demux_free(WOLFSSL_DEMUX* demux)
+{
+    word32 row;
+
+    if (demux == NULL)
+        return;
+
+    if (demux->table) {
+        for (row = 0; row < demux->rows; row++) {
+            DtlsDemuxPeer* peer = demux->table[row];
+            while (peer) {
+                DtlsDemuxPeer* next = peer->next;
+                DtlsDemuxFreePeer(demux, peer);
+                peer = next;
+            }
+        }
+        XFREE(demux->table, demux->heap, DYNAMIC_TYPE_DTLS_DEMUX);
+    }
+    XFREE(demux->rxBuf, demux->heap, DYNAMIC_TYPE_DTLS_BUFFER);
+    ForceZero(demux->cookieSecret, sizeof(demux->cookieSecret));
+
+    XFREE(demux, demux->heap, DYNAMIC_TYPE_DTLS_DEMUX);
+}
+
+
+/* Read a batch of datagrams and queue them for their peers. Sets the WOLFSSL
+ * of the peers that have new datagrams in ready, at most readySz. Call
+ * wolfSSL_accept(), wolfSSL_read() etc. on them until WANT_READ.
+ * returns number of WOLFSSL set in ready, 0 when none or negative on error */
+int wolfSSL_dtls_demux_read(WOLFSSL_DEMUX* demux, WOLFSSL** ready,
+                            int readySz)
+{
+    SOCKADDR_S addr[WOLFSSL_DTLS_DEMUX_BATCH];
+    XSOCKLENT  addrSz[WOLFSSL_DTLS_DEMUX_BATCH];
+    int        recvdSz[WOLFSSL_DTLS_DEMUX_BATCH];
+    int        batch;
+    int        recvd = 0;
+    int        readyCnt = 0;
+    int        i;
+#ifdef DTLS_DEMUX_RECVMMSG
+    struct mmsghdr msgs[WOLFSSL_DTLS_DEMUX_BATCH];
+    struct iovec   iov[WOLFSSL_DTLS_DEMUX_BATCH];
+#endif
+
+    if (demux == NULL || ready == NULL || readySz <= 0)
+        return BAD_FUNC_ARG;
+
+    /* each datagram can make at most one peer ready */
+    batch = min(readySz, WOLFSSL_DTLS_DEMUX_BATCH);
+
+#ifdef DTLS_DEMUX_RECVMMSG
+    XMEMSET(msgs, 0, sizeof(msgs));
+    for (i = 0; i < batch; i++) {
+        iov[i].iov_base = demux->rxBuf + i * MAX_UDP_SIZE;
+        iov[i].iov_len  = MAX_UDP_SIZE;
+        msgs[i].msg_hdr.msg_name    = &addr[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(SOCKADDR_S);
+        msgs[i].msg_hdr.msg_iov     = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    /* blocks for the first datagram only on blocking socket */
+    recvd = recvmmsg(demux->sfd, msgs, (unsigned int)batch, MSG_WAITFORONE,
+                     NULL);
+    for (i = 0; i < recvd; i++) {
+        addrSz[i]  = msgs[i].msg_hdr.msg_namelen;
+        recvdSz[i] = (msgs[i].msg_hdr.msg_flags & MSG_TRUNC) ? 0 :
+                                                       (int)msgs[i].msg_len;
+    }
+#else
+    (void)batch;
+    addrSz[0] = sizeof(SOCKADDR_S);
+    recvdSz[0] = (int)RECVFROM_FUNCTION(demux->sfd, (char*)demux->rxBuf,
+                           MAX_UDP_SIZE, 0, (SOCKADDR*)&addr[0], &addrSz[0]);
+    recvdSz[0] = TranslateReturnCode(recvdSz[0], demux->sfd);
+    recvd = (recvdSz[0] < 0) ? -1 : 1;
+#endif
+
+    if (recvd < 0) {
+        int err = wolfSSL_LastError();
+
+        if (err == SOCKET_EWOULDBLOCK || err == SOCKET_EAGAIN ||
+                err == SOCKET_EINTR || err == SOCKET_ECONNREFUSED)
+            return 0;
+
+        WOLFSSL_MSG("DTLS demux receive error");
+        return SOCKET_ERROR_E;
+    }
+
+    for (i = 0; i < recvd; i++) {
+        DtlsDemuxPeer* peer;
+
+        if (recvdSz[i] <= 0)
+            continue;
+
+        peer = DtlsDemuxDispatch(demux, demux->rxBuf + i * MAX_UDP_SIZE,
+                                 (word32)recvdSz[i], &addr[i], addrSz[i]);
+        if (peer != NULL && !peer->ready) {
+            peer->ready = 1;
+            ready[readyCnt++] = peer->ssl;
+        }
+    }
+
+    for (i = 0; i < readyCnt; i++)
+        ((DtlsDemuxPeer*)ready[i]->IOCB_ReadCtx)->ready = 0;
+
+    return readyCnt;
+}
+
+
+/* Remove the peer of ssl from demux and free ssl
+ * returns 0 on success */
+int wolfSSL_dtls_demux_remove(WOLFSSL_DEMUX* demux, WOLFSSL* ssl)
+{
+    DtlsDemuxPeer*  peer;
+    DtlsDemuxPeer** prev;
+
+    if (demux == NULL || ssl == NULL)
+        return BAD_FUNC_ARG;
+
+    peer = (DtlsDemuxPeer*)ssl->IOCB_ReadCtx;
+    if (peer == NULL || peer->ssl != ssl || peer->row >= demux->rows)
+        return BAD_FUNC_ARG;
+
+    prev = &demux->table[peer->row];
+    while (*prev && *prev != peer)
+        prev = &(*prev)->next;
+    if (*prev == NULL)
+        return BAD_FUNC_ARG;
+
+    *prev = peer->next;
+    demux->peers--;
+    DtlsDemuxFreePeer(demux, peer);
+
+    return 0;
+}
+
+
+/* returns number of peers in demux */
+int wolfSSL_dtls_demux_peers(WOLFSSL_DEMUX* demux)
+{
+    if (demux == NULL)
+        return BAD_FUNC_ARG;
+
+    return (int)demux->peers;
+}
+
+#endif /* WOLFSSL_DTLS_DEMUX && !NO_WOLFSSL_SERVER */
+
+
 #ifdef WOLFSSL_MULTICAST
 
 /* The alternate receive embedded callback for Multicast
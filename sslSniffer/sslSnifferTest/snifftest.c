@@ -457,6 +457,7 @@ int main(int argc, char** argv)
         }
         else {
             const char* passwd = NULL;
+            const char* keyFile = argv[2];
             /* defaults for server and port */
             port = 443;
             server = "127.0.0.1";
@@ -470,14 +471,21 @@ int main(int argc, char** argv)
             if (argc >= 6)
                 passwd = argv[5];
 
-            ret = ssl_SetPrivateKey(server, port, argv[2],
+            /* "-" for no key, sessions decoded with key log secrets only */
+            if (strcmp(keyFile, "-") == 0)
+                keyFile = NULL;
+
+            ret = ssl_SetPrivateKey(server, port, keyFile,
                                     FILETYPE_PEM, passwd, err);
+
+            if (ret == 0 && argc >= 7)
+                ret = ssl_LoadKeyLogFile(argv[6], err);
         }
     }
     else {
         /* usage error */
         printf( "usage: ./snifftest or ./snifftest dump pemKey"
-                " [server] [port] [password]\n");
+                " [server] [port] [password] [keylog]\n");
         exit(EXIT_FAILURE);
     }
 
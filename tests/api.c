@@ -3661,6 +3661,15 @@ static void test_wolfSSL_dtls_export(void)
         AssertIntGT(wolfSSL_dtls_export_state_only(ssl, window, &windowSz), 0);
         wolfSSL_free(ssl);
     }
+
+    /* window state from version 4 is a sliding window, version 6 unknown */
+    AssertNotNull(ssl = wolfSSL_new(ctx));
+    AssertIntGT(wolfSSL_dtls_import(ssl, session, sessionSz), 0);
+    window[1] = (window[1] & 0xF0) | 4;
+    AssertIntGT(wolfSSL_dtls_import(ssl, window, windowSz), 0);
+    window[1] = (window[1] & 0xF0) | 6;
+    AssertIntLT(wolfSSL_dtls_import(ssl, window, windowSz), 0);
+    wolfSSL_free(ssl);
     XFREE(session, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
     XFREE(window, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
     wolfSSL_CTX_free(ctx);
@@ -14645,6 +14654,105 @@ static int test_wc_ed25519_sign_msg (void)
 
 } /* END test_wc_ed25519_sign_msg */
 
+/*
+ * Testing wc_ed25519_verify_msg_batch()
+ */
+static int test_wc_ed25519_verify_msg_batch (void)
+{
+    int             ret = 0;
+
+#if defined(HAVE_ED25519) && defined(HAVE_ED25519_SIGN) && \
+    defined(HAVE_ED25519_VERIFY)
+    WC_RNG          rng;
+    ed25519_key     key;
+    byte            msg[] = "Everybody gets Friday off.\n";
+    byte            sig[2][ED25519_SIG_SIZE];
+    const byte*     sigs[3];
+    word32          sigLen[3];
+    const byte*     msgs[3];
+    word32          msgLen[3];
+    ed25519_key*    keys[3];
+    int             res[3];
+    int             i;
+
+    ret = wc_InitRng(&rng);
+    if (ret == 0) {
+        ret = wc_ed25519_init(&key);
+        if (ret == 0) {
+            ret = wc_ed25519_make_key(&rng, ED25519_KEY_SIZE, &key);
+        }
+    }
+    for (i = 0; ret == 0 && i < 3; i++) {
+        sigs[i] = sig[i & 1];
+        sigLen[i] = ED25519_SIG_SIZE;
+        msgs[i] = msg;
+        msgLen[i] = sizeof(msg) - (i & 1);
+        keys[i] = &key;
+        if (i < 2) {
+            ret = wc_ed25519_sign_msg(msgs[i], msgLen[i], sig[i], &sigLen[i],
+                                                                          &key);
+        }
+    }
+
+    printf(testingFmt, "wc_ed25519_verify_msg_batch()");
+
+    if (ret == 0) {
+        ret = wc_ed25519_verify_msg_batch(sigs, sigLen, msgs, msgLen, res,
+                                                                      keys, 2);
+        if (ret == 0 && (res[0] != 1 || res[1] != 1)) {
+            ret = SSL_FATAL_ERROR;
+        }
+    }
+    /* Third signature is of a different message. */
+    if (ret == 0) {
+        sigs[2] = sig[0];
+        msgLen[2] = sizeof(msg) - 1;
+        ret = wc_ed25519_verify_msg_batch(sigs, sigLen, msgs, msgLen, res,
+                                                                      keys, 3);
+        if (ret == SIG_VERIFY_E && res[0] == 1 && res[1] == 1 && res[2] == 0) {
+            ret = 0;
+        }
+        else if (ret == 0) {
+            ret = SSL_FATAL_ERROR;
+        }
+    }
+    /* Test bad args. */
+    if (ret == 0) {
+        ret = wc_ed25519_verify_msg_batch(NULL, sigLen, msgs, msgLen, res,
+                                                                      keys, 2);
+        if (ret == BAD_FUNC_ARG) {
+            ret = wc_ed25519_verify_msg_batch(sigs, sigLen, msgs, msgLen, NULL,
+                                                                      keys, 2);
+        }
+        if (ret == BAD_FUNC_ARG) {
+            ret = wc_ed25519_verify_msg_batch(sigs, sigLen, msgs, msgLen, res,
+                                                                      NULL, 2);
+        }
+        if (ret == BAD_FUNC_ARG) {
+            keys[1] = NULL;
+            ret = wc_ed25519_verify_msg_batch(sigs, sigLen, msgs, msgLen, res,
+                                                                      keys, 2);
+        }
+        if (ret == BAD_FUNC_ARG) {
+            ret = 0;
+        }
+        else if (ret == 0) {
+            ret = SSL_FATAL_ERROR;
+        }
+    }
+
+    printf(resultFmt, ret == 0 ? passed : failed);
+
+    if (wc_FreeRng(&rng) && ret == 0) {
+        ret = SSL_FATAL_ERROR;
+    }
+    wc_ed25519_free(&key);
+
+#endif
+    return ret;
+
+} /* END test_wc_ed25519_verify_msg_batch */
+
 /*
  * Testing wc_ed25519_import_public()
  */
@@ -15194,6 +15302,67 @@ static int test_wc_curve25519_size (void)
 
 } /* END test_wc_curve25519_size*/
 
+/*
+ * Testing wc_curve25519_make_pub().
+ */
+static int test_wc_curve25519_make_pub (void)
+{
+    int ret = 0;
+
+#if defined(HAVE_CURVE25519) && !defined(WC_NO_RNG)
+    curve25519_key  key;
+    WC_RNG          rng;
+    byte            pub[CURVE25519_KEYSIZE];
+
+    printf(testingFmt, "wc_curve25519_make_pub()");
+
+    ret = wc_InitRng(&rng);
+    if (ret == 0) {
+        ret = wc_curve25519_init(&key);
+        if (ret == 0) {
+            ret = wc_curve25519_make_key(&rng, CURVE25519_KEYSIZE, &key);
+        }
+    }
+    if (ret == 0) {
+        ret = wc_curve25519_make_pub((int)sizeof(pub), pub,
+                            (int)sizeof(key.k.point), key.k.point);
+        if (ret == 0 && XMEMCMP(pub, key.p.point, sizeof(pub)) != 0) {
+            ret = SSL_FATAL_ERROR;
+        }
+    }
+    /* Test bad args. */
+    if (ret == 0) {
+        if (wc_curve25519_make_pub((int)sizeof(pub), NULL,
+                (int)sizeof(key.k.point), key.k.point) != ECC_BAD_ARG_E ||
+            wc_curve25519_make_pub((int)sizeof(pub), pub,
+                (int)sizeof(key.k.point), NULL) != ECC_BAD_ARG_E ||
+            wc_curve25519_make_pub((int)sizeof(pub) - 1, pub,
+                (int)sizeof(key.k.point), key.k.point) != ECC_BAD_ARG_E ||
+            wc_curve25519_make_pub((int)sizeof(pub), pub,
+                (int)sizeof(key.k.point) - 1, key.k.point) != ECC_BAD_ARG_E) {
+            ret = SSL_FATAL_ERROR;
+        }
+    }
+    if (ret == 0) {
+        /* Private key not clamped. */
+        key.k.point[CURVE25519_KEYSIZE - 1] |= 0x80;
+        if (wc_curve25519_make_pub((int)sizeof(pub), pub,
+                (int)sizeof(key.k.point), key.k.point) != ECC_BAD_ARG_E) {
+            ret = SSL_FATAL_ERROR;
+        }
+    }
+
+    printf(resultFmt, ret == 0 ? passed : failed);
+
+    wc_curve25519_free(&key);
+    if (wc_FreeRng(&rng) && ret == 0) {
+        ret = SSL_FATAL_ERROR;
+    }
+#endif
+    return ret;
+
+} /* END test_wc_curve25519_make_pub */
+
 /*
  * Testing wc_ed448_make_key().
  */
@@ -17697,6 +17866,156 @@ static int test_wc_ecc_verify_hash_ex (void)
 
 } /* END test_wc_ecc_verify_hash_ex */
 
+/*
+ * Testing wc_ecc_verify_hash_batch()
+ */
+static int test_wc_ecc_verify_hash_batch (void)
+{
+    int             ret = 0;
+
+#if defined(HAVE_ECC) && defined(HAVE_ECC_SIGN) && defined(HAVE_ECC_VERIFY) \
+    && !defined(NO_ASN) && !defined(WC_NO_RNG) && \
+    !defined(WOLFSSL_ATECC508A) && !defined(WOLFSSL_ATECC608A)
+    ecc_key         key;
+    WC_RNG          rng;
+    ecc_key*        keys[3] = { &key, &key, &key };
+    byte            sigs[3][ECC_MAX_SIG_SIZE];
+    const byte*     sig[3] = { sigs[0], sigs[1], sigs[2] };
+    word32          sigLen[3];
+    byte            hashes[3][WC_SHA256_DIGEST_SIZE];
+    const byte*     hash[3] = { hashes[0], hashes[1], hashes[2] };
+    word32          hashLen[3];
+    int             res[3];
+    int             i;
+
+    printf(testingFmt, "wc_ecc_verify_hash_batch()");
+
+    ret = wc_InitRng(&rng);
+    if (ret == 0) {
+        ret = wc_ecc_init(&key);
+        if (ret == 0) {
+            ret = wc_ecc_make_key(&rng, KEY32, &key);
+        }
+    }
+    for (i = 0; ret == 0 && i < 3; i++) {
+        XMEMSET(hashes[i], 'a' + i, sizeof(hashes[i]));
+        hashLen[i] = sizeof(hashes[i]);
+        sigLen[i] = sizeof(sigs[i]);
+        ret = wc_ecc_sign_hash(hashes[i], hashLen[i], sigs[i], &sigLen[i],
+                                                                 &rng, &key);
+    }
+    if (ret == 0) {
+        /* second hash is not the one signed */
+        hashes[1][0] ^= 0x80;
+        ret = wc_ecc_verify_hash_batch(sig, sigLen, hash, hashLen, res, keys,
+                                                                           3);
+        if (ret == 0 && (res[0] != 1 || res[1] != 0 || res[2] != 1)) {
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+    }
+    /* Test bad args. */
+    if (ret == 0) {
+        if (wc_ecc_verify_hash_batch(NULL, sigLen, hash, hashLen, res, keys,
+                                                       3) != ECC_BAD_ARG_E ||
+            wc_ecc_verify_hash_batch(sig, NULL, hash, hashLen, res, keys,
+                                                       3) != ECC_BAD_ARG_E ||
+            wc_ecc_verify_hash_batch(sig, sigLen, NULL, hashLen, res, keys,
+                                                       3) != ECC_BAD_ARG_E ||
+            wc_ecc_verify_hash_batch(sig, sigLen, hash, NULL, res, keys,
+                                                       3) != ECC_BAD_ARG_E ||
+            wc_ecc_verify_hash_batch(sig, sigLen, hash, hashLen, NULL, keys,
+                                                       3) != ECC_BAD_ARG_E ||
+            wc_ecc_verify_hash_batch(sig, sigLen, hash, hashLen, res, NULL,
+                                                       3) != ECC_BAD_ARG_E) {
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+    }
+    if (ret == 0) {
+        sig[2] = NULL;
+        if (wc_ecc_verify_hash_batch(sig, sigLen, hash, hashLen, res, keys,
+                                                       3) != ECC_BAD_ARG_E) {
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+    }
+
+    printf(resultFmt, ret == 0 ? passed : failed);
+
+    wc_ecc_free(&key);
+    if (wc_FreeRng(&rng) && ret == 0) {
+        ret = WOLFSSL_FATAL_ERROR;
+    }
+#endif
+    return ret;
+
+} /* END test_wc_ecc_verify_hash_batch */
+
+/*
+ * Testing wc_ecc_set_precompute()
+ */
+static int test_wc_ecc_set_precompute (void)
+{
+    int             ret = 0;
+
+#if defined(WC_ECC_PRECOMP) && defined(HAVE_ECC_SIGN) && !defined(NO_ASN) && \
+    !defined(WC_NO_RNG)
+    ecc_key         key;
+    WC_RNG          rng;
+    byte            sig[ECC_MAX_SIG_SIZE];
+    word32          sigLen = sizeof(sig);
+    byte            hash[WC_SHA256_DIGEST_SIZE];
+    int             verify = 0;
+
+    printf(testingFmt, "wc_ecc_set_precompute()");
+
+    XMEMSET(hash, 'a', sizeof(hash));
+    ret = wc_InitRng(&rng);
+    if (ret == 0) {
+        ret = wc_ecc_init(&key);
+        if (ret == 0) {
+            ret = wc_ecc_make_key(&rng, KEY32, &key);
+        }
+    }
+    if (ret == 0) {
+        ret = wc_ecc_sign_hash(hash, sizeof(hash), sig, &sigLen, &rng, &key);
+    }
+    if (ret == 0) {
+        ret = wc_ecc_set_precompute(&key, ECC_PRECOMP_MIN_BITS);
+    }
+    if (ret == 0) {
+        /* Replaces the table. */
+        ret = wc_ecc_set_precompute(&key, ECC_PRECOMP_MAX_BITS);
+    }
+    if (ret == 0) {
+        ret = wc_ecc_verify_hash(sig, sigLen, hash, sizeof(hash), &verify,
+                                                                         &key);
+        if (ret == 0 && verify != 1) {
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+    }
+    /* Test bad args. */
+    if (ret == 0) {
+        if (wc_ecc_set_precompute(NULL, ECC_PRECOMP_MAX_BITS) !=
+                                                              BAD_FUNC_ARG ||
+            wc_ecc_set_precompute(&key, ECC_PRECOMP_MIN_BITS - 1) !=
+                                                              BAD_FUNC_ARG ||
+            wc_ecc_set_precompute(&key, ECC_PRECOMP_MAX_BITS + 1) !=
+                                                              BAD_FUNC_ARG) {
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+    }
+
+    printf(resultFmt, ret == 0 ? passed : failed);
+
+    /* Table freed with key. */
+    wc_ecc_free(&key);
+    if (wc_FreeRng(&rng) && ret == 0) {
+        ret = WOLFSSL_FATAL_ERROR;
+    }
+#endif
+    return ret;
+
+} /* END test_wc_ecc_set_precompute */
+
 /*
  * Testing wc_ecc_mulmod()
  */
@@ -25855,7 +26174,7 @@ static void test_wolfSSL_RSA(void)
 
     AssertNull(RSA_generate_key(-1, 3, NULL, NULL));
     AssertNull(RSA_generate_key(511, 3, NULL, NULL)); /* RSA_MIN_SIZE - 1 */
-    AssertNull(RSA_generate_key(4097, 3, NULL, NULL)); /* RSA_MAX_SIZE + 1 */
+    AssertNull(RSA_generate_key(RSA_MAX_SIZE + 1, 3, NULL, NULL));
     AssertNull(RSA_generate_key(2048, 0, NULL, NULL));
 
 
@@ -30334,6 +30653,208 @@ static int test_tls13_apis(void)
     return ret;
 }
 
+#if defined(WOLFSSL_KEY_SHARE_POOL) && defined(HAVE_CURVE25519) && \
+    !defined(NO_WOLFSSL_CLIENT)
+#if defined(WOLFSSL_PTHREADS) && !defined(WOLFSSL_NO_KEY_SHARE_POOL_FORK_CHECK)
+    #include <sys/wait.h>
+#endif
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && \
+    !defined(NO_WOLFSSL_SERVER) && defined(HAVE_IO_TESTS_DEPENDENCIES) && \
+    !defined(SINGLE_THREADED)
+static void test_key_share_pool_ctx_setup(WOLFSSL_CTX* ctx)
+{
+    AssertIntEQ(wolfSSL_CTX_UseKeySharePool(ctx, WOLFSSL_ECC_X25519, 2),
+                WOLFSSL_SUCCESS);
+#ifdef HAVE_ECC
+    AssertIntEQ(wolfSSL_CTX_UseKeySharePool(ctx, WOLFSSL_ECC_SECP256R1, 2),
+                WOLFSSL_SUCCESS);
+#endif
+    AssertIntEQ(wolfSSL_CTX_FillKeySharePool(ctx), WOLFSSL_SUCCESS);
+}
+
+static void test_key_share_pool_ssl_setup(WOLFSSL* ssl)
+{
+    WOLFSSL_KEY_SHARE_POOL_STATS stats;
+
+    /* Client key share is taken from the pool. */
+    AssertIntEQ(wolfSSL_UseKeyShare(ssl, WOLFSSL_ECC_X25519), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(wolfSSL_get_SSL_CTX(ssl),
+                WOLFSSL_ECC_X25519, &stats), WOLFSSL_SUCCESS);
+    AssertIntEQ(stats.hits, 1);
+    AssertIntEQ(stats.available, 1);
+}
+#endif
+
+static void test_wolfSSL_CTX_UseKeySharePool(void)
+{
+    WOLFSSL_CTX* ctx;
+    WOLFSSL*     ssl;
+    WOLFSSL_KEY_SHARE_POOL_STATS stats;
+    int          i;
+#if defined(WOLFSSL_PTHREADS) && !defined(WOLFSSL_NO_KEY_SHARE_POOL_FORK_CHECK)
+    pid_t        pid;
+    int          status;
+#endif
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && \
+    !defined(NO_WOLFSSL_SERVER) && defined(HAVE_IO_TESTS_DEPENDENCIES) && \
+    !defined(SINGLE_THREADED)
+    tcp_ready          ready;
+    func_args          server_args;
+    func_args          client_args;
+    THREAD_TYPE        serverThread;
+    callback_functions func_cb_client;
+    callback_functions func_cb_server;
+#endif
+
+    printf(testingFmt, "wolfSSL_CTX_UseKeySharePool()");
+
+    AssertNotNull(ctx = wolfSSL_CTX_new(wolfTLSv1_3_client_method()));
+
+    AssertIntEQ(wolfSSL_CTX_UseKeySharePool(NULL, WOLFSSL_ECC_X25519, 4),
+                BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_UseKeySharePool(ctx, WOLFSSL_ECC_X25519, 0),
+                BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_UseKeySharePool(ctx, 0, 4), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                &stats), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_UseKeySharePool(ctx, WOLFSSL_ECC_X25519, 4),
+                WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(NULL, WOLFSSL_ECC_X25519,
+                &stats), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                NULL), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_FillKeySharePool(NULL), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_SetKeySharePoolThreads(NULL, 1), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_SetKeySharePoolThreads(ctx, -1), BAD_FUNC_ARG);
+
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                &stats), WOLFSSL_SUCCESS);
+    AssertIntEQ(stats.depth, 4);
+    AssertIntEQ(stats.available, 0);
+
+    AssertIntEQ(wolfSSL_CTX_FillKeySharePool(ctx), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                &stats), WOLFSSL_SUCCESS);
+    AssertIntEQ(stats.available, 4);
+    AssertIntEQ(stats.generated, 4);
+
+    /* Each key share takes a key pair - generated when the pool is empty. */
+    for (i = 0; i < 5; i++) {
+        AssertNotNull(ssl = wolfSSL_new(ctx));
+        AssertIntEQ(wolfSSL_UseKeyShare(ssl, WOLFSSL_ECC_X25519),
+                    WOLFSSL_SUCCESS);
+        wolfSSL_free(ssl);
+    }
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                &stats), WOLFSSL_SUCCESS);
+    AssertIntEQ(stats.available, 0);
+    AssertIntEQ(stats.hits, 4);
+    AssertIntEQ(stats.misses, 1);
+
+    /* Reducing the depth frees the key pairs that don't fit. */
+    AssertIntEQ(wolfSSL_CTX_FillKeySharePool(ctx), WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_UseKeySharePool(ctx, WOLFSSL_ECC_X25519, 2),
+                WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                &stats), WOLFSSL_SUCCESS);
+    AssertIntEQ(stats.depth, 2);
+    AssertIntEQ(stats.available, 2);
+
+#if defined(WOLFSSL_PTHREADS) && !defined(WOLFSSL_NO_KEY_SHARE_POOL_FORK_CHECK)
+    /* A forked child doesn't use the key pairs of the parent. */
+    pid = fork();
+    AssertIntGE(pid, 0);
+    if (pid == 0) {
+        AssertNotNull(ssl = wolfSSL_new(ctx));
+        AssertIntEQ(wolfSSL_UseKeyShare(ssl, WOLFSSL_ECC_X25519),
+                    WOLFSSL_SUCCESS);
+        wolfSSL_free(ssl);
+        AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                    &stats), WOLFSSL_SUCCESS);
+        AssertIntEQ(stats.available, 0);
+        AssertIntEQ(stats.hits, 4);
+        AssertIntEQ(stats.misses, 2);
+        _exit(0);
+    }
+    AssertIntEQ(waitpid(pid, &status, 0), pid);
+    AssertTrue(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                &stats), WOLFSSL_SUCCESS);
+    AssertIntEQ(stats.available, 2);
+#endif
+
+#if defined(WOLFSSL_PTHREADS) && !defined(WOLFSSL_NO_KEY_SHARE_POOL_THREADS)
+    AssertIntEQ(wolfSSL_CTX_SetKeySharePoolThreads(ctx, 1000), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_CTX_SetKeySharePoolThreads(ctx, 2), WOLFSSL_SUCCESS);
+    for (i = 0; i < 2; i++) {
+        AssertNotNull(ssl = wolfSSL_new(ctx));
+        AssertIntEQ(wolfSSL_UseKeyShare(ssl, WOLFSSL_ECC_X25519),
+                    WOLFSSL_SUCCESS);
+        wolfSSL_free(ssl);
+    }
+    /* Wait for the refill threads. */
+    for (i = 0; i < 10000000; i++) {
+        AssertIntEQ(wolfSSL_CTX_GetKeySharePoolStats(ctx, WOLFSSL_ECC_X25519,
+                    &stats), WOLFSSL_SUCCESS);
+        if (stats.available == 2)
+            break;
+    }
+    AssertIntEQ(stats.available, 2);
+    AssertIntEQ(stats.threads, 2);
+    AssertIntEQ(stats.generated, 10);
+#else
+    AssertIntEQ(wolfSSL_CTX_SetKeySharePoolThreads(ctx, 1), NOT_COMPILED_IN);
+#endif
+
+    /* Frees the pool and stops the refill threads. */
+    wolfSSL_CTX_free(ctx);
+
+#if !defined(NO_FILESYSTEM) && !defined(NO_CERTS) && \
+    !defined(NO_WOLFSSL_SERVER) && defined(HAVE_IO_TESTS_DEPENDENCIES) && \
+    !defined(SINGLE_THREADED)
+    /* Handshake with pooled key shares on both sides. */
+    XMEMSET(&server_args, 0, sizeof(func_args));
+    XMEMSET(&client_args, 0, sizeof(func_args));
+    XMEMSET(&func_cb_client, 0, sizeof(callback_functions));
+    XMEMSET(&func_cb_server, 0, sizeof(callback_functions));
+
+    StartTCP();
+    InitTcpReady(&ready);
+
+#if defined(USE_WINDOWS_API)
+    /* use RNG to get random port if using windows */
+    ready.port = GetRandomPort();
+#endif
+
+    server_args.signal = &ready;
+    client_args.signal = &ready;
+    server_args.return_code = TEST_FAIL;
+    client_args.return_code = TEST_FAIL;
+
+    func_cb_client.ctx_ready = &test_key_share_pool_ctx_setup;
+    func_cb_client.ssl_ready = &test_key_share_pool_ssl_setup;
+    func_cb_client.method = wolfTLSv1_3_client_method;
+    client_args.callbacks = &func_cb_client;
+
+    func_cb_server.ctx_ready = &test_key_share_pool_ctx_setup;
+    func_cb_server.method = wolfTLSv1_3_server_method;
+    server_args.callbacks = &func_cb_server;
+
+    start_thread(test_server_nofail, &server_args, &serverThread);
+    wait_tcp_ready(&server_args);
+    test_client_nofail(&client_args, NULL);
+    join_thread(serverThread);
+
+    AssertTrue(client_args.return_code);
+    AssertTrue(server_args.return_code);
+
+    FreeTcpReady(&ready);
+#endif
+
+    printf(resultFmt, passed);
+}
+#endif
+
 #endif
 
 #ifdef HAVE_PK_CALLBACKS
@@ -31709,6 +32230,696 @@ static void test_wolfSSL_dtls_set_mtu(void)
 #endif
 }
 
+static void test_wolfSSL_dtls_demux(void)
+{
+#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_DEMUX) && \
+    defined(USE_WOLFSSL_IO) && defined(HAVE_IO_TESTS_DEPENDENCIES) && \
+    !defined(USE_WINDOWS_API)
+    WOLFSSL_CTX*        sctx = NULL;
+    WOLFSSL_CTX*        cctx = NULL;
+    WOLFSSL*            client[2] = { NULL, NULL };
+    WOLFSSL*            server[2] = { NULL, NULL };
+    WOLFSSL*            ready[4];
+    WOLFSSL_DEMUX* demux = NULL;
+    SOCKET_T            sfd = SOCKET_INVALID;
+    SOCKET_T            cfd[2] = { SOCKET_INVALID, SOCKET_INVALID };
+    SOCKADDR_IN_T       addr;
+    socklen_t           addrSz = sizeof(addr);
+    const char          msg[] = "demux";
+    char                buf[16];
+    int                 connected[2] = { 0, 0 };
+    int                 accepted = 0;
+    int                 echoed = 0;
+    int                 loops;
+    int                 i, j, n;
+
+    printf(testingFmt, "wolfSSL_dtls_demux()");
+
+    AssertNotNull(sctx = wolfSSL_CTX_new(wolfDTLSv1_2_server_method()));
+    AssertTrue(wolfSSL_CTX_use_certificate_file(sctx, svrCertFile,
+                                                WOLFSSL_FILETYPE_PEM));
+    AssertTrue(wolfSSL_CTX_use_PrivateKey_file(sctx, svrKeyFile,
+                                               WOLFSSL_FILETYPE_PEM));
+    AssertNotNull(cctx = wolfSSL_CTX_new(wolfDTLSv1_2_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(cctx, caCertFile, 0),
+                WOLFSSL_SUCCESS);
+
+    /* one UDP socket for all of the server's peers */
+    build_addr(&addr, wolfSSLIP, 0, 1, 0);
+    tcp_socket(&sfd, 1, 0);
+    AssertIntEQ(bind(sfd, (const struct sockaddr*)&addr, sizeof(addr)), 0);
+    AssertIntEQ(getsockname(sfd, (struct sockaddr*)&addr, &addrSz), 0);
+    tcp_set_nonblocking(&sfd);
+
+    AssertNull(wolfSSL_dtls_demux_new(NULL, sfd, 4));
+    AssertNull(wolfSSL_dtls_demux_new(sctx, sfd, 0));
+    AssertNull(wolfSSL_dtls_demux_new(cctx, sfd, 4));
+    AssertNotNull(demux = wolfSSL_dtls_demux_new(sctx, sfd, 4));
+    AssertIntEQ(wolfSSL_dtls_demux_read(NULL, ready, 4), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_dtls_demux_read(demux, NULL, 4), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_dtls_demux_remove(demux, NULL), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_dtls_demux_peers(NULL), BAD_FUNC_ARG);
+    AssertIntEQ(wolfSSL_dtls_demux_peers(demux), 0);
+    AssertIntEQ(wolfSSL_dtls_demux_read(demux, ready, 4), 0);
+
+    for (i = 0; i < 2; i++) {
+        tcp_socket(&cfd[i], 1, 0);
+        AssertIntEQ(connect(cfd[i], (const struct sockaddr*)&addr, addrSz),
+                    0);
+        tcp_set_nonblocking(&cfd[i]);
+        AssertNotNull(client[i] = wolfSSL_new(cctx));
+        AssertIntEQ(wolfSSL_dtls_set_peer(client[i], &addr, addrSz),
+                    WOLFSSL_SUCCESS);
+        AssertIntEQ(wolfSSL_set_fd(client[i], cfd[i]), WOLFSSL_SUCCESS);
+        wolfSSL_dtls_set_using_nonblock(client[i], 1);
+    }
+
+    /* the cookie exchange is answered by the demux, every later flight is
+     * queued for the peer's own WOLFSSL */
+    for (loops = 0; loops < 10000 && echoed < 2; loops++) {
+        for (i = 0; i < 2; i++) {
+            if (!connected[i]) {
+                if (wolfSSL_connect(client[i]) == WOLFSSL_SUCCESS) {
+                    connected[i] = 1;
+                    AssertIntEQ(wolfSSL_write(client[i], msg, sizeof(msg)),
+                                sizeof(msg));
+                }
+            }
+            else if (wolfSSL_read(client[i], buf, sizeof(buf)) > 0) {
+                AssertIntEQ(XMEMCMP(buf, msg, sizeof(msg)), 0);
+                echoed++;
+            }
+        }
+
+        n = wolfSSL_dtls_demux_read(demux, ready, 4);
+        AssertIntGE(n, 0);
+        for (j = 0; j < n; j++) {
+            if (!wolfSSL_is_init_finished(ready[j])) {
+                if (wolfSSL_accept(ready[j]) == WOLFSSL_SUCCESS)
+                    server[accepted++] = ready[j];
+            }
+            else if (wolfSSL_read(ready[j], buf, sizeof(buf)) > 0) {
+                AssertIntEQ(wolfSSL_write(ready[j], buf, sizeof(msg)),
+                            sizeof(msg));
+            }
+        }
+    }
+    AssertIntEQ(echoed, 2);
+    AssertIntEQ(accepted, 2);
+    AssertTrue(server[0] != server[1]);
+    AssertIntEQ(wolfSSL_dtls_demux_peers(demux), 2);
+
+    AssertIntEQ(wolfSSL_dtls_demux_remove(demux, server[0]), 0);
+    AssertIntEQ(wolfSSL_dtls_demux_peers(demux), 1);
+
+    for (i = 0; i < 2; i++) {
+        wolfSSL_free(client[i]);
+        CloseSocket(cfd[i]);
+    }
+    wolfSSL_dtls_demux_free(demux);
+    CloseSocket(sfd);
+    wolfSSL_CTX_free(cctx);
+    wolfSSL_CTX_free(sctx);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+#if defined(WOLFSSL_DTLS) && !defined(NO_RSA) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_WOLFSSL_CLIENT) && \
+    !defined(NO_WOLFSSL_SERVER)
+#define TEST_DTLS_QUEUE_SZ 64
+#define TEST_DTLS_MTU      1500
+
+/* datagrams in flight to one side */
+typedef struct test_dtls_queue {
+    byte data[TEST_DTLS_QUEUE_SZ][TEST_DTLS_MTU];
+    int  sz[TEST_DTLS_QUEUE_SZ];
+    int  count;
+    int  reverse;   /* deliver the next flight in reverse order */
+    int  drop;      /* number of datagrams still to be lost */
+} test_dtls_queue;
+
+static test_dtls_queue test_dtls_to_client;
+static test_dtls_queue test_dtls_to_server;
+
+/* queues a datagram for the peer */
+static int test_dtls_queue_send(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    test_dtls_queue* q = (test_dtls_queue*)ctx;
+
+    (void)ssl;
+
+    if (sz > TEST_DTLS_MTU || q->count == TEST_DTLS_QUEUE_SZ)
+        return WOLFSSL_CBIO_ERR_GENERAL;
+    if (q->drop > 0) {
+        q->drop--;
+        return sz;
+    }
+    XMEMCPY(q->data[q->count], buf, sz);
+    q->sz[q->count++] = sz;
+
+    return sz;
+}
+
+/* delivers the first flight of more than one datagram in reverse order when
+ * reverse is set, retransmits are delivered in order */
+static int test_dtls_queue_recv(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    test_dtls_queue* q = (test_dtls_queue*)ctx;
+    int i = 0;
+
+    (void)ssl;
+
+    if (q->count == 0)
+        return WOLFSSL_CBIO_ERR_WANT_READ;
+    if (q->reverse && q->count > 1) {
+        i = q->count - 1;
+        q->reverse = 2;
+    }
+
+    sz = min(sz, q->sz[i]);
+    XMEMCPY(buf, q->data[i], sz);
+    q->count--;
+    XMEMMOVE(q->data[i], q->data[i + 1], (q->count - i) * sizeof(q->data[0]));
+    XMEMMOVE(&q->sz[i], &q->sz[i + 1], (q->count - i) * sizeof(q->sz[0]));
+    if (q->count == 0 && q->reverse == 2)
+        q->reverse = 0;
+
+    return sz;
+}
+
+/* nonblocking handshake over the queues. When both queues are empty the
+ * handshake has stalled: with loss set a retransmit is triggered, otherwise
+ * every datagram was delivered and stalling is an error. */
+static void test_dtls_queue_connect(WOLFSSL* client, WOLFSSL* server,
+                                    int loss)
+{
+    int cret = WOLFSSL_FATAL_ERROR;
+    int sret = WOLFSSL_FATAL_ERROR;
+    int timeouts = 0;
+    int loops;
+
+    wolfSSL_dtls_set_using_nonblock(server, 1);
+    wolfSSL_dtls_set_using_nonblock(client, 1);
+
+    for (loops = 0; loops < 1000; loops++) {
+        if (cret != WOLFSSL_SUCCESS)
+            cret = wolfSSL_connect(client);
+        if (sret != WOLFSSL_SUCCESS)
+            sret = wolfSSL_accept(server);
+        if (cret == WOLFSSL_SUCCESS && sret == WOLFSSL_SUCCESS)
+            break;
+        AssertTrue(cret == WOLFSSL_SUCCESS ||
+                   wolfSSL_get_error(client, cret) == WOLFSSL_ERROR_WANT_READ);
+        AssertTrue(sret == WOLFSSL_SUCCESS ||
+                   wolfSSL_get_error(server, sret) == WOLFSSL_ERROR_WANT_READ);
+        if (test_dtls_to_client.count == 0 && test_dtls_to_server.count == 0) {
+            timeouts++;
+            if (!loss)
+                break;
+            if (cret != WOLFSSL_SUCCESS)
+                wolfSSL_dtls_got_timeout(client);
+            else
+                wolfSSL_dtls_got_timeout(server);
+        }
+    }
+    if (!loss)
+        AssertIntEQ(timeouts, 0);
+    else
+        AssertIntGT(timeouts, 0);
+    AssertIntEQ(cret, WOLFSSL_SUCCESS);
+    AssertIntEQ(sret, WOLFSSL_SUCCESS);
+}
+#endif
+
+/* Handshake with the server flight fragmented and reversed */
+static void test_wolfSSL_dtls_reassembly(void)
+{
+#if defined(WOLFSSL_DTLS) && !defined(NO_RSA) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_WOLFSSL_CLIENT) && \
+    !defined(NO_WOLFSSL_SERVER)
+    WOLFSSL_CTX* cctx;
+    WOLFSSL_CTX* sctx;
+    WOLFSSL*     client;
+    WOLFSSL*     server;
+    const char   msg[] = "reassembled";
+    char         buf[sizeof(msg)];
+
+    printf(testingFmt, "wolfSSL_dtls_reassembly()");
+
+    XMEMSET(&test_dtls_to_client, 0, sizeof(test_dtls_to_client));
+    XMEMSET(&test_dtls_to_server, 0, sizeof(test_dtls_to_server));
+    test_dtls_to_client.reverse = 1;
+
+    AssertNotNull(sctx = wolfSSL_CTX_new(wolfDTLSv1_2_server_method()));
+    /* certificate message of the chain is fragmented */
+    AssertIntEQ(wolfSSL_CTX_use_certificate_chain_file(sctx, svrCertFile),
+                WOLFSSL_SUCCESS);
+    AssertTrue(wolfSSL_CTX_use_PrivateKey_file(sctx, svrKeyFile,
+                                               WOLFSSL_FILETYPE_PEM));
+    AssertNotNull(cctx = wolfSSL_CTX_new(wolfDTLSv1_2_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(cctx, caCertFile, 0),
+                WOLFSSL_SUCCESS);
+    wolfSSL_SetIOSend(sctx, test_dtls_queue_send);
+    wolfSSL_SetIORecv(sctx, test_dtls_queue_recv);
+    wolfSSL_SetIOSend(cctx, test_dtls_queue_send);
+    wolfSSL_SetIORecv(cctx, test_dtls_queue_recv);
+
+    AssertNotNull(server = wolfSSL_new(sctx));
+    AssertNotNull(client = wolfSSL_new(cctx));
+    wolfSSL_SetIOWriteCtx(server, &test_dtls_to_client);
+    wolfSSL_SetIOReadCtx(server, &test_dtls_to_server);
+    wolfSSL_SetIOWriteCtx(client, &test_dtls_to_server);
+    wolfSSL_SetIOReadCtx(client, &test_dtls_to_client);
+
+    test_dtls_queue_connect(client, server, 0);
+
+    AssertIntEQ(wolfSSL_write(client, msg, sizeof(msg)), sizeof(msg));
+    AssertIntEQ(wolfSSL_read(server, buf, sizeof(buf)), sizeof(msg));
+    AssertIntEQ(XMEMCMP(buf, msg, sizeof(msg)), 0);
+
+    wolfSSL_free(client);
+    wolfSSL_free(server);
+    wolfSSL_CTX_free(cctx);
+    wolfSSL_CTX_free(sctx);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+/* Handshake with the first datagram of the server flight lost */
+static void test_wolfSSL_dtls_loss(void)
+{
+#if defined(WOLFSSL_DTLS) && !defined(NO_RSA) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_WOLFSSL_CLIENT) && \
+    !defined(NO_WOLFSSL_SERVER)
+    WOLFSSL_CTX* cctx;
+    WOLFSSL_CTX* sctx;
+    WOLFSSL*     client;
+    WOLFSSL*     server;
+    const char   msg[] = "retransmitted";
+    char         buf[sizeof(msg)];
+
+    printf(testingFmt, "wolfSSL_dtls_loss()");
+
+    XMEMSET(&test_dtls_to_client, 0, sizeof(test_dtls_to_client));
+    XMEMSET(&test_dtls_to_server, 0, sizeof(test_dtls_to_server));
+    test_dtls_to_client.drop = 1;
+
+    AssertNotNull(sctx = wolfSSL_CTX_new(wolfDTLSv1_2_server_method()));
+    AssertTrue(wolfSSL_CTX_use_certificate_file(sctx, svrCertFile,
+                                                WOLFSSL_FILETYPE_PEM));
+    AssertTrue(wolfSSL_CTX_use_PrivateKey_file(sctx, svrKeyFile,
+                                               WOLFSSL_FILETYPE_PEM));
+    AssertNotNull(cctx = wolfSSL_CTX_new(wolfDTLSv1_2_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(cctx, caCertFile, 0),
+                WOLFSSL_SUCCESS);
+    wolfSSL_SetIOSend(sctx, test_dtls_queue_send);
+    wolfSSL_SetIORecv(sctx, test_dtls_queue_recv);
+    wolfSSL_SetIOSend(cctx, test_dtls_queue_send);
+    wolfSSL_SetIORecv(cctx, test_dtls_queue_recv);
+
+    AssertNotNull(server = wolfSSL_new(sctx));
+    AssertNotNull(client = wolfSSL_new(cctx));
+    wolfSSL_SetIOWriteCtx(server, &test_dtls_to_client);
+    wolfSSL_SetIOReadCtx(server, &test_dtls_to_server);
+    wolfSSL_SetIOWriteCtx(client, &test_dtls_to_server);
+    wolfSSL_SetIOReadCtx(client, &test_dtls_to_client);
+
+    test_dtls_queue_connect(client, server, 1);
+
+    AssertIntEQ(wolfSSL_write(client, msg, sizeof(msg)), sizeof(msg));
+    AssertIntEQ(wolfSSL_read(server, buf, sizeof(buf)), sizeof(msg));
+    AssertIntEQ(XMEMCMP(buf, msg, sizeof(msg)), 0);
+
+    wolfSSL_free(client);
+    wolfSSL_free(server);
+    wolfSSL_CTX_free(cctx);
+    wolfSSL_CTX_free(sctx);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+/* Application records delivered in reverse order with a replayed record */
+static void test_wolfSSL_dtls_replay_window(void)
+{
+#if defined(WOLFSSL_DTLS) && !defined(NO_RSA) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_WOLFSSL_CLIENT) && \
+    !defined(NO_WOLFSSL_SERVER)
+    WOLFSSL_CTX*  cctx;
+    WOLFSSL_CTX*  sctx;
+    WOLFSSL*      client;
+    WOLFSSL*      server;
+    byte          seen[48];
+    byte          rec;
+    int           i;
+
+    printf(testingFmt, "wolfSSL_dtls_replay_window()");
+
+    XMEMSET(&test_dtls_to_client, 0, sizeof(test_dtls_to_client));
+    XMEMSET(&test_dtls_to_server, 0, sizeof(test_dtls_to_server));
+    XMEMSET(seen, 0, sizeof(seen));
+
+    AssertNotNull(sctx = wolfSSL_CTX_new(wolfDTLSv1_2_server_method()));
+    AssertTrue(wolfSSL_CTX_use_certificate_file(sctx, svrCertFile,
+                                                WOLFSSL_FILETYPE_PEM));
+    AssertTrue(wolfSSL_CTX_use_PrivateKey_file(sctx, svrKeyFile,
+                                               WOLFSSL_FILETYPE_PEM));
+    AssertNotNull(cctx = wolfSSL_CTX_new(wolfDTLSv1_2_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(cctx, caCertFile, 0),
+                WOLFSSL_SUCCESS);
+    wolfSSL_SetIOSend(sctx, test_dtls_queue_send);
+    wolfSSL_SetIORecv(sctx, test_dtls_queue_recv);
+    wolfSSL_SetIOSend(cctx, test_dtls_queue_send);
+    wolfSSL_SetIORecv(cctx, test_dtls_queue_recv);
+
+    AssertNotNull(server = wolfSSL_new(sctx));
+    AssertNotNull(client = wolfSSL_new(cctx));
+    wolfSSL_SetIOWriteCtx(server, &test_dtls_to_client);
+    wolfSSL_SetIOReadCtx(server, &test_dtls_to_server);
+    wolfSSL_SetIOWriteCtx(client, &test_dtls_to_server);
+    wolfSSL_SetIOReadCtx(client, &test_dtls_to_client);
+
+    test_dtls_queue_connect(client, server, 0);
+
+    for (i = 0; i < (int)sizeof(seen); i++) {
+        rec = (byte)i;
+        AssertIntEQ(wolfSSL_write(client, &rec, 1), 1);
+    }
+    AssertIntEQ(test_dtls_to_server.count, (int)sizeof(seen));
+    /* replay the first record, it is delivered first */
+    XMEMCPY(test_dtls_to_server.data[test_dtls_to_server.count],
+            test_dtls_to_server.data[0], test_dtls_to_server.sz[0]);
+    test_dtls_to_server.sz[test_dtls_to_server.count] =
+                                                    test_dtls_to_server.sz[0];
+    test_dtls_to_server.count++;
+    test_dtls_to_server.reverse = 1;
+
+    for (i = 0; i < (int)sizeof(seen); i++) {
+        AssertIntEQ(wolfSSL_read(server, &rec, 1), 1);
+        AssertIntLT(rec, sizeof(seen));
+        seen[rec]++;
+    }
+    for (i = 0; i < (int)sizeof(seen); i++) {
+        AssertIntEQ(seen[i], 1);
+    }
+    /* the original of the replayed record is dropped */
+    AssertIntEQ(wolfSSL_read(server, &rec, 1), WOLFSSL_FATAL_ERROR);
+    AssertIntEQ(wolfSSL_get_error(server, WOLFSSL_FATAL_ERROR),
+                WOLFSSL_ERROR_WANT_READ);
+    AssertIntEQ(test_dtls_to_server.count, 0);
+
+    wolfSSL_free(client);
+    wolfSSL_free(server);
+    wolfSSL_CTX_free(cctx);
+    wolfSSL_CTX_free(sctx);
+
+    printf(resultFmt, passed);
+#endif
+}
+
+/* Server drops CBC records whose padding length byte has been changed.
+ * With WOLFSSL_TEST_TIMING the dropping is timed too: MAC check of
+ * MAC-then-encrypt records must take the same time for all padding lengths.
+ * Wall-clock timing is unreliable on loaded machines so is opt-in. */
+static void test_wolfSSL_dtls_cbc_pad_timing(void)
+{
+#if defined(WOLFSSL_DTLS) && !defined(NO_RSA) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_WOLFSSL_CLIENT) && \
+    !defined(NO_WOLFSSL_SERVER) && defined(HAVE_ECC) && !defined(NO_AES) && \
+    defined(HAVE_AES_CBC) && !defined(NO_SHA256) && \
+    !defined(WOLFSSL_AEAD_ONLY)
+#ifdef WOLFSSL_TEST_TIMING
+    #define TEST_PAD_ROUNDS  15
+#else
+    #define TEST_PAD_ROUNDS  1
+#endif
+    #define TEST_PAD_RECORDS 48
+    /* 207 bytes of data, 32 bytes of MAC and padding length byte of zero
+     * fill 15 AES blocks exactly */
+    #define TEST_PAD_DATA_SZ 207
+    WOLFSSL_CTX*  cctx;
+    WOLFSSL_CTX*  sctx;
+    WOLFSSL*      client;
+    WOLFSSL*      server;
+    const char*   suite = "ECDHE-RSA-AES128-SHA256";
+    const byte    padLen[] = { 1, 64, 128, 192, 239 };
+    const int     padLenCnt = (int)sizeof(padLen);
+    double        t[sizeof(padLen)][TEST_PAD_ROUNDS];
+    double        start;
+#ifdef WOLFSSL_TEST_TIMING
+    double        med[sizeof(padLen)];
+    double        tmp, minMed, maxMed;
+    int           j;
+#endif
+    byte          msg[TEST_PAD_DATA_SZ];
+    byte          rec;
+    int           r, p, i;
+
+    printf(testingFmt, "wolfSSL_dtls_cbc_pad_timing()");
+
+    XMEMSET(&test_dtls_to_client, 0, sizeof(test_dtls_to_client));
+    XMEMSET(&test_dtls_to_server, 0, sizeof(test_dtls_to_server));
+    XMEMSET(msg, 0x5a, sizeof(msg));
+
+    AssertNotNull(sctx = wolfSSL_CTX_new(wolfDTLSv1_2_server_method()));
+    AssertTrue(wolfSSL_CTX_use_certificate_file(sctx, svrCertFile,
+                                                WOLFSSL_FILETYPE_PEM));
+    AssertTrue(wolfSSL_CTX_use_PrivateKey_file(sctx, svrKeyFile,
+                                               WOLFSSL_FILETYPE_PEM));
+    AssertIntEQ(wolfSSL_CTX_set_cipher_list(sctx, suite), WOLFSSL_SUCCESS);
+    AssertNotNull(cctx = wolfSSL_CTX_new(wolfDTLSv1_2_client_method()));
+    AssertIntEQ(wolfSSL_CTX_load_verify_locations(cctx, caCertFile, 0),
+                WOLFSSL_SUCCESS);
+    AssertIntEQ(wolfSSL_CTX_set_cipher_list(cctx, suite), WOLFSSL_SUCCESS);
+    wolfSSL_SetIOSend(sctx, test_dtls_queue_send);
+    wolfSSL_SetIORecv(sctx, test_dtls_queue_recv);
+    wolfSSL_SetIOSend(cctx, test_dtls_queue_send);
+    wolfSSL_SetIORecv(cctx, test_dtls_queue_recv);
+
+    AssertNotNull(server = wolfSSL_new(sctx));
+    AssertNotNull(client = wolfSSL_new(cctx));
+    wolfSSL_SetIOWriteCtx(server, &test_dtls_to_client);
+    wolfSSL_SetIOReadCtx(server, &test_dtls_to_server);
+    wolfSSL_SetIOWriteCtx(client, &test_dtls_to_server);
+    wolfSSL_SetIOReadCtx(client, &test_dtls_to_client);
+#ifdef HAVE_ENCRYPT_THEN_MAC
+    AssertIntEQ(wolfSSL_AllowEncryptThenMac(client, 0), WOLFSSL_SUCCESS);
+#endif
+
+    test_dtls_queue_connect(client, server, 0);
+
+    /* an unmodified record is accepted */
+    AssertIntEQ(wolfSSL_write(client, msg, sizeof(msg)), sizeof(msg));
+    AssertIntEQ(wolfSSL_read(server, msg, sizeof(msg)), sizeof(msg));
+
+    /* padding lengths interleaved so that drift affects all equally */
+    for (r = 0; r < TEST_PAD_ROUNDS; r++) {
+        for (p = 0; p < padLenCnt; p++) {
+            for (i = 0; i < TEST_PAD_RECORDS; i++) {
+                byte* d = test_dtls_to_server.data[i];
+                int   sz;
+
+                AssertIntEQ(wolfSSL_write(client, msg, sizeof(msg)),
+                            sizeof(msg));
+                /* padding length byte is last byte of plaintext - change it
+                 * through last byte of previous cipher text block */
+                sz = test_dtls_to_server.sz[i];
+                d[sz - AES_BLOCK_SIZE - 1] ^= padLen[p];
+            }
+
+            start = current_time(0);
+            for (i = 0; i < TEST_PAD_RECORDS; i++) {
+                AssertIntEQ(wolfSSL_read(server, &rec, 1), WOLFSSL_FATAL_ERROR);
+            }
+            t[p][r] = current_time(0) - start;
+            /* all records dropped */
+            AssertIntEQ(test_dtls_to_server.count, 0);
+        }
+    }
+
+#ifdef WOLFSSL_TEST_TIMING
+    /* median time of each padding length */
+    for (p = 0; p < padLenCnt; p++) {
+        for (i = 1; i < TEST_PAD_ROUNDS; i++) {
+            for (j = i; j > 0 && t[p][j - 1] > t[p][j]; j--) {
+                tmp = t[p][j - 1];
+                t[p][j - 1] = t[p][j];
+                t[p][j] = tmp;
+            }
+        }
+        med[p] = t[p][TEST_PAD_ROUNDS / 2];
+    }
+    minMed = maxMed = med[0];
+    for (p = 1; p < padLenCnt; p++) {
+        if (med[p] < minMed)
+            minMed = med[p];
+        if (med[p] > maxMed)
+            maxMed = med[p];
+    }
+    /* generous bound for a loaded machine - hashing only the blocks up to
+     * the end of the message differs by more */
+    AssertTrue(maxMed <= minMed * 1.25);
+#else
+    (void)t;
+#endif
+
+    wolfSSL_free(client);
+    wolfSSL_free(server);
+    wolfSSL_CTX_free(cctx);
+    wolfSSL_CTX_free(sctx);
+
+    printf(resultFmt, passed);
+
+    #undef TEST_PAD_ROUNDS
+    #undef TEST_PAD_RECORDS
+    #undef TEST_PAD_DATA_SZ
+#endif
+}
+
+#if defined(WOLFSSL_DTLS) && !defined(NO_RSA) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_WOLFSSL_CLIENT) && \
+    !defined(NO_WOLFSSL_SERVER) && defined(HAVE_ECC) && !defined(NO_AES) && \
+    defined(HAVE_AES_CBC) && !defined(WOLFSSL_AEAD_ONLY)
+#include <wolfssl/internal.h> /* for the client's write key */
+
+/* Replaces the padding of the CBC record with padLen bytes of padding.
+ * Record has the explicit IV as first cipher text block. */
+static int test_dtls_cbc_repad(WOLFSSL* ssl, byte* rec, int sz, int padLen)
+{
+    Aes  aes;
+    byte iv[AES_BLOCK_SIZE];
+    int  dataSz;
+
+    XMEMCPY(iv, rec + DTLS_RECORD_HEADER_SZ, AES_BLOCK_SIZE);
+    AssertIntEQ(wc_AesInit(&aes, NULL, INVALID_DEVID), 0);
+    AssertIntEQ(wc_AesSetKey(&aes, ssl->keys.client_write_key,
+                             ssl->specs.key_size, iv, AES_DECRYPTION), 0);
+    sz -= DTLS_RECORD_HEADER_SZ + AES_BLOCK_SIZE;
+    rec += DTLS_RECORD_HEADER_SZ + AES_BLOCK_SIZE;
+    AssertIntEQ(wc_AesCbcDecrypt(&aes, rec, rec, sz), 0);
+
+    /* data and MAC, then padding to a whole number of blocks */
+    dataSz = sz - rec[sz - 1] - 1;
+    sz = dataSz + padLen + 1;
+    if (sz % AES_BLOCK_SIZE != 0 || sz + DTLS_RECORD_HEADER_SZ +
+                                         AES_BLOCK_SIZE > TEST_DTLS_MTU) {
+        wc_AesFree(&aes);
+        return -1;
+    }
+    XMEMSET(rec + dataSz, padLen, padLen + 1);
+
+    AssertIntEQ(wc_AesSetKey(&aes, ssl->keys.client_write_key,
+                             ssl->specs.key_size, iv, AES_ENCRYPTION), 0);
+    AssertIntEQ(wc_AesCbcEncrypt(&aes, rec, rec, sz), 0);
+    wc_AesFree(&aes);
+
+    sz += AES_BLOCK_SIZE;
+    c16toa((word16)sz, rec - AES_BLOCK_SIZE - LENGTH_SZ);
+
+    return sz + DTLS_RECORD_HEADER_SZ;
+}
+#endif
+
+/* Records of more than TLS_MAX_PAD_SZ bytes with the padding replaced by
+ * all the padding lengths that fit. The constant time MAC check of the
+ * server must agree with the MAC the client calculated normally. */
+static void test_wolfSSL_dtls_cbc_mac_ct(void)
+{
+#if defined(WOLFSSL_DTLS) && !defined(NO_RSA) && !defined(NO_FILESYSTEM) && \
+    !defined(NO_CERTS) && !defined(NO_WOLFSSL_CLIENT) && \
+    !defined(NO_WOLFSSL_SERVER) && defined(HAVE_ECC) && !defined(NO_AES) && \
+    defined(HAVE_AES_CBC) && !defined(WOLFSSL_AEAD_ONLY)
+    WOLFSSL_CTX*  cctx;
+    WOLFSSL_CTX*  sctx;
+    WOLFSSL*      clientSsl;
+    WOLFSSL*      serverSsl;
+    const char*   suites[] = {
+    #ifndef NO_SHA
+        "ECDHE-RSA-AES128-SHA",
+    #endif
+    #ifndef NO_SHA256
+        "ECDHE-RSA-AES128-SHA256",
+    #endif
+    #if defined(WOLFSSL_SHA384) && defined(WOLFSSL_AES_256)
+        "ECDHE-RSA-AES256-SHA384",
+    #endif
+        NULL
+    };
+    /* over TLS_MAX_PAD_SZ bytes and not aligned to the hash blocks */
+    const int     msgSz[] = { 301, 333, 400, 447, 512 };
+    byte          msg[512];
+    byte          buf[512];
+    int           s, m, padLen, sz;
+
+    printf(testingFmt, "wolfSSL_dtls_cbc_mac_ct()");
+
+    for (sz = 0; sz < (int)sizeof(msg); sz++)
+        msg[sz] = (byte)sz;
+
+    for (s = 0; suites[s] != NULL; s++) {
+        XMEMSET(&test_dtls_to_client, 0, sizeof(test_dtls_to_client));
+        XMEMSET(&test_dtls_to_server, 0, sizeof(test_dtls_to_server));
+
+        AssertNotNull(sctx = wolfSSL_CTX_new(wolfDTLSv1_2_server_method()));
+        AssertTrue(wolfSSL_CTX_use_certificate_file(sctx, svrCertFile,
+                                                    WOLFSSL_FILETYPE_PEM));
+        AssertTrue(wolfSSL_CTX_use_PrivateKey_file(sctx, svrKeyFile,
+                                                   WOLFSSL_FILETYPE_PEM));
+        AssertIntEQ(wolfSSL_CTX_set_cipher_list(sctx, suites[s]),
+                    WOLFSSL_SUCCESS);
+        AssertNotNull(cctx = wolfSSL_CTX_new(wolfDTLSv1_2_client_method()));
+        AssertIntEQ(wolfSSL_CTX_load_verify_locations(cctx, caCertFile, 0),
+                    WOLFSSL_SUCCESS);
+        AssertIntEQ(wolfSSL_CTX_set_cipher_list(cctx, suites[s]),
+                    WOLFSSL_SUCCESS);
+        wolfSSL_SetIOSend(sctx, test_dtls_queue_send);
+        wolfSSL_SetIORecv(sctx, test_dtls_queue_recv);
+        wolfSSL_SetIOSend(cctx, test_dtls_queue_send);
+        wolfSSL_SetIORecv(cctx, test_dtls_queue_recv);
+
+        AssertNotNull(serverSsl = wolfSSL_new(sctx));
+        AssertNotNull(clientSsl = wolfSSL_new(cctx));
+        wolfSSL_SetIOWriteCtx(serverSsl, &test_dtls_to_client);
+        wolfSSL_SetIOReadCtx(serverSsl, &test_dtls_to_server);
+        wolfSSL_SetIOWriteCtx(clientSsl, &test_dtls_to_server);
+        wolfSSL_SetIOReadCtx(clientSsl, &test_dtls_to_client);
+    #ifdef HAVE_ENCRYPT_THEN_MAC
+        AssertIntEQ(wolfSSL_AllowEncryptThenMac(clientSsl, 0), WOLFSSL_SUCCESS);
+    #endif
+
+        test_dtls_queue_connect(clientSsl, serverSsl, 0);
+
+        for (m = 0; m < (int)(sizeof(msgSz) / sizeof(msgSz[0])); m++) {
+            for (padLen = 0; padLen <= TLS_MAX_PAD_SZ; padLen++) {
+                AssertIntEQ(wolfSSL_write(clientSsl, msg, msgSz[m]), msgSz[m]);
+                AssertIntEQ(test_dtls_to_server.count, 1);
+                sz = test_dtls_cbc_repad(clientSsl, test_dtls_to_server.data[0],
+                                      test_dtls_to_server.sz[0], padLen);
+                if (sz < 0) {
+                    /* padding length not possible for this message size */
+                    test_dtls_to_server.count = 0;
+                    continue;
+                }
+                test_dtls_to_server.sz[0] = sz;
+
+                AssertIntEQ(wolfSSL_read(serverSsl, buf, sizeof(buf)), msgSz[m]);
+                AssertIntEQ(XMEMCMP(buf, msg, msgSz[m]), 0);
+            }
+        }
+
+        wolfSSL_free(clientSsl);
+        wolfSSL_free(serverSsl);
+        wolfSSL_CTX_free(cctx);
+        wolfSSL_CTX_free(sctx);
+    }
+
+    printf(resultFmt, passed);
+#endif
+}
+
 #if !defined(NO_RSA) && !defined(NO_SHA) && !defined(NO_FILESYSTEM) && \
     !defined(NO_CERTS)
 static int load_ca_into_cm(WOLFSSL_CERT_MANAGER* cm, char* certA)
@@ -32012,6 +33223,12 @@ void ApiTest(void)
     test_wolfSSL_SetMinMaxDhKey_Sz();
     test_SetTmpEC_DHE_Sz();
     test_wolfSSL_dtls_set_mtu();
+    test_wolfSSL_dtls_demux();
+    test_wolfSSL_dtls_reassembly();
+    test_wolfSSL_dtls_loss();
+    test_wolfSSL_dtls_replay_window();
+    test_wolfSSL_dtls_cbc_pad_timing();
+    test_wolfSSL_dtls_cbc_mac_ct();
 #if !defined(NO_WOLFSSL_CLIENT) && !defined(NO_WOLFSSL_SERVER) && \
     defined(HAVE_IO_TESTS_DEPENDENCIES)
     test_wolfSSL_read_write();
@@ -32277,6 +33494,10 @@ void ApiTest(void)
 #ifdef WOLFSSL_TLS13
     /* TLS v1.3 API tests */
     test_tls13_apis();
+#if defined(WOLFSSL_KEY_SHARE_POOL) && defined(HAVE_CURVE25519) && \
+    !defined(NO_WOLFSSL_CLIENT)
+    test_wolfSSL_CTX_UseKeySharePool();
+#endif
 #endif
 
 #ifndef NO_CERTS
@@ -32446,6 +33667,7 @@ void ApiTest(void)
     AssertIntEQ(test_wc_ed25519_make_key(), 0);
     AssertIntEQ(test_wc_ed25519_init(), 0);
     AssertIntEQ(test_wc_ed25519_sign_msg(), 0);
+    AssertIntEQ(test_wc_ed25519_verify_msg_batch(), 0);
     AssertIntEQ(test_wc_ed25519_import_public(), 0);
     AssertIntEQ(test_wc_ed25519_import_private_key(), 0);
     AssertIntEQ(test_wc_ed25519_export(), 0);
@@ -32454,6 +33676,7 @@ void ApiTest(void)
     AssertIntEQ(test_wc_Ed25519PublicKeyToDer(), 0);
     AssertIntEQ(test_wc_curve25519_init(), 0);
     AssertIntEQ(test_wc_curve25519_size (), 0);
+    AssertIntEQ(test_wc_curve25519_make_pub(), 0);
     AssertIntEQ(test_wc_ed448_make_key(), 0);
     AssertIntEQ(test_wc_ed448_init(), 0);
     AssertIntEQ(test_wc_ed448_sign_msg(), 0);
@@ -32490,6 +33713,8 @@ void ApiTest(void)
     AssertIntEQ(test_wc_ecc_pointFns(), 0);
     AssertIntEQ(test_wc_ecc_shared_secret_ssh(), 0);
     AssertIntEQ(test_wc_ecc_verify_hash_ex(), 0);
+    AssertIntEQ(test_wc_ecc_verify_hash_batch(), 0);
+    AssertIntEQ(test_wc_ecc_set_precompute(), 0);
     AssertIntEQ(test_wc_ecc_mulmod(), 0);
     AssertIntEQ(test_wc_ecc_is_valid_idx(), 0);
 
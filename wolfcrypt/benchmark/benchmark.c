@@ -170,6 +170,9 @@
 #endif
 
 #include <wolfssl/wolfcrypt/dh.h>
+#if defined(WOLFSSL_PUBLIC_MP) && !defined(WOLFSSL_SP_MATH)
+    #include <wolfssl/wolfcrypt/integer.h>
+#endif
 #ifdef HAVE_NTRU
     #include "libntruencrypt/ntru_crypto.h"
 #endif
@@ -249,6 +252,10 @@
 #define BENCH_RIPEMD             0x00001000
 #define BENCH_BLAKE2B            0x00002000
 #define BENCH_BLAKE2S            0x00004000
+#define BENCH_SHAKE128           0x00008000
+#define BENCH_SHAKE256           0x00010000
+#define BENCH_BLAKE2BP           0x00020000
+#define BENCH_BLAKE2SP           0x00040000
 
 /* MAC algorithms. */
 #define BENCH_CMAC               0x00000001
@@ -268,6 +275,7 @@
 #define BENCH_RSA                0x00000002
 #define BENCH_RSA_SZ             0x00000004
 #define BENCH_DH                 0x00000010
+#define BENCH_MODEXP             0x00000020
 #define BENCH_NTRU               0x00000100
 #define BENCH_NTRU_KEYGEN        0x00000200
 #define BENCH_ECC_MAKEKEY        0x00001000
@@ -409,15 +417,23 @@ static const bench_alg bench_digest_opt[] = {
     #ifndef WOLFSSL_NOSHA3_512
     { "-sha3-512",           BENCH_SHA3_512          },
     #endif
+    #if defined(WOLFSSL_SHAKE128) && !defined(WOLFSSL_NO_SHAKE128)
+    { "-shake128",           BENCH_SHAKE128          },
+    #endif
+    #if defined(WOLFSSL_SHAKE256) && !defined(WOLFSSL_NO_SHAKE256)
+    { "-shake256",           BENCH_SHAKE256          },
+    #endif
 #endif
 #ifdef WOLFSSL_RIPEMD
     { "-ripemd",             BENCH_RIPEMD            },
 #endif
 #ifdef HAVE_BLAKE2
     { "-blake2b",            BENCH_BLAKE2B           },
+    { "-blake2bp",           BENCH_BLAKE2BP          },
 #endif
 #ifdef HAVE_BLAKE2S
     { "-blake2s",            BENCH_BLAKE2S           },
+    { "-blake2sp",           BENCH_BLAKE2SP          },
 #endif
     { NULL, 0}
 };
@@ -468,6 +484,9 @@ static const bench_alg bench_asym_opt[] = {
 #ifndef NO_DH
     { "-dh",                 BENCH_DH                },
 #endif
+#if defined(WOLFSSL_PUBLIC_MP) && !defined(WOLFSSL_SP_MATH)
+    { "-modexp",             BENCH_MODEXP            },
+#endif
 #ifdef HAVE_NTRU
     { "-ntru",               BENCH_NTRU              },
     { "-ntru-kg",            BENCH_NTRU_KEYGEN       },
@@ -532,7 +551,7 @@ static int lng_index = 0;
 
 #ifndef NO_MAIN_DRIVER
 #ifndef MAIN_NO_ARGS
-static const char* bench_Usage_msg1[][16] = {
+static const char* bench_Usage_msg1[][18] = {
     /* 0 English  */
     {   "-? <num>    Help, print this usage\n            0: English, 1: Japanese\n",
         "-csv        Print terminal output in csv format\n",
@@ -543,8 +562,10 @@ static const char* bench_Usage_msg1[][16] = {
         "<keySz> -rsa-sz\n            Measure RSA <key size> performance.\n",
         "-ffhdhe2048 Measure DH using FFDHE 2048-bit parameters.\n",
         "-ffhdhe3072 Measure DH using FFDHE 3072-bit parameters.\n",
+        "-ffhdhe8192 Measure DH using FFDHE 8192-bit parameters.\n",
         "-p256       Measure ECC using P-256 curve.\n",
         "-p384       Measure ECC using P-384 curve.\n",
+        "-p521       Measure ECC using P-521 curve.\n",
         "-<alg>      Algorithm to benchmark. Available algorithms include:\n",
         "-lng <num>  Display benchmark result by specified language.\n            0: English, 1: Japanese\n",
         "<num>       Size of block in bytes\n",
@@ -562,8 +583,10 @@ static const char* bench_Usage_msg1[][16] = {
         "<keySz> -rsa-sz\n            RSA <key size> の性能を測定します。\n",
         "-ffhdhe2048 Measure DH using FFDHE 2048-bit parameters.\n",
         "-ffhdhe3072 Measure DH using FFDHE 3072-bit parameters.\n",
+        "-ffhdhe8192 Measure DH using FFDHE 8192-bit parameters.\n",
         "-p256       Measure ECC using P-256 curve.\n",
         "-p384       Measure ECC using P-384 curve.\n",
+        "-p521       Measure ECC using P-521 curve.\n",
         "-<alg>      アルゴリズムのベンチマークを実施します。\n            利用可能なアルゴリズムは下記を含みます:\n",
         "-lng <num>  指定された言語でベンチマーク結果を表示します。\n            0: 英語、 1: 日本語\n",
         "<num>       ブロックサイズをバイト単位で指定します。\n",
@@ -1649,6 +1672,14 @@ static void* benchmarks_do(void* args)
     #endif
     }
     #endif /* WOLFSSL_NOSHA3_512 */
+    #if defined(WOLFSSL_SHAKE128) && !defined(WOLFSSL_NO_SHAKE128)
+    if (bench_all || (bench_digest_algs & BENCH_SHAKE128))
+        bench_shake128();
+    #endif
+    #if defined(WOLFSSL_SHAKE256) && !defined(WOLFSSL_NO_SHAKE256)
+    if (bench_all || (bench_digest_algs & BENCH_SHAKE256))
+        bench_shake256();
+    #endif
 #endif
 #ifdef WOLFSSL_RIPEMD
     if (bench_all || (bench_digest_algs & BENCH_RIPEMD))
@@ -1657,10 +1688,14 @@ static void* benchmarks_do(void* args)
 #ifdef HAVE_BLAKE2
     if (bench_all || (bench_digest_algs & BENCH_BLAKE2B))
         bench_blake2b();
+    if (bench_all || (bench_digest_algs & BENCH_BLAKE2BP))
+        bench_blake2bp();
 #endif
 #ifdef HAVE_BLAKE2S
     if (bench_all || (bench_digest_algs & BENCH_BLAKE2S))
         bench_blake2s();
+    if (bench_all || (bench_digest_algs & BENCH_BLAKE2SP))
+        bench_blake2sp();
 #endif
 #ifdef WOLFSSL_CMAC
     if (bench_all || (bench_mac_algs & BENCH_CMAC))
@@ -1803,6 +1838,12 @@ static void* benchmarks_do(void* args)
     }
 #endif
 
+#if defined(WOLFSSL_PUBLIC_MP) && !defined(WOLFSSL_SP_MATH)
+    if (bench_asym_algs & BENCH_MODEXP) {
+        bench_modexp();
+    }
+#endif
+
 #ifdef HAVE_NTRU
     if (bench_all || (bench_asym_algs & BENCH_NTRU))
         bench_ntru();
@@ -2192,11 +2233,70 @@ exit:
     }
 }
 
+#if !defined(NO_HMAC) && !defined(HAVE_FIPS) && !defined(HAVE_SELFTEST) && \
+    (!defined(NO_SHA) || !defined(NO_SHA256))
+/* AES-CBC encryption with HMAC of the plaintext in one pass */
+static void bench_aescbc_hmac(const byte* key, word32 keySz, const byte* iv,
+                              int type, const char* label)
+{
+    int    ret, count = 0, times;
+    Aes    enc;
+    Hmac   hmac;
+    byte   digest[WC_MAX_DIGEST_SIZE];
+    double start;
+
+    ret = wc_AesInit(&enc, HEAP_HINT, INVALID_DEVID);
+    if (ret == 0)
+        ret = wc_AesSetKey(&enc, key, keySz, iv, AES_ENCRYPTION);
+    if (ret != 0) {
+        printf("AesSetKey failed, ret = %d\n", ret);
+        return;
+    }
+    ret = wc_HmacInit(&hmac, HEAP_HINT, INVALID_DEVID);
+    if (ret == 0)
+        ret = wc_HmacSetKey(&hmac, type, key, keySz);
+    if (ret != 0) {
+        printf("HmacSetKey failed, ret = %d\n", ret);
+        wc_AesFree(&enc);
+        return;
+    }
+
+    bench_stats_start(&count, &start);
+    do {
+        for (times = 0; times < numBlocks; times++) {
+            ret = wc_HmacUpdate_AesCbcEncrypt(&hmac, &enc, bench_cipher,
+                                              bench_plain, BENCH_SIZE);
+            if (ret != 0)
+                break;
+        }
+        if (ret == 0)
+            ret = wc_HmacFinal(&hmac, digest);
+        count += times;
+    } while (ret == 0 && bench_stats_sym_check(start));
+    bench_stats_sym_finish(label, 0, count, bench_size, start, ret);
+
+    wc_HmacFree(&hmac);
+    wc_AesFree(&enc);
+}
+#endif
+
 void bench_aescbc(int doAsync)
 {
 #ifdef WOLFSSL_AES_128
     bench_aescbc_internal(doAsync, bench_key, 16, bench_iv,
                  "AES-128-CBC-enc", "AES-128-CBC-dec");
+#if !defined(NO_HMAC) && !defined(HAVE_FIPS) && !defined(HAVE_SELFTEST)
+    if (!doAsync) {
+    #ifndef NO_SHA
+        bench_aescbc_hmac(bench_key, 16, bench_iv, WC_SHA,
+                          "AES-128-CBC-HMAC-SHA");
+    #endif
+    #ifndef NO_SHA256
+        bench_aescbc_hmac(bench_key, 16, bench_iv, WC_SHA256,
+                          "AES-128-CBC-HMAC-SHA256");
+    #endif
+    }
+#endif
 #endif
 #ifdef WOLFSSL_AES_192
     bench_aescbc_internal(doAsync, bench_key, 24, bench_iv,
@@ -2338,6 +2438,80 @@ exit:
     FREE_VAR(bench_tag, HEAP_HINT);
 }
 
+/* TLS record sized messages, each with its own nonce, AAD and tag */
+static void bench_aesgcm_records(const byte* key, word32 keySz, word32 recSz,
+                                 const char* encLabel, const char* decLabel)
+{
+    Aes    aes;
+    double start;
+    int    i, count, ret;
+    word32 j;
+    word32 sz = (BENCH_SIZE / recSz) * recSz;
+    byte   iv[GCM_NONCE_MID_SZ];
+    byte   aad[AES_AUTH_ADD_SZ];
+    byte*  tag;
+
+    if (sz == 0)
+        return;
+    tag = (byte*)XMALLOC(sz / recSz * AES_BLOCK_SIZE, HEAP_HINT,
+                         DYNAMIC_TYPE_TMP_BUFFER);
+    if (tag == NULL)
+        return;
+
+    XMEMCPY(iv, bench_iv, sizeof(iv));
+    XMEMSET(aad, 0, sizeof(aad));
+    ret = wc_AesInit(&aes, HEAP_HINT, INVALID_DEVID);
+    if (ret == 0)
+        ret = wc_AesGcmSetKey(&aes, key, keySz);
+    if (ret != 0) {
+        printf("AesGcmSetKey failed, ret = %d\n", ret);
+        goto exit;
+    }
+
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < numBlocks; i++) {
+            for (j = 0; j < sz; j += recSz) {
+                iv[sizeof(iv) - 1] = (byte)(j / recSz);
+                ret = wc_AesGcmEncrypt(&aes, bench_cipher + j, bench_plain + j,
+                        recSz, iv, sizeof(iv), tag + j / recSz * AES_BLOCK_SIZE,
+                        AES_BLOCK_SIZE, aad, sizeof(aad));
+                if (ret != 0) {
+                    printf("wc_AesGcmEncrypt failed, ret = %d\n", ret);
+                    goto exit;
+                }
+            }
+        }
+        count += i;
+    } while (bench_stats_sym_check(start));
+    bench_stats_sym_finish(encLabel, 0, count, sz, start, ret);
+
+#ifdef HAVE_AES_DECRYPT
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < numBlocks; i++) {
+            for (j = 0; j < sz; j += recSz) {
+                iv[sizeof(iv) - 1] = (byte)(j / recSz);
+                ret = wc_AesGcmDecrypt(&aes, bench_plain + j, bench_cipher + j,
+                        recSz, iv, sizeof(iv), tag + j / recSz * AES_BLOCK_SIZE,
+                        AES_BLOCK_SIZE, aad, sizeof(aad));
+                if (ret != 0) {
+                    printf("wc_AesGcmDecrypt failed, ret = %d\n", ret);
+                    goto exit;
+                }
+            }
+        }
+        count += i;
+    } while (bench_stats_sym_check(start));
+    bench_stats_sym_finish(decLabel, 0, count, sz, start, ret);
+#endif
+    (void)decLabel;
+
+exit:
+    wc_AesFree(&aes);
+    XFREE(tag, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+}
+
 void bench_aesgcm(int doAsync)
 {
 #if defined(WOLFSSL_AES_128) && !defined(WOLFSSL_AFALG_XILINX_AES) \
@@ -2354,6 +2528,15 @@ void bench_aesgcm(int doAsync)
     bench_aesgcm_internal(doAsync, bench_key, 32, bench_iv, 12,
                           "AES-256-GCM-enc", "AES-256-GCM-dec");
 #endif
+#if defined(WOLFSSL_AES_128) && !defined(WOLFSSL_AFALG_XILINX_AES) \
+	&& !defined(WOLFSSL_XILINX_CRYPT)
+    if (!doAsync) {
+        bench_aesgcm_records(bench_key, 16, 16384,
+                             "AES-128-GCM-16K-enc", "AES-128-GCM-16K-dec");
+        bench_aesgcm_records(bench_key, 16, 1024,
+                             "AES-128-GCM-1K-enc", "AES-128-GCM-1K-dec");
+    }
+#endif
 }
 #endif /* HAVE_AESGCM */
 
@@ -2552,6 +2735,64 @@ void bench_aesofb(void)
 
 
 #ifdef WOLFSSL_AES_XTS
+/* disk sized data units, each sector has the next tweak */
+static void bench_aesxts_sectors(const byte* key, word32 keySz,
+                                 word32 sectorSz, const char* encLabel,
+                                 const char* decLabel)
+{
+    XtsAes aes;
+    double start;
+    int    i, count, ret;
+    word32 sz = (BENCH_SIZE / sectorSz) * sectorSz;
+
+    if (sz == 0)
+        return;
+
+    ret = wc_AesXtsSetKey(&aes, key, keySz, AES_ENCRYPTION, HEAP_HINT, devId);
+    if (ret != 0) {
+        printf("wc_AesXtsSetKey failed, ret = %d\n", ret);
+        return;
+    }
+
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < numBlocks; i++) {
+            if ((ret = wc_AesXtsEncryptConsecutiveSectors(&aes, bench_cipher,
+                            bench_plain, sz, (word64)i * (sz / sectorSz),
+                            sectorSz)) != 0) {
+                printf("wc_AesXtsEncryptConsecutiveSectors failed, "
+                       "ret = %d\n", ret);
+                return;
+            }
+        }
+        count += i;
+    } while (bench_stats_sym_check(start));
+    bench_stats_sym_finish(encLabel, 0, count, sz, start, ret);
+    wc_AesXtsFree(&aes);
+
+    ret = wc_AesXtsSetKey(&aes, key, keySz, AES_DECRYPTION, HEAP_HINT, devId);
+    if (ret != 0) {
+        printf("wc_AesXtsSetKey failed, ret = %d\n", ret);
+        return;
+    }
+
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < numBlocks; i++) {
+            if ((ret = wc_AesXtsDecryptConsecutiveSectors(&aes, bench_plain,
+                            bench_cipher, sz, (word64)i * (sz / sectorSz),
+                            sectorSz)) != 0) {
+                printf("wc_AesXtsDecryptConsecutiveSectors failed, "
+                       "ret = %d\n", ret);
+                return;
+            }
+        }
+        count += i;
+    } while (bench_stats_sym_check(start));
+    bench_stats_sym_finish(decLabel, 0, count, sz, start, ret);
+    wc_AesXtsFree(&aes);
+}
+
 void bench_aesxts(void)
 {
     XtsAes aes;
@@ -2612,6 +2853,11 @@ void bench_aesxts(void)
     } while (bench_stats_sym_check(start));
     bench_stats_sym_finish("AES-XTS-dec", 0, count, bench_size, start, ret);
     wc_AesXtsFree(&aes);
+
+    bench_aesxts_sectors(k1, sizeof(k1), 512, "AES-XTS-512-enc",
+                         "AES-XTS-512-dec");
+    bench_aesxts_sectors(k1, sizeof(k1), 4096, "AES-XTS-4K-enc",
+                         "AES-XTS-4K-dec");
 }
 #endif /* WOLFSSL_AES_XTS */
 
@@ -3263,6 +3509,67 @@ exit:
 #endif
 
 #ifndef NO_SHA256
+/* Many short messages, hashed one after another and as a multi-buffer batch */
+static void bench_sha256_batch(word32 msgSz, const char* seqLabel,
+                               const char* mbLabel)
+{
+    wc_Sha256 hash;
+    double start;
+    int    i, count, ret = 0;
+    word32 j;
+    word32 cnt = BENCH_SIZE / msgSz;
+    const byte** data;
+    word32* sz;
+    byte**  digest;
+
+    if (cnt == 0)
+        return;
+    data = (const byte**)XMALLOC(cnt * (sizeof(byte*) * 2 + sizeof(word32)),
+                                 HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (data == NULL)
+        return;
+    digest = (byte**)(data + cnt);
+    sz = (word32*)(digest + cnt);
+    for (j = 0; j < cnt; j++) {
+        data[j] = bench_plain + j * msgSz;
+        sz[j] = msgSz;
+        /* digests overwrite the ciphertext buffer */
+        digest[j] = bench_cipher + (j % (BENCH_SIZE / WC_SHA256_DIGEST_SIZE)) *
+                                   WC_SHA256_DIGEST_SIZE;
+    }
+
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < numBlocks; i++) {
+            for (j = 0; j < cnt; j++) {
+                ret = wc_InitSha256_ex(&hash, HEAP_HINT, INVALID_DEVID);
+                ret |= wc_Sha256Update(&hash, data[j], msgSz);
+                ret |= wc_Sha256Final(&hash, digest[j]);
+                if (ret != 0)
+                    goto exit_seq;
+            }
+        }
+        count += i;
+    } while (bench_stats_sym_check(start));
+exit_seq:
+    bench_stats_sym_finish(seqLabel, 0, count, cnt * msgSz, start, ret);
+    wc_Sha256Free(&hash);
+
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < numBlocks; i++) {
+            ret = wc_Sha256MultiBuffer(data, sz, digest, cnt);
+            if (ret != 0)
+                goto exit_mb;
+        }
+        count += i;
+    } while (bench_stats_sym_check(start));
+exit_mb:
+    bench_stats_sym_finish(mbLabel, 0, count, cnt * msgSz, start, ret);
+
+    XFREE(data, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+}
+
 void bench_sha256(int doAsync)
 {
     wc_Sha256 hash[BENCH_MAX_PENDING];
@@ -3335,6 +3642,11 @@ void bench_sha256(int doAsync)
 exit_sha256:
     bench_stats_sym_finish("SHA-256", doAsync, count, bench_size, start, ret);
 
+    if (!doAsync) {
+        bench_sha256_batch(64, "SHA-256-64", "SHA-256-MB-64");
+        bench_sha256_batch(1024, "SHA-256-1K", "SHA-256-MB-1K");
+    }
+
 exit:
 
     for (i = 0; i < BENCH_MAX_PENDING; i++) {
@@ -3588,6 +3900,68 @@ exit:
 #endif /* WOLFSSL_NOSHA3_224 */
 
 #ifndef WOLFSSL_NOSHA3_256
+/* Many short messages, hashed one after another and as a multi-buffer batch */
+static void bench_sha3_256_batch(word32 msgSz, const char* seqLabel,
+                                 const char* mbLabel)
+{
+    wc_Sha3 hash;
+    double start;
+    int    i, count, ret = 0;
+    word32 j;
+    word32 cnt = BENCH_SIZE / msgSz;
+    const byte** data;
+    word32* sz;
+    byte**  digest;
+
+    if (cnt == 0)
+        return;
+    data = (const byte**)XMALLOC(cnt * (sizeof(byte*) * 2 + sizeof(word32)),
+                                 HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (data == NULL)
+        return;
+    digest = (byte**)(data + cnt);
+    sz = (word32*)(digest + cnt);
+    for (j = 0; j < cnt; j++) {
+        data[j] = bench_plain + j * msgSz;
+        sz[j] = msgSz;
+        /* digests overwrite the ciphertext buffer */
+        digest[j] = bench_cipher +
+                    (j % (BENCH_SIZE / WC_SHA3_256_DIGEST_SIZE)) *
+                    WC_SHA3_256_DIGEST_SIZE;
+    }
+
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < numBlocks; i++) {
+            for (j = 0; j < cnt; j++) {
+                ret = wc_InitSha3_256(&hash, HEAP_HINT, INVALID_DEVID);
+                ret |= wc_Sha3_256_Update(&hash, data[j], msgSz);
+                ret |= wc_Sha3_256_Final(&hash, digest[j]);
+                if (ret != 0)
+                    goto exit_seq;
+            }
+        }
+        count += i;
+    } while (bench_stats_sym_check(start));
+exit_seq:
+    bench_stats_sym_finish(seqLabel, 0, count, cnt * msgSz, start, ret);
+    wc_Sha3_256_Free(&hash);
+
+    bench_stats_start(&count, &start);
+    do {
+        for (i = 0; i < numBlocks; i++) {
+            ret = wc_Sha3_256_MultiBuffer(data, sz, digest, cnt);
+            if (ret != 0)
+                goto exit_mb;
+        }
+        count += i;
+    } while (bench_stats_sym_check(start));
+exit_mb:
+    bench_stats_sym_finish(mbLabel, 0, count, cnt * msgSz, start, ret);
+
+    XFREE(data, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+}
+
 void bench_sha3_256(int doAsync)
 {
     wc_Sha3   hash[BENCH_MAX_PENDING];
@@ -3657,6 +4031,11 @@ void bench_sha3_256(int doAsync)
 exit_sha3_256:
     bench_stats_sym_finish("SHA3-256", doAsync, count, bench_size, start, ret);
 
+    if (!doAsync) {
+        bench_sha3_256_batch(64, "SHA3-256-64", "SHA3-256-MB-64");
+        bench_sha3_256_batch(1024, "SHA3-256-1K", "SHA3-256-MB-1K");
+    }
+
 exit:
 
     for (i = 0; i < BENCH_MAX_PENDING; i++) {
@@ -3826,6 +4205,100 @@ exit:
     FREE_ARRAY(digest, BENCH_MAX_PENDING, HEAP_HINT);
 }
 #endif /* WOLFSSL_NOSHA3_512 */
+
+#if defined(WOLFSSL_SHAKE128) && !defined(WOLFSSL_NO_SHAKE128)
+void bench_shake128(void)
+{
+    wc_Shake shake;
+    byte     digest[32];
+    double   start;
+    int      ret = 0, i, count;
+
+    ret = wc_InitShake128(&shake, HEAP_HINT, INVALID_DEVID);
+    if (ret != 0) {
+        printf("InitShake128 failed, ret = %d\n", ret);
+        return;
+    }
+
+    if (digest_stream) {
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < numBlocks; i++) {
+                ret = wc_Shake128_Update(&shake, bench_plain, BENCH_SIZE);
+                if (ret != 0)
+                    goto exit_shake128;
+            }
+            ret = wc_Shake128_Final(&shake, digest, sizeof(digest));
+            if (ret != 0)
+                goto exit_shake128;
+            count += i;
+        } while (bench_stats_sym_check(start));
+    }
+    else {
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < numBlocks; i++) {
+                ret = wc_Shake128_Update(&shake, bench_plain, BENCH_SIZE);
+                ret |= wc_Shake128_Final(&shake, digest, sizeof(digest));
+                if (ret != 0)
+                    goto exit_shake128;
+            }
+            count += i;
+        } while (bench_stats_sym_check(start));
+    }
+exit_shake128:
+    bench_stats_sym_finish("SHAKE128", 0, count, bench_size, start, ret);
+
+    wc_Shake128_Free(&shake);
+}
+#endif
+
+#if defined(WOLFSSL_SHAKE256) && !defined(WOLFSSL_NO_SHAKE256)
+void bench_shake256(void)
+{
+    wc_Shake shake;
+    byte     digest[64];
+    double   start;
+    int      ret = 0, i, count;
+
+    ret = wc_InitShake256(&shake, HEAP_HINT, INVALID_DEVID);
+    if (ret != 0) {
+        printf("InitShake256 failed, ret = %d\n", ret);
+        return;
+    }
+
+    if (digest_stream) {
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < numBlocks; i++) {
+                ret = wc_Shake256_Update(&shake, bench_plain, BENCH_SIZE);
+                if (ret != 0)
+                    goto exit_shake256;
+            }
+            ret = wc_Shake256_Final(&shake, digest, sizeof(digest));
+            if (ret != 0)
+                goto exit_shake256;
+            count += i;
+        } while (bench_stats_sym_check(start));
+    }
+    else {
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < numBlocks; i++) {
+                ret = wc_Shake256_Update(&shake, bench_plain, BENCH_SIZE);
+                ret |= wc_Shake256_Final(&shake, digest, sizeof(digest));
+                if (ret != 0)
+                    goto exit_shake256;
+            }
+            count += i;
+        } while (bench_stats_sym_check(start));
+    }
+exit_shake256:
+    bench_stats_sym_finish("SHAKE256", 0, count, bench_size, start, ret);
+
+    wc_Shake256_Free(&shake);
+}
+#endif
 #endif
 
 
@@ -3943,6 +4416,63 @@ void bench_blake2b(void)
     }
     bench_stats_sym_finish("BLAKE2b", 0, count, bench_size, start, ret);
 }
+
+void bench_blake2bp(void)
+{
+    Blake2bp b2bp;
+    byte    digest[64];
+    double  start;
+    int     ret = 0, i, count;
+
+    if (digest_stream) {
+        ret = wc_InitBlake2bp(&b2bp, 64);
+        if (ret != 0) {
+            printf("InitBlake2bp failed, ret = %d\n", ret);
+            return;
+        }
+
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < numBlocks; i++) {
+                ret = wc_Blake2bpUpdate(&b2bp, bench_plain, BENCH_SIZE);
+                if (ret != 0) {
+                    printf("Blake2bpUpdate failed, ret = %d\n", ret);
+                    return;
+                }
+            }
+            ret = wc_Blake2bpFinal(&b2bp, digest, 64);
+            if (ret != 0) {
+                printf("Blake2bpFinal failed, ret = %d\n", ret);
+                return;
+            }
+            count += i;
+        } while (bench_stats_sym_check(start));
+    }
+    else {
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < numBlocks; i++) {
+                ret = wc_InitBlake2bp(&b2bp, 64);
+                if (ret != 0) {
+                    printf("InitBlake2bp failed, ret = %d\n", ret);
+                    return;
+                }
+                ret = wc_Blake2bpUpdate(&b2bp, bench_plain, BENCH_SIZE);
+                if (ret != 0) {
+                    printf("Blake2bpUpdate failed, ret = %d\n", ret);
+                    return;
+                }
+                ret = wc_Blake2bpFinal(&b2bp, digest, 64);
+                if (ret != 0) {
+                    printf("Blake2bpFinal failed, ret = %d\n", ret);
+                    return;
+                }
+            }
+            count += i;
+        } while (bench_stats_sym_check(start));
+    }
+    bench_stats_sym_finish("BLAKE2bp", 0, count, bench_size, start, ret);
+}
 #endif
 
 #if defined(HAVE_BLAKE2S)
@@ -4002,6 +4532,63 @@ void bench_blake2s(void)
     }
     bench_stats_sym_finish("BLAKE2s", 0, count, bench_size, start, ret);
 }
+
+void bench_blake2sp(void)
+{
+    Blake2sp b2sp;
+    byte    digest[32];
+    double  start;
+    int     ret = 0, i, count;
+
+    if (digest_stream) {
+        ret = wc_InitBlake2sp(&b2sp, 32);
+        if (ret != 0) {
+            printf("InitBlake2sp failed, ret = %d\n", ret);
+            return;
+        }
+
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < numBlocks; i++) {
+                ret = wc_Blake2spUpdate(&b2sp, bench_plain, BENCH_SIZE);
+                if (ret != 0) {
+                    printf("Blake2spUpdate failed, ret = %d\n", ret);
+                    return;
+                }
+            }
+            ret = wc_Blake2spFinal(&b2sp, digest, 32);
+            if (ret != 0) {
+                printf("Blake2spFinal failed, ret = %d\n", ret);
+                return;
+            }
+            count += i;
+        } while (bench_stats_sym_check(start));
+    }
+    else {
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < numBlocks; i++) {
+                ret = wc_InitBlake2sp(&b2sp, 32);
+                if (ret != 0) {
+                    printf("InitBlake2sp failed, ret = %d\n", ret);
+                    return;
+                }
+                ret = wc_Blake2spUpdate(&b2sp, bench_plain, BENCH_SIZE);
+                if (ret != 0) {
+                    printf("Blake2spUpdate failed, ret = %d\n", ret);
+                    return;
+                }
+                ret = wc_Blake2spFinal(&b2sp, digest, 32);
+                if (ret != 0) {
+                    printf("Blake2spFinal failed, ret = %d\n", ret);
+                    return;
+                }
+            }
+            count += i;
+        } while (bench_stats_sym_check(start));
+    }
+    bench_stats_sym_finish("BLAKE2sp", 0, count, bench_size, start, ret);
+}
 #endif
 
 
@@ -4812,7 +5399,11 @@ exit_bench_rsa_key:
     #endif
 #endif
 
+#ifdef HAVE_FFDHE_8192
+#define BENCH_DH_KEY_SIZE  1024 /* for 8192 bit */
+#else
 #define BENCH_DH_KEY_SIZE  384 /* for 3072 bit */
+#endif
 #define BENCH_DH_PRIV_SIZE (BENCH_DH_KEY_SIZE/8)
 
 void bench_dh(int doAsync)
@@ -4877,6 +5468,12 @@ void bench_dh(int doAsync)
         dhKeySz = 3072;
     }
 #endif
+#ifdef HAVE_FFDHE_8192
+    else if (use_ffdhe == 8192) {
+        params = wc_Dh_ffdhe8192_Get();
+        dhKeySz = 8192;
+    }
+#endif
 
     /* clear for done cleanup */
     XMEMSET(dhKey, 0, sizeof(dhKey));
@@ -4899,7 +5496,8 @@ void bench_dh(int doAsync)
             ret = wc_DhKeyDecode(tmp, &idx, &dhKey[i], (word32)bytes);
     #endif
         }
-    #if defined(HAVE_FFDHE_2048) || defined(HAVE_FFDHE_3072)
+    #if defined(HAVE_FFDHE_2048) || defined(HAVE_FFDHE_3072) || \
+        defined(HAVE_FFDHE_8192)
         else if (params != NULL) {
             ret = wc_DhSetKey(&dhKey[i], params->p, params->p_len, params->g,
                                                                  params->g_len);
@@ -4979,6 +5577,79 @@ exit:
 }
 #endif /* !NO_DH */
 
+#if defined(WOLFSSL_PUBLIC_MP) && !defined(WOLFSSL_SP_MATH)
+/* Modular exponentiation with a full size exponent over a range of odd
+ * modulus sizes. */
+void bench_modexp(void)
+{
+    static const int sizes[] = { 1024, 1536, 2048, 2560, 3072, 4096, 6144,
+                                 8192 };
+    mp_int p, g, e, r;
+    double start;
+    int    ret, i, j, sz, count;
+    DECLARE_VAR(buf, byte, 1024, HEAP_HINT);
+
+    ret = mp_init_multi(&p, &g, &e, &r, NULL, NULL);
+    if (ret != MP_OKAY) {
+        printf("mp_init_multi failed: %d\n", ret);
+        FREE_VAR(buf, HEAP_HINT);
+        return;
+    }
+
+    for (j = 0; j < (int)(sizeof(sizes) / sizeof(*sizes)); j++) {
+    #ifdef USE_FAST_MATH
+        if (sizes[j] > FP_MAX_BITS / 2)
+            break;
+    #endif
+        sz = sizes[j] / 8;
+
+        /* Odd modulus with top bit set, base less than modulus. */
+        ret = wc_RNG_GenerateBlock(&gRng, buf, sz);
+        if (ret == 0) {
+            buf[0] |= 0x80;
+            buf[sz - 1] |= 0x01;
+            ret = mp_read_unsigned_bin(&p, buf, sz);
+        }
+        if (ret == 0)
+            ret = wc_RNG_GenerateBlock(&gRng, buf, sz);
+        if (ret == 0) {
+            buf[0] &= 0x7f;
+            ret = mp_read_unsigned_bin(&g, buf, sz);
+        }
+        if (ret == 0)
+            ret = wc_RNG_GenerateBlock(&gRng, buf, sz);
+        if (ret == 0)
+            ret = mp_read_unsigned_bin(&e, buf, sz);
+        if (ret != 0) {
+            printf("modexp setup failed: %d\n", ret);
+            break;
+        }
+
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < ntimes; i++) {
+                ret = mp_exptmod(&g, &e, &p, &r);
+                if (ret != MP_OKAY) {
+                    printf("mp_exptmod failed: %d\n", ret);
+                    break;
+                }
+            }
+            count += i;
+        } while (bench_stats_sym_check(start));
+        bench_stats_asym_finish("MODEXP", sizes[j], "exptmod", 0, count, start,
+                                                                          ret);
+        if (ret != MP_OKAY)
+            break;
+    }
+
+    mp_clear(&r);
+    mp_clear(&e);
+    mp_clear(&g);
+    mp_clear(&p);
+    FREE_VAR(buf, HEAP_HINT);
+}
+#endif /* WOLFSSL_PUBLIC_MP && !WOLFSSL_SP_MATH */
+
 #ifdef HAVE_NTRU
 byte GetEntropy(ENTROPY_CMD cmd, byte* out);
 
@@ -5196,7 +5867,9 @@ void bench_ntruKeyGen(void)
 #ifdef HAVE_ECC
 
 #ifndef BENCH_ECC_SIZE
-    #ifdef HAVE_ECC384
+    #ifdef HAVE_ECC521
+        #define BENCH_ECC_SIZE  66
+    #elif defined(HAVE_ECC384)
         #define BENCH_ECC_SIZE  48
     #else
         #define BENCH_ECC_SIZE  32
@@ -5398,6 +6071,37 @@ exit_ecdsa_sign:
     } while (bench_stats_sym_check(start));
 exit_ecdsa_verify:
     bench_stats_asym_finish("ECDSA", keySize * 8, desc[5], doAsync, count, start, ret);
+
+#ifdef WC_ECC_PRECOMP
+    /* ECC Verify with a table of public key points - not for all curves */
+    for (i = 0; i < BENCH_MAX_PENDING; i++) {
+        if (wc_ecc_set_precompute(&genKey[i], ECC_PRECOMP_MAX_BITS) != 0)
+            goto exit;
+    }
+
+    bench_stats_start(&count, &start);
+    do {
+        for (times = 0; times < agreeTimes || pending > 0; ) {
+            bench_async_poll(&pending);
+
+            /* while free pending slots in queue, submit ops */
+            for (i = 0; i < BENCH_MAX_PENDING; i++) {
+                if (bench_async_check(&ret, BENCH_ASYNC_GET_DEV(&genKey[i]), 1, &times, agreeTimes, &pending)) {
+                    if (genKey[i].state == 0)
+                        verify[i] = 0;
+                    ret = wc_ecc_verify_hash(sig[i], x[i], digest[i],
+                                        (word32)keySize, &verify[i], &genKey[i]);
+                    if (!bench_async_handle(&ret, BENCH_ASYNC_GET_DEV(&genKey[i]), 1, &times, &pending)) {
+                        goto exit_ecdsa_verify_table;
+                    }
+                }
+            } /* for i */
+        } /* for times */
+        count += times;
+    } while (bench_stats_sym_check(start));
+exit_ecdsa_verify_table:
+    bench_stats_asym_finish("ECDSA", keySize * 8, "verify/table", doAsync, count, start, ret);
+#endif /* WC_ECC_PRECOMP */
 #endif /* HAVE_ECC_VERIFY */
 #endif /* !NO_ASN && HAVE_ECC_SIGN */
 
@@ -5574,6 +6278,118 @@ exit:
 #endif /* HAVE_CURVE25519 */
 
 #ifdef HAVE_ED25519
+#if defined(HAVE_ED25519_SIGN) && defined(HAVE_ED25519_VERIFY)
+#define BENCH_ED25519_BATCH_MAX    1024
+
+/* Verify batches of signatures, each made with a different key */
+static void bench_ed25519VerifyBatch(void)
+{
+    static const word32 batchSz[] = { 8, 16, 64, 256, 1024 };
+    int          ret = 0;
+    double       start;
+    int          i, j, count;
+    word32       k;
+    char         label[16];
+    ed25519_key* key = NULL;
+    ed25519_key** keys = NULL;
+    byte*        sig = NULL;
+    const byte** sigs = NULL;
+    word32*      sigLen = NULL;
+    byte*        msg = NULL;
+    const byte** msgs = NULL;
+    word32*      msgLen = NULL;
+    int*         res = NULL;
+    const char**desc = bench_desc_words[lng_index];
+
+    key = (ed25519_key*)XMALLOC(sizeof(ed25519_key) * BENCH_ED25519_BATCH_MAX,
+                                                   HEAP_HINT, DYNAMIC_TYPE_ED25519);
+    keys = (ed25519_key**)XMALLOC(sizeof(ed25519_key*) *
+                      BENCH_ED25519_BATCH_MAX, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    sig = (byte*)XMALLOC(ED25519_SIG_SIZE * BENCH_ED25519_BATCH_MAX, HEAP_HINT,
+                                                        DYNAMIC_TYPE_TMP_BUFFER);
+    sigs = (const byte**)XMALLOC(sizeof(byte*) * BENCH_ED25519_BATCH_MAX,
+                                             HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    sigLen = (word32*)XMALLOC(sizeof(word32) * BENCH_ED25519_BATCH_MAX,
+                                             HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    msg = (byte*)XMALLOC(BENCH_ED25519_BATCH_MAX + 64, HEAP_HINT,
+                                                        DYNAMIC_TYPE_TMP_BUFFER);
+    msgs = (const byte**)XMALLOC(sizeof(byte*) * BENCH_ED25519_BATCH_MAX,
+                                             HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    msgLen = (word32*)XMALLOC(sizeof(word32) * BENCH_ED25519_BATCH_MAX,
+                                             HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    res = (int*)XMALLOC(sizeof(int) * BENCH_ED25519_BATCH_MAX, HEAP_HINT,
+                                                        DYNAMIC_TYPE_TMP_BUFFER);
+    if (key == NULL || keys == NULL || sig == NULL || sigs == NULL ||
+            sigLen == NULL || msg == NULL || msgs == NULL || msgLen == NULL ||
+            res == NULL) {
+        ret = MEMORY_E;
+        goto exit;
+    }
+
+    /* make dummy msgs, one signature of each with a new key */
+    for (i = 0; i < BENCH_ED25519_BATCH_MAX + 64; i++)
+        msg[i] = (byte)i;
+    for (i = 0; i < BENCH_ED25519_BATCH_MAX; i++) {
+        keys[i] = &key[i];
+        msgs[i] = msg + i;
+        msgLen[i] = 64;
+        sigs[i] = sig + i * ED25519_SIG_SIZE;
+        sigLen[i] = ED25519_SIG_SIZE;
+        wc_ed25519_init(&key[i]);
+        ret = wc_ed25519_make_key(&gRng, ED25519_KEY_SIZE, &key[i]);
+        if (ret == 0) {
+            ret = wc_ed25519_sign_msg(msgs[i], msgLen[i],
+                         sig + i * ED25519_SIG_SIZE, &sigLen[i], &key[i]);
+        }
+        if (ret != 0) {
+            printf("ed25519 batch signing failed\n");
+            goto exit;
+        }
+    }
+
+    for (j = 0; j < (int)(sizeof(batchSz) / sizeof(*batchSz)); j++) {
+        XSNPRINTF(label, sizeof(label), "%s/%d", desc[5],
+                                                              (int)batchSz[j]);
+
+        bench_stats_start(&count, &start);
+        do {
+            for (i = 0; i < agreeTimes; i += batchSz[j]) {
+                ret = wc_ed25519_verify_msg_batch(sigs, sigLen, msgs, msgLen,
+                                                      res, keys, batchSz[j]);
+                for (k = 0; ret == 0 && k < batchSz[j]; k++) {
+                    if (res[k] != 1)
+                        ret = SIG_VERIFY_E;
+                }
+                if (ret != 0) {
+                    printf("ed25519_verify_msg_batch failed\n");
+                    goto exit_ed_batch;
+                }
+            }
+            count += i;
+        } while (bench_stats_sym_check(start));
+exit_ed_batch:
+        bench_stats_asym_finish("ED", 25519, label, 0, count, start, ret);
+        if (ret != 0)
+            break;
+    }
+
+exit:
+    if (key != NULL) {
+        for (i = 0; i < BENCH_ED25519_BATCH_MAX; i++)
+            wc_ed25519_free(&key[i]);
+    }
+    XFREE(res, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(msgLen, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(msgs, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(msg, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(sigLen, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(sigs, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(sig, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(keys, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(key, HEAP_HINT, DYNAMIC_TYPE_ED25519);
+}
+#endif /* HAVE_ED25519_SIGN && HAVE_ED25519_VERIFY */
+
 void bench_ed25519KeyGen(void)
 {
     ed25519_key genKey;
@@ -5652,6 +6468,8 @@ exit_ed_sign:
     } while (bench_stats_sym_check(start));
 exit_ed_verify:
     bench_stats_asym_finish("ED", 25519, desc[5], 0, count, start, ret);
+
+    bench_ed25519VerifyBatch();
 #endif /* HAVE_ED25519_VERIFY */
 #endif /* HAVE_ED25519_SIGN */
 
@@ -6099,14 +6917,20 @@ static void Usage(void)
 #if !defined(NO_DH) && defined(HAVE_FFDHE_3072)
     printf("%s", bench_Usage_msg1[lng_index][8]);    /* option -ffdhe3072 */
 #endif
+#if !defined(NO_DH) && defined(HAVE_FFDHE_8192)
+    printf("%s", bench_Usage_msg1[lng_index][9]);    /* option -ffdhe8192 */
+#endif
 #if defined(HAVE_ECC) && !defined(NO_ECC256)
-    printf("%s", bench_Usage_msg1[lng_index][9]);    /* option -p256 */
+    printf("%s", bench_Usage_msg1[lng_index][10]);   /* option -p256 */
 #endif
 #if defined(HAVE_ECC) && defined(HAVE_ECC384)
-    printf("%s", bench_Usage_msg1[lng_index][10]);   /* option -p384 */
+    printf("%s", bench_Usage_msg1[lng_index][11]);   /* option -p384 */
+#endif
+#if defined(HAVE_ECC) && defined(HAVE_ECC521)
+    printf("%s", bench_Usage_msg1[lng_index][12]);   /* option -p521 */
 #endif
 #ifndef WOLFSSL_BENCHMARK_ALL
-    printf("%s", bench_Usage_msg1[lng_index][11]);   /* option -<alg> */
+    printf("%s", bench_Usage_msg1[lng_index][13]);   /* option -<alg> */
     printf("             ");
     line = 13;
     for (i=0; bench_cipher_opt[i].str != NULL; i++)
@@ -6129,12 +6953,12 @@ static void Usage(void)
         print_alg(bench_other_opt[i].str + 1, &line);
     printf("\n");
 #endif
-    printf("%s", bench_Usage_msg1[lng_index][12]);   /* option -lng */
-    printf("%s", bench_Usage_msg1[lng_index][13]);   /* option <num> */
+    printf("%s", bench_Usage_msg1[lng_index][14]);   /* option -lng */
+    printf("%s", bench_Usage_msg1[lng_index][15]);   /* option <num> */
 #if defined(WOLFSSL_ASYNC_CRYPT) && !defined(WC_NO_ASYNC_THREADING)
-    printf("%s", bench_Usage_msg1[lng_index][14]);   /* option -threads <num> */
+    printf("%s", bench_Usage_msg1[lng_index][16]);   /* option -threads <num> */
 #endif
-    printf("%s", bench_Usage_msg1[lng_index][15]);   /* option -print */
+    printf("%s", bench_Usage_msg1[lng_index][17]);   /* option -print */
 }
 
 /* Match the command line argument with the string.
@@ -6222,6 +7046,10 @@ int main(int argc, char** argv)
         else if (string_matches(argv[1], "-ffdhe3072"))
             use_ffdhe = 3072;
 #endif
+#if !defined(NO_DH) && defined(HAVE_FFDHE_8192)
+        else if (string_matches(argv[1], "-ffdhe8192"))
+            use_ffdhe = 8192;
+#endif
 #if defined(HAVE_ECC) && !defined(NO_ECC256)
         else if (string_matches(argv[1], "-p256"))
             bench_ecc_size = 32;
@@ -6230,6 +7058,10 @@ int main(int argc, char** argv)
         else if (string_matches(argv[1], "-p384"))
             bench_ecc_size = 48;
 #endif
+#if defined(HAVE_ECC) && defined(HAVE_ECC521)
+        else if (string_matches(argv[1], "-p521"))
+            bench_ecc_size = 66;
+#endif
 #ifdef BENCH_ASYM
         else if (string_matches(argv[1], "-csv")) {
             csv_format = 1;
@@ -67,6 +67,8 @@ void bench_sha3_224(int);
 void bench_sha3_256(int);
 void bench_sha3_384(int);
 void bench_sha3_512(int);
+void bench_shake128(void);
+void bench_shake256(void);
 int  bench_ripemd(void);
 void bench_cmac(void);
 void bench_scrypt(void);
@@ -81,6 +83,7 @@ void bench_rsaKeyGen_size(int, int);
 void bench_rsa(int);
 void bench_rsa_key(int, int);
 void bench_dh(int);
+void bench_modexp(void);
 void bench_eccMakeKey(int);
 void bench_ecc(int);
 void bench_eccEncrypt(void);
@@ -96,7 +99,9 @@ void bench_ntru(void);
 void bench_ntruKeyGen(void);
 void bench_rng(void);
 void bench_blake2b(void);
+void bench_blake2bp(void);
 void bench_blake2s(void);
+void bench_blake2sp(void);
 void bench_pbkdf2(void);
 
 void bench_stats_print(void);
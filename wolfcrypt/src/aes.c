@@ -628,6 +628,12 @@
         #define XASM_LINK(f) asm(f)
     #endif /* _MSC_VER */
 
+    /* VAES and VPCLMULQDQ on ZMM registers */
+    #if defined(USE_INTEL_SPEEDUP) && !defined(NO_AVX512_SUPPORT) && \
+        !defined(_MSC_VER)
+        #define HAVE_INTEL_AVX512
+    #endif
+
     static int checkAESNI = 0;
     static int haveAESNI  = 0;
     static word32 intel_flags = 0;
@@ -678,6 +684,48 @@
                              XASM_LINK("AES_ECB_decrypt");
     #endif
 
+    #if defined(WOLFSSL_AES_COUNTER) && !defined(_MSC_VER)
+        void AES_CTR_encrypt(const unsigned char* in, unsigned char* out,
+                             unsigned long blocks, unsigned char* ctr,
+                             const unsigned char* KS, int nr)
+                             XASM_LINK("AES_CTR_encrypt");
+        #ifdef HAVE_INTEL_AVX512
+            void AES_CTR_encrypt_vaes(const unsigned char* in,
+                                      unsigned char* out, unsigned long blocks,
+                                      unsigned char* ctr,
+                                      const unsigned char* KS, int nr)
+                                      XASM_LINK("AES_CTR_encrypt_vaes");
+        #endif
+    #endif /* WOLFSSL_AES_COUNTER && !_MSC_VER */
+
+    #if defined(WOLFSSL_AES_XTS) && !defined(_MSC_VER)
+        void AES_XTS_encrypt(const unsigned char* in, unsigned char* out,
+                             unsigned long blocks, unsigned char* tweak,
+                             const unsigned char* KS, int nr)
+                             XASM_LINK("AES_XTS_encrypt");
+        #ifdef HAVE_AES_DECRYPT
+            void AES_XTS_decrypt(const unsigned char* in, unsigned char* out,
+                                 unsigned long blocks, unsigned char* tweak,
+                                 const unsigned char* KS, int nr)
+                                 XASM_LINK("AES_XTS_decrypt");
+        #endif
+    #endif /* WOLFSSL_AES_XTS && !_MSC_VER */
+
+    #if defined(HAVE_AESCCM) && !defined(_MSC_VER)
+        void AES_CCM_encrypt(const unsigned char* in, unsigned char* out,
+                             unsigned long blocks, unsigned char* ctr,
+                             unsigned char* mac, const unsigned char* KS,
+                             int nr)
+                             XASM_LINK("AES_CCM_encrypt");
+        #ifdef HAVE_AES_DECRYPT
+            void AES_CCM_decrypt(const unsigned char* in, unsigned char* out,
+                                 unsigned long blocks, unsigned char* ctr,
+                                 unsigned char* mac, const unsigned char* KS,
+                                 int nr)
+                                 XASM_LINK("AES_CCM_decrypt");
+        #endif
+    #endif /* HAVE_AESCCM && !_MSC_VER */
+
     void AES_128_Key_Expansion(const unsigned char* userkey,
                                unsigned char* key_schedule)
                                XASM_LINK("AES_128_Key_Expansion");
@@ -2801,7 +2849,7 @@ static void wc_AesDecrypt(Aes* aes, const byte* inBlock, byte* outBlock)
     }
 
     #if defined(WOLFSSL_AES_DIRECT) || defined(WOLFSSL_AES_COUNTER)
-        /* AES-CTR and AES-DIRECT need to use this for key setup, no aesni yet */
+        /* AES-CTR and AES-DIRECT need to use this for key setup */
         int wc_AesSetKeyDirect(Aes* aes, const byte* userKey, word32 keylen,
                             const byte* iv, int dir)
         {
@@ -2824,7 +2872,12 @@ static void wc_AesDecrypt(Aes* aes, const byte* inBlock, byte* outBlock)
                 keylen = localSz;
             }
         #endif
+        #ifdef WOLFSSL_AESNI
+            /* AES-NI key schedule when available, direct and CTR use it */
+            ret = wc_AesSetKey(aes, userKey, keylen, iv, dir);
+        #else
             ret = wc_AesSetKeyLocal(aes, userKey, keylen, iv, dir);
+        #endif
 
         #ifdef WOLFSSL_IMX6_CAAM_BLOB
             ForceZero(local, sizeof(local));
@@ -3921,6 +3974,61 @@ int wc_AesSetIV(Aes* aes, const byte* iv)
             }
         }
 
+    #if defined(WOLFSSL_AESNI) && !defined(_MSC_VER)
+        /* AES-NI - CTR Encrypt of whole blocks, several blocks interleaved.
+         * The assembly only adds to the low 64 bits of the counter so calls
+         * are split where they wrap and the carry is added here. */
+        static void AesCtrEncryptBlocks_AESNI(Aes* aes, byte* out,
+                                              const byte* in, word32 blocks)
+        {
+            byte* ctr = (byte*)aes->reg;
+
+            while (blocks > 0) {
+                word32 n = blocks;
+                word64 lo = 0;
+                int i;
+
+                for (i = AES_BLOCK_SIZE / 2; i < AES_BLOCK_SIZE; i++)
+                    lo = (lo << 8) | ctr[i];
+                if (lo != 0 && (word64)0 - lo < n)
+                    n = (word32)((word64)0 - lo);
+                blocks -= n;
+
+            #ifdef HAVE_INTEL_AVX512
+                if (n >= 4 && IS_INTEL_VAES(intel_flags) &&
+                        IS_INTEL_AVX512F(intel_flags) &&
+                        IS_INTEL_AVX512BW(intel_flags)) {
+                    word32 n4 = n & ~(word32)3;
+
+                    AES_CTR_encrypt_vaes(in, out, n4, ctr, (byte*)aes->key,
+                                         aes->rounds);
+                    in  += n4 * AES_BLOCK_SIZE;
+                    out += n4 * AES_BLOCK_SIZE;
+                    n   -= n4;
+                }
+            #endif
+                if (n > 0) {
+                    AES_CTR_encrypt(in, out, n, ctr, (byte*)aes->key,
+                                    aes->rounds);
+                    in  += n * AES_BLOCK_SIZE;
+                    out += n * AES_BLOCK_SIZE;
+                }
+
+                /* low 64 bits wrapped, carry into the high 64 bits */
+                for (i = AES_BLOCK_SIZE / 2; i < AES_BLOCK_SIZE; i++) {
+                    if (ctr[i] != 0)
+                        break;
+                }
+                if (i == AES_BLOCK_SIZE) {
+                    for (i = AES_BLOCK_SIZE / 2 - 1; i >= 0; i--) {
+                        if (++ctr[i])
+                            break;
+                    }
+                }
+            }
+        }
+    #endif /* WOLFSSL_AESNI && !_MSC_VER */
+
         /* Software AES - CTR Encrypt */
         int wc_AesCtrEncrypt(Aes* aes, byte* out, const byte* in, word32 sz)
         {
@@ -3939,6 +4047,18 @@ int wc_AesSetIV(Aes* aes, const byte* iv)
                sz--;
             }
 
+        #if defined(WOLFSSL_AESNI) && !defined(_MSC_VER)
+            if (haveAESNI && aes->use_aesni && sz >= AES_BLOCK_SIZE) {
+                word32 blocks = sz / AES_BLOCK_SIZE;
+
+                AesCtrEncryptBlocks_AESNI(aes, out, in, blocks);
+                out += blocks * AES_BLOCK_SIZE;
+                in  += blocks * AES_BLOCK_SIZE;
+                sz  -= blocks * AES_BLOCK_SIZE;
+                aes->left = 0;
+            }
+        #endif
+
             /* do as many block size ops as possible */
             while (sz >= AES_BLOCK_SIZE) {
             #ifdef XTRANSFORM_AESCTRBLOCK
@@ -4193,6 +4313,14 @@ int wc_AesGcmSetKey(Aes* aes, const byte* key, word32 len)
 
 #ifndef _MSC_VER
 
+#ifdef HAVE_INTEL_AVX512
+    /* 16 blocks at a time with VAES and VPCLMULQDQ on ZMM registers */
+    #define IS_INTEL_GCM_AVX512(f)  (IS_INTEL_AVX512F(f) && \
+                                     IS_INTEL_AVX512BW(f) && \
+                                     IS_INTEL_VAES(f) && \
+                                     IS_INTEL_VPCLMULQDQ(f))
+#endif
+
 void AES_GCM_encrypt(const unsigned char *in, unsigned char *out,
                      const unsigned char* addt, const unsigned char* ivec,
                      unsigned char *tag, unsigned int nbytes,
@@ -4215,6 +4343,15 @@ void AES_GCM_encrypt_avx2(const unsigned char *in, unsigned char *out,
                           unsigned int tbytes, const unsigned char* key,
                           int nr)
                           XASM_LINK("AES_GCM_encrypt_avx2");
+#ifdef HAVE_INTEL_AVX512
+void AES_GCM_encrypt_avx512(const unsigned char *in, unsigned char *out,
+                            const unsigned char* addt,
+                            const unsigned char* ivec, unsigned char *tag,
+                            unsigned int nbytes, unsigned int abytes,
+                            unsigned int ibytes, unsigned int tbytes,
+                            const unsigned char* key, int nr)
+                            XASM_LINK("AES_GCM_encrypt_avx512");
+#endif /* HAVE_INTEL_AVX512 */
 #endif /* HAVE_INTEL_AVX2 */
 #endif /* HAVE_INTEL_AVX1 */
 
@@ -4239,6 +4376,15 @@ void AES_GCM_decrypt_avx2(const unsigned char *in, unsigned char *out,
                           int ibytes, int tbytes, const unsigned char* key,
                           int nr, int* res)
                           XASM_LINK("AES_GCM_decrypt_avx2");
+#ifdef HAVE_INTEL_AVX512
+void AES_GCM_decrypt_avx512(const unsigned char *in, unsigned char *out,
+                            const unsigned char* addt,
+                            const unsigned char* ivec,
+                            const unsigned char *tag, int nbytes, int abytes,
+                            int ibytes, int tbytes, const unsigned char* key,
+                            int nr, int* res)
+                            XASM_LINK("AES_GCM_decrypt_avx512");
+#endif /* HAVE_INTEL_AVX512 */
 #endif /* HAVE_INTEL_AVX2 */
 #endif /* HAVE_INTEL_AVX1 */
 #endif /* HAVE_AES_DECRYPT */
@@ -6289,6 +6435,14 @@ int wc_AesGcmEncrypt(Aes* aes, byte* out, const byte* in, word32 sz,
 #endif /* STM32_CRYPTO_AES_GCM */
 
 #ifdef WOLFSSL_AESNI
+    #ifdef HAVE_INTEL_AVX512
+    if (IS_INTEL_GCM_AVX512(intel_flags)) {
+        AES_GCM_encrypt_avx512(in, out, authIn, iv, authTag, sz, authInSz,
+                      ivSz, authTagSz, (const byte*)aes->key, aes->rounds);
+        return 0;
+    }
+    else
+    #endif
     #ifdef HAVE_INTEL_AVX2
     if (IS_INTEL_AVX2(intel_flags)) {
         AES_GCM_encrypt_avx2(in, out, authIn, iv, authTag, sz, authInSz, ivSz,
@@ -6743,6 +6897,16 @@ int wc_AesGcmDecrypt(Aes* aes, byte* out, const byte* in, word32 sz,
 #endif /* STM32_CRYPTO_AES_GCM */
 
 #ifdef WOLFSSL_AESNI
+    #ifdef HAVE_INTEL_AVX512
+    if (IS_INTEL_GCM_AVX512(intel_flags)) {
+        AES_GCM_decrypt_avx512(in, out, authIn, iv, authTag, sz, authInSz,
+                      ivSz, authTagSz, (byte*)aes->key, aes->rounds, &res);
+        if (res == 0)
+            return AES_GCM_AUTH_E;
+        return 0;
+    }
+    else
+    #endif
     #ifdef HAVE_INTEL_AVX2
     if (IS_INTEL_AVX2(intel_flags)) {
         AES_GCM_decrypt_avx2(in, out, authIn, iv, authTag, sz, authInSz, ivSz,
@@ -7239,6 +7403,39 @@ int wc_AesCcmEncrypt(Aes* aes, byte* out, const byte* in, word32 inSz,
 
     if (authInSz > 0)
         roll_auth(aes, authIn, authInSz, A);
+#if defined(WOLFSSL_AESNI) && !defined(_MSC_VER)
+    if (haveAESNI && aes->use_aesni) {
+        word32 blocks = inSz / AES_BLOCK_SIZE;
+        byte* S = B + AES_BLOCK_SIZE;
+
+        /* counter 0 for the tag, then CBC-MAC and CTR of the whole blocks
+         * in one pass from counter 1 */
+        B[0] = lenSz - 1;
+        for (i = 0; i < lenSz; i++)
+            B[AES_BLOCK_SIZE - 1 - i] = 0;
+        wc_AesEncrypt(aes, B, S);
+        B[AES_BLOCK_SIZE - 1] = 1;
+
+        AES_CCM_encrypt(in, out, blocks, B, A, (byte*)aes->key, aes->rounds);
+        in   += blocks * AES_BLOCK_SIZE;
+        out  += blocks * AES_BLOCK_SIZE;
+        inSz -= blocks * AES_BLOCK_SIZE;
+        if (inSz > 0) {
+            roll_x(aes, in, inSz, A);
+            wc_AesEncrypt(aes, B, B);
+            xorbuf(B, in, inSz);
+            XMEMCPY(out, B, inSz);
+        }
+
+        XMEMCPY(authTag, A, authTagSz);
+        xorbuf(authTag, S, authTagSz);
+
+        ForceZero(A, sizeof(A));
+        ForceZero(B, sizeof(B));
+
+        return 0;
+    }
+#endif
     if (inSz > 0)
         roll_x(aes, in, inSz, A);
     XMEMCPY(authTag, A, authTagSz);
@@ -7329,6 +7526,58 @@ int  wc_AesCcmDecrypt(Aes* aes, byte* out, const byte* in, word32 inSz,
     XMEMCPY(B+1, nonce, nonceSz);
     lenSz = AES_BLOCK_SIZE - 1 - (byte)nonceSz;
 
+#if defined(WOLFSSL_AESNI) && !defined(_MSC_VER)
+    if (haveAESNI && aes->use_aesni) {
+        word32 blocks = inSz / AES_BLOCK_SIZE;
+        byte* S  = B + AES_BLOCK_SIZE;
+        byte* B0 = B + AES_BLOCK_SIZE * 2;
+
+        /* first block of CBC-MAC */
+        XMEMCPY(B0, B, AES_BLOCK_SIZE);
+        B0[0] = (authInSz > 0 ? 64 : 0)
+              + (8 * (((byte)authTagSz - 2) / 2))
+              + (lenSz - 1);
+        for (i = 0; i < lenSz; i++) {
+            if (mask && i >= wordSz)
+                mask = 0x00;
+            B0[AES_BLOCK_SIZE - 1 - i] = (inSz >> ((8 * i) & mask)) & mask;
+        }
+        wc_AesEncrypt(aes, B0, A);
+        if (authInSz > 0)
+            roll_auth(aes, authIn, authInSz, A);
+
+        /* counter 0 for the tag, then CTR and CBC-MAC of the whole blocks
+         * in one pass from counter 1 */
+        B[0] = lenSz - 1;
+        for (i = 0; i < lenSz; i++)
+            B[AES_BLOCK_SIZE - 1 - i] = 0;
+        wc_AesEncrypt(aes, B, S);
+        B[AES_BLOCK_SIZE - 1] = 1;
+
+        AES_CCM_decrypt(in, o, blocks, B, A, (byte*)aes->key, aes->rounds);
+        in  += blocks * AES_BLOCK_SIZE;
+        o   += blocks * AES_BLOCK_SIZE;
+        oSz -= blocks * AES_BLOCK_SIZE;
+        if (oSz > 0) {
+            wc_AesEncrypt(aes, B, B);
+            xorbuf(B, in, oSz);
+            XMEMCPY(o, B, oSz);
+            roll_x(aes, o, oSz, A);
+        }
+        xorbuf(A, S, authTagSz);
+
+        if (ConstantCompare(A, authTag, authTagSz) != 0) {
+            XMEMSET(out, 0, inSz);
+            result = AES_CCM_AUTH_E;
+        }
+
+        ForceZero(A, sizeof(A));
+        ForceZero(B, sizeof(B));
+
+        return result;
+    }
+#endif
+
     B[0] = lenSz - 1;
     for (i = 0; i < lenSz; i++)
         B[AES_BLOCK_SIZE - 1 - i] = 0;
@@ -8453,6 +8702,89 @@ int wc_AesXtsDecryptSector(XtsAes* aes, byte* out, const byte* in, word32 sz,
     return wc_AesXtsDecrypt(aes, out, in, sz, (const byte*)i, AES_BLOCK_SIZE);
 }
 
+
+/* Encrypts a run of consecutive sectors in one call. Each sectorSz bytes of
+ * the buffer is a data unit with its own tweak, the first uses sector and each
+ * following one the next sector number. A last sector shorter than sectorSz is
+ * encrypted with cipher text stealing as long as it is at least one block.
+ *
+ * aes      AES keys to use for block encrypt
+ * out      output buffer to hold cipher text
+ * in       input plain text buffer to encrypt
+ * sz       size of both out and in buffers
+ * sector   value to use for tweak of first sector
+ * sectorSz size of each sector, at least AES_BLOCK_SIZE
+ *
+ * returns 0 on success
+ */
+int wc_AesXtsEncryptConsecutiveSectors(XtsAes* aes, byte* out, const byte* in,
+        word32 sz, word64 sector, word32 sectorSz)
+{
+    int ret = 0;
+
+    if (aes == NULL || out == NULL || in == NULL ||
+            sectorSz < AES_BLOCK_SIZE) {
+        return BAD_FUNC_ARG;
+    }
+    if (sz < AES_BLOCK_SIZE || (sz % sectorSz != 0 &&
+            sz % sectorSz < AES_BLOCK_SIZE)) {
+        WOLFSSL_MSG("Plain text input too small for encryption");
+        return BAD_FUNC_ARG;
+    }
+
+    while (ret == 0 && sz > 0) {
+        word32 len = (sz < sectorSz) ? sz : sectorSz;
+
+        ret = wc_AesXtsEncryptSector(aes, out, in, len, sector);
+        in  += len;
+        out += len;
+        sz  -= len;
+        sector++;
+    }
+
+    return ret;
+}
+
+
+/* Same process as wc_AesXtsEncryptConsecutiveSectors but decrypts.
+ *
+ * aes      AES keys to use for block decrypt
+ * out      output buffer to hold plain text
+ * in       input cipher text buffer to decrypt
+ * sz       size of both out and in buffers
+ * sector   value to use for tweak of first sector
+ * sectorSz size of each sector, at least AES_BLOCK_SIZE
+ *
+ * returns 0 on success
+ */
+int wc_AesXtsDecryptConsecutiveSectors(XtsAes* aes, byte* out, const byte* in,
+        word32 sz, word64 sector, word32 sectorSz)
+{
+    int ret = 0;
+
+    if (aes == NULL || out == NULL || in == NULL ||
+            sectorSz < AES_BLOCK_SIZE) {
+        return BAD_FUNC_ARG;
+    }
+    if (sz < AES_BLOCK_SIZE || (sz % sectorSz != 0 &&
+            sz % sectorSz < AES_BLOCK_SIZE)) {
+        WOLFSSL_MSG("Cipher text input too small for decryption");
+        return BAD_FUNC_ARG;
+    }
+
+    while (ret == 0 && sz > 0) {
+        word32 len = (sz < sectorSz) ? sz : sectorSz;
+
+        ret = wc_AesXtsDecryptSector(aes, out, in, len, sector);
+        in  += len;
+        out += len;
+        sz  -= len;
+        sector++;
+    }
+
+    return ret;
+}
+
 #ifdef HAVE_AES_ECB
 /* helper function for encrypting / decrypting full buffer at once */
 static int _AesXtsHelper(Aes* aes, byte* out, const byte* in, word32 sz, int dir)
@@ -8532,9 +8864,21 @@ int wc_AesXtsEncrypt(XtsAes* xaes, byte* out, const byte* in, word32 sz,
 
         wc_AesEncryptDirect(tweak, tmp, i);
 
+    #if defined(WOLFSSL_AESNI) && !defined(_MSC_VER)
+        if (haveAESNI && aes->use_aesni) {
+            /* all whole blocks, tweaks calculated along side */
+            AES_XTS_encrypt(in, out, blocks, tmp, (byte*)aes->key,
+                            aes->rounds);
+            in  += blocks * AES_BLOCK_SIZE;
+            out += blocks * AES_BLOCK_SIZE;
+            sz  -= blocks * AES_BLOCK_SIZE;
+            blocks = 0;
+        }
+    #endif
+
     #ifdef HAVE_AES_ECB
         /* encrypt all of buffer at once when possible */
-        if (in != out) { /* can not handle inline */
+        if (in != out && blocks > 0) { /* can not handle inline */
             XMEMCPY(out, tmp, AES_BLOCK_SIZE);
             if ((ret = _AesXtsHelper(aes, out, in, sz, AES_ENCRYPTION)) != 0) {
                 return ret;
@@ -8579,13 +8923,19 @@ int wc_AesXtsEncrypt(XtsAes* xaes, byte* out, const byte* in, word32 sz,
         /* stealing operation of XTS to handle left overs */
         if (sz > 0) {
             byte buf[AES_BLOCK_SIZE];
+            word32 j;
 
             XMEMCPY(buf, out - AES_BLOCK_SIZE, AES_BLOCK_SIZE);
             if (sz >= AES_BLOCK_SIZE) { /* extra sanity check before copy */
                 return BUFFER_E;
             }
-            XMEMCPY(out, buf, sz);
-            XMEMCPY(buf, in, sz);
+            /* swap bytes so that in and out can be the same buffer */
+            for (j = 0; j < sz; j++) {
+                byte tmpC = in[j];
+
+                out[j] = buf[j];
+                buf[j] = tmpC;
+            }
 
             xorbuf(buf, tmp, AES_BLOCK_SIZE);
             wc_AesEncryptDirect(aes, out - AES_BLOCK_SIZE, buf);
@@ -8649,9 +8999,21 @@ int wc_AesXtsDecrypt(XtsAes* xaes, byte* out, const byte* in, word32 sz,
             blocks--;
         }
 
+    #if defined(WOLFSSL_AESNI) && !defined(_MSC_VER)
+        if (haveAESNI && aes->use_aesni) {
+            /* whole blocks before any stealing, tweaks calculated along side */
+            AES_XTS_decrypt(in, out, blocks, tmp, (byte*)aes->key,
+                            aes->rounds);
+            in  += blocks * AES_BLOCK_SIZE;
+            out += blocks * AES_BLOCK_SIZE;
+            sz  -= blocks * AES_BLOCK_SIZE;
+            blocks = 0;
+        }
+    #endif
+
     #ifdef HAVE_AES_ECB
         /* decrypt all of buffer at once when possible */
-        if (in != out) { /* can not handle inline */
+        if (in != out && blocks > 0) { /* can not handle inline */
             XMEMCPY(out, tmp, AES_BLOCK_SIZE);
             if ((ret = _AesXtsHelper(aes, out, in, sz, AES_DECRYPTION)) != 0) {
                 return ret;
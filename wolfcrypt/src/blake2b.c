@@ -44,6 +44,35 @@
 #include <wolfssl/wolfcrypt/blake2.h>
 #include <wolfssl/wolfcrypt/blake2-impl.h>
 
+#if defined(USE_INTEL_SPEEDUP) && !defined(HAVE_FIPS)
+    #include <wolfssl/wolfcrypt/cpuid.h>
+
+    #if defined(__GNUC__) && ((__GNUC__ < 4) || \
+                              (__GNUC__ == 4 && __GNUC_MINOR__ <= 8))
+        #undef  NO_AVX2_SUPPORT
+        #define NO_AVX2_SUPPORT
+    #endif
+    #if defined(__clang__) && ((__clang_major__ < 3) || \
+                               (__clang_major__ == 3 && __clang_minor__ <= 5))
+        #define NO_AVX2_SUPPORT
+    #elif defined(__clang__) && defined(NO_AVX2_SUPPORT)
+        #undef NO_AVX2_SUPPORT
+    #endif
+
+    #ifndef NO_AVX2_SUPPORT
+        #define HAVE_INTEL_AVX2
+        #ifndef NO_AVX512_SUPPORT
+            #define HAVE_INTEL_AVX512
+        #endif
+    #endif
+#endif /* USE_INTEL_SPEEDUP && !HAVE_FIPS */
+
+/* Leaves of BLAKE2bp and the bytes of a stripe of one block per leaf. */
+#define BLAKE2BP_DEGREE         4
+#define BLAKE2BP_STRIPEBYTES    (BLAKE2BP_DEGREE * BLAKE2B_BLOCKBYTES)
+/* Most stripes handed to the assembly code in one call. */
+#define BLAKE2BP_MAX_STRIPES    0x10000
+
 
 static const word64 blake2b_IV[8] =
 {
@@ -69,6 +98,59 @@ static const byte blake2b_sigma[12][16] =
   { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 }
 };
 
+#ifdef HAVE_INTEL_AVX2
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+    /* h is followed by t and f, as in blake2b_state. */
+    extern void Blake2b_Compress_AVX2(word64* h, const byte* block);
+    /* Compress stripes of four blocks with the leaf states interleaved,
+     * word i of leaf j at h[i * 4 + j]. All leaves have the counter t0, t1
+     * and none of the blocks is the last of its leaf. */
+    extern void Blake2b_Compress_AVX2_x4(word64* h, const byte* in,
+                                         word64 t0, word64 t1, word32 stripes);
+#ifdef HAVE_INTEL_AVX512
+    extern void Blake2b_Compress_AVX512(word64* h, const byte* block);
+    extern void Blake2b_Compress_AVX512_x4(word64* h, const byte* in,
+                                           word64 t0, word64 t1,
+                                           word32 stripes);
+#endif
+
+#ifdef __cplusplus
+    }  /* extern "C" */
+#endif
+
+    static void (*Blake2b_Compress_p)(word64* h, const byte* block) = NULL;
+    static void (*Blake2b_Compress_x4_p)(word64* h, const byte* in, word64 t0,
+                                         word64 t1, word32 stripes) = NULL;
+    static int transform_check = 0;
+
+    static void Blake2b_SetTransform(void)
+    {
+        word32 intel_flags;
+
+        if (transform_check)
+            return;
+
+        intel_flags = cpuid_get_flags();
+
+    #ifdef HAVE_INTEL_AVX512
+        if (IS_INTEL_AVX512F(intel_flags) && IS_INTEL_AVX512VL(intel_flags)) {
+            Blake2b_Compress_p = Blake2b_Compress_AVX512;
+            Blake2b_Compress_x4_p = Blake2b_Compress_AVX512_x4;
+        }
+        else
+    #endif
+        if (IS_INTEL_AVX2(intel_flags)) {
+            Blake2b_Compress_p = Blake2b_Compress_AVX2;
+            Blake2b_Compress_x4_p = Blake2b_Compress_AVX2_x4;
+        }
+
+        transform_check = 1;
+    }
+#endif /* HAVE_INTEL_AVX2 */
+
 
 static WC_INLINE int blake2b_set_lastnode( blake2b_state *S )
 {
@@ -108,6 +190,9 @@ int blake2b_init_param( blake2b_state *S, const blake2b_param *P )
 {
   word32 i;
   byte *p ;
+#ifdef HAVE_INTEL_AVX2
+  Blake2b_SetTransform();
+#endif
   blake2b_init0( S );
   p =  ( byte * )( P );
 
@@ -211,7 +296,20 @@ static int blake2b_compress( blake2b_state *S,
 #ifdef WOLFSSL_SMALL_STACK
   word64* m;
   word64* v;
+#else
+  word64 m[16];
+  word64 v[16];
+#endif
+
+#ifdef HAVE_INTEL_AVX2
+  if ( Blake2b_Compress_p != NULL )
+  {
+    (*Blake2b_Compress_p)( S->h, block );
+    return 0;
+  }
+#endif
 
+#ifdef WOLFSSL_SMALL_STACK
   m = (word64*)XMALLOC(sizeof(word64) * 16, NULL, DYNAMIC_TYPE_TMP_BUFFER);
 
   if ( m == NULL ) return -1;
@@ -223,9 +321,6 @@ static int blake2b_compress( blake2b_state *S,
     XFREE(m, NULL, DYNAMIC_TYPE_TMP_BUFFER);
     return -1;
   }
-#else
-  word64 m[16];
-  word64 v[16];
 #endif
 
   for( i = 0; i < 16; ++i )
@@ -380,6 +475,231 @@ int blake2b( byte *out, const void *in, const void *key, const byte outlen,
   return blake2b_final( S, out, outlen );
 }
 
+/* BLAKE2bp: four BLAKE2b leaves, block i of the message going to leaf
+ * i % 4, and a root hashing the leaf digests. */
+
+static int blake2bp_init_leaf( blake2b_state *S, byte outlen, byte keylen,
+                               word64 offset )
+{
+  blake2b_param P[1];
+
+  XMEMSET( P, 0, sizeof( *P ) );
+  P->digest_length = outlen;
+  P->key_length    = keylen;
+  P->fanout        = BLAKE2BP_DEGREE;
+  P->depth         = 2;
+  store64( &P->node_offset, offset );
+  P->node_depth    = 0;
+  P->inner_length  = BLAKE2B_OUTBYTES;
+  return blake2b_init_param( S, P );
+}
+
+static int blake2bp_init_root( blake2b_state *S, byte outlen, byte keylen )
+{
+  blake2b_param P[1];
+
+  XMEMSET( P, 0, sizeof( *P ) );
+  P->digest_length = outlen;
+  P->key_length    = keylen;
+  P->fanout        = BLAKE2BP_DEGREE;
+  P->depth         = 2;
+  P->node_depth    = 1;
+  P->inner_length  = BLAKE2B_OUTBYTES;
+  return blake2b_init_param( S, P );
+}
+
+static int blake2bp_init_tree( blake2bp_state *S, byte outlen, byte keylen )
+{
+  word32 i;
+
+  if ( ( !outlen ) || ( outlen > BLAKE2B_OUTBYTES ) ) return -1;
+
+  if( blake2bp_init_root( S->R, outlen, keylen ) < 0 ) return -1;
+
+  for( i = 0; i < BLAKE2BP_DEGREE; ++i )
+    if( blake2bp_init_leaf( S->S[i], outlen, keylen, i ) < 0 ) return -1;
+
+  S->R->last_node = 1;
+  S->S[BLAKE2BP_DEGREE - 1]->last_node = 1;
+  S->buflen = 0;
+  return 0;
+}
+
+int blake2bp_init( blake2bp_state *S, const byte outlen )
+{
+  return blake2bp_init_tree( S, outlen, 0 );
+}
+
+int blake2bp_init_key( blake2bp_state *S, const byte outlen, const void *key,
+                       const byte keylen )
+{
+  word32 i;
+
+  if ( !key || !keylen || keylen > BLAKE2B_KEYBYTES ) return -1;
+
+  if( blake2bp_init_tree( S, outlen, keylen ) < 0 ) return -1;
+
+  /* Each leaf starts with the padded key block, buffered like message data
+   * so that it is flagged as the last block of an empty message. */
+  XMEMSET( S->buf, 0, BLAKE2BP_STRIPEBYTES );
+  for( i = 0; i < BLAKE2BP_DEGREE; ++i )
+    XMEMCPY( S->buf + i * BLAKE2B_BLOCKBYTES, key, keylen );
+  S->buflen = BLAKE2BP_STRIPEBYTES;
+  return 0;
+}
+
+/* Compress whole stripes, one block for each leaf. None of the blocks may be
+ * the last block of its leaf. */
+static int blake2bp_compress( blake2bp_state *S, const byte *in,
+                              word64 stripes )
+{
+  word32 i;
+
+#ifdef HAVE_INTEL_AVX2
+  if ( Blake2b_Compress_x4_p != NULL )
+  {
+    word64 h[8 * BLAKE2BP_DEGREE];
+    word32 j;
+
+    for( i = 0; i < BLAKE2BP_DEGREE; ++i )
+      for( j = 0; j < 8; ++j )
+        h[j * BLAKE2BP_DEGREE + i] = S->S[i]->h[j];
+
+    while( stripes > 0 )
+    {
+      word32 n = ( stripes > BLAKE2BP_MAX_STRIPES ) ? BLAKE2BP_MAX_STRIPES :
+                                                      ( word32 )stripes;
+
+      /* All leaves have seen the same number of blocks. */
+      (*Blake2b_Compress_x4_p)( h, in, S->S[0]->t[0], S->S[0]->t[1], n );
+      for( i = 0; i < BLAKE2BP_DEGREE; ++i )
+        blake2b_increment_counter( S->S[i], ( word64 )n * BLAKE2B_BLOCKBYTES );
+      in += ( word64 )n * BLAKE2BP_STRIPEBYTES;
+      stripes -= n;
+    }
+
+    for( i = 0; i < BLAKE2BP_DEGREE; ++i )
+      for( j = 0; j < 8; ++j )
+        S->S[i]->h[j] = h[j * BLAKE2BP_DEGREE + i];
+    secure_zero_memory( h, sizeof( h ) );
+    return 0;
+  }
+#endif
+
+  for( ; stripes > 0; --stripes )
+  {
+    for( i = 0; i < BLAKE2BP_DEGREE; ++i )
+    {
+      blake2b_increment_counter( S->S[i], BLAKE2B_BLOCKBYTES );
+      if ( blake2b_compress( S->S[i], in + i * BLAKE2B_BLOCKBYTES ) < 0 )
+        return -1;
+    }
+    in += BLAKE2BP_STRIPEBYTES;
+  }
+
+  return 0;
+}
+
+/* A stripe is only compressed once every leaf has data after it, which is
+ * when more than 3 blocks follow. Up to a stripe and 3 blocks are buffered. */
+int blake2bp_update( blake2bp_state *S, const byte *in, word64 inlen )
+{
+  const word64 keep = ( BLAKE2BP_DEGREE - 1 ) * BLAKE2B_BLOCKBYTES;
+
+  while( inlen > 0 )
+  {
+    if( S->buflen + inlen <= BLAKE2BP_STRIPEBYTES + keep )
+    {
+      XMEMCPY( S->buf + S->buflen, in, (wolfssl_word)inlen );
+      S->buflen += inlen;
+      inlen = 0;
+    }
+    else if( S->buflen > 0 )
+    {
+      if( S->buflen < BLAKE2BP_STRIPEBYTES )
+      {
+        word64 fill = BLAKE2BP_STRIPEBYTES - S->buflen;
+
+        XMEMCPY( S->buf + S->buflen, in, (wolfssl_word)fill );
+        S->buflen += fill;
+        in += fill;
+        inlen -= fill;
+      }
+
+      if ( blake2bp_compress( S, S->buf, 1 ) < 0 ) return -1;
+
+      S->buflen -= BLAKE2BP_STRIPEBYTES;
+      XMEMMOVE( S->buf, S->buf + BLAKE2BP_STRIPEBYTES,
+                (wolfssl_word)S->buflen );
+    }
+    else
+    {
+      word64 stripes = ( inlen - keep - 1 ) / BLAKE2BP_STRIPEBYTES;
+
+      if ( blake2bp_compress( S, in, stripes ) < 0 ) return -1;
+
+      in += stripes * BLAKE2BP_STRIPEBYTES;
+      inlen -= stripes * BLAKE2BP_STRIPEBYTES;
+    }
+  }
+
+  return 0;
+}
+
+int blake2bp_final( blake2bp_state *S, byte *out, byte outlen )
+{
+  byte hash[BLAKE2BP_DEGREE][BLAKE2B_OUTBYTES];
+  word64 off;
+  word32 i;
+
+  for( i = 0; i < BLAKE2BP_DEGREE; ++i )
+  {
+    for( off = i * BLAKE2B_BLOCKBYTES; off < S->buflen;
+         off += BLAKE2BP_STRIPEBYTES )
+    {
+      word64 left = S->buflen - off;
+
+      if( left > BLAKE2B_BLOCKBYTES ) left = BLAKE2B_BLOCKBYTES;
+
+      if ( blake2b_update( S->S[i], S->buf + off, left ) < 0 ) return -1;
+    }
+
+    if ( blake2b_final( S->S[i], hash[i], BLAKE2B_OUTBYTES ) < 0 ) return -1;
+  }
+  secure_zero_memory( S->buf, sizeof( S->buf ) );
+
+  for( i = 0; i < BLAKE2BP_DEGREE; ++i )
+    if ( blake2b_update( S->R, hash[i], BLAKE2B_OUTBYTES ) < 0 ) return -1;
+
+  return blake2b_final( S->R, out, outlen );
+}
+
+int blake2bp( byte *out, const void *in, const void *key, const byte outlen,
+              const word64 inlen, byte keylen )
+{
+  blake2bp_state S[1];
+
+  /* Verify parameters */
+  if ( NULL == in ) return -1;
+
+  if ( NULL == out ) return -1;
+
+  if( NULL == key ) keylen = 0;
+
+  if( keylen > 0 )
+  {
+    if( blake2bp_init_key( S, outlen, key, keylen ) < 0 ) return -1;
+  }
+  else
+  {
+    if( blake2bp_init( S, outlen ) < 0 ) return -1;
+  }
+
+  if ( blake2bp_update( S, ( byte * )in, inlen ) < 0) return -1;
+
+  return blake2bp_final( S, out, outlen );
+}
+
 #if defined(BLAKE2B_SELFTEST)
 #include <string.h>
 #include "blake2-kat.h"
@@ -446,6 +766,35 @@ int wc_Blake2bFinal(Blake2b* b2b, byte* final, word32 requestSz)
 }
 
 
+
+/* Init Blake2bp digest, track size in case final doesn't want to "remember" */
+int wc_InitBlake2bp(Blake2bp* b2bp, word32 digestSz)
+{
+    if (b2bp == NULL){
+        return -1;
+    }
+    b2bp->digestSz = digestSz;
+
+    return blake2bp_init(b2bp->S, (byte)digestSz);
+}
+
+
+/* Blake2bp Update */
+int wc_Blake2bpUpdate(Blake2bp* b2bp, const byte* data, word32 sz)
+{
+    return blake2bp_update(b2bp->S, data, sz);
+}
+
+
+/* Blake2bp Final, if pass in zero size we use init digestSz */
+int wc_Blake2bpFinal(Blake2bp* b2bp, byte* final, word32 requestSz)
+{
+    word32 sz = requestSz ? requestSz : b2bp->digestSz;
+
+    return blake2bp_final(b2bp->S, final, (byte)sz);
+}
+
+
 /* end CTaoCrypt API */
 
 #endif  /* HAVE_BLAKE2 */
@@ -44,6 +44,36 @@
 #include <wolfssl/wolfcrypt/blake2.h>
 #include <wolfssl/wolfcrypt/blake2-impl.h>
 
+#if defined(USE_INTEL_SPEEDUP) && !defined(HAVE_FIPS)
+    #include <wolfssl/wolfcrypt/cpuid.h>
+
+    #if defined(__GNUC__) && ((__GNUC__ < 4) || \
+                              (__GNUC__ == 4 && __GNUC_MINOR__ <= 8))
+        #undef  NO_AVX2_SUPPORT
+        #define NO_AVX2_SUPPORT
+    #endif
+    #if defined(__clang__) && ((__clang_major__ < 3) || \
+                               (__clang_major__ == 3 && __clang_minor__ <= 5))
+        #define NO_AVX2_SUPPORT
+    #elif defined(__clang__) && defined(NO_AVX2_SUPPORT)
+        #undef NO_AVX2_SUPPORT
+    #endif
+
+    #define HAVE_INTEL_AVX1
+    #ifndef NO_AVX2_SUPPORT
+        #define HAVE_INTEL_AVX2
+        #ifndef NO_AVX512_SUPPORT
+            #define HAVE_INTEL_AVX512
+        #endif
+    #endif
+#endif /* USE_INTEL_SPEEDUP && !HAVE_FIPS */
+
+/* Leaves of BLAKE2sp and the bytes of a stripe of one block per leaf. */
+#define BLAKE2SP_DEGREE         8
+#define BLAKE2SP_STRIPEBYTES    (BLAKE2SP_DEGREE * BLAKE2S_BLOCKBYTES)
+/* Most stripes handed to the assembly code in one call. */
+#define BLAKE2SP_MAX_STRIPES    0x10000
+
 
 static const word32 blake2s_IV[8] =
 {
@@ -66,6 +96,66 @@ static const byte blake2s_sigma[10][16] =
 };
 
 
+#ifdef HAVE_INTEL_AVX1
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+    /* h is followed by t and f, as in blake2s_state. */
+    extern void Blake2s_Compress_AVX(word32* h, const byte* block);
+#ifdef HAVE_INTEL_AVX2
+    /* Compress stripes of eight blocks with the leaf states interleaved,
+     * word i of leaf j at h[i * 8 + j]. All leaves have the 64-bit counter t
+     * and none of the blocks is the last of its leaf. */
+    extern void Blake2s_Compress_AVX2_x8(word32* h, const byte* in, word64 t,
+                                         word32 stripes);
+#endif
+#ifdef HAVE_INTEL_AVX512
+    extern void Blake2s_Compress_AVX512(word32* h, const byte* block);
+    extern void Blake2s_Compress_AVX512_x8(word32* h, const byte* in,
+                                           word64 t, word32 stripes);
+#endif
+
+#ifdef __cplusplus
+    }  /* extern "C" */
+#endif
+
+    static void (*Blake2s_Compress_p)(word32* h, const byte* block) = NULL;
+#ifdef HAVE_INTEL_AVX2
+    static void (*Blake2s_Compress_x8_p)(word32* h, const byte* in, word64 t,
+                                         word32 stripes) = NULL;
+#endif
+    static int transform_check = 0;
+
+    static void Blake2s_SetTransform(void)
+    {
+        word32 intel_flags;
+
+        if (transform_check)
+            return;
+
+        intel_flags = cpuid_get_flags();
+
+    #ifdef HAVE_INTEL_AVX512
+        if (IS_INTEL_AVX512F(intel_flags) && IS_INTEL_AVX512VL(intel_flags)) {
+            Blake2s_Compress_p = Blake2s_Compress_AVX512;
+            Blake2s_Compress_x8_p = Blake2s_Compress_AVX512_x8;
+        }
+        else
+    #endif
+        {
+        #ifdef HAVE_INTEL_AVX2
+            if (IS_INTEL_AVX2(intel_flags))
+                Blake2s_Compress_x8_p = Blake2s_Compress_AVX2_x8;
+        #endif
+            if (IS_INTEL_AVX1(intel_flags))
+                Blake2s_Compress_p = Blake2s_Compress_AVX;
+        }
+
+        transform_check = 1;
+    }
+#endif /* HAVE_INTEL_AVX1 */
+
 static WC_INLINE int blake2s_set_lastnode( blake2s_state *S )
 {
   S->f[1] = ~0;
@@ -104,6 +194,9 @@ int blake2s_init_param( blake2s_state *S, const blake2s_param *P )
 {
   word32 i;
   byte *p ;
+#ifdef HAVE_INTEL_AVX1
+  Blake2s_SetTransform();
+#endif
   blake2s_init0( S );
   p =  ( byte * )( P );
 
@@ -207,7 +300,20 @@ static int blake2s_compress( blake2s_state *S,
 #ifdef WOLFSSL_SMALL_STACK
   word32* m;
   word32* v;
+#else
+  word32 m[16];
+  word32 v[16];
+#endif
+
+#ifdef HAVE_INTEL_AVX1
+  if ( Blake2s_Compress_p != NULL )
+  {
+    (*Blake2s_Compress_p)( S->h, block );
+    return 0;
+  }
+#endif
 
+#ifdef WOLFSSL_SMALL_STACK
   m = (word32*)XMALLOC(sizeof(word32) * 16, NULL, DYNAMIC_TYPE_TMP_BUFFER);
 
   if ( m == NULL ) return -1;
@@ -219,9 +325,6 @@ static int blake2s_compress( blake2s_state *S,
     XFREE(m, NULL, DYNAMIC_TYPE_TMP_BUFFER);
     return -1;
   }
-#else
-  word32 m[16];
-  word32 v[16];
 #endif
 
   for( i = 0; i < 16; ++i )
@@ -374,6 +477,232 @@ int blake2s( byte *out, const void *in, const void *key, const byte outlen,
   return blake2s_final( S, out, outlen );
 }
 
+/* BLAKE2sp: eight BLAKE2s leaves, block i of the message going to leaf
+ * i % 8, and a root hashing the leaf digests. */
+
+static int blake2sp_init_leaf( blake2s_state *S, byte outlen, byte keylen,
+                               word64 offset )
+{
+  blake2s_param P[1];
+
+  XMEMSET( P, 0, sizeof( *P ) );
+  P->digest_length = outlen;
+  P->key_length    = keylen;
+  P->fanout        = BLAKE2SP_DEGREE;
+  P->depth         = 2;
+  store48( P->node_offset, offset );
+  P->node_depth    = 0;
+  P->inner_length  = BLAKE2S_OUTBYTES;
+  return blake2s_init_param( S, P );
+}
+
+static int blake2sp_init_root( blake2s_state *S, byte outlen, byte keylen )
+{
+  blake2s_param P[1];
+
+  XMEMSET( P, 0, sizeof( *P ) );
+  P->digest_length = outlen;
+  P->key_length    = keylen;
+  P->fanout        = BLAKE2SP_DEGREE;
+  P->depth         = 2;
+  P->node_depth    = 1;
+  P->inner_length  = BLAKE2S_OUTBYTES;
+  return blake2s_init_param( S, P );
+}
+
+static int blake2sp_init_tree( blake2sp_state *S, byte outlen, byte keylen )
+{
+  word32 i;
+
+  if ( ( !outlen ) || ( outlen > BLAKE2S_OUTBYTES ) ) return -1;
+
+  if( blake2sp_init_root( S->R, outlen, keylen ) < 0 ) return -1;
+
+  for( i = 0; i < BLAKE2SP_DEGREE; ++i )
+    if( blake2sp_init_leaf( S->S[i], outlen, keylen, i ) < 0 ) return -1;
+
+  S->R->last_node = 1;
+  S->S[BLAKE2SP_DEGREE - 1]->last_node = 1;
+  S->buflen = 0;
+  return 0;
+}
+
+int blake2sp_init( blake2sp_state *S, const byte outlen )
+{
+  return blake2sp_init_tree( S, outlen, 0 );
+}
+
+int blake2sp_init_key( blake2sp_state *S, const byte outlen, const void *key,
+                       const byte keylen )
+{
+  word32 i;
+
+  if ( !key || !keylen || keylen > BLAKE2S_KEYBYTES ) return -1;
+
+  if( blake2sp_init_tree( S, outlen, keylen ) < 0 ) return -1;
+
+  /* Each leaf starts with the padded key block, buffered like message data
+   * so that it is flagged as the last block of an empty message. */
+  XMEMSET( S->buf, 0, BLAKE2SP_STRIPEBYTES );
+  for( i = 0; i < BLAKE2SP_DEGREE; ++i )
+    XMEMCPY( S->buf + i * BLAKE2S_BLOCKBYTES, key, keylen );
+  S->buflen = BLAKE2SP_STRIPEBYTES;
+  return 0;
+}
+
+/* Compress whole stripes, one block for each leaf. None of the blocks may be
+ * the last block of its leaf. */
+static int blake2sp_compress( blake2sp_state *S, const byte *in,
+                              word32 stripes )
+{
+  word32 i;
+
+#ifdef HAVE_INTEL_AVX2
+  if ( Blake2s_Compress_x8_p != NULL )
+  {
+    word32 h[8 * BLAKE2SP_DEGREE];
+    word32 j;
+
+    for( i = 0; i < BLAKE2SP_DEGREE; ++i )
+      for( j = 0; j < 8; ++j )
+        h[j * BLAKE2SP_DEGREE + i] = S->S[i]->h[j];
+
+    while( stripes > 0 )
+    {
+      word32 n = ( stripes > BLAKE2SP_MAX_STRIPES ) ? BLAKE2SP_MAX_STRIPES :
+                                                      stripes;
+
+      /* All leaves have seen the same number of blocks. */
+      (*Blake2s_Compress_x8_p)( h, in, ( ( word64 )S->S[0]->t[1] << 32 ) |
+                                       S->S[0]->t[0], n );
+      for( i = 0; i < BLAKE2SP_DEGREE; ++i )
+        blake2s_increment_counter( S->S[i], n * BLAKE2S_BLOCKBYTES );
+      in += n * BLAKE2SP_STRIPEBYTES;
+      stripes -= n;
+    }
+
+    for( i = 0; i < BLAKE2SP_DEGREE; ++i )
+      for( j = 0; j < 8; ++j )
+        S->S[i]->h[j] = h[j * BLAKE2SP_DEGREE + i];
+    secure_zero_memory( h, sizeof( h ) );
+    return 0;
+  }
+#endif
+
+  for( ; stripes > 0; --stripes )
+  {
+    for( i = 0; i < BLAKE2SP_DEGREE; ++i )
+    {
+      blake2s_increment_counter( S->S[i], BLAKE2S_BLOCKBYTES );
+      if ( blake2s_compress( S->S[i], in + i * BLAKE2S_BLOCKBYTES ) < 0 )
+        return -1;
+    }
+    in += BLAKE2SP_STRIPEBYTES;
+  }
+
+  return 0;
+}
+
+/* A stripe is only compressed once every leaf has data after it, which is
+ * when more than 7 blocks follow. Up to a stripe and 7 blocks are buffered. */
+int blake2sp_update( blake2sp_state *S, const byte *in, word32 inlen )
+{
+  const word32 keep = ( BLAKE2SP_DEGREE - 1 ) * BLAKE2S_BLOCKBYTES;
+
+  while( inlen > 0 )
+  {
+    if( S->buflen + inlen <= BLAKE2SP_STRIPEBYTES + keep )
+    {
+      XMEMCPY( S->buf + S->buflen, in, (wolfssl_word)inlen );
+      S->buflen += inlen;
+      inlen = 0;
+    }
+    else if( S->buflen > 0 )
+    {
+      if( S->buflen < BLAKE2SP_STRIPEBYTES )
+      {
+        word32 fill = BLAKE2SP_STRIPEBYTES - S->buflen;
+
+        XMEMCPY( S->buf + S->buflen, in, (wolfssl_word)fill );
+        S->buflen += fill;
+        in += fill;
+        inlen -= fill;
+      }
+
+      if ( blake2sp_compress( S, S->buf, 1 ) < 0 ) return -1;
+
+      S->buflen -= BLAKE2SP_STRIPEBYTES;
+      XMEMMOVE( S->buf, S->buf + BLAKE2SP_STRIPEBYTES,
+                (wolfssl_word)S->buflen );
+    }
+    else
+    {
+      word32 stripes = ( inlen - keep - 1 ) / BLAKE2SP_STRIPEBYTES;
+
+      if ( blake2sp_compress( S, in, stripes ) < 0 ) return -1;
+
+      in += stripes * BLAKE2SP_STRIPEBYTES;
+      inlen -= stripes * BLAKE2SP_STRIPEBYTES;
+    }
+  }
+
+  return 0;
+}
+
+int blake2sp_final( blake2sp_state *S, byte *out, byte outlen )
+{
+  byte hash[BLAKE2SP_DEGREE][BLAKE2S_OUTBYTES];
+  word32 off;
+  word32 i;
+
+  for( i = 0; i < BLAKE2SP_DEGREE; ++i )
+  {
+    for( off = i * BLAKE2S_BLOCKBYTES; off < S->buflen;
+         off += BLAKE2SP_STRIPEBYTES )
+    {
+      word32 left = S->buflen - off;
+
+      if( left > BLAKE2S_BLOCKBYTES ) left = BLAKE2S_BLOCKBYTES;
+
+      if ( blake2s_update( S->S[i], S->buf + off, left ) < 0 ) return -1;
+    }
+
+    if ( blake2s_final( S->S[i], hash[i], BLAKE2S_OUTBYTES ) < 0 ) return -1;
+  }
+  secure_zero_memory( S->buf, sizeof( S->buf ) );
+
+  for( i = 0; i < BLAKE2SP_DEGREE; ++i )
+    if ( blake2s_update( S->R, hash[i], BLAKE2S_OUTBYTES ) < 0 ) return -1;
+
+  return blake2s_final( S->R, out, outlen );
+}
+
+int blake2sp( byte *out, const void *in, const void *key, const byte outlen,
+              const word32 inlen, byte keylen )
+{
+  blake2sp_state S[1];
+
+  /* Verify parameters */
+  if ( NULL == in ) return -1;
+
+  if ( NULL == out ) return -1;
+
+  if( NULL == key ) keylen = 0;
+
+  if( keylen > 0 )
+  {
+    if( blake2sp_init_key( S, outlen, key, keylen ) < 0 ) return -1;
+  }
+  else
+  {
+    if( blake2sp_init( S, outlen ) < 0 ) return -1;
+  }
+
+  if ( blake2sp_update( S, ( byte * )in, inlen ) < 0) return -1;
+
+  return blake2sp_final( S, out, outlen );
+}
+
 #if defined(BLAKE2S_SELFTEST)
 #include <string.h>
 #include "blake2-kat.h"
@@ -440,6 +769,35 @@ int wc_Blake2sFinal(Blake2s* b2s, byte* final, word32 requestSz)
 }
 
 
+
+/* Init Blake2sp digest, track size in case final doesn't want to "remember" */
+int wc_InitBlake2sp(Blake2sp* b2sp, word32 digestSz)
+{
+    if (b2sp == NULL){
+        return -1;
+    }
+    b2sp->digestSz = digestSz;
+
+    return blake2sp_init(b2sp->S, (byte)digestSz);
+}
+
+
+/* Blake2sp Update */
+int wc_Blake2spUpdate(Blake2sp* b2sp, const byte* data, word32 sz)
+{
+    return blake2sp_update(b2sp->S, data, sz);
+}
+
+
+/* Blake2sp Final, if pass in zero size we use init digestSz */
+int wc_Blake2spFinal(Blake2sp* b2sp, byte* final, word32 requestSz)
+{
+    word32 sz = requestSz ? requestSz : b2sp->digestSz;
+
+    return blake2sp_final(b2sp->S, final, (byte)sz);
+}
+
+
 /* end CTaoCrypt API */
 
 #endif  /* HAVE_BLAKE2S */
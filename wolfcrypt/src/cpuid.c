@@ -39,12 +39,20 @@
             __asm__ __volatile__ ("cpuid":\
                 "=a" (reg[0]), "=b" (reg[1]), "=c" (reg[2]), "=d" (reg[3]) :\
                 "a" (leaf), "c"(sub));
+        #define xgetbv(reg, xcr)\
+            __asm__ __volatile__ ("xgetbv":\
+                "=a" (reg[0]), "=d" (reg[1]) : "c" (xcr));
 
         #define XASM_LINK(f) asm(f)
     #else
         #include <intrin.h>
 
         #define cpuid(a,b,c) __cpuidex((int*)a,b,c)
+        #define xgetbv(reg, xcr) {\
+            unsigned __int64 xcr_val = _xgetbv(xcr);\
+            reg[0] = (unsigned int)xcr_val;\
+            reg[1] = (unsigned int)(xcr_val >> 32);\
+        }
 
         #define XASM_LINK(f)
     #endif /* _MSC_VER */
@@ -86,6 +94,19 @@
         return 0;
     }
 
+    /* The OS must save the opmask and all of the ZMM registers, XCR0 bits 1, 2
+     * and 5 to 7, before AVX-512 instructions can be used */
+    static int cpuid_avx512_os(void)
+    {
+        unsigned int reg[2];
+
+        /* OSXSAVE: XGETBV is available */
+        if (!cpuid_flag(1, 0, ECX, 27))
+            return 0;
+        xgetbv(reg, 0);
+        return (reg[0] & 0xE6) == 0xE6;
+    }
+
 
     void cpuid_set_flags(void)
     {
@@ -98,6 +119,19 @@
             if (cpuid_flag(1, 0, ECX, 25)) { cpuid_flags |= CPUID_AESNI ; }
             if (cpuid_flag(7, 0, EBX, 19)) { cpuid_flags |= CPUID_ADX   ; }
             if (cpuid_flag(1, 0, ECX, 22)) { cpuid_flags |= CPUID_MOVBE ; }
+            if (cpuid_flag(7, 0, EBX, 29)) { cpuid_flags |= CPUID_SHA     ; }
+            if (cpuid_avx512_os()) {
+                if (cpuid_flag(7, 0, EBX, 16)) { cpuid_flags |= CPUID_AVX512F; }
+                if (cpuid_flag(7, 0, EBX, 30)) { cpuid_flags |= CPUID_AVX512BW;}
+                if (cpuid_flag(7, 0, ECX,  9)) { cpuid_flags |= CPUID_VAES   ; }
+                if (cpuid_flag(7, 0, ECX, 10)) {
+                    cpuid_flags |= CPUID_VPCLMULQDQ;
+                }
+                if (cpuid_flag(7, 0, EBX, 31)) { cpuid_flags |= CPUID_AVX512VL;}
+                if (cpuid_flag(7, 0, EBX, 21)) {
+                    cpuid_flags |= CPUID_AVX512IFMA;
+                }
+            }
             cpuid_check = 1;
         }
     }
@@ -108,4 +142,12 @@
             cpuid_set_flags();
         return cpuid_flags;
     }
+
+    /* Replace the detected flags, e.g. to test the code for other CPUs.
+     * Only flags of features that the CPU has may be selected. */
+    void cpuid_select_flags(word32 flags)
+    {
+        cpuid_flags = flags;
+        cpuid_check = 1;
+    }
 #endif
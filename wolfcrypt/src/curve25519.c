@@ -44,6 +44,14 @@
     #include <wolfssl/wolfcrypt/port/nxp/ksdk_port.h>
 #endif
 
+#if defined(HAVE_ED25519) && !defined(ED25519_SMALL) && \
+    !defined(CURVE25519_SMALL) && !defined(FREESCALE_LTC_ECC) && \
+    !defined(NO_CURVE25519_ED_BASE)
+    /* Calculate public keys with the Ed25519 base point table */
+    #define CURVE25519_ED_BASE
+    #include <wolfssl/wolfcrypt/ge_operations.h>
+#endif
+
 const curve25519_set_type curve25519_sets[] = {
     {
         CURVE25519_KEYSIZE,
@@ -51,12 +59,85 @@ const curve25519_set_type curve25519_sets[] = {
     }
 };
 
-int wc_curve25519_make_key(WC_RNG* rng, int keysize, curve25519_key* key)
+#ifndef FREESCALE_LTC_ECC
+/* Calculate the public key - the u-coordinate of priv.B where B has u = 9.
+ * With the Ed25519 base point table, priv.B is calculated on the birationally
+ * equivalent Edwards curve, which is faster than the Montgomery ladder, and
+ * mapped: u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y)
+ *
+ * pub   Public key - u-coordinate.
+ * priv  Private key - clamped scalar.
+ * returns 0 on success.
+ */
+static int curve25519_base(byte* pub, const byte* priv)
+{
+#ifdef CURVE25519_ED_BASE
+    ge_p3 A;
+    fe    n;
+    fe    d;
+
+    ge_scalarmult_base(&A, priv);
+    fe_add(n, A.Z, A.Y);
+    fe_sub(d, A.Z, A.Y);
+    fe_invert(d, d);
+    fe_mul(n, n, d);
+    fe_tobytes(pub, n);
+
+    return 0;
+#else
+    unsigned char basepoint[CURVE25519_KEYSIZE] = {9};
+
+    return curve25519(pub, (byte*)priv, basepoint);
+#endif
+}
+#endif /* !FREESCALE_LTC_ECC */
+
+/* Calculate the public key from a clamped private key.
+ *
+ * public_size   Size of the public key buffer. Must be CURVE25519_KEYSIZE.
+ * pub           Buffer to hold the public key - little-endian.
+ * private_size  Size of the private key. Must be CURVE25519_KEYSIZE.
+ * priv          Private key - little-endian and clamped.
+ * returns ECC_BAD_ARG_E when a parameter is invalid and 0 on success.
+ */
+int wc_curve25519_make_pub(int public_size, byte* pub, int private_size,
+                           const byte* priv)
 {
 #ifdef FREESCALE_LTC_ECC
     const ECPoint* basepoint = wc_curve25519_GetBasePoint();
+    ECPoint wc_pub;
+#endif
+    int ret;
+
+    if (pub == NULL || priv == NULL)
+        return ECC_BAD_ARG_E;
+
+    if (public_size != CURVE25519_KEYSIZE ||
+                                          private_size != CURVE25519_KEYSIZE)
+        return ECC_BAD_ARG_E;
+
+    /* check clamping */
+    if ((priv[0] & ~248) != 0 || (priv[CURVE25519_KEYSIZE-1] & 128) != 0)
+        return ECC_BAD_ARG_E;
+
+#ifdef FREESCALE_LTC_ECC
+    /* input basepoint on Weierstrass curve */
+    ret = wc_curve25519(&wc_pub, (byte*)priv, basepoint, kLTC_Weierstrass);
+    if (ret == 0)
+        XMEMCPY(pub, wc_pub.point, CURVE25519_KEYSIZE);
 #else
-    unsigned char basepoint[CURVE25519_KEYSIZE] = {9};
+    fe_init();
+
+    ret = curve25519_base(pub, priv);
+#endif
+
+    return ret;
+}
+
+int wc_curve25519_make_key(WC_RNG* rng, int keysize, curve25519_key* key)
+{
+#ifdef FREESCALE_LTC_ECC
+    const ECPoint* basepoint = wc_curve25519_GetBasePoint();
 #endif
     int  ret;
 
@@ -85,7 +166,7 @@ int wc_curve25519_make_key(WC_RNG* rng, int keysize, curve25519_key* key)
     #ifdef FREESCALE_LTC_ECC
         ret = wc_curve25519(&key->p, key->k.point, basepoint, kLTC_Weierstrass); /* input basepoint on Weierstrass curve */
     #else
-        ret = curve25519(key->p.point, key->k.point, basepoint);
+        ret = curve25519_base(key->p.point, key->k.point);
     #endif
     if (ret != 0) {
         ForceZero(key->k.point, keysize);
@@ -1158,6 +1158,44 @@ static int GeneratePrivateDh186(DhKey* key, WC_RNG* rng, byte* priv,
     return err;
 }
 #endif /* WOLFSSL_NO_DH186 */
+
+
+/* Size of a short private key for a prime of the given size.
+ *
+ * sz  Size of the prime in bytes.
+ * returns the size of the private key in bytes, 0 when not supported.
+ */
+static word32 DhPrivSz(word32 sz)
+{
+    /* Table of predetermined values from the operation
+       2 * DiscreteLogWorkFactor(sz * WOLFSSL_BIT_SIZE) /
+       WOLFSSL_BIT_SIZE + 1
+       Sizes in table checked against RFC 3526
+     */
+    WOLFSSL_DH_ROUND(sz); /* if using fixed points only, then round up */
+    switch (sz) {
+        case 128:  sz = 21; break;
+        case 256:  sz = 29; break;
+        case 384:  sz = 34; break;
+        case 512:  sz = 39; break;
+        case 640:  sz = 42; break;
+        case 768:  sz = 46; break;
+        case 896:  sz = 49; break;
+        case 1024: sz = 52; break;
+        default:
+        #ifndef WOLFSSL_DH_CONST
+            /* if using floating points and size of p is not in table */
+            sz = min(sz, 2 * DiscreteLogWorkFactor(sz * WOLFSSL_BIT_SIZE) /
+                                       WOLFSSL_BIT_SIZE + 1);
+            break;
+        #else
+            sz = 0;
+            break;
+        #endif
+    }
+
+    return sz;
+}
 #endif /* !WC_NO_RNG */
 
 static int GeneratePrivateDh(DhKey* key, WC_RNG* rng, byte* priv,
@@ -1168,7 +1206,10 @@ static int GeneratePrivateDh(DhKey* key, WC_RNG* rng, byte* priv,
     word32 sz = 0;
 
 #ifndef WOLFSSL_NO_DH186
-    if (mp_iszero(&key->q) == MP_NO) {
+    /* Safe prime groups, q = (p-1)/2, like FFDHE use short private keys
+     * (SP 800-56A Rev. 3, 5.6.1.1.4). */
+    if (mp_iszero(&key->q) == MP_NO &&
+            mp_count_bits(&key->q) != mp_count_bits(&key->p) - 1) {
 
         /* q param available, use NIST FIPS 186-4, "B.1.1 Key Pair
          * Generation Using Extra Random Bits" */
@@ -1178,33 +1219,9 @@ static int GeneratePrivateDh(DhKey* key, WC_RNG* rng, byte* priv,
 #endif
     {
 
-        sz = mp_unsigned_bin_size(&key->p);
-
-        /* Table of predetermined values from the operation
-           2 * DiscreteLogWorkFactor(sz * WOLFSSL_BIT_SIZE) /
-           WOLFSSL_BIT_SIZE + 1
-           Sizes in table checked against RFC 3526
-         */
-        WOLFSSL_DH_ROUND(sz); /* if using fixed points only, then round up */
-        switch (sz) {
-            case 128:  sz = 21; break;
-            case 256:  sz = 29; break;
-            case 384:  sz = 34; break;
-            case 512:  sz = 39; break;
-            case 640:  sz = 42; break;
-            case 768:  sz = 46; break;
-            case 896:  sz = 49; break;
-            case 1024: sz = 52; break;
-            default:
-            #ifndef WOLFSSL_DH_CONST
-                /* if using floating points and size of p is not in table */
-                sz = min(sz, 2 * DiscreteLogWorkFactor(sz * WOLFSSL_BIT_SIZE) /
-                                           WOLFSSL_BIT_SIZE + 1);
-                break;
-            #else
-                return BAD_FUNC_ARG;
-            #endif
-        }
+        sz = DhPrivSz(mp_unsigned_bin_size(&key->p));
+        if (sz == 0)
+            return BAD_FUNC_ARG;
 
         ret = wc_RNG_GenerateBlock(rng, priv, sz);
 
@@ -1225,6 +1242,155 @@ static int GeneratePrivateDh(DhKey* key, WC_RNG* rng, byte* priv,
 }
 
 
+#ifdef WC_DH_PRECOMP
+typedef int (*DhPrecompGenFunc)(const byte* mod, word32 modSz, int bits,
+                                void** table, void* heap);
+typedef int (*DhPrecompExpFunc)(const void* table, const byte* exp,
+                                word32 expLen, mp_int* mod, byte* out,
+                                word32* outLen);
+
+/* FFDHE group with a comb table of powers of its generator, 2. */
+typedef struct DhPrecompGroup {
+    const byte*      p;     /* prime of the group */
+    word32           pSz;   /* size of the prime in bytes */
+    DhPrecompGenFunc gen;   /* generates the table */
+    DhPrecompExpFunc exp;   /* exponentiates with the table */
+} DhPrecompGroup;
+
+static const DhPrecompGroup dhPrecompGroups[] = {
+#if defined(HAVE_FFDHE_2048) && !defined(WOLFSSL_SP_NO_2048)
+    { dh_ffdhe2048_p, sizeof(dh_ffdhe2048_p),
+      sp_DhPrecomp_2048, sp_DhExp_precomp_2048 },
+#endif
+#if defined(HAVE_FFDHE_3072) && !defined(WOLFSSL_SP_NO_3072)
+    { dh_ffdhe3072_p, sizeof(dh_ffdhe3072_p),
+      sp_DhPrecomp_3072, sp_DhExp_precomp_3072 },
+#endif
+#if defined(HAVE_FFDHE_4096) && defined(WOLFSSL_SP_4096)
+    { dh_ffdhe4096_p, sizeof(dh_ffdhe4096_p),
+      sp_DhPrecomp_4096, sp_DhExp_precomp_4096 },
+#endif
+#if defined(HAVE_FFDHE_8192) && defined(WOLFSSL_SP_8192)
+    { dh_ffdhe8192_p, sizeof(dh_ffdhe8192_p),
+      sp_DhPrecomp_8192, sp_DhExp_precomp_8192 },
+#endif
+    { NULL, 0, NULL, NULL }
+};
+
+#define DH_PRECOMP_GROUP_CNT \
+    (sizeof(dhPrecompGroups) / sizeof(*dhPrecompGroups))
+
+/* cache of the tables, generated on first use and shared by all keys */
+static void* dhPrecompTable[DH_PRECOMP_GROUP_CNT];
+#ifndef SINGLE_THREADED
+    static volatile int dhPrecompMutexInit = 0;
+    static wolfSSL_Mutex dhPrecompMutex;
+#endif
+
+int wc_DhPrecompInit(void)
+{
+    int ret = 0;
+#ifndef SINGLE_THREADED
+    if (dhPrecompMutexInit == 0) {
+        ret = wc_InitMutex(&dhPrecompMutex);
+        if (ret == 0)
+            dhPrecompMutexInit = 1;
+    }
+#endif
+    return ret;
+}
+
+void wc_DhPrecompFree(void)
+{
+    int i;
+
+    for (i = 0; i < (int)DH_PRECOMP_GROUP_CNT; i++) {
+        if (dhPrecompTable[i] != NULL) {
+            XFREE(dhPrecompTable[i], NULL, DYNAMIC_TYPE_DH);
+            dhPrecompTable[i] = NULL;
+        }
+    }
+
+#ifndef SINGLE_THREADED
+    if (dhPrecompMutexInit != 0) {
+        wc_FreeMutex(&dhPrecompMutex);
+        dhPrecompMutexInit = 0;
+    }
+#endif
+}
+
+/* Get the comb table of a group, generating it on first use.
+ *
+ * i      Index of the group.
+ * table  Comb table of the group.
+ * returns 0 on success, otherwise failure.
+ */
+static int DhPrecompGetTable(int i, const void** table)
+{
+    int ret = 0;
+    const DhPrecompGroup* grp = &dhPrecompGroups[i];
+
+#ifndef SINGLE_THREADED
+    /* extra sanity check if wolfCrypt_Init not called */
+    ret = wc_DhPrecompInit();
+    if (ret == 0)
+        ret = wc_LockMutex(&dhPrecompMutex);
+    if (ret != 0)
+        return ret;
+#endif
+
+    if (dhPrecompTable[i] == NULL) {
+        ret = grp->gen(grp->p, grp->pSz,
+                       (int)DhPrivSz(grp->pSz) * WOLFSSL_BIT_SIZE,
+                       &dhPrecompTable[i], NULL);
+    }
+    *table = dhPrecompTable[i];
+
+#ifndef SINGLE_THREADED
+    wc_UnLockMutex(&dhPrecompMutex);
+#endif
+
+    return ret;
+}
+
+/* Calculate the public key with a comb table of powers of 2 when the group
+ * is an FFDHE group and the private key is short.
+ *
+ * returns NOT_COMPILED_IN when there is no table for the key, 0 on success
+ * and otherwise failure.
+ */
+static int GeneratePublicDhPrecomp(DhKey* key, byte* priv, word32 privSz,
+    byte* pub, word32* pubSz)
+{
+    int ret = NOT_COMPILED_IN;
+    int i;
+    word32 pSz;
+    const void* table = NULL;
+
+    if (mp_cmp_d(&key->g, 2) != MP_EQ)
+        return NOT_COMPILED_IN;
+
+    pSz = mp_unsigned_bin_size(&key->p);
+    for (i = 0; dhPrecompGroups[i].p != NULL; i++) {
+        if (dhPrecompGroups[i].pSz == pSz)
+            break;
+    }
+    if (dhPrecompGroups[i].p == NULL || privSz > DhPrivSz(pSz))
+        return NOT_COMPILED_IN;
+
+    ret = DhPrecompGetTable(i, &table);
+    if (ret == 0) {
+        ret = dhPrecompGroups[i].exp(table, priv, privSz, &key->p, pub,
+                                                                        pubSz);
+        /* prime is not of the FFDHE group */
+        if (ret == BAD_FUNC_ARG)
+            ret = NOT_COMPILED_IN;
+    }
+
+    return ret;
+}
+#endif /* WC_DH_PRECOMP */
+
 static int GeneratePublicDh(DhKey* key, byte* priv, word32 privSz,
     byte* pub, word32* pubSz)
 {
@@ -1239,6 +1405,13 @@ static int GeneratePublicDh(DhKey* key, byte* priv, word32 privSz,
 #endif
 #endif
 
+#ifdef WC_DH_PRECOMP
+    ret = GeneratePublicDhPrecomp(key, priv, privSz, pub, pubSz);
+    if (ret != NOT_COMPILED_IN)
+        return ret;
+    ret = 0;
+#endif
+
 #ifdef WOLFSSL_HAVE_SP_DH
 #ifndef WOLFSSL_SP_NO_2048
     if (mp_count_bits(&key->p) == 2048)
@@ -1252,6 +1425,10 @@ static int GeneratePublicDh(DhKey* key, byte* priv, word32 privSz,
     if (mp_count_bits(&key->p) == 4096)
         return sp_DhExp_4096(&key->g, priv, privSz, &key->p, pub, pubSz);
 #endif
+#ifdef WOLFSSL_SP_8192
+    if (mp_count_bits(&key->p) == 8192)
+        return sp_DhExp_8192(&key->g, priv, privSz, &key->p, pub, pubSz);
+#endif
 #endif
 
 #ifndef WOLFSSL_SP_MATH
@@ -1493,6 +1670,14 @@ int wc_DhCheckPubKey_ex(DhKey* key, const byte* pub, word32 pubSz,
         }
         else
 #endif
+#ifdef WOLFSSL_SP_8192
+        if (mp_count_bits(&key->p) == 8192) {
+            ret = sp_ModExp_8192(y, q, p, y);
+            if (ret != 0)
+                ret = MP_EXPTMOD_E;
+        }
+        else
+#endif
 #endif
 
         {
@@ -1780,6 +1965,14 @@ int wc_DhCheckKeyPair(DhKey* key, const byte* pub, word32 pubSz,
         }
         else
 #endif
+#ifdef WOLFSSL_SP_8192
+        if (mp_count_bits(&key->p) == 8192) {
+            ret = sp_ModExp_8192(&key->g, privateKey, &key->p, checkKey);
+            if (ret != 0)
+                ret = MP_EXPTMOD_E;
+        }
+        else
+#endif
 #endif
         {
 #ifndef WOLFSSL_SP_MATH
@@ -1951,6 +2144,28 @@ static int wc_DhAgree_Sync(DhKey* key, byte* agree, word32* agreeSz,
         return ret;
     }
 #endif
+#ifdef WOLFSSL_SP_8192
+    if (mp_count_bits(&key->p) == 8192) {
+        if (mp_init(y) != MP_OKAY)
+            return MP_INIT_E;
+
+        if (ret == 0 && mp_read_unsigned_bin(y, otherPub, pubSz) != MP_OKAY)
+            ret = MP_READ_E;
+
+        if (ret == 0)
+            ret = sp_DhExp_8192(y, priv, privSz, &key->p, agree, agreeSz);
+
+        mp_clear(y);
+    #ifdef WOLFSSL_SMALL_STACK
+    #ifndef WOLFSSL_SP_MATH
+        XFREE(z, key->heap, DYNAMIC_TYPE_DH);
+        XFREE(x, key->heap, DYNAMIC_TYPE_DH);
+    #endif
+        XFREE(y, key->heap, DYNAMIC_TYPE_DH);
+    #endif
+        return ret;
+    }
+#endif
 #endif
 
 #ifndef WOLFSSL_SP_MATH
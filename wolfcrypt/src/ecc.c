@@ -1897,6 +1897,12 @@ done:
         return sp_ecc_proj_add_point_384(P->x, P->y, P->z, Q->x, Q->y, Q->z,
                                          R->x, R->y, R->z);
     }
+#endif
+#ifdef WOLFSSL_SP_521
+    if (mp_count_bits(modulus) == 521) {
+        return sp_ecc_proj_add_point_521(P->x, P->y, P->z, Q->x, Q->y, Q->z,
+                                         R->x, R->y, R->z);
+    }
 #endif
     return ECC_BAD_ARG_E;
 #endif
@@ -2275,6 +2281,11 @@ int ecc_projective_dbl_point(ecc_point *P, ecc_point *R, mp_int* a,
     if (mp_count_bits(modulus) == 384) {
         return sp_ecc_proj_dbl_point_384(P->x, P->y, P->z, R->x, R->y, R->z);
     }
+#endif
+#ifdef WOLFSSL_SP_521
+    if (mp_count_bits(modulus) == 521) {
+        return sp_ecc_proj_dbl_point_521(P->x, P->y, P->z, R->x, R->y, R->z);
+    }
 #endif
     return ECC_BAD_ARG_E;
 #endif
@@ -2494,6 +2505,11 @@ done:
     if (mp_count_bits(modulus) == 384) {
         return sp_ecc_map_384(P->x, P->y, P->z);
     }
+#endif
+#ifdef WOLFSSL_SP_521
+    if (mp_count_bits(modulus) == 521) {
+        return sp_ecc_map_521(P->x, P->y, P->z);
+    }
 #endif
     return ECC_BAD_ARG_E;
 #endif
@@ -2994,6 +3010,11 @@ exit:
    if (mp_count_bits(modulus) == 384) {
        return sp_ecc_mulmod_384(k, G, R, map, heap);
    }
+#endif
+#ifdef WOLFSSL_SP_521
+   if (mp_count_bits(modulus) == 521) {
+       return sp_ecc_mulmod_521(k, G, R, map, heap);
+   }
 #endif
    return ECC_BAD_ARG_E;
 #endif
@@ -3650,6 +3671,13 @@ static int wc_ecc_shared_secret_gen_sync(ecc_key* private_key, ecc_point* point,
     }
     else
 #endif
+#ifdef WOLFSSL_SP_521
+    if (private_key->idx != ECC_CUSTOM_IDX &&
+                               ecc_sets[private_key->idx].id == ECC_SECP521R1) {
+        err = sp_ecc_secret_gen_521(k, point, out, outlen, private_key->heap);
+    }
+    else
+#endif
 #endif
 #ifdef WOLFSSL_SP_MATH
     {
@@ -4035,6 +4063,12 @@ static int wc_ecc_make_pub_ex(ecc_key* key, ecc_curve_spec* curveIn,
     }
     else
 #endif
+#ifdef WOLFSSL_SP_521
+    if (key->idx != ECC_CUSTOM_IDX && ecc_sets[key->idx].id == ECC_SECP521R1) {
+        err = sp_ecc_mulmod_base_521(&key->k, pub, 1, key->heap);
+    }
+    else
+#endif
 #endif
 #ifdef WOLFSSL_SP_MATH
         err = WC_KEY_SIZE_E;
@@ -4278,6 +4312,15 @@ int wc_ecc_make_key_ex(WC_RNG* rng, int keysize, ecc_key* key, int curve_id)
     }
     else
 #endif
+#ifdef WOLFSSL_SP_521
+    if (key->idx != ECC_CUSTOM_IDX && ecc_sets[key->idx].id == ECC_SECP521R1) {
+        err = sp_ecc_make_key_521(rng, &key->k, &key->pubkey, key->heap);
+        if (err == MP_OKAY) {
+            key->type = ECC_PRIVATEKEY;
+        }
+    }
+    else
+#endif
 #endif /* WOLFSSL_HAVE_SP_ECC */
 
    { /* software key gen */
@@ -4906,6 +4949,16 @@ int wc_ecc_sign_hash_ex(const byte* in, word32 inlen, WC_RNG* rng,
                                                                      key->heap);
     #endif
     }
+#endif
+#ifdef WOLFSSL_SP_521
+    if (key->idx != ECC_CUSTOM_IDX && ecc_sets[key->idx].id == ECC_SECP521R1) {
+    #ifndef WOLFSSL_ECDSA_SET_K
+        return sp_ecc_sign_521(in, inlen, rng, &key->k, r, s, NULL, key->heap);
+    #else
+        return sp_ecc_sign_521(in, inlen, rng, &key->k, r, s, key->sign_k,
+                                                                     key->heap);
+    #endif
+    }
 #endif
     return WC_KEY_SIZE_E;
 #else
@@ -4937,6 +4990,18 @@ int wc_ecc_sign_hash_ex(const byte* in, word32 inlen, WC_RNG* rng,
                                                                      key->heap);
         #endif
         }
+#endif
+#ifdef WOLFSSL_SP_521
+        if (key->idx != ECC_CUSTOM_IDX &&
+                                       ecc_sets[key->idx].id == ECC_SECP521R1) {
+        #ifndef WOLFSSL_ECDSA_SET_K
+            return sp_ecc_sign_521(in, inlen, rng, &key->k, r, s, NULL,
+                                                                     key->heap);
+        #else
+            return sp_ecc_sign_521(in, inlen, rng, &key->k, r, s, key->sign_k,
+                                                                     key->heap);
+        #endif
+        }
 #endif
     }
 #endif /* WOLFSSL_HAVE_SP_ECC */
@@ -5348,6 +5413,13 @@ int wc_ecc_free(ecc_key* key)
 
     mp_forcezero(&key->k);
 
+#ifdef WC_ECC_PRECOMP
+    if (key->precomp != NULL) {
+        XFREE(key->precomp, key->heap, DYNAMIC_TYPE_ECC);
+        key->precomp = NULL;
+    }
+#endif
+
 #ifdef WOLFSSL_CUSTOM_CURVES
     if (key->deallocSet && key->dp != NULL)
         wc_ecc_free_curve(key->dp, key->heap);
@@ -5826,8 +5898,252 @@ int wc_ecc_verify_hash(const byte* sig, word32 siglen, const byte* hash,
 
     return err;
 }
+
+#if defined(WOLFSSL_HAVE_SP_ECC) && defined(SP_ECC_VERIFY_BATCH) && \
+    !defined(FREESCALE_LTC_ECC) && !defined(WOLFSSL_DSP) && \
+    !defined(WOLFSSL_STM32_PKA)
+    #define WC_ECC_VERIFY_BATCH
+#endif
+
+#ifdef WC_ECC_VERIFY_BATCH
+/* Whether the key's signatures can be verified in a batch */
+static int wc_ecc_verify_batch_key(ecc_key* key)
+{
+    if (wc_ecc_is_valid_idx(key->idx) != 1 || key->idx == ECC_CUSTOM_IDX ||
+            ecc_sets[key->idx].id != ECC_SECP256R1) {
+        return 0;
+    }
+    /* public part made by the verify of one signature */
+    if (key->type == ECC_PRIVATEKEY_ONLY) {
+        return 0;
+    }
+#ifdef WOLF_CRYPTO_CB
+    if (key->devId != INVALID_DEVID) {
+        return 0;
+    }
+#endif
+#if defined(WOLFSSL_ASYNC_CRYPT) && defined(WC_ASYNC_ENABLE_ECC)
+    if (key->asyncDev.marker == WOLFSSL_ASYNC_MARKER_ECC) {
+        return 0;
+    }
+#endif
+
+    return 1;
+}
+
+/* Verify the decoded signatures rs of items idx together, each one on its
+ * own when that fails. Clears rs. */
+static int wc_ecc_verify_batch_sp(mp_int* rs, const word32* idx, int cnt,
+    const byte** hash, const word32* hashlen, int* res, ecc_key** key)
+{
+    const byte* bHash[SP_ECC_VERIFY_BATCH];
+    word32      bHashLen[SP_ECC_VERIFY_BATCH];
+    mp_int*     bX[SP_ECC_VERIFY_BATCH];
+    mp_int*     bY[SP_ECC_VERIFY_BATCH];
+    mp_int*     bZ[SP_ECC_VERIFY_BATCH];
+    mp_int*     bR[SP_ECC_VERIFY_BATCH];
+    mp_int*     bS[SP_ECC_VERIFY_BATCH];
+    int         bRes[SP_ECC_VERIFY_BATCH];
+    int         err = MP_OKAY;
+    int         batchErr;
+    int         ret;
+    int         i;
+
+    if (cnt <= 0 || cnt > SP_ECC_VERIFY_BATCH) {
+        return BAD_FUNC_ARG;
+    }
+
+    for (i = 0; i < cnt; i++) {
+        bHash[i]    = hash[idx[i]];
+        bHashLen[i] = hashlen[idx[i]];
+        bX[i]       = key[idx[i]]->pubkey.x;
+        bY[i]       = key[idx[i]]->pubkey.y;
+        bZ[i]       = key[idx[i]]->pubkey.z;
+        bR[i]       = &rs[2 * i];
+        bS[i]       = &rs[2 * i + 1];
+    }
+
+    batchErr = sp_ecc_verify_256_batch(bHash, bHashLen, bX, bY, bZ, bR, bS,
+                                       bRes, cnt, key[idx[0]]->heap);
+    for (i = 0; i < cnt; i++) {
+        if (batchErr == MP_OKAY) {
+            res[idx[i]] = bRes[i];
+        }
+        else {
+            /* fall back to verifying one at a time */
+            ret = wc_ecc_verify_hash_ex(bR[i], bS[i], hash[idx[i]],
+                                     hashlen[idx[i]], &res[idx[i]], key[idx[i]]);
+            if (ret != MP_OKAY && err == MP_OKAY) {
+                err = ret;
+            }
+        }
+        mp_clear(bR[i]);
+        mp_clear(bS[i]);
+    }
+
+    return err;
+}
+#endif /* WC_ECC_VERIFY_BATCH */
+
+/**
+ Verify a batch of ECC signatures
+ Signatures with P-256 keys are verified in batches that share the modular
+ inversion when the single precision math supports it. The others, and a
+ batch that fails, are verified one at a time.
+ sig         The signatures to verify
+ siglen      The lengths of the signatures (octets)
+ hash        The hashes (message digests) that were signed
+ hashlen     The lengths of the hashes (octets)
+ res         Results of the signatures, 1==valid, 0==invalid
+ key         The corresponding public ECC keys
+ count       The number of signatures
+ return      MP_OKAY if successful (even if signatures are not valid),
+             otherwise the first error of a signature, all are tried
+ */
+int wc_ecc_verify_hash_batch(const byte** sig, const word32* siglen,
+    const byte** hash, const word32* hashlen, int* res, ecc_key** key,
+    word32 count)
+{
+    int    err = MP_OKAY;
+    int    ret;
+    word32 i;
+#ifdef WC_ECC_VERIFY_BATCH
+    mp_int* rs = NULL;
+    word32  idx[SP_ECC_VERIFY_BATCH];
+    int     cnt = 0;
+#endif
+
+    if (sig == NULL || siglen == NULL || hash == NULL || hashlen == NULL ||
+                                                  res == NULL || key == NULL) {
+        return ECC_BAD_ARG_E;
+    }
+    for (i = 0; i < count; i++) {
+        if (sig[i] == NULL || hash[i] == NULL || key[i] == NULL) {
+            return ECC_BAD_ARG_E;
+        }
+        /* default to invalid signature */
+        res[i] = 0;
+    }
+
+#ifdef WC_ECC_VERIFY_BATCH
+    if (count > 1) {
+        /* r and s of each signature in the batch */
+        rs = (mp_int*)XMALLOC(sizeof(mp_int) * 2 * SP_ECC_VERIFY_BATCH,
+                                               key[0]->heap, DYNAMIC_TYPE_ECC);
+        /* decoding may fail before r and s are initialized - clear is safe */
+        if (rs != NULL) {
+            XMEMSET(rs, 0, sizeof(mp_int) * 2 * SP_ECC_VERIFY_BATCH);
+        }
+    }
+#endif
+
+    for (i = 0; i < count; i++) {
+    #ifdef WC_ECC_VERIFY_BATCH
+        if (rs != NULL && wc_ecc_verify_batch_key(key[i])) {
+            ret = DecodeECC_DSA_Sig(sig[i], siglen[i], &rs[2 * cnt],
+                                                           &rs[2 * cnt + 1]);
+            if (ret == 0) {
+                idx[cnt++] = i;
+            }
+            else {
+                mp_clear(&rs[2 * cnt]);
+                mp_clear(&rs[2 * cnt + 1]);
+            }
+        }
+        else
+    #endif
+        {
+            ret = wc_ecc_verify_hash(sig[i], siglen[i], hash[i], hashlen[i],
+                                                             &res[i], key[i]);
+        }
+        if (ret != MP_OKAY && err == MP_OKAY) {
+            err = ret;
+        }
+
+    #ifdef WC_ECC_VERIFY_BATCH
+        if (cnt == SP_ECC_VERIFY_BATCH || (cnt > 0 && i + 1 == count)) {
+            ret = wc_ecc_verify_batch_sp(rs, idx, cnt, hash, hashlen, res,
+                                                                          key);
+            if (ret != MP_OKAY && err == MP_OKAY) {
+                err = ret;
+            }
+            cnt = 0;
+        }
+    #endif
+    }
+
+#ifdef WC_ECC_VERIFY_BATCH
+    if (rs != NULL) {
+        XFREE(rs, key[0]->heap, DYNAMIC_TYPE_ECC);
+    }
+#endif
+
+    return err;
+}
 #endif /* !NO_ASN */
 
+#ifdef WC_ECC_PRECOMP
+/**
+   Set a table of public key points into the key to speed up verification.
+   Use with long-lived public keys on P-256 and P-384. The table has 2^bits
+   points of 64 (P-256) or 96 (P-384) bytes - more bits make verification
+   faster and use more memory. A table is not used after the public key
+   changes - call again to regenerate it.
+   key         The public ECC key
+   bits        Bits of scalar per table index, ECC_PRECOMP_MIN_BITS to
+               ECC_PRECOMP_MAX_BITS, or 0 to free the table
+   return      MP_OKAY on success, NOT_COMPILED_IN when the curve has no
+               table support
+*/
+int wc_ecc_set_precompute(ecc_key* key, int bits)
+{
+    int err = MP_OKAY;
+
+    if (key == NULL || (bits != 0 && (bits < ECC_PRECOMP_MIN_BITS ||
+                                               bits > ECC_PRECOMP_MAX_BITS))) {
+        return BAD_FUNC_ARG;
+    }
+
+    if (key->precomp != NULL) {
+        XFREE(key->precomp, key->heap, DYNAMIC_TYPE_ECC);
+        key->precomp = NULL;
+    }
+    if (bits == 0) {
+        return MP_OKAY;
+    }
+
+    if (wc_ecc_is_valid_idx(key->idx) != 1 || key->idx == ECC_CUSTOM_IDX) {
+        return ECC_BAD_ARG_E;
+    }
+    /* table is of the public point */
+    if (key->type == ECC_PRIVATEKEY_ONLY) {
+        err = wc_ecc_make_pub_ex(key, NULL, NULL);
+    }
+
+    if (err == MP_OKAY) {
+    #ifndef WOLFSSL_SP_NO_256
+        if (ecc_sets[key->idx].id == ECC_SECP256R1) {
+            err = sp_ecc_precomp_256(key->pubkey.x, key->pubkey.y,
+                             key->pubkey.z, bits, &key->precomp, key->heap);
+        }
+        else
+    #endif
+    #ifdef WOLFSSL_SP_384
+        if (ecc_sets[key->idx].id == ECC_SECP384R1) {
+            err = sp_ecc_precomp_384(key->pubkey.x, key->pubkey.y,
+                             key->pubkey.z, bits, &key->precomp, key->heap);
+        }
+        else
+    #endif
+        {
+            err = NOT_COMPILED_IN;
+        }
+    }
+
+    return err;
+}
+#endif /* WC_ECC_PRECOMP */
+
 
 /**
    Verify an ECC signature
@@ -5988,15 +6304,35 @@ int wc_ecc_verify_hash_ex(mp_int *r, mp_int *s, const byte* hash,
 #if defined(WOLFSSL_SP_MATH) && !defined(FREESCALE_LTC_ECC)
 #ifndef WOLFSSL_SP_NO_256
   if (key->idx != ECC_CUSTOM_IDX && ecc_sets[key->idx].id == ECC_SECP256R1) {
+  #ifdef WC_ECC_PRECOMP
+      if (key->precomp != NULL) {
+          return sp_ecc_verify_precomp_256(hash, hashlen, key->pubkey.x,
+                                  key->pubkey.y, key->pubkey.z, r, s,
+                                  key->precomp, res, key->heap);
+      }
+  #endif
       return sp_ecc_verify_256(hash, hashlen, key->pubkey.x, key->pubkey.y,
                                            key->pubkey.z, r, s, res, key->heap);
   }
 #endif
 #ifdef WOLFSSL_SP_384
   if (key->idx != ECC_CUSTOM_IDX && ecc_sets[key->idx].id == ECC_SECP384R1) {
+  #ifdef WC_ECC_PRECOMP
+      if (key->precomp != NULL) {
+          return sp_ecc_verify_precomp_384(hash, hashlen, key->pubkey.x,
+                                  key->pubkey.y, key->pubkey.z, r, s,
+                                  key->precomp, res, key->heap);
+      }
+  #endif
       return sp_ecc_verify_384(hash, hashlen, key->pubkey.x, key->pubkey.y,
                                            key->pubkey.z, r, s, res, key->heap);
   }
+#endif
+#ifdef WOLFSSL_SP_521
+  if (key->idx != ECC_CUSTOM_IDX && ecc_sets[key->idx].id == ECC_SECP521R1) {
+      return sp_ecc_verify_521(hash, hashlen, key->pubkey.x, key->pubkey.y,
+                                           key->pubkey.z, r, s, res, key->heap);
+  }
 #endif
   return WC_KEY_SIZE_E;
 #else
@@ -6008,6 +6344,13 @@ int wc_ecc_verify_hash_ex(mp_int *r, mp_int *s, const byte* hash,
 #ifndef WOLFSSL_SP_NO_256
         if (key->idx != ECC_CUSTOM_IDX &&
                                        ecc_sets[key->idx].id == ECC_SECP256R1) {
+        #ifdef WC_ECC_PRECOMP
+            if (key->precomp != NULL) {
+                return sp_ecc_verify_precomp_256(hash, hashlen, key->pubkey.x,
+                                         key->pubkey.y, key->pubkey.z, r, s,
+                                         key->precomp, res, key->heap);
+            }
+        #endif
             return sp_ecc_verify_256(hash, hashlen, key->pubkey.x,
                                          key->pubkey.y, key->pubkey.z,r, s, res,
                                          key->heap);
@@ -6016,11 +6359,26 @@ int wc_ecc_verify_hash_ex(mp_int *r, mp_int *s, const byte* hash,
 #ifdef WOLFSSL_SP_384
         if (key->idx != ECC_CUSTOM_IDX &&
                                        ecc_sets[key->idx].id == ECC_SECP384R1) {
+        #ifdef WC_ECC_PRECOMP
+            if (key->precomp != NULL) {
+                return sp_ecc_verify_precomp_384(hash, hashlen, key->pubkey.x,
+                                         key->pubkey.y, key->pubkey.z, r, s,
+                                         key->precomp, res, key->heap);
+            }
+        #endif
             return sp_ecc_verify_384(hash, hashlen, key->pubkey.x,
                                          key->pubkey.y, key->pubkey.z,r, s, res,
                                          key->heap);
         }
 #endif /* WOLFSSL_SP_384 */
+#ifdef WOLFSSL_SP_521
+        if (key->idx != ECC_CUSTOM_IDX &&
+                                       ecc_sets[key->idx].id == ECC_SECP521R1) {
+            return sp_ecc_verify_521(hash, hashlen, key->pubkey.x,
+                                         key->pubkey.y, key->pubkey.z,r, s, res,
+                                         key->heap);
+        }
+#endif /* WOLFSSL_SP_521 */
     }
 #endif /* WOLFSSL_HAVE_SP_ECC */
 
@@ -6434,6 +6792,13 @@ int wc_ecc_import_point_der_ex(byte* in, word32 inLen, const int curve_idx,
             sp_ecc_uncompress_384(point->x, pointType, point->y);
         }
         else
+    #endif
+    #ifdef WOLFSSL_SP_521
+        if (curve_idx != ECC_CUSTOM_IDX &&
+                                      ecc_sets[curve_idx].id == ECC_SECP521R1) {
+            sp_ecc_uncompress_521(point->x, pointType, point->y);
+        }
+        else
     #endif
         {
             err = WC_KEY_SIZE_E;
@@ -6830,6 +7195,11 @@ int wc_ecc_is_point(ecc_point* ecp, mp_int* a, mp_int* b, mp_int* prime)
    if (mp_count_bits(prime) == 384) {
        return sp_ecc_is_point_384(ecp->x, ecp->y);
    }
+#endif
+#ifdef WOLFSSL_SP_521
+   if (mp_count_bits(prime) == 521) {
+       return sp_ecc_is_point_521(ecp->x, ecp->y);
+   }
 #endif
    return WC_KEY_SIZE_E;
 #endif
@@ -6870,6 +7240,14 @@ static int ecc_check_privkey_gen(ecc_key* key, mp_int* a, mp_int* prime)
     }
     else
 #endif
+#ifdef WOLFSSL_SP_521
+    if (key->idx != ECC_CUSTOM_IDX && ecc_sets[key->idx].id == ECC_SECP521R1) {
+        if (err == MP_OKAY) {
+            err = sp_ecc_mulmod_base_521(&key->k, res, 1, key->heap);
+        }
+    }
+    else
+#endif
 #endif
     {
         base = wc_ecc_new_point_h(key->heap);
@@ -6980,6 +7358,13 @@ static int ecc_check_pubkey_order(ecc_key* key, ecc_point* pubkey, mp_int* a,
         }
         else
 #endif
+#ifdef WOLFSSL_SP_521
+        if (key->idx != ECC_CUSTOM_IDX &&
+                                       ecc_sets[key->idx].id == ECC_SECP521R1) {
+            err = sp_ecc_mulmod_521(order, pubkey, inf, 1, key->heap);
+        }
+        else
+#endif
 #endif
 #ifndef WOLFSSL_SP_MATH
             err = wc_ecc_mulmod_ex(order, pubkey, inf, a, prime, 1, key->heap);
@@ -7158,6 +7543,13 @@ int wc_ecc_check_key(ecc_key* key)
                                                                      key->heap);
     }
     else
+#endif
+#ifdef WOLFSSL_SP_521
+    if (key->idx != ECC_CUSTOM_IDX && ecc_sets[key->idx].id == ECC_SECP521R1) {
+        err = sp_ecc_check_key_521(key->pubkey.x, key->pubkey.y, &key->k,
+                                                                     key->heap);
+    }
+    else
 #endif
     {
         err = WC_KEY_SIZE_E;
@@ -7324,6 +7716,12 @@ int wc_ecc_import_x963_ex(const byte* in, word32 inLen, ecc_key* key,
             sp_ecc_uncompress_384(key->pubkey.x, pointType, key->pubkey.y);
         }
         else
+    #endif
+    #ifdef WOLFSSL_SP_521
+        if (key->dp->id == ECC_SECP521R1) {
+            sp_ecc_uncompress_521(key->pubkey.x, pointType, key->pubkey.y);
+        }
+        else
     #endif
         {
             err = WC_KEY_SIZE_E;
@@ -9609,6 +10007,11 @@ int wc_ecc_mulmod_ex(mp_int* k, ecc_point *G, ecc_point *R, mp_int* a,
     if (mp_count_bits(modulus) == 384) {
         return sp_ecc_mulmod_384(k, G, R, map, heap);
     }
+#endif
+#ifdef WOLFSSL_SP_521
+    if (mp_count_bits(modulus) == 521) {
+        return sp_ecc_mulmod_521(k, G, R, map, heap);
+    }
 #endif
     return WC_KEY_SIZE_E;
 #endif
@@ -52,6 +52,71 @@ static const byte ed25519Ctx[ED25519CTX_SIZE+1] =
                                              "SigEd25519 no Ed25519 collisions";
 #endif
 
+/*
+   Expands the private key into the clamped scalar and the prefix.
+   The key is only read so that it can be shared between threads.
+   key  Ed25519 key with private key set
+   az   buffer of ED25519_PRV_KEY_SIZE bytes to hold the expanded key
+   return  0 on success
+*/
+static int ed25519_expand_private(const ed25519_key* key, byte* az)
+{
+    int ret;
+
+#ifdef WC_ED25519_KEY_CACHE
+    if (key->azSet) {
+        XMEMCPY(az, key->az, ED25519_PRV_KEY_SIZE);
+        return 0;
+    }
+#endif
+
+    ret = wc_Sha512Hash(key->k, ED25519_KEY_SIZE, az);
+    if (ret == 0) {
+        /* apply clamp */
+        az[0]  &= 248;
+        az[31] &= 63; /* same than az[31] &= 127 because of az[31] |= 64 */
+        az[31] |= 64;
+    }
+
+    return ret;
+}
+
+/*
+   Call when the private key has changed. Fills the cache of the expanded
+   private key.
+   key  Ed25519 key with new private key
+   return  0 on success
+*/
+static int ed25519_private_set(ed25519_key* key)
+{
+    int ret = 0;
+
+#ifdef WC_ED25519_KEY_CACHE
+    key->azSet = 0;
+    ret = ed25519_expand_private(key, key->az);
+    if (ret == 0)
+        key->azSet = 1;
+#else
+    (void)key;
+#endif
+
+    return ret;
+}
+
+/*
+   Call when the public key has changed. Marks the public key as set and fills
+   the cache of the negated point. A public key that does not decode is not
+   cached and fails verification.
+   key  Ed25519 key with new public key
+*/
+static void ed25519_public_set(ed25519_key* key)
+{
+    key->pubKeySet = 1;
+#if defined(WC_ED25519_KEY_CACHE) && !defined(FREESCALE_LTC_ECC)
+    key->negASet = (ge_frombytes_negate_vartime(&key->negA, key->p) == 0);
+#endif
+}
+
 int wc_ed25519_make_public(ed25519_key* key, unsigned char* pubKey,
                            word32 pubKeySz)
 {
@@ -65,13 +130,8 @@ int wc_ed25519_make_public(ed25519_key* key, unsigned char* pubKey,
         ret = BAD_FUNC_ARG;
 
     if (ret == 0)
-        ret = wc_Sha512Hash(key->k, ED25519_KEY_SIZE, az);
+        ret = ed25519_expand_private(key, az);
     if (ret == 0) {
-        /* apply clamp */
-        az[0]  &= 248;
-        az[31] &= 63; /* same than az[31] &= 127 because of az[31] |= 64 */
-        az[31] |= 64;
-
     #ifdef FREESCALE_LTC_ECC
         ltc_pkha_ecc_point_t publicKey = {0};
         publicKey.X = key->pointX;
@@ -102,11 +162,18 @@ int wc_ed25519_make_key(WC_RNG* rng, int keySz, ed25519_key* key)
     if (keySz != ED25519_KEY_SIZE)
         return BAD_FUNC_ARG;
 
+#ifdef WC_ED25519_KEY_CACHE
+    key->azSet = 0;
+    key->negASet = 0;
+#endif
+
     ret  = wc_RNG_GenerateBlock(rng, key->k, ED25519_KEY_SIZE);
     if (ret != 0)
         return ret;
 
-    ret = wc_ed25519_make_public(key, key->p, ED25519_PUB_KEY_SIZE);
+    ret = ed25519_private_set(key);
+    if (ret == 0)
+        ret = wc_ed25519_make_public(key, key->p, ED25519_PUB_KEY_SIZE);
     if (ret != 0) {
         ForceZero(key->k, ED25519_KEY_SIZE);
         return ret;
@@ -115,7 +182,7 @@ int wc_ed25519_make_key(WC_RNG* rng, int keySz, ed25519_key* key)
     /* put public key after private key, on the same buffer */
     XMEMMOVE(key->k + ED25519_KEY_SIZE, key->p, ED25519_PUB_KEY_SIZE);
 
-    key->pubKeySet = 1;
+    ed25519_public_set(key);
 
     return ret;
 }
@@ -166,15 +233,10 @@ static int ed25519_sign_msg(const byte* in, word32 inLen, byte* out,
 
     /* step 1: create nonce to use where nonce is r in
        r = H(h_b, ... ,h_2b-1,M) */
-    ret = wc_Sha512Hash(key->k, ED25519_KEY_SIZE, az);
+    ret = ed25519_expand_private(key, az);
     if (ret != 0)
         return ret;
 
-    /* apply clamp */
-    az[0]  &= 248;
-    az[31] &= 63; /* same than az[31] &= 127 because of az[31] |= 64 */
-    az[31] |= 64;
-
     ret = wc_InitSha512(&sha);
     if (ret != 0)
         return ret;
@@ -333,6 +395,30 @@ int wc_ed25519ph_sign_msg(const byte* in, word32 inLen, byte* out,
 
 #ifdef HAVE_ED25519_VERIFY
 
+#ifndef FREESCALE_LTC_ECC
+/*
+   Decodes the public key into a point and negates it, for verification.
+   The key is only read so that it can be shared between threads.
+   key  Ed25519 key with public key set
+   A    point to hold -A
+   return  0 on success and BAD_FUNC_ARG when the public key is not valid
+*/
+static int ed25519_neg_public(const ed25519_key* key, ge_p3* A)
+{
+#ifdef WC_ED25519_KEY_CACHE
+    if (key->negASet) {
+        XMEMCPY(A, &key->negA, sizeof(ge_p3));
+        return 0;
+    }
+#endif
+
+    if (ge_frombytes_negate_vartime(A, key->p) != 0)
+        return BAD_FUNC_ARG;
+
+    return 0;
+}
+#endif /* !FREESCALE_LTC_ECC */
+
 /*
    sig     is array of bytes containing the signature
    sigLen  is the length of sig byte array
@@ -370,8 +456,9 @@ static int ed25519_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
 
     /* uncompress A (public key), test if valid, and negate it */
 #ifndef FREESCALE_LTC_ECC
-    if (ge_frombytes_negate_vartime(&A, key->p) != 0)
-        return BAD_FUNC_ARG;
+    ret = ed25519_neg_public(key, &A);
+    if (ret != 0)
+        return ret;
 #endif
 
     /* find H(R,A,M) and store it as h */
@@ -506,16 +593,263 @@ int wc_ed25519ph_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
     return wc_ed25519ph_verify_hash(sig, sigLen, hash, sizeof(hash), res, key,
                                                            context, contextLen);
 }
+
+#if !defined(FREESCALE_LTC_ECC) && !defined(ED25519_SMALL)
+/* Number of signatures checked with one multi-scalar multiplication. */
+#ifndef ED25519_VERIFY_BATCH
+    #define ED25519_VERIFY_BATCH    32
+#endif
+
+/* Working data for checking a chunk of signatures together. */
+typedef struct ed25519_batch {
+    ge_p3 p[2 * ED25519_VERIFY_BATCH];                   /* -R and -A */
+    byte  s[2 * ED25519_VERIFY_BATCH][ED25519_KEY_SIZE]; /* their scalars */
+    byte  h[ED25519_VERIFY_BATCH][WC_SHA512_DIGEST_SIZE];
+    int   a[ED25519_VERIFY_BATCH];                       /* index of -A */
+} ed25519_batch;
+
+/* Checks the encoded y-ordinate is less than the prime 2^255 - 19.
+ *
+ * y  Little endian encoding of y-ordinate with sign of x in top bit.
+ * returns 1 when reduced and 0 otherwise.
+ */
+static int ed25519_y_reduced(const byte* y)
+{
+    int i;
+
+    if ((y[ED25519_PUB_KEY_SIZE-1] & 0x7f) != 0x7f)
+        return 1;
+    for (i = ED25519_PUB_KEY_SIZE - 2; i > 0; i--) {
+        if (y[i] != 0xff)
+            return 1;
+    }
+    return y[0] < 0xed;
+}
+
+/* Checks a chunk of signatures with one combined equation.
+ *
+ * With 128-bit random z[i] the equations SB = R + hA of the signatures are
+ * summed as:
+ *   8 * ((sum z[i].S[i])B + sum z[i].(-R[i]) + sum (z[i].h[i]).(-A[i])) = 0
+ * The z[i] are derived by hashing every h[i] and S[i] so that no signature
+ * can be chosen to cancel the error in another. Repeated public keys share
+ * one point.
+ *
+ * sig     Signatures to verify.
+ * sigLen  Lengths of the signatures.
+ * msg     Messages that were signed.
+ * msgLen  Lengths of the messages.
+ * key     Ed25519 public keys.
+ * cnt     Number of signatures. Maximum of ED25519_VERIFY_BATCH.
+ * returns 0 when all signatures are valid, SIG_VERIFY_E when one or more is
+ * not and other negative values on error.
+ */
+static int ed25519_verify_msg_batch_chunk(const byte** sig,
+    const word32* sigLen, const byte** msg, const word32* msgLen,
+    ed25519_key** key, word32 cnt)
+{
+    static const byte identity[ED25519_PUB_KEY_SIZE] = { 1 };
+    ed25519_batch* b;
+    wc_Sha512 sha;
+    byte   seed[WC_SHA512_DIGEST_SIZE];
+    byte   digest[WC_SHA512_DIGEST_SIZE];
+    byte   z[ED25519_KEY_SIZE];
+    byte   sb[ED25519_KEY_SIZE];
+    byte   idx;
+    byte   check[ED25519_PUB_KEY_SIZE];
+    ge_p2  sum;
+    word32 i;
+    word32 j;
+    int    n = 0;
+    int    ret = 0;
+
+    b = (ed25519_batch*)XMALLOC(sizeof(ed25519_batch), key[0]->heap,
+                                                          DYNAMIC_TYPE_ED25519);
+    if (b == NULL)
+        return MEMORY_E;
+
+    /* find H(R,A,M) of each signature */
+    for (i = 0; ret == 0 && i < cnt; i++) {
+        if (sigLen[i] < ED25519_SIG_SIZE ||
+                (sig[i][ED25519_SIG_SIZE-1] & 224) ||
+                !ed25519_y_reduced(sig[i])) {
+            ret = BAD_FUNC_ARG;
+            break;
+        }
+        ret = wc_InitSha512(&sha);
+        if (ret != 0)
+            break;
+        ret = wc_Sha512Update(&sha, sig[i], ED25519_SIG_SIZE/2);
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, key[i]->p, ED25519_PUB_KEY_SIZE);
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, msg[i], msgLen[i]);
+        if (ret == 0)
+            ret = wc_Sha512Final(&sha, b->h[i]);
+        wc_Sha512Free(&sha);
+        if (ret == 0)
+            sc_reduce(b->h[i]);
+    }
+
+    /* seed for the random multipliers */
+    if (ret == 0)
+        ret = wc_InitSha512(&sha);
+    if (ret == 0) {
+        for (i = 0; ret == 0 && i < cnt; i++) {
+            ret = wc_Sha512Update(&sha, b->h[i], ED25519_KEY_SIZE);
+            if (ret == 0) {
+                ret = wc_Sha512Update(&sha, sig[i] + ED25519_SIG_SIZE/2,
+                                                           ED25519_SIG_SIZE/2);
+            }
+        }
+        if (ret == 0)
+            ret = wc_Sha512Final(&sha, seed);
+        wc_Sha512Free(&sha);
+    }
+
+    XMEMSET(z, 0, sizeof(z));
+    XMEMSET(sb, 0, sizeof(sb));
+    for (i = 0; ret == 0 && i < cnt; i++) {
+        idx = (byte)i;
+        ret = wc_InitSha512(&sha);
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, seed, sizeof(seed));
+        if (ret == 0)
+            ret = wc_Sha512Update(&sha, &idx, sizeof(idx));
+        if (ret == 0)
+            ret = wc_Sha512Final(&sha, digest);
+        wc_Sha512Free(&sha);
+        if (ret != 0)
+            break;
+        XMEMCPY(z, digest, ED25519_KEY_SIZE / 2);
+
+        sc_muladd(sb, z, sig[i] + ED25519_SIG_SIZE/2, sb);
+
+        if (ge_frombytes_negate_vartime(&b->p[n], sig[i]) != 0) {
+            ret = BAD_FUNC_ARG;
+            break;
+        }
+        XMEMCPY(b->s[n++], z, ED25519_KEY_SIZE);
+
+        for (j = 0; j < i; j++) {
+            if (XMEMCMP(key[j]->p, key[i]->p, ED25519_PUB_KEY_SIZE) == 0)
+                break;
+        }
+        if (j < i) {
+            b->a[i] = b->a[j];
+        }
+        else {
+            ret = ed25519_neg_public(key[i], &b->p[n]);
+            if (ret != 0)
+                break;
+            XMEMSET(b->s[n], 0, ED25519_KEY_SIZE);
+            b->a[i] = n++;
+        }
+        sc_muladd(b->s[b->a[i]], z, b->h[i], b->s[b->a[i]]);
+    }
+
+    if (ret == 0)
+        ret = ge_multi_scalarmult_vartime(&sum, sb, b->s[0], b->p, n,
+                                                                 key[0]->heap);
+    if (ret == 0) {
+        ge_tobytes(check, &sum);
+        if (XMEMCMP(check, identity, sizeof(identity)) != 0)
+            ret = SIG_VERIFY_E;
+    }
+
+    XFREE(b, key[0]->heap, DYNAMIC_TYPE_ED25519);
+
+    return ret;
+}
+#endif /* !FREESCALE_LTC_ECC && !ED25519_SMALL */
+
+/*
+   Verify a batch of Ed25519 signatures.
+   Chunks of signatures are checked together with one multi-scalar
+   multiplication. When a chunk fails, its signatures are verified one at a
+   time to find those that are not valid.
+   Both checks are cofactored (RFC 8032, 5.1.7) so that the result of a
+   signature does not depend on the others in the batch. A signature with a
+   small order component in R or A may be valid here and not valid with
+   wc_ed25519_verify_msg().
+   sig     signatures to verify
+   sigLen  lengths of the signatures
+   msg     messages that were signed
+   msgLen  lengths of the messages
+   res     results of the signatures, 1 on valid and 0 on not valid
+   key     Ed25519 public keys
+   count   number of signatures
+   return  0 when all are valid, otherwise the first error of a signature
+*/
+int wc_ed25519_verify_msg_batch(const byte** sig, const word32* sigLen,
+                                const byte** msg, const word32* msgLen,
+                                int* res, ed25519_key** key, word32 count)
+{
+    int    err = 0;
+    int    ret;
+    word32 i;
+    word32 j;
+    word32 cnt;
+
+    if (sig == NULL || sigLen == NULL || msg == NULL || msgLen == NULL ||
+                                                  res == NULL || key == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    for (i = 0; i < count; i++) {
+        if (sig[i] == NULL || msg[i] == NULL || key[i] == NULL)
+            return BAD_FUNC_ARG;
+        /* set verification failed by default */
+        res[i] = 0;
+    }
+
+    for (i = 0; i < count; i += cnt) {
+        cnt = count - i;
+        ret = SIG_VERIFY_E;
+    #if !defined(FREESCALE_LTC_ECC) && !defined(ED25519_SMALL)
+        if (cnt > ED25519_VERIFY_BATCH)
+            cnt = ED25519_VERIFY_BATCH;
+        if (cnt > 1) {
+            ret = ed25519_verify_msg_batch_chunk(sig + i, sigLen + i, msg + i,
+                                                      msgLen + i, key + i, cnt);
+        }
+    #endif
+        if (ret == 0) {
+            for (j = i; j < i + cnt; j++)
+                res[j] = 1;
+            continue;
+        }
+
+        /* find the signatures that are not valid */
+        for (j = i; j < i + cnt; j++) {
+        #if !defined(FREESCALE_LTC_ECC) && !defined(ED25519_SMALL)
+            /* same equation as the chunk */
+            ret = ed25519_verify_msg_batch_chunk(sig + j, sigLen + j, msg + j,
+                                                        msgLen + j, key + j, 1);
+            if (ret == 0)
+                res[j] = 1;
+        #else
+            ret = wc_ed25519_verify_msg(sig[j], sigLen[j], msg[j], msgLen[j],
+                                                              &res[j], key[j]);
+        #endif
+            if (ret != 0 && err == 0)
+                err = ret;
+        }
+    }
+
+    return err;
+}
 #endif /* HAVE_ED25519_VERIFY */
 
 
 /* initialize information and memory for key */
-int wc_ed25519_init(ed25519_key* key)
+int wc_ed25519_init_ex(ed25519_key* key, void* heap, int devId)
 {
     if (key == NULL)
         return BAD_FUNC_ARG;
 
     XMEMSET(key, 0, sizeof(ed25519_key));
+    key->heap = heap;
+    (void)devId;
 
 #ifndef FREESCALE_LTC_ECC
     fe_init();
@@ -524,6 +858,12 @@ int wc_ed25519_init(ed25519_key* key)
     return 0;
 }
 
+/* initialize information and memory for key */
+int wc_ed25519_init(ed25519_key* key)
+{
+    return wc_ed25519_init_ex(key, NULL, INVALID_DEVID);
+}
+
 
 /* clear memory of key */
 void wc_ed25519_free(ed25519_key* key)
@@ -580,6 +920,10 @@ int wc_ed25519_import_public(const byte* in, word32 inLen, ed25519_key* key)
     if (inLen < ED25519_PUB_KEY_SIZE)
         return BAD_FUNC_ARG;
 
+#ifdef WC_ED25519_KEY_CACHE
+    key->negASet = 0;
+#endif
+
     /* compressed prefix according to draft
        http://www.ietf.org/id/draft-koch-eddsa-for-openpgp-02.txt */
     if (in[0] == 0x40 && inLen > ED25519_PUB_KEY_SIZE) {
@@ -592,7 +936,7 @@ int wc_ed25519_import_public(const byte* in, word32 inLen, ed25519_key* key)
         pubKey.Y = key->pointY;
         LTC_PKHA_Ed25519_PointDecompress(key->p, ED25519_PUB_KEY_SIZE, &pubKey);
 #endif
-        key->pubKeySet = 1;
+        ed25519_public_set(key);
         return 0;
     }
 
@@ -606,14 +950,14 @@ int wc_ed25519_import_public(const byte* in, word32 inLen, ed25519_key* key)
             key->pointY[i] = *(in + 2*ED25519_KEY_SIZE - i);
         }
         XMEMCPY(key->p, key->pointY, ED25519_KEY_SIZE);
-        key->pubKeySet = 1;
+        ed25519_public_set(key);
         ret = 0;
 #else
         /* pass in (x,y) and store compressed key */
         ret = ge_compress_key(key->p, in+1,
                               in+1+ED25519_PUB_KEY_SIZE, ED25519_PUB_KEY_SIZE);
         if (ret == 0)
-            key->pubKeySet = 1;
+            ed25519_public_set(key);
 #endif /* FREESCALE_LTC_ECC */
         return ret;
     }
@@ -629,7 +973,7 @@ int wc_ed25519_import_public(const byte* in, word32 inLen, ed25519_key* key)
         pubKey.Y = key->pointY;
         LTC_PKHA_Ed25519_PointDecompress(key->p, ED25519_PUB_KEY_SIZE, &pubKey);
 #endif
-        key->pubKeySet = 1;
+        ed25519_public_set(key);
         return 0;
     }
 
@@ -654,7 +998,7 @@ int wc_ed25519_import_private_only(const byte* priv, word32 privSz,
 
     XMEMCPY(key->k, priv, ED25519_KEY_SIZE);
 
-    return 0;
+    return ed25519_private_set(key);
 }
 
 /*
@@ -682,7 +1026,7 @@ int wc_ed25519_import_private_key(const byte* priv, word32 privSz,
     XMEMCPY(key->k, priv, ED25519_KEY_SIZE);
     XMEMCPY(key->k + ED25519_KEY_SIZE, key->p, ED25519_PUB_KEY_SIZE);
 
-    return ret;
+    return ed25519_private_set(key);
 }
 
 #endif /* HAVE_ED25519_KEY_IMPORT */
@@ -51,6 +51,73 @@
 static const byte ed448Ctx[ED448CTX_SIZE+1] = "SigEd448";
 #endif
 
+/* Expand the private key into the clamped scalar and the prefix.
+ * The key is only read so that it can be shared between threads.
+ *
+ * key  [in]  Ed448 key with private key set.
+ * az   [in]  Array of ED448_PRV_KEY_SIZE bytes to hold expanded key.
+ * returns 0 on success and other -ve value on hash failure.
+ */
+static int ed448_expand_private(const ed448_key* key, byte* az)
+{
+    int ret = 0;
+
+#ifdef WC_ED448_KEY_CACHE
+    if (key->azSet) {
+        XMEMCPY(az, key->az, ED448_PRV_KEY_SIZE);
+    }
+    else
+#endif
+    {
+        ret = wc_Shake256Hash(key->k, ED448_KEY_SIZE, az, ED448_PRV_KEY_SIZE);
+        if (ret == 0) {
+            /* apply clamp */
+            az[0]  &= 0xfc;
+            az[55] |= 0x80;
+            az[56]  = 0x00;
+        }
+    }
+
+    return ret;
+}
+
+/* Call when the private key has changed. Fills the cache of the expanded
+ * private key.
+ *
+ * key  [in]  Ed448 key with new private key.
+ * returns 0 on success and other -ve value on hash failure.
+ */
+static int ed448_private_set(ed448_key* key)
+{
+    int ret = 0;
+
+#ifdef WC_ED448_KEY_CACHE
+    key->azSet = 0;
+    ret = ed448_expand_private(key, key->az);
+    if (ret == 0) {
+        key->azSet = 1;
+    }
+#else
+    (void)key;
+#endif
+
+    return ret;
+}
+
+/* Call when the public key has changed. Marks the public key as set and fills
+ * the cache of the negated point. A public key that does not decode is not
+ * cached and fails verification.
+ *
+ * key  [in]  Ed448 key with new public key.
+ */
+static void ed448_public_set(ed448_key* key)
+{
+    key->pubKeySet = 1;
+#ifdef WC_ED448_KEY_CACHE
+    key->negASet = (ge448_from_bytes_negate_vartime(&key->negA, key->p) == 0);
+#endif
+}
+
 /* Derive the public key for the private key.
  *
  * key       [in]  Ed448 key object.
@@ -72,14 +139,9 @@ int wc_ed448_make_public(ed448_key* key, unsigned char* pubKey, word32 pubKeySz)
     }
 
     if (ret == 0) {
-        ret = wc_Shake256Hash(key->k, ED448_KEY_SIZE, az, sizeof(az));
+        ret = ed448_expand_private(key, az);
     }
     if (ret == 0) {
-        /* apply clamp */
-        az[0]  &= 0xfc;
-        az[55] |= 0x80;
-        az[56]  = 0x00;
-
         ge448_scalarmult_base(&A, az);
         ge448_to_bytes(pubKey, &A);
     }
@@ -111,10 +173,17 @@ int wc_ed448_make_key(WC_RNG* rng, int keySz, ed448_key* key)
     }
 
     if (ret == 0) {
+    #ifdef WC_ED448_KEY_CACHE
+        key->azSet = 0;
+        key->negASet = 0;
+    #endif
         ret = wc_RNG_GenerateBlock(rng, key->k, ED448_KEY_SIZE);
     }
     if (ret == 0) {
-        ret = wc_ed448_make_public(key, key->p, ED448_PUB_KEY_SIZE);
+        ret = ed448_private_set(key);
+        if (ret == 0) {
+            ret = wc_ed448_make_public(key, key->p, ED448_PUB_KEY_SIZE);
+        }
         if (ret != 0) {
             ForceZero(key->k, ED448_KEY_SIZE);
         }
@@ -123,7 +192,7 @@ int wc_ed448_make_key(WC_RNG* rng, int keySz, ed448_key* key)
         /* put public key after private key, on the same buffer */
         XMEMMOVE(key->k + ED448_KEY_SIZE, key->p, ED448_PUB_KEY_SIZE);
 
-        key->pubKeySet = 1;
+        ed448_public_set(key);
     }
 
     return ret;
@@ -179,14 +248,9 @@ static int ed448_sign_msg(const byte* in, word32 inLen, byte* out,
 
         /* step 1: create nonce to use where nonce is r in
            r = H(h_b, ... ,h_2b-1,M) */
-        ret = wc_Shake256Hash(key->k, ED448_KEY_SIZE, az, sizeof(az));
+        ret = ed448_expand_private(key, az);
     }
     if (ret == 0) {
-        /* apply clamp */
-        az[0]  &= 0xfc;
-        az[55] |= 0x80;
-        az[56]  = 0x00;
-
         ret = wc_InitShake256(&sha, NULL, INVALID_DEVID);
         if (ret == 0) {
             ret = wc_Shake256_Update(&sha, ed448Ctx, ED448CTX_SIZE);
@@ -341,6 +405,31 @@ int wc_ed448ph_sign_msg(const byte* in, word32 inLen, byte* out, word32 *outLen,
 
 #ifdef HAVE_ED448_VERIFY
 
+/* Decode the public key into a point and negate it, for verification.
+ * The key is only read so that it can be shared between threads.
+ *
+ * key  [in]  Ed448 key with public key set.
+ * A    [in]  Point to hold -A.
+ * returns BAD_FUNC_ARG when the public key is not valid,
+ *         0 otherwise.
+ */
+static int ed448_neg_public(const ed448_key* key, ge448_p2* A)
+{
+    int ret = 0;
+
+#ifdef WC_ED448_KEY_CACHE
+    if (key->negASet) {
+        XMEMCPY(A, &key->negA, sizeof(ge448_p2));
+    }
+    else
+#endif
+    if (ge448_from_bytes_negate_vartime(A, key->p) != 0) {
+        ret = BAD_FUNC_ARG;
+    }
+
+    return ret;
+}
+
 /* Verify the message using the ed448 public key.
  *
  *  sig         [in]  Signature to verify.
@@ -385,8 +474,8 @@ static int ed448_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
     }
 
     /* uncompress A (public key), test if valid, and negate it */
-    if ((ret == 0) && (ge448_from_bytes_negate_vartime(&A, key->p) != 0)) {
-        ret = BAD_FUNC_ARG;
+    if (ret == 0) {
+        ret = ed448_neg_public(key, &A);
     }
 
     if (ret == 0) {
@@ -615,26 +704,32 @@ int wc_ed448_import_public(const byte* in, word32 inLen, ed448_key* key)
         ret = BAD_FUNC_ARG;
     }
 
+#ifdef WC_ED448_KEY_CACHE
+    if (ret == 0) {
+        key->negASet = 0;
+    }
+#endif
+
     if (ret == 0) {
         /* compressed prefix according to draft
          * https://tools.ietf.org/html/draft-ietf-openpgp-rfc4880bis-06 */
         if (in[0] == 0x40 && inLen > ED448_PUB_KEY_SIZE) {
             /* key is stored in compressed format so just copy in */
             XMEMCPY(key->p, (in + 1), ED448_PUB_KEY_SIZE);
-            key->pubKeySet = 1;
+            ed448_public_set(key);
         }
         /* importing uncompressed public key */
         else if (in[0] == 0x04 && inLen > 2*ED448_PUB_KEY_SIZE) {
             /* pass in (x,y) and store compressed key */
             ret = ge448_compress_key(key->p, in+1, in+1+ED448_PUB_KEY_SIZE);
             if (ret == 0)
-                key->pubKeySet = 1;
+                ed448_public_set(key);
         }
         else if (inLen == ED448_PUB_KEY_SIZE) {
             /* if not specified compressed or uncompressed check key size
              * if key size is equal to compressed key size copy in key */
             XMEMCPY(key->p, in, ED448_PUB_KEY_SIZE);
-            key->pubKeySet = 1;
+            ed448_public_set(key);
         }
         else {
             /* bad public key format */
@@ -672,6 +767,7 @@ int wc_ed448_import_private_only(const byte* priv, word32 privSz,
 
     if (ret == 0) {
         XMEMCPY(key->k, priv, ED448_KEY_SIZE);
+        ret = ed448_private_set(key);
     }
 
     return ret;
@@ -711,6 +807,7 @@ int wc_ed448_import_private_key(const byte* priv, word32 privSz,
         /* make the private key (priv + pub) */
         XMEMCPY(key->k, priv, ED448_KEY_SIZE);
         XMEMCPY(key->k + ED448_KEY_SIZE, key->p, ED448_PUB_KEY_SIZE);
+        ret = ed448_private_set(key);
     }
 
     return ret;
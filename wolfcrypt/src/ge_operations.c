@@ -9399,6 +9399,23 @@ static const ge_precomp Bi[8] = {
 #endif
 
 
+/*
+Ai = A,3A,5A,7A,9A,11A,13A,15A
+*/
+static void ge_cached_odd_multiples(ge_cached *Ai, const ge_p3 *A)
+{
+  ge_p1p1 t;
+  ge_p3 u;
+  ge_p3 A2;
+  int i;
+
+  ge_p3_to_cached(&Ai[0],A);
+  ge_p3_dbl(&t,A); ge_p1p1_to_p3(&A2,&t);
+  for (i = 1;i < 8;++i) {
+    ge_add(&t,&A2,&Ai[i - 1]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[i],&u);
+  }
+}
+
 /*
 r = a * A + b * B
 where a = a[0]+256*a[1]+...+256^31 a[31].
@@ -9413,21 +9430,12 @@ int ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a,
   ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
   ge_p1p1 t;
   ge_p3 u;
-  ge_p3 A2;
   int i;
 
   slide(aslide,a);
   slide(bslide,b);
 
-  ge_p3_to_cached(&Ai[0],A);
-  ge_p3_dbl(&t,A); ge_p1p1_to_p3(&A2,&t);
-  ge_add(&t,&A2,&Ai[0]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[1],&u);
-  ge_add(&t,&A2,&Ai[1]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[2],&u);
-  ge_add(&t,&A2,&Ai[2]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[3],&u);
-  ge_add(&t,&A2,&Ai[3]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[4],&u);
-  ge_add(&t,&A2,&Ai[4]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[5],&u);
-  ge_add(&t,&A2,&Ai[5]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[6],&u);
-  ge_add(&t,&A2,&Ai[6]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[7],&u);
+  ge_cached_odd_multiples(Ai,A);
 
   ge_p2_0(r);
 
@@ -9460,6 +9468,91 @@ int ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a,
   return 0;
 }
 
+
+/*
+r = 8 * (b * B + a[0] * A[0] + ... + a[n-1] * A[n-1])
+where each scalar is 32 bytes, little endian and less than 2^253.
+B is the Ed25519 base point (x,4/5) with x positive.
+The points share one chain of doublings and each adds in a sliding window of
+its odd multiples (Straus). Multiplying by the cofactor removes any small
+order component so that the sum of valid signature equations is zero.
+*/
+int ge_multi_scalarmult_vartime(ge_p2 *r, const unsigned char *b,
+                                const unsigned char *a, const ge_p3 *A, int n,
+                                void *heap)
+{
+  signed char bslide[256];
+  signed char *aslide;
+  ge_cached *Ai;
+  ge_p1p1 t;
+  ge_p3 u;
+  int i;
+  int j;
+  int top;
+
+  aslide = (signed char*)XMALLOC(256 * n, heap, DYNAMIC_TYPE_TMP_BUFFER);
+  Ai = (ge_cached*)XMALLOC(sizeof(ge_cached) * 8 * n, heap,
+                           DYNAMIC_TYPE_TMP_BUFFER);
+  if (aslide == NULL || Ai == NULL) {
+    XFREE(Ai, heap, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(aslide, heap, DYNAMIC_TYPE_TMP_BUFFER);
+    return MEMORY_E;
+  }
+
+  slide(bslide,b);
+  for (i = 255;i >= 0;--i) {
+    if (bslide[i]) break;
+  }
+  top = i;
+  for (j = 0;j < n;++j) {
+    slide(aslide + 256 * j,a + 32 * j);
+    ge_cached_odd_multiples(Ai + 8 * j,&A[j]);
+    for (i = 255;i > top;--i) {
+      if (aslide[256 * j + i]) {
+        top = i;
+        break;
+      }
+    }
+  }
+
+  ge_p2_0(r);
+
+  for (i = top;i >= 0;--i) {
+    ge_p2_dbl(&t,r);
+
+    for (j = 0;j < n;++j) {
+      signed char s = aslide[256 * j + i];
+      if (s > 0) {
+        ge_p1p1_to_p3(&u,&t);
+        ge_add(&t,&u,&Ai[8 * j + s/2]);
+      } else if (s < 0) {
+        ge_p1p1_to_p3(&u,&t);
+        ge_sub(&t,&u,&Ai[8 * j + (-s)/2]);
+      }
+    }
+
+    if (bslide[i] > 0) {
+      ge_p1p1_to_p3(&u,&t);
+      ge_madd(&t,&u,&Bi[bslide[i]/2]);
+    } else if (bslide[i] < 0) {
+      ge_p1p1_to_p3(&u,&t);
+      ge_msub(&t,&u,&Bi[(-bslide[i])/2]);
+    }
+
+    ge_p1p1_to_p2(r,&t);
+  }
+
+  for (i = 0;i < 3;++i) {
+    ge_p2_dbl(&t,r);
+    ge_p1p1_to_p2(r,&t);
+  }
+
+  XFREE(Ai, heap, DYNAMIC_TYPE_TMP_BUFFER);
+  XFREE(aslide, heap, DYNAMIC_TYPE_TMP_BUFFER);
+
+  return 0;
+}
+
 #ifdef CURVED25519_ASM_64BIT
 static const ge d = {
     0x75eb4dca135978a3, 0x00700a4d4141d8ab, -0x7338bf8688861768, 0x52036cee2b6ffe73,
@@ -1149,6 +1149,222 @@ int wolfSSL_GetHmacMaxSize(void)
     return WC_MAX_DIGEST_SIZE;
 }
 
+#if !defined(NO_AES) && defined(HAVE_AES_CBC) && !defined(HAVE_FIPS) && \
+    !defined(HAVE_SELFTEST)
+
+#if defined(WOLFSSL_AESNI) && defined(USE_INTEL_SPEEDUP) && \
+    (!defined(NO_SHA) || !defined(NO_SHA256))
+    #define HAVE_HMAC_AES_CBC_STITCH
+
+    #include <wolfssl/wolfcrypt/cpuid.h>
+
+    #ifdef __cplusplus
+        extern "C" {
+    #endif
+    #ifndef NO_SHA256
+    extern void AES_CBC_encrypt_SHA256_SHANI(const byte* in, byte* out,
+        byte* ivec, word32 blocks, const byte* ks, int nr, word32* digest,
+        const byte* hashIn);
+    #endif
+    #ifndef NO_SHA
+    extern void AES_CBC_encrypt_SHA1_SHANI(const byte* in, byte* out,
+        byte* ivec, word32 blocks, const byte* ks, int nr, word32* digest,
+        const byte* hashIn);
+    #endif
+    #ifdef __cplusplus
+        }  /* extern "C" */
+    #endif
+
+/* Returns the number of bytes needed to fill the hash's partial block when the
+ * hash and cipher can be interleaved, otherwise -1.
+ */
+static int HmacAesCbcStitchFill(Hmac* hmac, Aes* aes)
+{
+    word32 buffLen;
+    word32 flags;
+
+    if (!aes->use_aesni)
+        return -1;
+#ifdef WOLF_CRYPTO_CB
+    if (hmac->devId != INVALID_DEVID || aes->devId != INVALID_DEVID)
+        return -1;
+#endif
+#if defined(WOLFSSL_ASYNC_CRYPT) && defined(WC_ASYNC_ENABLE_HMAC)
+    if (hmac->asyncDev.marker == WOLFSSL_ASYNC_MARKER_HMAC)
+        return -1;
+#endif
+
+    flags = cpuid_get_flags();
+    if (!IS_INTEL_SHA(flags) || !IS_INTEL_AESNI(flags))
+        return -1;
+
+    switch (hmac->macType) {
+    #ifndef NO_SHA
+        case WC_SHA:
+            buffLen = hmac->hash.sha.buffLen;
+            break;
+    #endif
+    #ifndef NO_SHA256
+        case WC_SHA256:
+            buffLen = hmac->hash.sha256.buffLen;
+            break;
+    #endif
+        default:
+            return -1;
+    }
+
+    /* Keying the inner hash adds a whole block so the fill is unchanged. */
+    return (int)((WC_SHA256_BLOCK_SIZE - buffLen) % WC_SHA256_BLOCK_SIZE);
+}
+
+/* AES-CBC encrypt sz bytes of in to out while hashing sz bytes of hashIn.
+ * sz is a multiple of the hash block size and the hash has no buffered data.
+ */
+static void HmacAesCbcStitch(Hmac* hmac, Aes* aes, byte* out, const byte* in,
+                             const byte* hashIn, word32 sz)
+{
+    word32* loLen;
+    word32* hiLen;
+    word32  tmp;
+
+#ifndef NO_SHA256
+    if (hmac->macType == WC_SHA256) {
+        AES_CBC_encrypt_SHA256_SHANI(in, out, (byte*)aes->reg,
+            sz / WC_SHA256_BLOCK_SIZE, (byte*)aes->key, (int)aes->rounds,
+            hmac->hash.sha256.digest, hashIn);
+        loLen = &hmac->hash.sha256.loLen;
+        hiLen = &hmac->hash.sha256.hiLen;
+    }
+    else
+#endif
+    {
+    #ifndef NO_SHA
+        AES_CBC_encrypt_SHA1_SHANI(in, out, (byte*)aes->reg,
+            sz / WC_SHA_BLOCK_SIZE, (byte*)aes->key, (int)aes->rounds,
+            hmac->hash.sha.digest, hashIn);
+        loLen = &hmac->hash.sha.loLen;
+        hiLen = &hmac->hash.sha.hiLen;
+    #else
+        return;
+    #endif
+    }
+
+    tmp = *loLen;
+    if ((*loLen += sz) < tmp)
+        (*hiLen)++;
+}
+#endif /* WOLFSSL_AESNI && USE_INTEL_SPEEDUP && (!NO_SHA || !NO_SHA256) */
+
+/* Update the HMAC with the data and AES-CBC encrypt it, mac-then-encrypt.
+ * Same result as wc_HmacUpdate(hmac, in, sz) then
+ * wc_AesCbcEncrypt(aes, out, in, sz). out may be the same as in.
+ *
+ * hmac  HMAC object, key set.
+ * aes   AES object, key and IV set for encryption.
+ * out   Buffer to hold cipher text.
+ * in    Data to MAC and encrypt.
+ * sz    Size of data in bytes, a multiple of AES_BLOCK_SIZE.
+ * returns BAD_FUNC_ARG when a parameter is invalid and 0 on success.
+ */
+int wc_HmacUpdate_AesCbcEncrypt(Hmac* hmac, Aes* aes, byte* out,
+                                const byte* in, word32 sz)
+{
+    int ret;
+#ifdef HAVE_HMAC_AES_CBC_STITCH
+    int    fill;
+    word32 blocks;
+#endif
+
+    if (hmac == NULL || aes == NULL || (sz > 0 && (out == NULL || in == NULL)) ||
+                                                    sz % AES_BLOCK_SIZE != 0) {
+        return BAD_FUNC_ARG;
+    }
+
+#ifdef HAVE_HMAC_AES_CBC_STITCH
+    fill = HmacAesCbcStitchFill(hmac, aes);
+    if (fill >= 0 && sz >= (word32)fill + WC_SHA256_BLOCK_SIZE) {
+        /* Hash reads of a block are done before the cipher text is stored
+         * and the hash is always ahead of the cipher. */
+        ret = wc_HmacUpdate(hmac, in, (word32)fill);
+        if (ret != 0)
+            return ret;
+        blocks = (sz - (word32)fill) & ~(WC_SHA256_BLOCK_SIZE - 1);
+        HmacAesCbcStitch(hmac, aes, out, in, in + fill, blocks);
+        ret = wc_HmacUpdate(hmac, in + fill + blocks,
+                                                  sz - (word32)fill - blocks);
+        if (ret == 0 && sz > blocks)
+            ret = wc_AesCbcEncrypt(aes, out + blocks, in + blocks, sz - blocks);
+        return ret;
+    }
+#endif
+
+    ret = wc_HmacUpdate(hmac, in, sz);
+    if (ret == 0 && sz > 0)
+        ret = wc_AesCbcEncrypt(aes, out, in, sz);
+    return ret;
+}
+
+/* AES-CBC encrypt the data and update the HMAC with the cipher text,
+ * encrypt-then-MAC.
+ * Same result as wc_AesCbcEncrypt(aes, out, in, sz) then
+ * wc_HmacUpdate(hmac, out, sz). out may be the same as in.
+ *
+ * aes   AES object, key and IV set for encryption.
+ * hmac  HMAC object, key set.
+ * out   Buffer to hold cipher text.
+ * in    Data to encrypt.
+ * sz    Size of data in bytes, a multiple of AES_BLOCK_SIZE.
+ * returns BAD_FUNC_ARG when a parameter is invalid and 0 on success.
+ */
+int wc_AesCbcEncrypt_HmacUpdate(Aes* aes, Hmac* hmac, byte* out,
+                                const byte* in, word32 sz)
+{
+    int ret;
+#ifdef HAVE_HMAC_AES_CBC_STITCH
+    int    fill;
+    word32 lead;
+    word32 blocks;
+#endif
+
+    if (hmac == NULL || aes == NULL || (sz > 0 && (out == NULL || in == NULL)) ||
+                                                    sz % AES_BLOCK_SIZE != 0) {
+        return BAD_FUNC_ARG;
+    }
+
+#ifdef HAVE_HMAC_AES_CBC_STITCH
+    fill = HmacAesCbcStitchFill(hmac, aes);
+    /* The hash trails the cipher by at least a block so that it only reads
+     * cipher text that has been stored. */
+    lead = ((word32)fill + WC_SHA256_BLOCK_SIZE + AES_BLOCK_SIZE - 1) &
+                                                       ~(AES_BLOCK_SIZE - 1);
+    if (fill >= 0 && sz >= lead + WC_SHA256_BLOCK_SIZE) {
+        ret = wc_AesCbcEncrypt(aes, out, in, lead);
+        if (ret == 0)
+            ret = wc_HmacUpdate(hmac, out, (word32)fill);
+        if (ret != 0)
+            return ret;
+        blocks = (sz - lead) & ~(WC_SHA256_BLOCK_SIZE - 1);
+        HmacAesCbcStitch(hmac, aes, out + lead, in + lead, out + fill, blocks);
+        if (sz > lead + blocks) {
+            ret = wc_AesCbcEncrypt(aes, out + lead + blocks, in + lead + blocks,
+                                   sz - lead - blocks);
+        }
+        if (ret == 0)
+            ret = wc_HmacUpdate(hmac, out + fill + blocks,
+                                                  sz - (word32)fill - blocks);
+        return ret;
+    }
+#endif
+
+    ret = 0;
+    if (sz > 0)
+        ret = wc_AesCbcEncrypt(aes, out, in, sz);
+    if (ret == 0)
+        ret = wc_HmacUpdate(hmac, out, sz);
+    return ret;
+}
+#endif /* !NO_AES && HAVE_AES_CBC && !HAVE_FIPS && !HAVE_SELFTEST */
+
 #ifdef HAVE_HKDF
     /* HMAC-KDF-Extract.
      * RFC 5869 - HMAC-based Extract-and-Expand Key Derivation Function (HKDF).
@@ -76,6 +76,8 @@ WOLFSSL_LOCAL int sp_ModExp_3072(mp_int* base, mp_int* exp, mp_int* mod,
     mp_int* res);
 WOLFSSL_LOCAL int sp_ModExp_4096(mp_int* base, mp_int* exp, mp_int* mod,
     mp_int* res);
+WOLFSSL_LOCAL int sp_ModExp_8192(mp_int* base, mp_int* exp, mp_int* mod,
+    mp_int* res);
 #ifdef __cplusplus
     } /* extern "C" */
 #endif
@@ -896,6 +898,13 @@ int mp_exptmod (mp_int * G, mp_int * X, mp_int * P, mp_int * Y)
   }
 #endif
 
+#ifdef WOLFSSL_MONT52
+  /* odd modulus and CPU has AVX-512 IFMA */
+  if (mp_mont52_supported(P)) {
+    return mp_exptmod_mont52(G, X, mp_count_bits(X), P, Y);
+  }
+#endif
+
 /* modified diminished radix reduction */
 #if defined(BN_MP_REDUCE_IS_2K_L_C) && defined(BN_MP_REDUCE_2K_L_C) && \
   defined(BN_S_MP_EXPTMOD_C)
@@ -4652,6 +4661,11 @@ static int mp_prime_miller_rabin (mp_int * a, mp_int * b, int *result)
       err = sp_ModExp_4096(b, &r, a, &y);
   else
 #endif
+#ifdef WOLFSSL_SP_8192
+  if (mp_count_bits(a) == 8192)
+      err = sp_ModExp_8192(b, &r, a, &y);
+  else
+#endif
 #endif
       err = mp_exptmod (b, &r, a, &y);
   if (err != MP_OKAY)
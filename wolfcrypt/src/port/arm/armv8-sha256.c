@@ -1376,6 +1376,36 @@ int wc_Sha256Copy(wc_Sha256* src, wc_Sha256* dst)
     return ret;
 }
 
+/* Hash cnt independent messages: data[i] of sz[i] bytes into hash[i].
+ * The messages are hashed in turn.
+ */
+int wc_Sha256MultiBuffer(const byte* const* data, const word32* sz,
+                         byte* const* hash, word32 cnt)
+{
+    int ret = 0;
+    word32 i;
+    wc_Sha256 sha256;
+
+    if (cnt > 0 && (data == NULL || sz == NULL || hash == NULL))
+        return BAD_FUNC_ARG;
+    for (i = 0; i < cnt; i++) {
+        if (hash[i] == NULL || (data[i] == NULL && sz[i] > 0))
+            return BAD_FUNC_ARG;
+    }
+
+    ret = wc_InitSha256_ex(&sha256, NULL, INVALID_DEVID);
+    if (ret != 0)
+        return ret;
+    for (i = 0; ret == 0 && i < cnt; i++) {
+        ret = wc_Sha256Update(&sha256, data[i], sz[i]);
+        if (ret == 0)
+            ret = wc_Sha256Final(&sha256, hash[i]);
+    }
+    wc_Sha256Free(&sha256);
+
+    return ret;
+}
+
 #endif /* !NO_SHA256 */
 
 
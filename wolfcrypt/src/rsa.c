@@ -56,6 +56,9 @@ Possible RSA enable options:
  * NO_RSA:              Overall control of RSA                      default: on (not defined)
  * WC_RSA_BLINDING:     Uses Blinding w/ Private Ops                default: off
                         Note: slower by ~20%
+ * WC_RSA_NO_BLINDING_CACHE: New blinding values for every private op default: off
+ * WC_RSA_BLINDING_UPDATES: Private ops with cached blinding values   default: 32
+                        before new values generated.
  * WOLFSSL_KEY_GEN:     Allows Private Key Generation               default: off
  * RSA_LOW_MEM:         NON CRT Private Operations, less memory     default: off
  * WC_NO_RSA_OAEP:      Disables RSA OAEP padding                   default: on (not defined)
@@ -317,6 +320,18 @@ int wc_InitRsaKey_ex(RsaKey* key, void* heap, int devId)
     }
 #endif
 
+#ifdef WC_RSA_BLINDING_CACHE
+    ret = mp_init_multi(&key->blind, &key->blindInv, &key->blindMod,
+                                                   &key->blindExp, NULL, NULL);
+    if (ret != MP_OKAY)
+        return ret;
+    key->blindCnt = 0;
+#ifndef SINGLE_THREADED
+    if (wc_InitMutex(&key->blindMutex) != 0)
+        return BAD_MUTEX_E;
+#endif
+#endif
+
 #ifdef WOLFSSL_XILINX_CRYPT
     key->pubExp = 0;
     key->mod    = NULL;
@@ -549,6 +564,19 @@ int wc_FreeRsaKey(RsaKey* key)
     mp_clear(&key->e);
     mp_clear(&key->n);
 
+#ifdef WC_RSA_BLINDING_CACHE
+    mp_forcezero(&key->blindInv);
+    mp_forcezero(&key->blind);
+    mp_clear(&key->blindMod);
+    mp_clear(&key->blindExp);
+    mp_clear(&key->blindInv);
+    mp_clear(&key->blind);
+    key->blindCnt = 0;
+#ifndef SINGLE_THREADED
+    wc_FreeMutex(&key->blindMutex);
+#endif
+#endif
+
 #ifdef WOLFSSL_XILINX_CRYPT
     XFREE(key->mod, key->heap, DYNAMIC_TYPE_KEY);
     key->mod = NULL;
@@ -640,6 +668,17 @@ int wc_CheckRsaKey(RsaKey* key)
     }
     else
 #endif
+#ifdef WOLFSSL_SP_8192
+    if (mp_count_bits(&key->n) == 8192) {
+        ret = sp_ModExp_8192(k, &key->e, &key->n, tmp);
+        if (ret != 0)
+            ret = MP_EXPTMOD_E;
+        ret = sp_ModExp_8192(tmp, &key->d, &key->n, tmp);
+        if (ret != 0)
+            ret = MP_EXPTMOD_E;
+    }
+    else
+#endif
 #endif
 #ifdef WOLFSSL_SP_MATH
     {
@@ -2043,6 +2082,79 @@ done:
 }
 
 #else
+#ifdef WC_RSA_BLINDING_CACHE
+/* Get the blinding and unblinding values for a private key operation.
+ * New values are generated every WC_RSA_BLINDING_UPDATES operations. In
+ * between, the values cached in the key are squared:
+ *   (r^2)^e = (r^e)^2 and 1/r^2 = (1/r)^2
+ * replacing a modular inverse and exponentiation with two squares.
+ *
+ * key   RSA key.
+ * rnd   Blinding value: r^e mod n.
+ * rndi  Unblinding value: 1/r mod n.
+ * rng   Random number generator.
+ * returns 0 on success, otherwise failure.
+ */
+static int RsaGetBlinding(RsaKey* key, mp_int* rnd, mp_int* rndi, WC_RNG* rng)
+{
+    int ret = 0;
+
+#ifndef SINGLE_THREADED
+    if (wc_LockMutex(&key->blindMutex) != 0)
+        return BAD_MUTEX_E;
+#endif
+
+    /* Key may have been loaded with a different modulus or exponent since -
+     * r^e is only valid for the e it was calculated with. */
+    if (key->blindCnt > 0 && mp_cmp(&key->n, &key->blindMod) == MP_EQ &&
+                             mp_cmp(&key->e, &key->blindExp) == MP_EQ) {
+        if (mp_sqrmod(&key->blind, &key->n, &key->blind) != MP_OKAY)
+            ret = MP_MULMOD_E;
+        if (ret == 0 && mp_sqrmod(&key->blindInv, &key->n,
+                                                   &key->blindInv) != MP_OKAY) {
+            ret = MP_MULMOD_E;
+        }
+        if (ret == 0)
+            key->blindCnt--;
+    }
+    else {
+        ret = mp_rand(&key->blind, get_digit_count(&key->n), rng);
+
+        /* blindInv = 1/blind mod n */
+        if (ret == 0 && mp_invmod(&key->blind, &key->n,
+                                                   &key->blindInv) != MP_OKAY) {
+            ret = MP_INVMOD_E;
+        }
+
+        /* blind = blind^e */
+        if (ret == 0 && mp_exptmod(&key->blind, &key->e, &key->n,
+                                                      &key->blind) != MP_OKAY) {
+            ret = MP_EXPTMOD_E;
+        }
+
+        if (ret == 0 && mp_copy(&key->n, &key->blindMod) != MP_OKAY)
+            ret = MP_INIT_E;
+        if (ret == 0 && mp_copy(&key->e, &key->blindExp) != MP_OKAY)
+            ret = MP_INIT_E;
+        if (ret == 0)
+            key->blindCnt = WC_RSA_BLINDING_UPDATES;
+    }
+
+    if (ret == 0 && mp_copy(&key->blind, rnd) != MP_OKAY)
+        ret = MP_INIT_E;
+    if (ret == 0 && mp_copy(&key->blindInv, rndi) != MP_OKAY)
+        ret = MP_INIT_E;
+    if (ret != 0)
+        key->blindCnt = 0;
+
+#ifndef SINGLE_THREADED
+    wc_UnLockMutex(&key->blindMutex);
+#endif
+
+    return ret;
+}
+#endif /* WC_RSA_BLINDING_CACHE */
+
 static int wc_RsaFunctionSync(const byte* in, word32 inLen, byte* out,
                           word32* outLen, int type, RsaKey* key, WC_RNG* rng)
 {
@@ -2151,6 +2263,35 @@ static int wc_RsaFunctionSync(const byte* in, word32 inLen, byte* out,
         }
     }
 #endif
+#ifdef WOLFSSL_SP_8192
+    if (mp_count_bits(&key->n) == 8192) {
+        switch(type) {
+#ifndef WOLFSSL_RSA_PUBLIC_ONLY
+        case RSA_PRIVATE_DECRYPT:
+        case RSA_PRIVATE_ENCRYPT:
+    #ifdef WC_RSA_BLINDING
+            if (rng == NULL)
+                return MISSING_RNG_E;
+    #endif
+    #ifndef RSA_LOW_MEM
+            if ((mp_count_bits(&key->p) == 4096) &&
+                                             (mp_count_bits(&key->q) == 4096)) {
+                return sp_RsaPrivate_8192(in, inLen, &key->d, &key->p, &key->q,
+                                          &key->dP, &key->dQ, &key->u, &key->n,
+                                          out, outLen);
+            }
+            break;
+    #else
+            return sp_RsaPrivate_8192(in, inLen, &key->d, NULL, NULL, NULL,
+                                      NULL, NULL, &key->n, out, outLen);
+    #endif
+#endif
+        case RSA_PUBLIC_ENCRYPT:
+        case RSA_PUBLIC_DECRYPT:
+            return sp_RsaPublic_8192(in, inLen, &key->e, &key->n, out, outLen);
+        }
+    }
+#endif
 #endif /* WOLFSSL_HAVE_SP_RSA */
 
 #ifdef WOLFSSL_SP_MATH
@@ -2199,6 +2340,10 @@ static int wc_RsaFunctionSync(const byte* in, word32 inLen, byte* out,
         case RSA_PRIVATE_ENCRYPT:
         {
         #if defined(WC_RSA_BLINDING) && !defined(WC_NO_RNG)
+        #ifdef WC_RSA_BLINDING_CACHE
+            /* blind with values cached in key */
+            ret = RsaGetBlinding(key, rnd, rndi, rng);
+        #else
             /* blind */
             ret = mp_rand(rnd, get_digit_count(&key->n), rng);
 
@@ -2209,6 +2354,7 @@ static int wc_RsaFunctionSync(const byte* in, word32 inLen, byte* out,
             /* rnd = rnd^e */
             if (ret == 0 && mp_exptmod(rnd, &key->e, &key->n, rnd) != MP_OKAY)
                 ret = MP_EXPTMOD_E;
+        #endif
 
             /* tmp = tmp*rnd mod n */
             if (ret == 0 && mp_mulmod(tmp, rnd, &key->n, tmp) != MP_OKAY)
@@ -43,6 +43,7 @@
 #include <wolfssl/wolfcrypt/sha.h>
 #include <wolfssl/wolfcrypt/error-crypt.h>
 #include <wolfssl/wolfcrypt/hash.h>
+#include <wolfssl/wolfcrypt/cpuid.h>
 
 #ifdef WOLF_CRYPTO_CB
     #include <wolfssl/wolfcrypt/cryptocb.h>
@@ -332,6 +333,11 @@
     /* Software implementation */
     #define USE_SHA_SOFTWARE_IMPL
 
+    #if defined(USE_INTEL_SPEEDUP) && !defined(HAVE_FIPS)
+        /* SHA-NI transform in sha_asm.S, chosen at runtime */
+        #define HAVE_INTEL_SHA
+    #endif
+
     static int InitSha(wc_Sha* sha)
     {
         int ret = 0;
@@ -363,6 +369,30 @@ static WC_INLINE void AddLength(wc_Sha* sha, word32 len)
         sha->hiLen++;                       /* carry low to high */
 }
 
+#ifdef HAVE_INTEL_SHA
+#ifdef __cplusplus
+    extern "C" {
+#endif
+    /* Message bytes are used as is, big-endian words are loaded in asm */
+    extern int Transform_Sha_SHANI_Len(word32* digest, const byte* data,
+                                       word32 len);
+#ifdef __cplusplus
+    }  /* extern "C" */
+#endif
+
+    static int transform_check = 0;
+    static word32 intel_flags;
+
+    static void Sha_SetTransform(void)
+    {
+        if (transform_check)
+            return;
+
+        intel_flags = cpuid_get_flags();
+        transform_check = 1;
+    }
+#endif /* HAVE_INTEL_SHA */
+
 /* Check if custom wc_Sha transform is used */
 #ifndef XTRANSFORM
     #define XTRANSFORM(S,B)   Transform((S),(B))
@@ -476,6 +506,19 @@ static WC_INLINE void AddLength(wc_Sha* sha, word32 len)
     }
 #endif /* !USE_CUSTOM_SHA_TRANSFORM */
 
+#ifdef HAVE_INTEL_SHA
+    static int Transform_Sha(wc_Sha* sha, const byte* data)
+    {
+        if (IS_INTEL_SHA(intel_flags))
+            return Transform_Sha_SHANI_Len(sha->digest, data,
+                                           WC_SHA_BLOCK_SIZE);
+        return Transform(sha, data);
+    }
+
+    #undef  XTRANSFORM
+    #define XTRANSFORM(S,B)   Transform_Sha((S),(B))
+#endif
+
 
 int wc_InitSha_ex(wc_Sha* sha, void* heap, int devId)
 {
@@ -498,6 +541,11 @@ int wc_InitSha_ex(wc_Sha* sha, void* heap, int devId)
     if (ret != 0)
         return ret;
 
+#ifdef HAVE_INTEL_SHA
+    /* choose best Transform function under this runtime environment */
+    Sha_SetTransform();
+#endif
+
 #if defined(WOLFSSL_ASYNC_CRYPT) && defined(WC_ASYNC_ENABLE_SHA)
     ret = wolfAsync_DevCtxInit(&sha->asyncDev, WOLFSSL_ASYNC_MARKER_SHA,
                                                             sha->heap, devId);
@@ -561,7 +609,12 @@ int wc_ShaUpdate(wc_Sha* sha, const byte* data, word32 len)
 
         if (sha->buffLen == WC_SHA_BLOCK_SIZE) {
         #if defined(LITTLE_ENDIAN_ORDER) && !defined(FREESCALE_MMCAU_SHA)
-            ByteReverseWords(sha->buffer, sha->buffer, WC_SHA_BLOCK_SIZE);
+            #ifdef HAVE_INTEL_SHA
+            if (!IS_INTEL_SHA(intel_flags))
+            #endif
+            {
+                ByteReverseWords(sha->buffer, sha->buffer, WC_SHA_BLOCK_SIZE);
+            }
         #endif
 
         #if defined(WOLFSSL_ESP32WROOM32_CRYPT) && \
@@ -597,6 +650,17 @@ int wc_ShaUpdate(wc_Sha* sha, const byte* data, word32 len)
         len  -= blocksLen;
     }
 #else
+    #ifdef HAVE_INTEL_SHA
+    if (IS_INTEL_SHA(intel_flags)) {
+        blocksLen = len & ~(WC_SHA_BLOCK_SIZE-1);
+        if (blocksLen > 0) {
+            /* Byte reversal handled in function */
+            ret = Transform_Sha_SHANI_Len(sha->digest, data, blocksLen);
+            data += blocksLen;
+            len  -= blocksLen;
+        }
+    }
+    #endif
     while (len >= WC_SHA_BLOCK_SIZE) {
         word32* local32 = sha->buffer;
         /* optimization to avoid memcpy if data pointer is properly aligned */
@@ -699,7 +763,12 @@ int wc_ShaFinal(wc_Sha* sha, byte* hash)
         sha->buffLen += WC_SHA_BLOCK_SIZE - sha->buffLen;
 
     #if defined(LITTLE_ENDIAN_ORDER) && !defined(FREESCALE_MMCAU_SHA)
-        ByteReverseWords(sha->buffer, sha->buffer, WC_SHA_BLOCK_SIZE);
+        #ifdef HAVE_INTEL_SHA
+        if (!IS_INTEL_SHA(intel_flags))
+        #endif
+        {
+            ByteReverseWords(sha->buffer, sha->buffer, WC_SHA_BLOCK_SIZE);
+        }
     #endif
 
     #if defined(WOLFSSL_ESP32WROOM32_CRYPT) && \
@@ -723,7 +792,12 @@ int wc_ShaFinal(wc_Sha* sha, byte* hash)
     XMEMSET(&local[sha->buffLen], 0, WC_SHA_PAD_SIZE - sha->buffLen);
 
 #if defined(LITTLE_ENDIAN_ORDER) && !defined(FREESCALE_MMCAU_SHA)
-    ByteReverseWords(sha->buffer, sha->buffer, WC_SHA_BLOCK_SIZE);
+    #ifdef HAVE_INTEL_SHA
+    if (!IS_INTEL_SHA(intel_flags))
+    #endif
+    {
+        ByteReverseWords(sha->buffer, sha->buffer, WC_SHA_BLOCK_SIZE);
+    }
 #endif
 
     /* store lengths */
@@ -740,6 +814,13 @@ int wc_ShaFinal(wc_Sha* sha, byte* hash)
     ByteReverseWords(&sha->buffer[WC_SHA_PAD_SIZE/sizeof(word32)],
                      &sha->buffer[WC_SHA_PAD_SIZE/sizeof(word32)],
                      2 * sizeof(word32));
+#elif defined(HAVE_INTEL_SHA)
+    /* SHA-NI also works on the message bytes, lengths are big-endian */
+    if (IS_INTEL_SHA(intel_flags)) {
+        ByteReverseWords(&sha->buffer[WC_SHA_PAD_SIZE/sizeof(word32)],
+                         &sha->buffer[WC_SHA_PAD_SIZE/sizeof(word32)],
+                         2 * sizeof(word32));
+    }
 #endif
 
 #if defined(WOLFSSL_ESP32WROOM32_CRYPT) && \
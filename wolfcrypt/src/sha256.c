@@ -152,6 +152,9 @@
     #define HAVE_INTEL_AVX1
     #ifndef NO_AVX2_SUPPORT
         #define HAVE_INTEL_AVX2
+        #ifndef NO_AVX512_SUPPORT
+            #define HAVE_INTEL_AVX512
+        #endif
     #endif
 #endif /* USE_INTEL_SPEEDUP */
 
@@ -268,6 +271,9 @@ static int InitSha256(wc_Sha256* sha256)
         extern int Transform_Sha256_AVX1(wc_Sha256 *sha256, const byte* data);
         extern int Transform_Sha256_AVX1_Len(wc_Sha256* sha256,
                                              const byte* data, word32 len);
+        extern int Transform_Sha256_SHANI(wc_Sha256 *sha256, const byte* data);
+        extern int Transform_Sha256_SHANI_Len(wc_Sha256* sha256,
+                                              const byte* data, word32 len);
     #endif
     #if defined(HAVE_INTEL_AVX2)
         extern int Transform_Sha256_AVX2(wc_Sha256 *sha256, const byte* data);
@@ -281,6 +287,14 @@ static int InitSha256(wc_Sha256* sha256)
         extern int Transform_Sha256_AVX2_RORX_Len(wc_Sha256* sha256,
                                                   const byte* data, word32 len);
         #endif /* HAVE_INTEL_RORX */
+        /* Multi-buffer: one message per 32-bit lane, state is word-major */
+        extern int Transform_Sha256_AVX2_x8(word32* state, const byte** data,
+                                            word32 blocks);
+        #ifdef HAVE_INTEL_AVX512
+        extern int Transform_Sha256_AVX512_x16(word32* state,
+                                               const byte** data,
+                                               word32 blocks);
+        #endif
     #endif /* HAVE_INTEL_AVX2 */
 
 #ifdef __cplusplus
@@ -298,6 +312,11 @@ static int InitSha256(wc_Sha256* sha256)
     #define XTRANSFORM(S, D)         (*Transform_Sha256_p)((S),(D))
     #define XTRANSFORM_LEN(S, D, L)  (*Transform_Sha256_Len_p)((S),(D),(L))
 
+    /* Intel transforms load the message bytes as big-endian words */
+    #define SHA256_REV_BYTES()                                          \
+        (!IS_INTEL_AVX1(intel_flags) && !IS_INTEL_AVX2(intel_flags) &&  \
+         !IS_INTEL_SHA(intel_flags))
+
     static void Sha256_SetTransform(void)
     {
 
@@ -306,6 +325,13 @@ static int InitSha256(wc_Sha256* sha256)
 
         intel_flags = cpuid_get_flags();
 
+    #ifdef HAVE_INTEL_AVX1
+        if (IS_INTEL_SHA(intel_flags)) {
+            Transform_Sha256_p = Transform_Sha256_SHANI;
+            Transform_Sha256_Len_p = Transform_Sha256_SHANI_Len;
+        }
+        else
+    #endif
     #ifdef HAVE_INTEL_AVX2
         if (1 && IS_INTEL_AVX2(intel_flags)) {
         #ifdef HAVE_INTEL_RORX
@@ -344,6 +370,145 @@ static int InitSha256(wc_Sha256* sha256)
         transform_check = 1;
     }
 
+#ifdef HAVE_INTEL_AVX2
+    #define WC_SHA256_MULTI_LANES   16
+
+    static const word32 sha256_mb_iv[8] = {
+        0x6A09E667L, 0xBB67AE85L, 0x3C6EF372L, 0xA54FF53AL,
+        0x510E527FL, 0x9B05688CL, 0x1F83D9ABL, 0x5BE0CD19L
+    };
+
+    /* Hash cnt independent messages with one message in each SIMD lane.
+     * Lanes that finish their message are refilled with the next one and
+     * idle lanes rehash another lane's data with the result thrown away.
+     */
+    static int Sha256MultiBuffer_Lanes(const byte* const* data,
+        const word32* sz, byte* const* hash, word32 cnt, int lanes,
+        int (*transform)(word32* state, const byte** data, word32 blocks))
+    {
+        int    ret = 0;
+        int    i;
+        int    j;
+        int    active;
+        int    job[WC_SHA256_MULTI_LANES];
+        int    inTail[WC_SHA256_MULTI_LANES];
+        word32 left[WC_SHA256_MULTI_LANES];
+        word32 n;
+        word32 rem;
+        word64 bits;
+        word32 next = 0;
+        byte*  t;
+        const byte* ptr[WC_SHA256_MULTI_LANES];
+    #ifdef WOLFSSL_SMALL_STACK
+        word32* state;
+        byte*   tail;
+    #else
+        word32 state[8 * WC_SHA256_MULTI_LANES];
+        byte   tail[WC_SHA256_MULTI_LANES * 2 * WC_SHA256_BLOCK_SIZE];
+    #endif
+
+    #ifdef WOLFSSL_SMALL_STACK
+        state = (word32*)XMALLOC(8 * WC_SHA256_MULTI_LANES * sizeof(word32) +
+                                 WC_SHA256_MULTI_LANES * 2 * WC_SHA256_BLOCK_SIZE,
+                                 NULL, DYNAMIC_TYPE_TMP_BUFFER);
+        if (state == NULL)
+            return MEMORY_E;
+        tail = (byte*)(state + 8 * WC_SHA256_MULTI_LANES);
+    #endif
+
+        for (i = 0; i < lanes; i++)
+            job[i] = -1;
+
+        while (ret == 0) {
+            /* load the next messages into empty lanes */
+            for (i = 0; i < lanes; i++) {
+                if (job[i] >= 0 || next == cnt)
+                    continue;
+
+                job[i] = (int)next++;
+                for (j = 0; j < 8; j++)
+                    state[j * lanes + i] = sha256_mb_iv[j];
+
+                /* final one or two blocks with the padding and length */
+                t = &tail[i * 2 * WC_SHA256_BLOCK_SIZE];
+                rem = sz[job[i]] % WC_SHA256_BLOCK_SIZE;
+                XMEMSET(t, 0, 2 * WC_SHA256_BLOCK_SIZE);
+                if (rem > 0)
+                    XMEMCPY(t, data[job[i]] + sz[job[i]] - rem, rem);
+                t[rem] = 0x80;
+                n = (rem < WC_SHA256_PAD_SIZE) ? 1 : 2;
+                bits = (word64)sz[job[i]] << 3;
+                for (j = 0; j < 8; j++) {
+                    t[n * WC_SHA256_BLOCK_SIZE - 1 - j] = (byte)bits;
+                    bits >>= 8;
+                }
+
+                ptr[i] = data[job[i]];
+                left[i] = sz[job[i]] / WC_SHA256_BLOCK_SIZE;
+                inTail[i] = 0;
+                if (left[i] == 0) {
+                    ptr[i] = t;
+                    left[i] = n;
+                    inTail[i] = 1;
+                }
+            }
+
+            /* run all lanes for as long as the shortest one has blocks */
+            active = -1;
+            n = 0;
+            for (i = 0; i < lanes; i++) {
+                if (job[i] < 0)
+                    continue;
+                if (active < 0 || left[i] < n)
+                    n = left[i];
+                active = i;
+            }
+            if (active < 0)
+                break;
+            for (i = 0; i < lanes; i++) {
+                if (job[i] < 0)
+                    ptr[i] = ptr[active];
+            }
+
+            ret = transform(state, (const byte**)ptr, n);
+            if (ret != 0)
+                break;
+
+            for (i = 0; i < lanes; i++) {
+                if (job[i] < 0)
+                    continue;
+                left[i] -= n;
+                ptr[i] += n * WC_SHA256_BLOCK_SIZE;
+                if (left[i] > 0)
+                    continue;
+
+                if (!inTail[i]) {
+                    ptr[i] = &tail[i * 2 * WC_SHA256_BLOCK_SIZE];
+                    rem = sz[job[i]] % WC_SHA256_BLOCK_SIZE;
+                    left[i] = (rem < WC_SHA256_PAD_SIZE) ? 1 : 2;
+                    inTail[i] = 1;
+                }
+                else {
+                    for (j = 0; j < 8; j++) {
+                        word32 w = state[j * lanes + i];
+                        hash[job[i]][j * 4 + 0] = (byte)(w >> 24);
+                        hash[job[i]][j * 4 + 1] = (byte)(w >> 16);
+                        hash[job[i]][j * 4 + 2] = (byte)(w >>  8);
+                        hash[job[i]][j * 4 + 3] = (byte)(w      );
+                    }
+                    job[i] = -1;
+                }
+            }
+        }
+
+    #ifdef WOLFSSL_SMALL_STACK
+        XFREE(state, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    #endif
+
+        return ret;
+    }
+#endif /* HAVE_INTEL_AVX2 */
+
     int wc_InitSha256_ex(wc_Sha256* sha256, void* heap, int devId)
     {
         int ret = 0;
@@ -929,7 +1094,7 @@ static int InitSha256(wc_Sha256* sha256)
             if (sha256->buffLen == WC_SHA256_BLOCK_SIZE) {
             #if defined(LITTLE_ENDIAN_ORDER) && !defined(FREESCALE_MMCAU_SHA)
                 #if defined(HAVE_INTEL_AVX1) || defined(HAVE_INTEL_AVX2)
-                if (!IS_INTEL_AVX1(intel_flags) && !IS_INTEL_AVX2(intel_flags))
+                if (SHA256_REV_BYTES())
                 #endif
                 {
                     ByteReverseWords(sha256->buffer, sha256->buffer,
@@ -1002,7 +1167,7 @@ static int InitSha256(wc_Sha256* sha256)
 
             #if defined(LITTLE_ENDIAN_ORDER) && !defined(FREESCALE_MMCAU_SHA)
                 #if defined(HAVE_INTEL_AVX1) || defined(HAVE_INTEL_AVX2)
-                if (!IS_INTEL_AVX1(intel_flags) && !IS_INTEL_AVX2(intel_flags))
+                if (SHA256_REV_BYTES())
                 #endif
                 {
                     ByteReverseWords(local32, local32, WC_SHA256_BLOCK_SIZE);
@@ -1089,7 +1254,7 @@ static int InitSha256(wc_Sha256* sha256)
 
         #if defined(LITTLE_ENDIAN_ORDER) && !defined(FREESCALE_MMCAU_SHA)
             #if defined(HAVE_INTEL_AVX1) || defined(HAVE_INTEL_AVX2)
-            if (!IS_INTEL_AVX1(intel_flags) && !IS_INTEL_AVX2(intel_flags))
+            if (SHA256_REV_BYTES())
             #endif
             {
                 ByteReverseWords(sha256->buffer, sha256->buffer,
@@ -1126,7 +1291,7 @@ static int InitSha256(wc_Sha256* sha256)
         /* store lengths */
     #if defined(LITTLE_ENDIAN_ORDER) && !defined(FREESCALE_MMCAU_SHA)
         #if defined(HAVE_INTEL_AVX1) || defined(HAVE_INTEL_AVX2)
-        if (!IS_INTEL_AVX1(intel_flags) && !IS_INTEL_AVX2(intel_flags))
+        if (SHA256_REV_BYTES())
         #endif
         {
             ByteReverseWords(sha256->buffer, sha256->buffer,
@@ -1142,7 +1307,7 @@ static int InitSha256(wc_Sha256* sha256)
         defined(HAVE_INTEL_AVX2)
         /* Kinetis requires only these bytes reversed */
         #if defined(HAVE_INTEL_AVX1) || defined(HAVE_INTEL_AVX2)
-        if (IS_INTEL_AVX1(intel_flags) || IS_INTEL_AVX2(intel_flags))
+        if (!SHA256_REV_BYTES())
         #endif
         {
             ByteReverseWords(
@@ -1641,4 +1806,56 @@ int wc_Sha256GetFlags(wc_Sha256* sha256, word32* flags)
 #endif
 #endif /* !WOLFSSL_TI_HASH */
 
+/* Hash cnt independent messages: data[i] of sz[i] bytes into hash[i].
+ * With AVX2 or AVX-512 the messages are hashed 8 or 16 at a time, one per
+ * SIMD lane. Otherwise, or for too few messages, they are hashed in turn.
+ */
+int wc_Sha256MultiBuffer(const byte* const* data, const word32* sz,
+                         byte* const* hash, word32 cnt)
+{
+    int ret = 0;
+    word32 i;
+    wc_Sha256 sha256;
+#ifdef WC_SHA256_MULTI_LANES
+    word32 flags;
+#endif
+
+    if (cnt > 0 && (data == NULL || sz == NULL || hash == NULL))
+        return BAD_FUNC_ARG;
+    for (i = 0; i < cnt; i++) {
+        if (hash[i] == NULL || (data[i] == NULL && sz[i] > 0))
+            return BAD_FUNC_ARG;
+    }
+
+#ifdef WC_SHA256_MULTI_LANES
+    Sha256_SetTransform();
+    /* current flags, not the ones of the single message transform, so that
+     * each lane implementation can be selected */
+    flags = cpuid_get_flags();
+#ifdef HAVE_INTEL_AVX512
+    if (cnt >= 8 && IS_INTEL_AVX512F(flags)) {
+        return Sha256MultiBuffer_Lanes(data, sz, hash, cnt, 16,
+                                       Transform_Sha256_AVX512_x16);
+    }
+#endif
+    /* SHA-NI hashing one message at a time is faster than 8 AVX2 lanes */
+    if (cnt >= 4 && IS_INTEL_AVX2(flags) && !IS_INTEL_SHA(flags)) {
+        return Sha256MultiBuffer_Lanes(data, sz, hash, cnt, 8,
+                                       Transform_Sha256_AVX2_x8);
+    }
+#endif
+
+    ret = wc_InitSha256_ex(&sha256, NULL, INVALID_DEVID);
+    if (ret != 0)
+        return ret;
+    for (i = 0; ret == 0 && i < cnt; i++) {
+        ret = wc_Sha256Update(&sha256, data[i], sz[i]);
+        if (ret == 0)
+            ret = wc_Sha256Final(&sha256, hash[i]);
+    }
+    wc_Sha256Free(&sha256);
+
+    return ret;
+}
+
 #endif /* NO_SHA256 */
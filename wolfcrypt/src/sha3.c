@@ -52,6 +52,29 @@
     #include <wolfcrypt/src/misc.c>
 #endif
 
+#if defined(USE_INTEL_SPEEDUP) && !defined(HAVE_FIPS)
+    #include <wolfssl/wolfcrypt/cpuid.h>
+
+    #if defined(__GNUC__) && ((__GNUC__ < 4) || \
+                              (__GNUC__ == 4 && __GNUC_MINOR__ <= 8))
+        #undef  NO_AVX2_SUPPORT
+        #define NO_AVX2_SUPPORT
+    #endif
+    #if defined(__clang__) && ((__clang_major__ < 3) || \
+                               (__clang_major__ == 3 && __clang_minor__ <= 5))
+        #define NO_AVX2_SUPPORT
+    #elif defined(__clang__) && defined(NO_AVX2_SUPPORT)
+        #undef NO_AVX2_SUPPORT
+    #endif
+
+    #ifndef NO_AVX2_SUPPORT
+        #define HAVE_INTEL_AVX2
+        #ifndef NO_AVX512_SUPPORT
+            #define HAVE_INTEL_AVX512
+        #endif
+    #endif
+#endif /* USE_INTEL_SPEEDUP && !HAVE_FIPS */
+
 
 #ifdef WOLFSSL_SHA3_SMALL
 /* Rotate a 64-bit value left.
@@ -538,6 +561,53 @@ static void BlockSha3(word64 *s)
 }
 #endif /* WOLFSSL_SHA3_SMALL */
 
+#ifdef HAVE_INTEL_AVX2
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+    /* Permute four states, lane i of state j is at s[i * 4 + j]. */
+    extern void BlockSha3_AVX2_x4(word64* s);
+#ifdef HAVE_INTEL_AVX512
+    extern void BlockSha3_AVX512(word64* s);
+    extern void BlockSha3_AVX512_x4(word64* s);
+#endif
+
+#ifdef __cplusplus
+    }  /* extern "C" */
+#endif
+
+    static void (*BlockSha3_p)(word64* s) = BlockSha3;
+    static void (*BlockSha3_x4_p)(word64* s) = NULL;
+    static int transform_check = 0;
+
+    #define SHA3_BLOCK(s)       (*BlockSha3_p)(s)
+
+    static void Sha3_SetTransform(void)
+    {
+        word32 intel_flags;
+
+        if (transform_check)
+            return;
+
+        intel_flags = cpuid_get_flags();
+
+    #ifdef HAVE_INTEL_AVX512
+        if (IS_INTEL_AVX512F(intel_flags)) {
+            BlockSha3_p = BlockSha3_AVX512;
+            if (IS_INTEL_AVX512VL(intel_flags))
+                BlockSha3_x4_p = BlockSha3_AVX512_x4;
+        }
+    #endif
+        if (BlockSha3_x4_p == NULL && IS_INTEL_AVX2(intel_flags))
+            BlockSha3_x4_p = BlockSha3_AVX2_x4;
+
+        transform_check = 1;
+    }
+#else
+    #define SHA3_BLOCK(s)       BlockSha3(s)
+#endif /* HAVE_INTEL_AVX2 */
+
 /* Convert the array of bytes, in little-endian order, to a 64-bit integer.
  *
  * a  Array of bytes.
@@ -609,7 +679,7 @@ static int Sha3Update(wc_Sha3* sha3, const byte* data, word32 len, byte p)
         {
             for (i = 0; i < p; i++)
                 sha3->s[i] ^= Load64BitBigEndian(sha3->t + 8 * i);
-            BlockSha3(sha3->s);
+            SHA3_BLOCK(sha3->s);
             sha3->i = 0;
         }
     }
@@ -617,7 +687,7 @@ static int Sha3Update(wc_Sha3* sha3, const byte* data, word32 len, byte p)
     {
         for (i = 0; i < p; i++)
             sha3->s[i] ^= Load64BitBigEndian(data + 8 * i);
-        BlockSha3(sha3->s);
+        SHA3_BLOCK(sha3->s);
         len -= p * 8;
         data += p * 8;
     }
@@ -629,6 +699,7 @@ static int Sha3Update(wc_Sha3* sha3, const byte* data, word32 len, byte p)
 }
 
 /* Calculate the SHA-3 hash based on all the message data seen.
+ * Output longer than a block, for SHAKE, is squeezed a block at a time.
  *
  * sha3  wc_Sha3 object holding state.
  * hash  Buffer to hold the hash result.
@@ -636,10 +707,12 @@ static int Sha3Update(wc_Sha3* sha3, const byte* data, word32 len, byte p)
  * len   Number of bytes in output.
  * returns 0 on success.
  */
-static int Sha3Final(wc_Sha3* sha3, byte padChar, byte* hash, byte p, byte l)
+static int Sha3Final(wc_Sha3* sha3, byte padChar, byte* hash, byte p, word32 l)
 {
     byte i;
     byte *s8 = (byte *)sha3->s;
+    word32 j;
+    word32 n;
 
     sha3->t[p * 8 - 1]  = 0x00;
 #ifdef WOLFSSL_HASH_FLAGS
@@ -653,12 +726,18 @@ static int Sha3Final(wc_Sha3* sha3, byte padChar, byte* hash, byte p, byte l)
         sha3->t[i] = 0;
     for (i = 0; i < p; i++)
         sha3->s[i] ^= Load64BitBigEndian(sha3->t + 8 * i);
-    BlockSha3(sha3->s);
-#if defined(BIG_ENDIAN_ORDER)
-    ByteReverseWords64(sha3->s, sha3->s, ((l+7)/8)*8);
-#endif
-    for (i = 0; i < l; i++)
-        hash[i] = s8[i];
+    for (j = 0; j < l; j += n) {
+        n = min(l - j, (word32)p * 8);
+        SHA3_BLOCK(sha3->s);
+    #if defined(BIG_ENDIAN_ORDER)
+        ByteReverseWords64(sha3->s, sha3->s, ((n+7)/8)*8);
+    #endif
+        XMEMCPY(hash + j, s8, n);
+    #if defined(BIG_ENDIAN_ORDER)
+        if (j + n < l)
+            ByteReverseWords64(sha3->s, sha3->s, ((n+7)/8)*8);
+    #endif
+    }
 
     return 0;
 }
@@ -678,6 +757,9 @@ static int wc_InitSha3(wc_Sha3* sha3, void* heap, int devId)
         return BAD_FUNC_ARG;
 
     sha3->heap = heap;
+#ifdef HAVE_INTEL_AVX2
+    Sha3_SetTransform();
+#endif
     ret = InitSha3(sha3);
     if (ret != 0)
         return ret;
@@ -1139,6 +1221,218 @@ int wc_Sha3_GetFlags(wc_Sha3* sha3, word32* flags)
 }
 #endif
 
+#ifdef HAVE_INTEL_AVX2
+#define WC_SHA3_MULTI_LANES     4
+
+/* Hash cnt independent messages with one message in each of the four
+ * interleaved states. Lanes that finish their message are refilled with the
+ * next one and idle lanes are permuted with the result thrown away.
+ *
+ * p    Number of 64-bit numbers in a block of data to process.
+ * len  Number of bytes in output.
+ */
+static int Sha3MultiBuffer_x4(const byte* const* data, const word32* sz,
+    byte* const* hash, word32 cnt, byte p, byte len)
+{
+    int    i;
+    word32 j;
+    int    active;
+    int    job[WC_SHA3_MULTI_LANES];
+    int    last[WC_SHA3_MULTI_LANES];
+    word32 off[WC_SHA3_MULTI_LANES];
+    word32 left;
+    word32 next = 0;
+    const byte* m;
+    byte   t[WC_SHA3_224_COUNT * 8];
+#ifdef WOLFSSL_SMALL_STACK
+    word64* s;
+#else
+    word64 s[25 * WC_SHA3_MULTI_LANES];
+#endif
+
+#ifdef WOLFSSL_SMALL_STACK
+    s = (word64*)XMALLOC(25 * WC_SHA3_MULTI_LANES * sizeof(word64), NULL,
+                         DYNAMIC_TYPE_TMP_BUFFER);
+    if (s == NULL)
+        return MEMORY_E;
+#endif
+
+    for (i = 0; i < WC_SHA3_MULTI_LANES; i++)
+        job[i] = -1;
+
+    for (;;) {
+        active = 0;
+        for (i = 0; i < WC_SHA3_MULTI_LANES; i++) {
+            /* load the next message into an empty lane */
+            if (job[i] < 0 && next < cnt) {
+                job[i] = (int)next++;
+                off[i] = 0;
+                for (j = 0; j < 25; j++)
+                    s[j * WC_SHA3_MULTI_LANES + i] = 0;
+            }
+            if (job[i] < 0)
+                continue;
+            active = 1;
+
+            /* absorb a full block or the padded final block */
+            left = sz[job[i]] - off[i];
+            if (left >= (word32)p * 8) {
+                m = data[job[i]] + off[i];
+                off[i] += (word32)p * 8;
+                last[i] = 0;
+            }
+            else {
+                XMEMSET(t, 0, p * 8);
+                if (left > 0)
+                    XMEMCPY(t, data[job[i]] + off[i], left);
+                t[left] = 0x06;
+                t[p * 8 - 1] |= 0x80;
+                m = t;
+                last[i] = 1;
+            }
+            for (j = 0; j < p; j++)
+                s[j * WC_SHA3_MULTI_LANES + i] ^= Load64BitBigEndian(m + 8 * j);
+        }
+        if (!active)
+            break;
+
+        (*BlockSha3_x4_p)(s);
+
+        for (i = 0; i < WC_SHA3_MULTI_LANES; i++) {
+            if (job[i] < 0 || !last[i])
+                continue;
+            for (j = 0; j < len; j++) {
+                hash[job[i]][j] = (byte)(s[(j / 8) * WC_SHA3_MULTI_LANES + i] >>
+                                         (8 * (j % 8)));
+            }
+            job[i] = -1;
+        }
+    }
+
+    ForceZero(s, 25 * WC_SHA3_MULTI_LANES * sizeof(word64));
+    ForceZero(t, sizeof(t));
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(s, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    return 0;
+}
+#endif /* HAVE_INTEL_AVX2 */
+
+/* Hash cnt independent messages with SHA3-256: data[i] of sz[i] bytes into
+ * hash[i]. With AVX2 or AVX-512 the messages are hashed four at a time, one
+ * in each of four interleaved states. Otherwise they are hashed in turn.
+ */
+int wc_Sha3_256_MultiBuffer(const byte* const* data, const word32* sz,
+                            byte* const* hash, word32 cnt)
+{
+    int ret = 0;
+    word32 i;
+    wc_Sha3 sha3;
+
+    if (cnt > 0 && (data == NULL || sz == NULL || hash == NULL))
+        return BAD_FUNC_ARG;
+    for (i = 0; i < cnt; i++) {
+        if (hash[i] == NULL || (data[i] == NULL && sz[i] > 0))
+            return BAD_FUNC_ARG;
+    }
+
+#ifdef HAVE_INTEL_AVX2
+    Sha3_SetTransform();
+    if (cnt >= 2 && BlockSha3_x4_p != NULL) {
+        return Sha3MultiBuffer_x4(data, sz, hash, cnt, WC_SHA3_256_COUNT,
+                                  WC_SHA3_256_DIGEST_SIZE);
+    }
+#endif
+
+    ret = wc_InitSha3_256(&sha3, NULL, INVALID_DEVID);
+    if (ret != 0)
+        return ret;
+    for (i = 0; ret == 0 && i < cnt; i++) {
+        ret = wc_Sha3_256_Update(&sha3, data[i], sz[i]);
+        if (ret == 0)
+            ret = wc_Sha3_256_Final(&sha3, hash[i]);
+    }
+    wc_Sha3_256_Free(&sha3);
+
+    return ret;
+}
+
+#if defined(WOLFSSL_SHAKE128)
+/* Initialize the state for a Shake128 hash operation.
+ *
+ * shake  wc_Shake object holding state.
+ * heap   Heap reference for dynamic memory allocation. (Used in async ops.)
+ * devId  Device identifier for asynchronous operation.
+ * returns 0 on success.
+ */
+int wc_InitShake128(wc_Shake* shake, void* heap, int devId)
+{
+    return wc_InitSha3(shake, heap, devId);
+}
+
+/* Update the SHAKE128 hash state with message data.
+ *
+ * shake  wc_Shake object holding state.
+ * data  Message data to be hashed.
+ * len   Length of the message data.
+ * returns 0 on success.
+ */
+int wc_Shake128_Update(wc_Shake* shake, const byte* data, word32 len)
+{
+    if (shake == NULL || (data == NULL && len > 0)) {
+         return BAD_FUNC_ARG;
+    }
+
+    return Sha3Update(shake, data, len, WC_SHA3_128_COUNT);
+}
+
+/* Calculate the SHAKE128 hash based on all the message data seen.
+ * The state is initialized ready for a new message to hash.
+ *
+ * shake  wc_Shake object holding state.
+ * hash  Buffer to hold the hash result. Must be at least hashLen bytes.
+ * returns 0 on success.
+ */
+int wc_Shake128_Final(wc_Shake* shake, byte* hash, word32 hashLen)
+{
+    int ret;
+
+    if (shake == NULL || hash == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = Sha3Final(shake, 0x1f, hash, WC_SHA3_128_COUNT, hashLen);
+    if (ret != 0)
+        return ret;
+
+    return InitSha3(shake);  /* reset state */
+}
+
+/* Dispose of any dynamically allocated data from the SHAKE128 operation.
+ * (Required for async ops.)
+ *
+ * shake  wc_Shake object holding state.
+ * returns 0 on success.
+ */
+void wc_Shake128_Free(wc_Shake* shake)
+{
+    wc_Sha3Free(shake);
+}
+
+/* Copy the state of the SHAKE128 operation.
+ *
+ * src  wc_Shake object holding state top copy.
+ * dst  wc_Shake object to copy into.
+ * returns 0 on success.
+ */
+int wc_Shake128_Copy(wc_Shake* src, wc_Shake* dst)
+{
+    return wc_Sha3Copy(src, dst);
+}
+#endif
+
+
 #if defined(WOLFSSL_SHAKE256)
 /* Initialize the state for a Shake256 hash operation.
  *
@@ -1172,7 +1466,7 @@ int wc_Shake256_Update(wc_Shake* shake, const byte* data, word32 len)
  * The state is initialized ready for a new message to hash.
  *
  * shake  wc_Shake object holding state.
- * hash  Buffer to hold the hash result. Must be at least 64 bytes.
+ * hash  Buffer to hold the hash result. Must be at least hashLen bytes.
  * returns 0 on success.
  */
 int wc_Shake256_Final(wc_Shake* shake, byte* hash, word32 hashLen)
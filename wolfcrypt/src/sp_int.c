@@ -44,7 +44,9 @@
  * WOLFSSL_SP_NO_2048:          Disable RSA/DH 2048-bit support
  * WOLFSSL_SP_NO_3072:          Disable RSA/DH 3072-bit support
  * WOLFSSL_SP_4096:             Enable RSA/RH 4096-bit support
+ * WOLFSSL_SP_8192:             Enable RSA/RH 8192-bit support (requires WOLFSSL_SP_4096)
  * WOLFSSL_SP_384               Enable ECC 384-bit SECP384R1 support
+ * WOLFSSL_SP_521               Enable ECC 521-bit SECP521R1 support
  * WOLFSSL_SP_NO_256            Disable ECC 256-bit SECP256R1 support
  * WOLFSSL_SP_CACHE_RESISTANT   Enable cache resistantant code 
  * WOLFSSL_SP_ASM               Enable assembly speedups (detect platform)
@@ -72,6 +74,8 @@ WOLFSSL_LOCAL int sp_ModExp_3072(sp_int* base, sp_int* exp, sp_int* mod,
     sp_int* res);
 WOLFSSL_LOCAL int sp_ModExp_4096(sp_int* base, sp_int* exp, sp_int* mod,
     sp_int* res);
+WOLFSSL_LOCAL int sp_ModExp_8192(sp_int* base, sp_int* exp, sp_int* mod,
+    sp_int* res);
 
 #endif
 
@@ -1665,6 +1669,14 @@ int sp_exptmod(sp_int* b, sp_int* e, sp_int* m, sp_int* r)
             done = 1;
         }
         else
+#endif
+#ifdef WOLFSSL_SP_8192
+        if ((mBits == 8192) && sp_isodd(m) && (bBits <= 8192) &&
+            (eBits <= 8192)) {
+            err = sp_ModExp_8192(b, e, m, r);
+            done = 1;
+        }
+        else
 #endif
         {
         }
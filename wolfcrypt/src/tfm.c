@@ -80,6 +80,8 @@ WOLFSSL_LOCAL int sp_ModExp_3072(mp_int* base, mp_int* exp, mp_int* mod,
     mp_int* res);
 WOLFSSL_LOCAL int sp_ModExp_4096(mp_int* base, mp_int* exp, mp_int* mod,
     mp_int* res);
+WOLFSSL_LOCAL int sp_ModExp_8192(mp_int* base, mp_int* exp, mp_int* mod,
+    mp_int* res);
 #ifdef __cplusplus
     } /* extern "C" */
 #endif
@@ -1579,6 +1581,12 @@ static int _fp_exptmod_ct(fp_int * G, fp_int * X, int digits, fp_int * P,
   fp_digit buf, mp;
   int      err, bitcnt, digidx, y;
 
+#ifdef WOLFSSL_MONT52
+  if (mp_mont52_supported(P)) {
+     return mp_exptmod_mont52(G, X, digits * DIGIT_BIT, P, Y);
+  }
+#endif
+
   /* now setup montgomery  */
   if ((err = fp_montgomery_setup (P, &mp)) != FP_OKAY) {
      return err;
@@ -1718,6 +1726,12 @@ static int _fp_exptmod_nct(fp_int * G, fp_int * X, fp_int * P, fp_int * Y)
   fp_int   M[(1 << 6) + 1];
 #endif
 
+#ifdef WOLFSSL_MONT52
+  if (mp_mont52_supported(P)) {
+     return mp_exptmod_mont52(G, X, fp_count_bits(X), P, Y);
+  }
+#endif
+
   /* find window size */
   x = fp_count_bits (X);
   if (x <= 21) {
@@ -4193,6 +4207,11 @@ static int fp_prime_miller_rabin_ex(fp_int * a, fp_int * b, int *result,
       sp_ModExp_4096(b, r, a, y);
   else
 #endif
+#ifdef WOLFSSL_SP_8192
+  if (fp_count_bits(a) == 8192)
+      sp_ModExp_8192(b, r, a, y);
+  else
+#endif
 #endif
       fp_exptmod(b, r, a, y);
 
@@ -32,6 +32,9 @@
 #ifdef HAVE_ECC
     #include <wolfssl/wolfcrypt/ecc.h>
 #endif
+#ifndef NO_DH
+    #include <wolfssl/wolfcrypt/dh.h>
+#endif
 #ifdef WOLFSSL_ASYNC_CRYPT
     #include <wolfssl/wolfcrypt/async.h>
 #endif
@@ -232,6 +235,13 @@ int wolfCrypt_Init(void)
     #endif
 #endif
 
+#if !defined(NO_DH) && defined(WC_DH_PRECOMP)
+        if ((ret = wc_DhPrecompInit()) != 0) {
+            WOLFSSL_MSG("Error creating DH table cache");
+            return ret;
+        }
+#endif
+
 #ifdef WOLFSSL_SCE
         ret = (int)WOLFSSL_SCE_GSCE_HANDLE.p_api->open(
                 WOLFSSL_SCE_GSCE_HANDLE.p_ctrl, WOLFSSL_SCE_GSCE_HANDLE.p_cfg);
@@ -286,6 +296,10 @@ int wolfCrypt_Cleanup(void)
     #endif
 #endif /* HAVE_ECC */
 
+#if !defined(NO_DH) && defined(WC_DH_PRECOMP)
+        wc_DhPrecompFree();
+#endif
+
     #if defined(OPENSSL_EXTRA) || defined(DEBUG_WOLFSSL_VERBOSE)
         ret = wc_LoggingCleanup();
     #endif
@@ -227,6 +227,376 @@ int wc_export_int(mp_int* mp, byte* buf, word32* len, word32 keySz,
     return err;
 }
 
+#ifdef WOLFSSL_MONT52
+/* Montgomery multiplication on 52-bit words with AVX-512 IFMA.
+ * Numbers are held in arrays of 52-bit words with a length that is a multiple
+ * of 8, the vector size. With n words used, R = 2^(52.n).
+ * The assembly code calculates r = a * b / R mod m with a, b < 2.m and
+ * 4.m < R, leaving r < 2.m. */
+
+#include <wolfssl/wolfcrypt/cpuid.h>
+
+#define MONT52_MASK         W64LIT(0xfffffffffffff)
+#define MONT52_MAX_WORDS    160
+
+typedef void (*mont52_mul_func)(word64* r, const word64* a, const word64* b,
+                                const word64* m, word64 k0, word64 n);
+
+extern void mont52_mul_avx512_16(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_24(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_32(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_40(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_48(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_56(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_64(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_72(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_80(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_88(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_96(word64* r, const word64* a, const word64* b,
+                                 const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_104(word64* r, const word64* a, const word64* b,
+                                  const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_112(word64* r, const word64* a, const word64* b,
+                                  const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_120(word64* r, const word64* a, const word64* b,
+                                  const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_128(word64* r, const word64* a, const word64* b,
+                                  const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_136(word64* r, const word64* a, const word64* b,
+                                  const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_144(word64* r, const word64* a, const word64* b,
+                                  const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_152(word64* r, const word64* a, const word64* b,
+                                  const word64* m, word64 k0, word64 n);
+extern void mont52_mul_avx512_160(word64* r, const word64* a, const word64* b,
+                                  const word64* m, word64 k0, word64 n);
+
+/* Indexed by number of words rounded up to a multiple of 8, / 8 - 2. */
+static const mont52_mul_func mont52_mul[] = {
+    mont52_mul_avx512_16,  mont52_mul_avx512_24,  mont52_mul_avx512_32,
+    mont52_mul_avx512_40,  mont52_mul_avx512_48,  mont52_mul_avx512_56,
+    mont52_mul_avx512_64,  mont52_mul_avx512_72,  mont52_mul_avx512_80,
+    mont52_mul_avx512_88,  mont52_mul_avx512_96,  mont52_mul_avx512_104,
+    mont52_mul_avx512_112, mont52_mul_avx512_120, mont52_mul_avx512_128,
+    mont52_mul_avx512_136, mont52_mul_avx512_144, mont52_mul_avx512_152,
+    mont52_mul_avx512_160
+};
+
+/* Number of 52-bit words needed to hold values below 4 times the modulus. */
+static int mont52_words(int bits)
+{
+    return (bits + 2 + 52 - 1) / 52;
+}
+
+/* Check whether the modulus can be used with the 52-bit word Montgomery
+ * exponentiation.
+ *
+ * m  Modulus.
+ * returns 1 when the CPU supports AVX-512 IFMA and the modulus is odd and of
+ *         a supported size, 0 otherwise.
+ */
+int mp_mont52_supported(mp_int* m)
+{
+    word32 flags = cpuid_get_flags();
+    int    bits;
+    int    n;
+
+    if (!IS_INTEL_AVX512F(flags) || !IS_INTEL_AVX512IFMA(flags) ||
+                                                        !IS_INTEL_BMI2(flags)) {
+        return 0;
+    }
+    if (m == NULL || mp_isneg(m) || !mp_isodd(m)) {
+        return 0;
+    }
+    bits = mp_count_bits(m);
+    if (bits < WOLFSSL_MONT52_MIN_BITS) {
+        return 0;
+    }
+    n = mont52_words(bits);
+    return n > 8 && n <= MONT52_MAX_WORDS;
+}
+
+/* Convert big-endian bytes to n 52-bit words. */
+static void mont52_from_bin(word64* r, int n, const byte* in, int inSz)
+{
+    int    i;
+    int    j = 0;
+    int    s = 0;
+    word64 v = 0;
+
+    for (i = inSz - 1; (i >= 0) && (j < n); i--) {
+        v |= (word64)in[i] << s;
+        s += 8;
+        if (s >= 52) {
+            r[j++] = v & MONT52_MASK;
+            s -= 52;
+            v = (word64)in[i] >> (8 - s);
+        }
+    }
+    if (j < n) {
+        r[j++] = v;
+    }
+    for (; j < n; j++) {
+        r[j] = 0;
+    }
+}
+
+/* Convert n 52-bit words to outSz big-endian bytes. */
+static void mont52_to_bin(byte* out, int outSz, const word64* a, int n)
+{
+    int    i;
+    int    j = 0;
+    int    s = 0;
+    word64 v = 0;
+
+    for (i = outSz - 1; i >= 0; i--) {
+        if ((s < 8) && (j < n)) {
+            v |= a[j++] << s;
+            s += 52;
+        }
+        out[i] = (byte)v;
+        v >>= 8;
+        s -= 8;
+    }
+}
+
+/* Convert an mp_int, less than the modulus, to n 52-bit words. */
+static int mont52_from_mp(word64* r, int n, mp_int* a, byte* buf, int bufSz)
+{
+    int err = mp_to_unsigned_bin_len(a, buf, bufSz);
+    if (err == MP_OKAY) {
+        mont52_from_bin(r, n, buf, bufSz);
+    }
+    return err;
+}
+
+/* Get w bits of the big-endian exponent starting at bit pos. */
+static int mont52_get_window(const byte* e, int eSz, int pos, int w)
+{
+    int    i = eSz - 1 - (pos >> 3);
+    word32 v = e[i];
+
+    if (i > 0) {
+        v |= (word32)e[i - 1] << 8;
+    }
+    return (int)(v >> (pos & 7)) & ((1 << w) - 1);
+}
+
+/* Constant time copy of table entry idx into r. */
+static void mont52_select(word64* r, const word64* t, int cnt, int n, int idx)
+{
+    int    i;
+    int    j;
+    word64 mask;
+
+    XMEMSET(r, 0, n * sizeof(word64));
+    for (i = 0; i < cnt; i++) {
+        mask = (word64)0 - (word64)(i == idx);
+        for (j = 0; j < n; j++) {
+            r[j] |= t[i * n + j] & mask;
+        }
+    }
+}
+
+/* Modular exponentiation using 52-bit word Montgomery multiplication with
+ * AVX-512 IFMA. Uses a fixed window and constant time table look-up.
+ * Only call when mp_mont52_supported() returns 1 for the modulus.
+ *
+ * G     Base.
+ * X     Exponent - must be non-negative.
+ * bits  Number of exponent bits to operate on. Pass a fixed count, derived
+ *       from the size of the modulus, to hide the length of a secret exponent.
+ * P     Modulus - must be odd.
+ * Y     Result.
+ * returns MEMORY_E when dynamic memory allocation fails, BAD_FUNC_ARG when
+ *         the exponent is larger than bits and MP_OKAY otherwise.
+ */
+int mp_exptmod_mont52(mp_int* G, mp_int* X, int bits, mp_int* P, mp_int* Y)
+{
+    int             err = MP_OKAY;
+    int             n;
+    int             words;
+    int             i;
+    int             w;
+    int             c;
+    int             pos;
+    int             cnt;
+    int             bufSz;
+    int             eSz;
+    word64          k0;
+    word64          inv;
+    word64          mask;
+    word64          borrow;
+    word64*         d = NULL;
+    word64*         t;
+    word64*         m;
+    word64*         rr;
+    word64*         acc;
+    word64*         tmp;
+    byte*           buf = NULL;
+    byte*           e;
+    mont52_mul_func mul;
+#ifdef WOLFSSL_SMALL_STACK
+    mp_int*         r = NULL;
+#else
+    mp_int          r[1];
+#endif
+
+    if (bits <= 0) {
+        bits = 1;
+    }
+    if (mp_count_bits(X) > bits) {
+        return BAD_FUNC_ARG;
+    }
+
+    /* Vector operations work on multiples of 8 words. */
+    words = mont52_words(mp_count_bits(P));
+    n = (words + 7) / 8 * 8;
+    mul = mont52_mul[n / 8 - 2];
+    if (bits > 256)
+        w = 5;
+    else if (bits > 80)
+        w = 4;
+    else if (bits > 24)
+        w = 3;
+    else if (bits > 6)
+        w = 2;
+    else
+        w = 1;
+    cnt = 1 << w;
+    bufSz = n * 8;
+    eSz = (bits + 7) / 8;
+
+#ifdef WOLFSSL_SMALL_STACK
+    r = (mp_int*)XMALLOC(sizeof(mp_int), NULL, DYNAMIC_TYPE_BIGINT);
+    if (r == NULL)
+        err = MEMORY_E;
+#endif
+    if (err == MP_OKAY) {
+        /* Extra words to align to 64 bytes for the vector loads. */
+        d = (word64*)XMALLOC((cnt + 4) * n * sizeof(word64) + 64, NULL,
+                                                           DYNAMIC_TYPE_BIGINT);
+        buf = (byte*)XMALLOC(bufSz + eSz, NULL, DYNAMIC_TYPE_BIGINT);
+        if (d == NULL || buf == NULL)
+            err = MEMORY_E;
+    }
+    if (err == MP_OKAY) {
+        err = mp_init(r);
+    }
+    if (err != MP_OKAY) {
+        XFREE(buf, NULL, DYNAMIC_TYPE_BIGINT);
+        XFREE(d, NULL, DYNAMIC_TYPE_BIGINT);
+    #ifdef WOLFSSL_SMALL_STACK
+        XFREE(r, NULL, DYNAMIC_TYPE_BIGINT);
+    #endif
+        return err;
+    }
+
+    t = (word64*)(((wolfssl_word)d + 63) & ~(wolfssl_word)63);
+    m = t + cnt * n;
+    rr = m + n;
+    acc = rr + n;
+    tmp = acc + n;
+    e = buf + bufSz;
+
+    /* k0 = -1 / m mod 2^52 using Newton's method. */
+    err = mont52_from_mp(m, n, P, buf, bufSz);
+    if (err == MP_OKAY) {
+        inv = m[0];
+        for (i = 0; i < 5; i++) {
+            inv *= 2 - m[0] * inv;
+        }
+        k0 = ((word64)0 - inv) & MONT52_MASK;
+
+        /* Montgomery form of 1: R mod m. */
+        err = mp_2expt(r, words * 52);
+    }
+    if (err == MP_OKAY)
+        err = mp_mod(r, P, r);
+    if (err == MP_OKAY)
+        err = mont52_from_mp(t, n, r, buf, bufSz);
+    /* Montgomery normalizer: R^2 mod m. */
+    if (err == MP_OKAY)
+        err = mp_mulmod(r, r, P, r);
+    if (err == MP_OKAY)
+        err = mont52_from_mp(rr, n, r, buf, bufSz);
+    /* Base reduced modulo m. */
+    if (err == MP_OKAY) {
+        if (mp_isneg(G) || mp_cmp(G, P) != MP_LT) {
+            err = mp_mod(G, P, r);
+            if (err == MP_OKAY)
+                err = mont52_from_mp(tmp, n, r, buf, bufSz);
+        }
+        else {
+            err = mont52_from_mp(tmp, n, G, buf, bufSz);
+        }
+    }
+    if (err == MP_OKAY)
+        err = mp_to_unsigned_bin_len(X, e, eSz);
+
+    if (err == MP_OKAY) {
+        /* Table of base to the powers 0..2^w-1 in Montgomery form. */
+        mul(t + n, tmp, rr, m, k0, words);
+        for (i = 2; i < cnt; i++) {
+            mul(t + i * n, t + (i - 1) * n, t + n, m, k0, words);
+        }
+
+        c = bits % w;
+        if (c == 0)
+            c = w;
+        pos = bits - c;
+        mont52_select(acc, t, cnt, n, mont52_get_window(e, eSz, pos, c));
+        while (pos > 0) {
+            pos -= w;
+            for (i = 0; i < w; i++) {
+                mul(acc, acc, acc, m, k0, words);
+            }
+            mont52_select(tmp, t, cnt, n, mont52_get_window(e, eSz, pos, w));
+            mul(acc, acc, tmp, m, k0, words);
+        }
+
+        /* Convert out of Montgomery form: result is at most m. */
+        XMEMSET(tmp, 0, n * sizeof(word64));
+        tmp[0] = 1;
+        mul(acc, acc, tmp, m, k0, words);
+        borrow = 0;
+        for (i = 0; i < n; i++) {
+            tmp[i] = acc[i] - m[i] - borrow;
+            borrow = tmp[i] >> 63;
+            tmp[i] &= MONT52_MASK;
+        }
+        mask = borrow - 1;
+        for (i = 0; i < n; i++) {
+            acc[i] = (tmp[i] & mask) | (acc[i] & ~mask);
+        }
+
+        mont52_to_bin(buf, bufSz, acc, n);
+        err = mp_read_unsigned_bin(Y, buf, bufSz);
+    }
+
+    ForceZero(t, (cnt + 4) * n * sizeof(word64));
+    ForceZero(buf, bufSz + eSz);
+    XFREE(buf, NULL, DYNAMIC_TYPE_BIGINT);
+    XFREE(d, NULL, DYNAMIC_TYPE_BIGINT);
+    mp_forcezero(r);
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(r, NULL, DYNAMIC_TYPE_BIGINT);
+#endif
+
+    return err;
+}
+#endif /* WOLFSSL_MONT52 */
+
 
 #ifdef HAVE_WOLF_BIGINT
 void wc_bigint_init(WC_BIGINT* a)
@@ -154,6 +154,10 @@
 #include <wolfssl/wolfcrypt/pwdbased.h>
 #include <wolfssl/wolfcrypt/ripemd.h>
 #include <wolfssl/wolfcrypt/error-crypt.h>
+#if defined(USE_INTEL_SPEEDUP) && !defined(WOLFSSL_NO_ASM)
+    #include <wolfssl/wolfcrypt/cpuid.h>
+    #define TEST_CPUID_FLAGS
+#endif
 #ifdef HAVE_ECC
     #include <wolfssl/wolfcrypt/ecc.h>
 #endif
@@ -284,6 +288,7 @@ int  sha256_test(void);
 int  sha512_test(void);
 int  sha384_test(void);
 int  sha3_test(void);
+int  shake128_test(void);
 int  shake256_test(void);
 int  hash_test(void);
 int  hmac_md5_test(void);
@@ -294,6 +299,7 @@ int  hmac_sha384_test(void);
 int  hmac_sha512_test(void);
 int  hmac_sha3_test(void);
 int  hkdf_test(void);
+int  hmac_aes_cbc_test(void);
 int  x963kdf_test(void);
 int  arc4_test(void);
 int  hc128_test(void);
@@ -409,6 +415,9 @@ int mp_test(void);
 #if defined(WOLFSSL_PUBLIC_MP) && defined(WOLFSSL_KEY_GEN)
 int prime_test(void);
 #endif
+#if defined(WOLFSSL_PUBLIC_MP) && !defined(WOLFSSL_SP_MATH)
+int exptmod_test(void);
+#endif
 #ifdef ASN_BER_TO_DER
 int berder_test(void);
 #endif
@@ -702,6 +711,13 @@ initDefaultName();
         test_pass("SHA-3    test passed!\n");
 #endif
 
+#ifdef WOLFSSL_SHAKE128
+    if ( (ret = shake128_test()) != 0)
+        return err_sys("SHAKE128 test failed!\n", ret);
+    else
+        test_pass("SHAKE128 test passed!\n");
+#endif
+
 #ifdef WOLFSSL_SHAKE256
     if ( (ret = shake256_test()) != 0)
         return err_sys("SHAKE256 test failed!\n", ret);
@@ -786,6 +802,14 @@ initDefaultName();
             test_pass("HMAC-SHA3   test passed!\n");
     #endif
 
+    #if !defined(NO_AES) && defined(HAVE_AES_CBC) && !defined(HAVE_FIPS) && \
+        !defined(HAVE_SELFTEST) && (!defined(NO_SHA) || !defined(NO_SHA256))
+        if ( (ret = hmac_aes_cbc_test()) != 0)
+            return err_sys("HMAC-AES-CBC test failed!\n", ret);
+        else
+            test_pass("HMAC-AES-CBC test passed!\n");
+    #endif
+
     #ifdef HAVE_HKDF
         if ( (ret = hkdf_test()) != 0)
             return err_sys("HMAC-KDF    test failed!\n", ret);
@@ -1136,6 +1160,13 @@ initDefaultName();
         test_pass("prime    test passed!\n");
 #endif
 
+#if defined(WOLFSSL_PUBLIC_MP) && !defined(WOLFSSL_SP_MATH)
+    if ( (ret = exptmod_test()) != 0)
+        return err_sys("exptmod  test failed!\n", ret);
+    else
+        test_pass("exptmod  test passed!\n");
+#endif
+
 #if defined(ASN_BER_TO_DER) && \
     (defined(WOLFSSL_TEST_CERT) || defined(OPENSSL_EXTRA) || \
      defined(OPENSSL_EXTRA_X509_SMALL))
@@ -2130,11 +2161,37 @@ static const byte blake2b_vec[BLAKE2B_TESTS][BLAKE2B_OUTBYTES] =
 
 
 
+static const byte blake2bp_vec[2][BLAKE2B_OUTBYTES] =
+{
+  {
+    0xb5, 0xef, 0x81, 0x1a, 0x80, 0x38, 0xf7, 0x0b,
+    0x62, 0x8f, 0xa8, 0xb2, 0x94, 0xda, 0xae, 0x74,
+    0x92, 0xb1, 0xeb, 0xe3, 0x43, 0xa8, 0x0e, 0xaa,
+    0xbb, 0xf1, 0xf6, 0xae, 0x66, 0x4d, 0xd6, 0x7b,
+    0x9d, 0x90, 0xb0, 0x12, 0x07, 0x91, 0xea, 0xb8,
+    0x1d, 0xc9, 0x69, 0x85, 0xf2, 0x88, 0x49, 0xf6,
+    0xa3, 0x05, 0x18, 0x6a, 0x85, 0x50, 0x1b, 0x40,
+    0x51, 0x14, 0xbf, 0xa6, 0x78, 0xdf, 0x93, 0x80
+  },
+  {
+    0x6d, 0x11, 0x56, 0x2e, 0x72, 0x66, 0xb4, 0x02,
+    0xd2, 0xfa, 0xcf, 0x3f, 0xcb, 0x9e, 0x6d, 0x74,
+    0xb7, 0x4c, 0xc9, 0x21, 0x7c, 0x4c, 0x2a, 0xf3,
+    0xbf, 0x51, 0xd5, 0x98, 0xe5, 0xae, 0x1b, 0x62,
+    0x20, 0x45, 0x4d, 0xf0, 0x36, 0xc2, 0xb3, 0xf3,
+    0x2f, 0xa5, 0x2d, 0x74, 0x48, 0xfc, 0xbc, 0xd7,
+    0x43, 0xe6, 0x6c, 0xaa, 0x87, 0xfb, 0xaa, 0x02,
+    0xe0, 0x2b, 0x0e, 0x32, 0x07, 0xdf, 0x54, 0xa9
+  }
+};
+
+
 int blake2b_test(void)
 {
     Blake2b b2b;
+    Blake2bp b2bp;
     byte    digest[64];
-    byte    input[64];
+    byte    input[256];
     int     i, ret;
 
     for (i = 0; i < (int)sizeof(input); i++)
@@ -2158,6 +2215,33 @@ int blake2b_test(void)
         }
     }
 
+    /* tree mode: empty message and 1537 bytes of (byte)i */
+    ret = wc_InitBlake2bp(&b2bp, 64);
+    if (ret != 0)
+        return -2040;
+    ret = wc_Blake2bpFinal(&b2bp, digest, 64);
+    if (ret != 0)
+        return -2041;
+    if (XMEMCMP(digest, blake2bp_vec[0], 64) != 0)
+        return -2042;
+
+    ret = wc_InitBlake2bp(&b2bp, 64);
+    if (ret != 0)
+        return -2043;
+    for (i = 0; i < 6; i++) {
+        ret = wc_Blake2bpUpdate(&b2bp, input, sizeof(input));
+        if (ret != 0)
+            return -2044;
+    }
+    ret = wc_Blake2bpUpdate(&b2bp, input, 1);
+    if (ret != 0)
+        return -2045;
+    ret = wc_Blake2bpFinal(&b2bp, digest, 64);
+    if (ret != 0)
+        return -2046;
+    if (XMEMCMP(digest, blake2bp_vec[1], 64) != 0)
+        return -2047;
+
     return 0;
 }
 #endif /* HAVE_BLAKE2 */
@@ -2191,11 +2275,29 @@ static const byte blake2s_vec[BLAKE2S_TESTS][BLAKE2S_OUTBYTES] =
 
 
 
+static const byte blake2sp_vec[2][BLAKE2S_OUTBYTES] =
+{
+  {
+    0xdd, 0x0e, 0x89, 0x17, 0x76, 0x93, 0x3f, 0x43,
+    0xc7, 0xd0, 0x32, 0xb0, 0x8a, 0x91, 0x7e, 0x25,
+    0x74, 0x1f, 0x8a, 0xa9, 0xa1, 0x2c, 0x12, 0xe1,
+    0xca, 0xc8, 0x80, 0x15, 0x00, 0xf2, 0xca, 0x4f
+  },
+  {
+    0x8f, 0xd0, 0x89, 0x1e, 0x55, 0x28, 0x27, 0xf0,
+    0x66, 0x52, 0xc5, 0xed, 0x9a, 0x5c, 0x81, 0xab,
+    0x3f, 0xd6, 0x8e, 0x78, 0x93, 0xb3, 0xbe, 0x89,
+    0x01, 0x1f, 0xb4, 0x7e, 0xd9, 0xcd, 0x26, 0xe8
+  }
+};
+
+
 int blake2s_test(void)
 {
     Blake2s b2s;
+    Blake2sp b2sp;
     byte    digest[32];
-    byte    input[64];
+    byte    input[256];
     int     i, ret;
 
     for (i = 0; i < (int)sizeof(input); i++)
@@ -2219,6 +2321,33 @@ int blake2s_test(void)
         }
     }
 
+    /* tree mode: empty message and 1537 bytes of (byte)i */
+    ret = wc_InitBlake2sp(&b2sp, 32);
+    if (ret != 0)
+        return -2140;
+    ret = wc_Blake2spFinal(&b2sp, digest, 32);
+    if (ret != 0)
+        return -2141;
+    if (XMEMCMP(digest, blake2sp_vec[0], 32) != 0)
+        return -2142;
+
+    ret = wc_InitBlake2sp(&b2sp, 32);
+    if (ret != 0)
+        return -2143;
+    for (i = 0; i < 6; i++) {
+        ret = wc_Blake2spUpdate(&b2sp, input, sizeof(input));
+        if (ret != 0)
+            return -2144;
+    }
+    ret = wc_Blake2spUpdate(&b2sp, input, 1);
+    if (ret != 0)
+        return -2145;
+    ret = wc_Blake2spFinal(&b2sp, digest, 32);
+    if (ret != 0)
+        return -2146;
+    if (XMEMCMP(digest, blake2sp_vec[1], 32) != 0)
+        return -2147;
+
     return 0;
 }
 #endif /* HAVE_BLAKE2S */
@@ -2402,6 +2531,101 @@ int sha256_test(void)
         ERROR_OUT(-2310, exit);
     } /* END LARGE HASH TEST */
 
+    /* BEGIN MULTI-BUFFER TEST */ {
+    /* more messages than lanes so lanes are refilled as messages finish */
+    const byte* mbData[19];
+    word32      mbSz[19];
+    byte*       mbHash[19];
+    byte        mbOut[19][WC_SHA256_DIGEST_SIZE];
+    int         mbCnt = (int)(sizeof(mbSz) / sizeof(mbSz[0]));
+
+    for (i = 0; i < mbCnt; i++) {
+        mbData[i] = (const byte*)test_sha[i % 3].input;
+        mbSz[i] = (word32)test_sha[i % 3].inLen;
+        mbHash[i] = mbOut[i];
+    }
+    for (times = 1; times <= mbCnt; times += 6) {
+        XMEMSET(mbOut, 0, sizeof(mbOut));
+        ret = wc_Sha256MultiBuffer(mbData, mbSz, mbHash, (word32)times);
+        if (ret != 0)
+            ERROR_OUT(-2311, exit);
+        for (i = 0; i < times; i++) {
+            if (XMEMCMP(mbOut[i], test_sha[i % 3].output,
+                                                WC_SHA256_DIGEST_SIZE) != 0)
+                ERROR_OUT(-2312, exit);
+        }
+    }
+    } /* END MULTI-BUFFER TEST */
+
+    /* BEGIN MULTI-BUFFER MIXED LENGTH TEST */ {
+    /* multi-block messages finish in different blocks and some have their
+     * length in a second padding block - compared with hashing each one */
+    static const word32 mixSz[] = { 64, 65, 1000, 4097, 0, 55, 56, 119,
+                                    4096, 3, 128, 63, 1, 2048, 191, 4000,
+                                    17 };
+    static const word32 mixCnts[] = { 4, 7, 8, 12, 17 };
+    const byte* mbData[17];
+    byte*       mbHash[17];
+    byte        mbOut[17][WC_SHA256_DIGEST_SIZE];
+    byte*       mixIn;
+    int         pass, j;
+    int         passes = 1;
+#ifdef TEST_CPUID_FLAGS
+    word32      flags = cpuid_get_flags();
+
+    /* again without AVX-512 and SHA-NI so that the 8 AVX2 lanes are used */
+    if (IS_INTEL_AVX2(flags))
+        passes = 2;
+#endif
+
+    /* messages of up to 4097 bytes at different alignments */
+    mixIn = (byte*)XMALLOC(4097 + 3, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (mixIn == NULL)
+        ERROR_OUT(-2313, exit);
+    for (i = 0; i < 4097 + 3; i++)
+        mixIn[i] = (byte)(i * 7 + 3);
+    for (i = 0; i < 17; i++) {
+        mbData[i] = mixIn + (i & 3);
+        mbHash[i] = mbOut[i];
+    }
+
+    for (pass = 0; ret == 0 && pass < passes; pass++) {
+    #ifdef TEST_CPUID_FLAGS
+        if (pass == 1)
+            cpuid_select_flags(flags & ~(CPUID_AVX512F | CPUID_SHA));
+    #endif
+        /* fewer than 8 messages use AVX2 lanes, more use AVX-512 lanes */
+        for (j = 0; ret == 0 && j < (int)(sizeof(mixCnts) /
+                                               sizeof(mixCnts[0])); j++) {
+            XMEMSET(mbOut, 0, sizeof(mbOut));
+            ret = wc_Sha256MultiBuffer(mbData, mixSz, mbHash, mixCnts[j]);
+            if (ret != 0) {
+                ret = -2314;
+                break;
+            }
+            for (i = 0; i < (int)mixCnts[j]; i++) {
+                ret = wc_Sha256Update(&sha, mbData[i], mixSz[i]);
+                if (ret == 0)
+                    ret = wc_Sha256Final(&sha, hash);
+                if (ret != 0) {
+                    ret = -2315;
+                    break;
+                }
+                if (XMEMCMP(mbOut[i], hash, WC_SHA256_DIGEST_SIZE) != 0) {
+                    ret = -2316;
+                    break;
+                }
+            }
+        }
+    #ifdef TEST_CPUID_FLAGS
+        cpuid_select_flags(flags);
+    #endif
+    }
+    XFREE(mixIn, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (ret != 0)
+        goto exit;
+    } /* END MULTI-BUFFER MIXED LENGTH TEST */
+
 exit:
 
     wc_Sha256Free(&sha);
@@ -2803,6 +3027,41 @@ static int sha3_256_test(void)
         ERROR_OUT(-2708, exit);
     } /* END LARGE HASH TEST */
 
+    /* BEGIN MULTI-BUFFER TEST */ {
+    /* more messages than lanes, of one and of several blocks */
+    const char* mbLargeDigest =
+        "\xb6\xc7\x06\x31\xc6\xff\x93\x2b\x9f\x38\x0d\x9c\xde\x87\x50\xeb"
+        "\x9b\xea\x39\x38\x17\xa9\xae\xa4\x10\xc2\x11\x9e\xb7\xb9\xb8\x70";
+    const byte* mbData[11];
+    word32      mbSz[11];
+    byte*       mbHash[11];
+    byte        mbOut[11][WC_SHA3_256_DIGEST_SIZE];
+    int         mbCnt = (int)(sizeof(mbSz) / sizeof(mbSz[0]));
+
+    for (i = 0; i < mbCnt; i++) {
+        if (i % 4 == 3) {
+            mbData[i] = large_input;
+            mbSz[i] = (word32)sizeof(large_input);
+        }
+        else {
+            mbData[i] = (const byte*)test_sha[i % 4].input;
+            mbSz[i] = (word32)test_sha[i % 4].inLen;
+        }
+        mbHash[i] = mbOut[i];
+    }
+    for (times = 1; times <= mbCnt; times += 5) {
+        XMEMSET(mbOut, 0, sizeof(mbOut));
+        ret = wc_Sha3_256_MultiBuffer(mbData, mbSz, mbHash, (word32)times);
+        if (ret != 0)
+            ERROR_OUT(-2713, exit);
+        for (i = 0; i < times; i++) {
+            if (XMEMCMP(mbOut[i], (i % 4 == 3) ? mbLargeDigest :
+                        test_sha[i % 4].output, WC_SHA3_256_DIGEST_SIZE) != 0)
+                ERROR_OUT(-2714, exit);
+        }
+    }
+    } /* END MULTI-BUFFER TEST */
+
     /* this is a software only variant of SHA3 not supported by external hardware devices */
 #if defined(WOLFSSL_HASH_FLAGS) && !defined(WOLFSSL_ASYNC_CRYPT)
     /* Test for Keccak256 */
@@ -3068,6 +3327,148 @@ int sha3_test(void)
 }
 #endif /* WOLFSSL_SHA3 */
 
+#ifdef WOLFSSL_SHAKE128
+int shake128_test(void)
+{
+#ifndef WOLFSSL_NO_SHAKE128
+    wc_Shake  sha;
+    byte  hash[114];
+
+    testVector a, b, c;
+    testVector test_sha[3];
+    int ret = 0;
+    int times = sizeof(test_sha) / sizeof(struct testVector), i;
+
+    byte large_input[1024];
+    const char* large_digest =
+        "\x88\xd7\x0e\x86\x46\x72\x6b\x3d\x7d\x22\xe1\xa9\x2d\x02\xdb\x35"
+        "\x92\x4f\x1b\x03\x90\xee\xa3\xce\xd1\x3a\x08\x3a\xd7\x4e\x10\xdf"
+        "\x09\x67\x33\x35\x4f\xdd\x38\x50\x5b\xcb\x75\xc7\xba\x65\xe5\xe8"
+        "\xb8\x76\xde\xc5\xee\xd7\xf1\x65\x93\x4e\x5e\xc4\xb1\xd7\x6b\xee"
+        "\x4b\x57\x48\xf5\x38\x49\x9e\x45\xa0\xf7\x32\xe9\x05\x26\x6a\x10"
+        "\x70\xd4\x7c\x19\x01\x1f\x6d\x37\xba\x7b\x74\xc2\xbc\xb6\xbc\x74"
+        "\xa3\x66\x6c\x9b\x11\x84\x9d\x4a\x36\xbc\x8a\x0d\x4c\xe3\x39\xfa"
+        "\xfa\x1b";
+    byte long_hash[2 * WC_SHA3_128_COUNT * 8 + 16];
+    const char* long_digest =
+        "\x58\x81\x09\x2d\xd8\x18\xbf\x5c\xf8\xa3\xdd\xb7\x93\xfb\xcb\xa7"
+        "\x40\x97\xd5\xc5\x26\xa6\xd3\x5f\x97\xb8\x33\x51\x94\x0f\x2c\xc8"
+        "\x44\xc5\x0a\xf3\x2a\xcd\x3f\x2c\xdd\x06\x65\x68\x70\x6f\x50\x9b"
+        "\xc1\xbd\xde\x58\x29\x5d\xae\x3f\x89\x1a\x9a\x0f\xca\x57\x83\x78"
+        "\x9a\x41\xf8\x61\x12\x14\xce\x61\x23\x94\xdf\x28\x6a\x62\xd1\xa2"
+        "\x25\x2a\xa9\x4d\xb9\xc5\x38\x95\x6c\x71\x7d\xc2\xbe\xd4\xf2\x32"
+        "\xa0\x29\x4c\x85\x7c\x73\x0a\xa1\x60\x67\xac\x10\x62\xf1\x20\x1f"
+        "\xb0\xd3\x77\xcf\xb9\xcd\xe4\xc6\x35\x99\xb2\x7f\x34\x62\xbb\xa4"
+        "\xa0\xed\x29\x6c\x80\x1f\x9f\xf7\xf5\x73\x02\xbb\x30\x76\xee\x14"
+        "\x5f\x97\xa3\x2a\xe6\x8e\x76\xab\x66\xc4\x8d\x51\x67\x5b\xd4\x9a"
+        "\xcc\x29\x08\x2f\x56\x47\x58\x4e\x6a\xa0\x1b\x3f\x5a\xf0\x57\x80"
+        "\x5f\x97\x3f\xf8\xec\xb8\xb2\x26\xac\x32\xad\xa6\xf0\x1c\x1f\xcd"
+        "\x48\x18\xcb\x00\x6a\xa5\xb4\xcd\xb3\x61\x1e\xb1\xe5\x33\xc8\x96"
+        "\x4c\xac\xfd\xf3\x10\x12\xcd\x3f\xb7\x44\xd0\x22\x25\xb9\x88\xb4"
+        "\x75\x37\x5f\xaa\xd9\x96\xeb\x1b\x91\x76\xec\xb0\xf8\xb2\x87\x17"
+        "\x23\xd6\xdb\xb8\x04\xe2\x33\x57\xe5\x07\x32\xf5\xcf\xc9\x04\xb1"
+        "\x31\x97\x95\x00\x0d\x73\x61\xd9\xe5\xe1\xb7\x7b\x4b\x8f\x57\x74"
+        "\xaa\x14\x82\xcf\xa5\x8f\x83\x09\x6b\xdb\x2e\x06\xa3\xee\xd5\x43"
+        "\xa3\x89\x19\xb5\x7e\xcb\xec\x73\x7f\x40\x86\xbe\x00\x7f\x8e\xf8"
+        "\x00\x94\xce\xea\x88\x07\x19\x3d\x46\xe9\xbe\x54\x0b\x6e\x99\xb4"
+        "\xc1\xc7\x15\x07\x09\x50\x28\xa0\x24\xe8\xd3\x9a\xa8\xf4\xc5\x85"
+        "\x4c\xed\xd5\x0d\x30\xa2\x23\xe7\xd5\x4e\x9a\x24\xf0\xa2\x52\x6b";
+
+    a.input  = "";
+    a.output = "\x7f\x9c\x2b\xa4\xe8\x8f\x82\x7d\x61\x60\x45\x50\x76\x05\x85"
+               "\x3e\xd7\x3b\x80\x93\xf6\xef\xbc\x88\xeb\x1a\x6e\xac\xfa\x66"
+               "\xef\x26\x3c\xb1\xee\xa9\x88\x00\x4b\x93\x10\x3c\xfb\x0a\xee"
+               "\xfd\x2a\x68\x6e\x01\xfa\x4a\x58\xe8\xa3\x63\x9c\xa8\xa1\xe3"
+               "\xf9\xae\x57\xe2\x35\xb8\xcc\x87\x3c\x23\xdc\x62\xb8\xd2\x60"
+               "\x16\x9a\xfa\x2f\x75\xab\x91\x6a\x58\xd9\x74\x91\x88\x35\xd2"
+               "\x5e\x6a\x43\x50\x85\xb2\xba\xdf\xd6\xdf\xaa\xc3\x59\xa5\xef"
+               "\xbb\x7b\xcc\x4b\x59\xd5\x38\xdf\x9a";
+    a.inLen  = XSTRLEN(a.input);
+    a.outLen = sizeof(hash);
+
+    b.input  = "abc";
+    b.output = "\x58\x81\x09\x2d\xd8\x18\xbf\x5c\xf8\xa3\xdd\xb7\x93\xfb\xcb"
+               "\xa7\x40\x97\xd5\xc5\x26\xa6\xd3\x5f\x97\xb8\x33\x51\x94\x0f"
+               "\x2c\xc8\x44\xc5\x0a\xf3\x2a\xcd\x3f\x2c\xdd\x06\x65\x68\x70"
+               "\x6f\x50\x9b\xc1\xbd\xde\x58\x29\x5d\xae\x3f\x89\x1a\x9a\x0f"
+               "\xca\x57\x83\x78\x9a\x41\xf8\x61\x12\x14\xce\x61\x23\x94\xdf"
+               "\x28\x6a\x62\xd1\xa2\x25\x2a\xa9\x4d\xb9\xc5\x38\x95\x6c\x71"
+               "\x7d\xc2\xbe\xd4\xf2\x32\xa0\x29\x4c\x85\x7c\x73\x0a\xa1\x60"
+               "\x67\xac\x10\x62\xf1\x20\x1f\xb0\xd3";
+    b.inLen  = XSTRLEN(b.input);
+    b.outLen = sizeof(hash);
+
+    c.input  = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    c.output = "\x1a\x96\x18\x2b\x50\xfb\x8c\x7e\x74\xe0\xa7\x07\x78\x8f\x55"
+               "\xe9\x82\x09\xb8\xd9\x1f\xad\xe8\xf3\x2f\x8d\xd5\xcf\xf7\xbf"
+               "\x21\xf5\x4e\xe5\xf1\x95\x50\x82\x5a\x6e\x07\x00\x30\x51\x9e"
+               "\x94\x42\x63\xac\x1c\x67\x65\x28\x70\x65\x62\x1f\x9f\xcb\x32"
+               "\x01\x72\x3e\x32\x23\xb6\x3a\x46\xc2\x93\x8a\xa9\x53\xba\x84"
+               "\x01\xd0\xea\x77\xb8\xd2\x64\x90\x77\x55\x66\x40\x7b\x95\x67"
+               "\x3c\x0f\x4c\xc1\xce\x9f\xd9\x66\x14\x8d\x7e\xfd\xff\x26\xbb"
+               "\xf9\xf4\x8a\x21\xc6\xda\x35\xbf\xaa";
+    c.inLen  = XSTRLEN(c.input);
+    c.outLen = sizeof(hash);
+
+    test_sha[0] = a;
+    test_sha[1] = b;
+    test_sha[2] = c;
+
+    ret = wc_InitShake128(&sha, HEAP_HINT, devId);
+    if (ret != 0)
+        return -3110;
+
+    for (i = 0; i < times; ++i) {
+        ret = wc_Shake128_Update(&sha, (byte*)test_sha[i].input,
+            (word32)test_sha[i].inLen);
+        if (ret != 0)
+            ERROR_OUT(-3111 - i, exit);
+        ret = wc_Shake128_Final(&sha, hash, (word32)test_sha[i].outLen);
+        if (ret != 0)
+            ERROR_OUT(-3112 - i, exit);
+
+        if (XMEMCMP(hash, test_sha[i].output, test_sha[i].outLen) != 0)
+            ERROR_OUT(-3113 - i, exit);
+    }
+
+    /* BEGIN LARGE HASH TEST */ {
+    for (i = 0; i < (int)sizeof(large_input); i++) {
+        large_input[i] = (byte)(i & 0xFF);
+    }
+    times = 100;
+    for (i = 0; i < times; ++i) {
+        ret = wc_Shake128_Update(&sha, (byte*)large_input,
+            (word32)sizeof(large_input));
+        if (ret != 0)
+            ERROR_OUT(-3114, exit);
+    }
+    ret = wc_Shake128_Final(&sha, hash, (word32)sizeof(hash));
+    if (ret != 0)
+        ERROR_OUT(-3115, exit);
+    if (XMEMCMP(hash, large_digest, sizeof(hash)) != 0)
+        ERROR_OUT(-3116, exit);
+    } /* END LARGE HASH TEST */
+
+    /* output of more than one block */
+    ret = wc_Shake128_Update(&sha, (byte*)b.input, (word32)b.inLen);
+    if (ret != 0)
+        ERROR_OUT(-3117, exit);
+    ret = wc_Shake128_Final(&sha, long_hash, (word32)sizeof(long_hash));
+    if (ret != 0)
+        ERROR_OUT(-3118, exit);
+    if (XMEMCMP(long_hash, long_digest, sizeof(long_hash)) != 0)
+        ERROR_OUT(-3119, exit);
+
+exit:
+    wc_Shake128_Free(&sha);
+
+    return ret;
+#else
+    return 0;
+#endif
+}
+#endif
+
 #ifdef WOLFSSL_SHAKE256
 int shake256_test(void)
 {
@@ -4242,6 +4643,162 @@ int hmac_sha3_test(void)
 #endif
 
 
+#if !defined(NO_HMAC) && !defined(NO_AES) && defined(HAVE_AES_CBC) && \
+    !defined(HAVE_FIPS) && !defined(HAVE_SELFTEST) && \
+    (!defined(NO_SHA) || !defined(NO_SHA256))
+#define HMAC_AES_CBC_TEST_SZ    1040
+
+static int hmac_aes_cbc_setup(Hmac* hmac, Aes* aes, int type, word32 keySz,
+                              const byte* pre, word32 preSz)
+{
+    static const byte key[] = {
+        0x60,0x3d,0xeb,0x10,0x15,0xca,0x71,0xbe,
+        0x2b,0x73,0xae,0xf0,0x85,0x7d,0x77,0x81,
+        0x1f,0x35,0x2c,0x07,0x3b,0x61,0x08,0xd7,
+        0x2d,0x98,0x10,0xa3,0x09,0x14,0xdf,0xf4
+    };
+    static const byte iv[] = {
+        0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+        0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f
+    };
+    int ret;
+
+    ret = wc_AesInit(aes, HEAP_HINT, devId);
+    if (ret == 0)
+        ret = wc_AesSetKey(aes, key, keySz, iv, AES_ENCRYPTION);
+    if (ret == 0)
+        ret = wc_HmacInit(hmac, HEAP_HINT, devId);
+    if (ret == 0)
+        ret = wc_HmacSetKey(hmac, type, key + 7, 20);
+    if (ret == 0)
+        ret = wc_HmacUpdate(hmac, pre, preSz);
+    return ret;
+}
+
+/* MAC and encrypt in one pass must match separate AES-CBC and HMAC. */
+int hmac_aes_cbc_test(void)
+{
+    Hmac   hmac;
+    Aes    aes;
+    byte*  in;
+    byte*  exp;
+    byte*  out;
+    byte   expMac[WC_MAX_DIGEST_SIZE];
+    byte   mac[WC_MAX_DIGEST_SIZE];
+    int    ret = 0;
+    int    t, k, p, n, etm, inPlace;
+    word32 i;
+    static const int types[] = {
+    #ifndef NO_SHA
+        WC_SHA,
+    #endif
+    #ifndef NO_SHA256
+        WC_SHA256,
+    #endif
+    };
+    static const word32 keySzs[] = {
+    #ifdef WOLFSSL_AES_128
+        16,
+    #endif
+    #ifdef WOLFSSL_AES_192
+        24,
+    #endif
+    #ifdef WOLFSSL_AES_256
+        32,
+    #endif
+    };
+    /* TLS MAC pseudo-header is 13 bytes */
+    static const word32 preSzs[] = { 0, 13, 64, 77 };
+    static const word32 szs[] = { 0, 16, 64, 80, 144, 208, 1024 };
+
+    in  = (byte*)XMALLOC(HMAC_AES_CBC_TEST_SZ * 3, HEAP_HINT,
+                                                       DYNAMIC_TYPE_TMP_BUFFER);
+    if (in == NULL)
+        return -3860;
+    exp = in + HMAC_AES_CBC_TEST_SZ;
+    out = exp + HMAC_AES_CBC_TEST_SZ;
+    for (i = 0; i < HMAC_AES_CBC_TEST_SZ; i++)
+        in[i] = (byte)(i * 7 + 3);
+
+    for (t = 0; t < (int)(sizeof(types) / sizeof(*types)); t++)
+    for (k = 0; k < (int)(sizeof(keySzs) / sizeof(*keySzs)); k++)
+    for (p = 0; p < (int)(sizeof(preSzs) / sizeof(*preSzs)); p++)
+    for (n = 0; n < (int)(sizeof(szs) / sizeof(*szs)); n++)
+    for (etm = 0; etm <= 1; etm++)
+    for (inPlace = 0; inPlace <= 1; inPlace++) {
+        word32 sz = szs[n];
+
+        /* separate passes, the last block checks the chaining value */
+        ret = hmac_aes_cbc_setup(&hmac, &aes, types[t], keySzs[k], in,
+                                                                    preSzs[p]);
+        if (ret == 0)
+            ret = wc_AesCbcEncrypt(&aes, exp, in, sz + AES_BLOCK_SIZE);
+        if (ret == 0)
+            ret = wc_HmacUpdate(&hmac, etm ? exp : in, sz);
+        if (ret == 0)
+            ret = wc_HmacFinal(&hmac, expMac);
+        wc_HmacFree(&hmac);
+        wc_AesFree(&aes);
+        if (ret != 0) {
+            ret = -3861;
+            goto out;
+        }
+
+        ret = hmac_aes_cbc_setup(&hmac, &aes, types[t], keySzs[k], in,
+                                                                    preSzs[p]);
+        if (ret == 0) {
+            byte* src = in;
+            if (inPlace) {
+                XMEMCPY(out, in, sz + AES_BLOCK_SIZE);
+                src = out;
+            }
+            if (etm)
+                ret = wc_AesCbcEncrypt_HmacUpdate(&aes, &hmac, out, src, sz);
+            else
+                ret = wc_HmacUpdate_AesCbcEncrypt(&hmac, &aes, out, src, sz);
+            if (ret == 0) {
+                ret = wc_AesCbcEncrypt(&aes, out + sz, src + sz,
+                                                               AES_BLOCK_SIZE);
+            }
+        }
+        if (ret == 0)
+            ret = wc_HmacFinal(&hmac, mac);
+        wc_HmacFree(&hmac);
+        wc_AesFree(&aes);
+        if (ret != 0) {
+            ret = -3862;
+            goto out;
+        }
+
+        if (XMEMCMP(out, exp, sz + AES_BLOCK_SIZE) != 0) {
+            ret = -3863;
+            goto out;
+        }
+        if (XMEMCMP(mac, expMac, wc_HmacSizeByType(types[t])) != 0) {
+            ret = -3864;
+            goto out;
+        }
+    }
+
+    ret = wc_HmacUpdate_AesCbcEncrypt(&hmac, &aes, out, in, AES_BLOCK_SIZE - 1);
+    if (ret != BAD_FUNC_ARG) {
+        ret = -3865;
+        goto out;
+    }
+    ret = wc_AesCbcEncrypt_HmacUpdate(NULL, &hmac, out, in, AES_BLOCK_SIZE);
+    if (ret != BAD_FUNC_ARG) {
+        ret = -3866;
+        goto out;
+    }
+    ret = 0;
+
+out:
+    XFREE(in, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    return ret;
+}
+#endif
+
+
 #ifndef NO_RC4
 int arc4_test(void)
 {
@@ -7392,6 +7949,127 @@ static int aes_xts_sector_test(void)
 }
 #endif /* WOLFSSL_AES_128 && WOLFSSL_AES_256 */
 
+#ifdef WOLFSSL_AES_128
+/* consecutive sectors in one call, multiple blocks per sector and stealing on
+ * the last sector, in and out of place */
+static int aes_xts_consecutive_sectors_test(void)
+{
+    XtsAes aes;
+    int ret = 0;
+    word32 i;
+    byte* buf;
+    byte* plain;
+
+    static unsigned char k1[] = {
+        0xa3, 0xe4, 0x0d, 0x5b, 0xd4, 0xb6, 0xbb, 0xed,
+        0xb2, 0xd1, 0x8c, 0x70, 0x0a, 0xd2, 0xdb, 0x22,
+        0x10, 0xc8, 0x11, 0x90, 0x64, 0x6d, 0x67, 0x3c,
+        0xbc, 0xa5, 0x3f, 0x13, 0x3e, 0xab, 0x37, 0x3c
+    };
+
+    /* sectors 141, 142 and 143 of 160 bytes, last is 20 bytes long */
+    static unsigned char c1[] = {
+        0x00, 0xba, 0xd3, 0x7a, 0x84, 0xe6, 0x3f, 0x5a,
+        0x5b, 0x66, 0xff, 0x5d, 0x01, 0xbc, 0x9f, 0x8a,
+        0xd1, 0x21, 0x7a, 0x2e, 0x4e, 0xf4, 0xab, 0x16,
+        0xae, 0x11, 0x7f, 0x25, 0xff, 0xcb, 0x39, 0xa0,
+        0x72, 0x3a, 0x18, 0x77, 0x1c, 0xb3, 0xf8, 0x24,
+        0xab, 0x2a, 0xe0, 0x68, 0xa9, 0x79, 0x45, 0x26,
+        0x3a, 0x92, 0x65, 0xea, 0xff, 0x0e, 0x71, 0x85,
+        0xd4, 0x12, 0x65, 0xa8, 0x9c, 0x5d, 0x41, 0xf3,
+        0x06, 0x08, 0x6a, 0x97, 0x8e, 0xdd, 0x59, 0xb3,
+        0x65, 0x27, 0x76, 0x2d, 0x8b, 0x36, 0x2c, 0x07,
+        0x27, 0x42, 0x09, 0xee, 0x5d, 0x5c, 0x7f, 0xd2,
+        0x30, 0x82, 0x50, 0x82, 0x6d, 0xf5, 0x8c, 0x60,
+        0xab, 0xe0, 0x90, 0xfd, 0xf3, 0xa6, 0xcf, 0x44,
+        0x6f, 0xcb, 0x76, 0xf1, 0xac, 0xab, 0xda, 0x43,
+        0x8a, 0x2b, 0x66, 0xfd, 0xc1, 0x19, 0x42, 0x04,
+        0xf1, 0x7c, 0x41, 0xb4, 0x8d, 0x6d, 0xc0, 0xfd,
+        0x3d, 0xd7, 0x00, 0x9a, 0xa0, 0xd9, 0x9d, 0x0f,
+        0xa9, 0xbf, 0xc4, 0xd3, 0xba, 0xe0, 0x2d, 0x7d,
+        0xc3, 0xe4, 0x42, 0x47, 0xc6, 0x85, 0xb9, 0x7a,
+        0x8b, 0x3d, 0x6a, 0x8f, 0x90, 0xb9, 0x8c, 0xb2,
+        0xf5, 0x13, 0xe9, 0x09, 0x28, 0xa4, 0x60, 0xe6,
+        0xa4, 0x70, 0xe4, 0xfe, 0xc5, 0x05, 0xd3, 0x25,
+        0x68, 0xd6, 0xc0, 0x85, 0x91, 0x1d, 0x96, 0x94,
+        0xf7, 0x1b, 0xc5, 0x29, 0xbd, 0x79, 0xa5, 0x67,
+        0x90, 0xa3, 0x4d, 0x2b, 0x3b, 0x18, 0x6f, 0x9f,
+        0x72, 0x13, 0x1f, 0x30, 0xab, 0xe6, 0xec, 0xe4,
+        0xe3, 0x18, 0x93, 0x4f, 0xa0, 0x25, 0x2b, 0x97,
+        0xea, 0x69, 0xac, 0xf3, 0x27, 0x88, 0x04, 0x3f,
+        0x2f, 0x4c, 0xf6, 0xaa, 0xea, 0x1e, 0x1d, 0x38,
+        0x2e, 0x2c, 0x3b, 0xa8, 0x04, 0x5a, 0x39, 0x37,
+        0x97, 0x17, 0x49, 0x06, 0x63, 0x59, 0x5f, 0xab,
+        0xf5, 0x88, 0x13, 0x04, 0xd8, 0xf7, 0x43, 0x97,
+        0xa2, 0xf8, 0x10, 0xc3, 0x0d, 0x00, 0x00, 0x89,
+        0xc6, 0x23, 0x7c, 0xf8, 0xb2, 0x88, 0xd0, 0x54,
+        0x2e, 0xfa, 0x78, 0x55, 0x57, 0x79, 0x27, 0x11,
+        0x9c, 0x67, 0x9d, 0x41, 0x3a, 0xe6, 0x55, 0xc7,
+        0xb7, 0xd4, 0xf4, 0x4a, 0x05, 0x79, 0x6f, 0xb2,
+        0x30, 0x51, 0x8a, 0x63, 0x0c, 0x72, 0x02, 0x75,
+        0x30, 0xa2, 0x17, 0x6f, 0x65, 0x22, 0x55, 0x0b,
+        0x0b, 0x3d, 0x33, 0xe1, 0x01, 0x1a, 0x5a, 0xaa,
+        0x43, 0x00, 0x96, 0xe2, 0xa2, 0xc5, 0x0e, 0x54,
+        0xff, 0xdb, 0x82, 0x57, 0x90, 0x67, 0xbe, 0x9e,
+        0x81, 0xaa, 0x38, 0x8f
+    };
+    word64 s1 = 141;
+    word32 sectorSz = 160;
+
+    buf = (byte*)XMALLOC(sizeof(c1) * 2, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (buf == NULL)
+        return -5412;
+    plain = buf + sizeof(c1);
+    for (i = 0; i < sizeof(c1); i++)
+        plain[i] = (byte)i;
+
+    if (wc_AesXtsSetKey(&aes, k1, sizeof(k1), AES_ENCRYPTION,
+            HEAP_HINT, devId) != 0)
+        ret = -5413;
+    if (ret == 0) {
+        ret = wc_AesXtsEncryptConsecutiveSectors(&aes, buf, plain, sizeof(c1),
+                s1, sectorSz);
+        if (ret != 0 || XMEMCMP(c1, buf, sizeof(c1)) != 0)
+            ret = -5414;
+    }
+    if (ret == 0) {
+        XMEMCPY(buf, plain, sizeof(c1));
+        ret = wc_AesXtsEncryptConsecutiveSectors(&aes, buf, buf, sizeof(c1),
+                s1, sectorSz);
+        if (ret != 0 || XMEMCMP(c1, buf, sizeof(c1)) != 0)
+            ret = -5415;
+    }
+    if (ret == 0) {
+        /* last sector less than a block */
+        if (wc_AesXtsEncryptConsecutiveSectors(&aes, buf, plain,
+                2 * sectorSz + 8, s1, sectorSz) != BAD_FUNC_ARG)
+            ret = -5416;
+    }
+    wc_AesXtsFree(&aes);
+
+    if (ret == 0 && wc_AesXtsSetKey(&aes, k1, sizeof(k1), AES_DECRYPTION,
+            HEAP_HINT, devId) != 0)
+        ret = -5417;
+    if (ret == 0) {
+        ret = wc_AesXtsDecryptConsecutiveSectors(&aes, buf, c1, sizeof(c1),
+                s1, sectorSz);
+        if (ret != 0 || XMEMCMP(plain, buf, sizeof(c1)) != 0)
+            ret = -5418;
+    }
+    if (ret == 0) {
+        XMEMCPY(buf, c1, sizeof(c1));
+        ret = wc_AesXtsDecryptConsecutiveSectors(&aes, buf, buf, sizeof(c1),
+                s1, sectorSz);
+        if (ret != 0 || XMEMCMP(plain, buf, sizeof(c1)) != 0)
+            ret = -5419;
+    }
+    wc_AesXtsFree(&aes);
+
+    XFREE(buf, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    return ret;
+}
+#endif /* WOLFSSL_AES_128 */
+
 
 #ifdef WOLFSSL_AES_128
 /* testing of bad arguments */
@@ -7911,6 +8589,47 @@ int aes_test(void)
 
         if (XMEMCMP(cipher, oddCipher, sizeof(oddCipher)))
             return -5734;
+
+        /* low 64 bits of counter wrap part way through a long message,
+         * compare one call against one byte at a time */
+        {
+            #define CTR_WRAP_TEST_SZ (37 * AES_BLOCK_SIZE + 5)
+            const byte ctrWrapIv[] =
+            {
+                0xf0,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xff,
+                0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf5
+            };
+            byte* zeros;
+            byte* bulk;
+            byte* single;
+            word32 i;
+
+            zeros = (byte*)XMALLOC(CTR_WRAP_TEST_SZ * 3, HEAP_HINT,
+                                   DYNAMIC_TYPE_TMP_BUFFER);
+            if (zeros == NULL)
+                return -5747;
+            bulk = zeros + CTR_WRAP_TEST_SZ;
+            single = bulk + CTR_WRAP_TEST_SZ;
+            XMEMSET(zeros, 0, CTR_WRAP_TEST_SZ);
+
+            wc_AesSetKeyDirect(&enc, ctr128Key, sizeof(ctr128Key),
+                               ctrWrapIv, AES_ENCRYPTION);
+            wc_AesSetKeyDirect(&dec, ctr128Key, sizeof(ctr128Key),
+                               ctrWrapIv, AES_ENCRYPTION);
+
+            ret = wc_AesCtrEncrypt(&enc, bulk, zeros, CTR_WRAP_TEST_SZ);
+            for (i = 0; ret == 0 && i < CTR_WRAP_TEST_SZ; i++)
+                ret = wc_AesCtrEncrypt(&dec, single + i, zeros + i, 1);
+            if (ret == 0 && XMEMCMP(bulk, single, CTR_WRAP_TEST_SZ) != 0)
+                ret = -5749;
+            else if (ret != 0)
+                ret = -5748;
+
+            XFREE(zeros, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+            if (ret != 0)
+                return ret;
+            #undef CTR_WRAP_TEST_SZ
+        }
 #endif /* WOLFSSL_AES_128 */
 
 #ifdef WOLFSSL_AES_192
@@ -8032,6 +8751,11 @@ int aes_test(void)
         return ret;
     #endif
     #ifdef WOLFSSL_AES_128
+    ret = aes_xts_consecutive_sectors_test();
+    if (ret != 0)
+        return ret;
+    #endif
+    #ifdef WOLFSSL_AES_128
     ret = aes_xts_args_test();
     if (ret != 0)
         return ret;
@@ -8418,6 +9142,114 @@ int aesgcm_default_test(void)
 	return 0;
 }
 
+#if defined(WOLFSSL_AES_256) || defined(WOLFSSL_AES_128)
+/* whole 16 block iterations followed by whole blocks or a partial block,
+ * checked with the last cipher text block and the tag */
+static int aesgcm_wide_test(void)
+{
+    Aes aes;
+    int ret = 0;
+    word32 i;
+    byte* buf;
+    byte* plain;
+    byte* dec;
+    byte tag[AES_BLOCK_SIZE];
+
+    static const byte k1[] = {
+        0xa0, 0xa5, 0xaa, 0xaf, 0xb4, 0xb9, 0xbe, 0xc3,
+        0xc8, 0xcd, 0xd2, 0xd7, 0xdc, 0xe1, 0xe6, 0xeb,
+        0xf0, 0xf5, 0xfa, 0xff, 0x04, 0x09, 0x0e, 0x13,
+        0x18, 0x1d, 0x22, 0x27, 0x2c, 0x31, 0x36, 0x3b
+    };
+    static const byte iv1[] = {
+        0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d,
+        0x18, 0x23, 0x2e, 0x39
+    };
+    static const byte a1[] = {
+        0x30, 0x33, 0x36, 0x39, 0x3c, 0x3f, 0x42, 0x45,
+        0x48, 0x4b, 0x4e, 0x51, 0x54, 0x57, 0x5a, 0x5d,
+        0x60, 0x63, 0x66, 0x69
+    };
+    static const struct {
+        word32 keySz;
+        word32 sz;
+        byte   c[AES_BLOCK_SIZE]; /* last cipher text block */
+        byte   t[AES_BLOCK_SIZE];
+    } tv[] = {
+    #ifdef WOLFSSL_AES_256
+        { 32, 1040,
+          { 0x0f, 0x88, 0x91, 0xed, 0xae, 0x98, 0x58, 0x65,
+            0x7d, 0xc9, 0x20, 0xb6, 0xbc, 0x05, 0xea, 0x36 },
+          { 0xba, 0xe0, 0x1e, 0x8c, 0x76, 0xd6, 0xf3, 0xf4,
+            0x73, 0xce, 0x6e, 0xf4, 0xde, 0xe2, 0x5d, 0x63 } },
+    #endif
+    #ifdef WOLFSSL_AES_128
+        { 16, 771,
+          { 0x36, 0x12, 0xbf, 0x82, 0xb9, 0xc4, 0x81, 0x4c,
+            0xc0, 0x3d, 0xcd, 0x92, 0x79, 0x15, 0xaa, 0x41 },
+          { 0x7b, 0xbe, 0xec, 0x5e, 0x99, 0xce, 0x6d, 0x43,
+            0x82, 0x05, 0xe0, 0xca, 0x84, 0x1b, 0x03, 0xcc } },
+    #endif
+    };
+    int j;
+
+    buf = (byte*)XMALLOC(1040 * 3, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (buf == NULL)
+        return -6142;
+    plain = buf + 1040;
+    dec = plain + 1040;
+    for (i = 0; i < 1040; i++)
+        plain[i] = (byte)i;
+
+    if (wc_AesInit(&aes, HEAP_HINT, devId) != 0)
+        ret = -6143;
+    for (j = 0; ret == 0 && j < (int)(sizeof(tv) / sizeof(tv[0])); j++) {
+        if (wc_AesGcmSetKey(&aes, k1, tv[j].keySz) != 0)
+            ret = -6144;
+        if (ret == 0) {
+            ret = wc_AesGcmEncrypt(&aes, buf, plain, tv[j].sz, iv1,
+                    sizeof(iv1), tag, sizeof(tag), a1, sizeof(a1));
+        #if defined(WOLFSSL_ASYNC_CRYPT)
+            ret = wc_AsyncWait(ret, &aes.asyncDev, WC_ASYNC_FLAG_NONE);
+        #endif
+            if (ret != 0 ||
+                    XMEMCMP(buf + tv[j].sz - AES_BLOCK_SIZE, tv[j].c,
+                            AES_BLOCK_SIZE) != 0 ||
+                    XMEMCMP(tag, tv[j].t, sizeof(tag)) != 0)
+                ret = -6145;
+        }
+    #ifdef HAVE_AES_DECRYPT
+        if (ret == 0) {
+            ret = wc_AesGcmDecrypt(&aes, dec, buf, tv[j].sz, iv1,
+                    sizeof(iv1), tag, sizeof(tag), a1, sizeof(a1));
+        #if defined(WOLFSSL_ASYNC_CRYPT)
+            ret = wc_AsyncWait(ret, &aes.asyncDev, WC_ASYNC_FLAG_NONE);
+        #endif
+            if (ret != 0 || XMEMCMP(dec, plain, tv[j].sz) != 0)
+                ret = -6146;
+        }
+        if (ret == 0) {
+            /* change in the first 16 block iteration */
+            buf[100] ^= 0x01;
+            ret = wc_AesGcmDecrypt(&aes, dec, buf, tv[j].sz, iv1,
+                    sizeof(iv1), tag, sizeof(tag), a1, sizeof(a1));
+        #if defined(WOLFSSL_ASYNC_CRYPT)
+            ret = wc_AsyncWait(ret, &aes.asyncDev, WC_ASYNC_FLAG_NONE);
+        #endif
+            if (ret != AES_GCM_AUTH_E)
+                ret = -6147;
+            else
+                ret = 0;
+        }
+    #endif /* HAVE_AES_DECRYPT */
+    }
+    wc_AesFree(&aes);
+
+    XFREE(buf, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    return ret;
+}
+#endif
+
 int aesgcm_test(void)
 {
     Aes enc;
@@ -8943,6 +9775,12 @@ int aesgcm_test(void)
     wc_AesFree(&enc);
     wc_AesFree(&dec);
 
+#if defined(WOLFSSL_AES_256) || defined(WOLFSSL_AES_128)
+    result = aesgcm_wide_test();
+    if (result != 0)
+        return result;
+#endif
+
     return 0;
 }
 
@@ -12729,16 +13567,635 @@ exit_rsa:
     wc_ecc_free(&caEccKey);
     wc_ecc_free(&caEccKeyPub);
 
-    XFREE(myCert, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
-    myCert = NULL;
-    XFREE(der, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
-    der = NULL;
+    XFREE(myCert, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    myCert = NULL;
+    XFREE(der, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    der = NULL;
+
+    if (ret >= 0)
+        ret = 0;
+    return ret;
+}
+#endif /* !NO_RSA && HAVE_ECC && WOLFSSL_CERT_GEN */
+
+#if defined(WOLFSSL_SP_8192) && !defined(NO_ASN) && \
+    !defined(NO_SIG_WRAPPER) && !defined(WOLFSSL_RSA_PUBLIC_ONLY) && \
+    !defined(WOLFSSL_RSA_VERIFY_ONLY)
+/* RSA-8192 private key (PKCS #1) and its PKCS #1 v1.5 SHA-256 signature of
+ * "Everyone gets Friday off." made with OpenSSL. */
+static const byte rsa_8192_key_der[] = {
+    0x30, 0x82, 0x12, 0x29, 0x02, 0x01, 0x00, 0x02, 0x82, 0x04, 0x01, 0x00,
+    0xCA, 0x63, 0x2C, 0x19, 0x5A, 0x55, 0xF8, 0x26, 0x85, 0xB7, 0xD3, 0x83,
+    0xA2, 0xB5, 0x31, 0x48, 0xA3, 0xC7, 0x1E, 0x73, 0x3E, 0xF5, 0x67, 0xC0,
+    0x18, 0xCC, 0xF6, 0x2F, 0x78, 0xC2, 0x97, 0x60, 0x85, 0x3D, 0x3B, 0xEF,
+    0x47, 0x25, 0xB9, 0x7F, 0xED, 0x25, 0xD7, 0x21, 0x14, 0xC2, 0x2E, 0x50,
+    0xD2, 0x49, 0xC1, 0xB9, 0xE6, 0x01, 0xA2, 0xDA, 0xA8, 0x37, 0x72, 0xC7,
+    0xCC, 0x6D, 0x39, 0xD2, 0x64, 0x74, 0xA6, 0x52, 0xAD, 0x17, 0x7D, 0xBF,
+    0xAD, 0x3D, 0xB5, 0xFB, 0x6E, 0x3F, 0xB8, 0x3F, 0xA9, 0x6B, 0xF6, 0x67,
+    0x19, 0x95, 0x1C, 0xC2, 0xFA, 0xE7, 0xA2, 0xDD, 0x44, 0x0B, 0x10, 0xF1,
+    0x64, 0xFF, 0xF1, 0x08, 0x4C, 0x85, 0x0E, 0x15, 0x53, 0x67, 0x6C, 0x76,
+    0xAD, 0xF3, 0x6B, 0x58, 0xC0, 0x87, 0x31, 0x5F, 0x09, 0xF0, 0x5A, 0x1E,
+    0x2D, 0xA2, 0xB9, 0x2F, 0x3C, 0x24, 0x0F, 0x0D, 0x8B, 0x45, 0x25, 0x6E,
+    0x0A, 0x84, 0xE7, 0x73, 0x66, 0x5D, 0xBF, 0x6E, 0xC3, 0xD0, 0xF0, 0x5C,
+    0x0D, 0x67, 0x39, 0xF1, 0x70, 0x16, 0xDE, 0xDB, 0xC9, 0x64, 0x2B, 0x08,
+    0xE5, 0x74, 0x56, 0xE9, 0x79, 0x02, 0x1B, 0x7E, 0x94, 0xCC, 0xD6, 0xDD,
+    0x2B, 0x84, 0xC6, 0xFA, 0x67, 0xBD, 0xDA, 0x08, 0x21, 0x71, 0x99, 0x2A,
+    0x6E, 0x23, 0x1F, 0x1D, 0x96, 0x4C, 0x5C, 0xC3, 0x46, 0x85, 0x94, 0x4F,
+    0x48, 0x2B, 0xA4, 0x50, 0x23, 0x67, 0x97, 0x4C, 0x5B, 0x8A, 0x60, 0x1F,
+    0x29, 0xA9, 0x13, 0xD3, 0x70, 0x17, 0xDB, 0x55, 0x00, 0x53, 0x02, 0x24,
+    0x7A, 0xC0, 0xD3, 0x57, 0xD9, 0x14, 0x66, 0x23, 0x29, 0x74, 0x21, 0x48,
+    0x70, 0x4A, 0xFB, 0xDE, 0xEA, 0x48, 0xC9, 0x9E, 0xDE, 0x70, 0xFA, 0x76,
+    0x10, 0x55, 0xE7, 0xDB, 0x4E, 0x09, 0xB4, 0x1E, 0x69, 0x51, 0x80, 0x5F,
+    0x1A, 0x65, 0x6C, 0x95, 0x94, 0xE5, 0xF7, 0x89, 0x96, 0x6E, 0x66, 0x2B,
+    0x80, 0x57, 0x2B, 0x59, 0x92, 0xC6, 0xA2, 0xEB, 0x3E, 0x7F, 0x32, 0xD0,
+    0x52, 0x4C, 0xB1, 0x53, 0x3E, 0xA1, 0x00, 0x75, 0x35, 0x05, 0x98, 0xA2,
+    0xA7, 0xAB, 0x29, 0x4A, 0x86, 0xA0, 0xA7, 0x2B, 0xE6, 0x25, 0x06, 0x57,
+    0x03, 0x2E, 0x23, 0xD1, 0x63, 0xB3, 0x41, 0x93, 0x32, 0x01, 0x2A, 0xBF,
+    0x61, 0x6E, 0xE3, 0x0F, 0xC1, 0x11, 0x19, 0x86, 0xA4, 0xA7, 0xFE, 0x2B,
+    0x75, 0xFD, 0x37, 0x95, 0x8A, 0x05, 0x43, 0x8D, 0x1F, 0x4E, 0xD2, 0xC8,
+    0x1E, 0xFA, 0x5F, 0xBA, 0x9E, 0xC1, 0xEE, 0x9B, 0xC4, 0xCE, 0x14, 0xC3,
+    0xA1, 0xF6, 0xA8, 0x34, 0xB5, 0xB0, 0x6F, 0xBA, 0x41, 0x64, 0xED, 0xB8,
+    0xA2, 0x3A, 0x90, 0xEF, 0x5A, 0x24, 0x6F, 0x7B, 0x48, 0xE9, 0x48, 0x8B,
+    0x23, 0x91, 0x47, 0xDB, 0x27, 0xFA, 0x67, 0xE8, 0xB3, 0xE1, 0x99, 0x43,
+    0xD4, 0x47, 0xD8, 0x8C, 0x69, 0xB6, 0x7D, 0xDC, 0x51, 0x37, 0x8E, 0x28,
+    0x2E, 0x82, 0xC9, 0xFD, 0x38, 0xD5, 0x07, 0xE7, 0x7F, 0xE8, 0xB1, 0xF2,
+    0xDF, 0x96, 0xFD, 0xFD, 0x3B, 0x34, 0xCE, 0xB5, 0xCA, 0x7D, 0x8F, 0xEC,
+    0x99, 0x39, 0xA7, 0x84, 0xC5, 0xC7, 0x21, 0x08, 0xF5, 0xCA, 0x56, 0x34,
+    0x64, 0x87, 0xF4, 0x8A, 0x25, 0x90, 0x61, 0x81, 0xF1, 0xDB, 0x1D, 0x85,
+    0xC7, 0xD1, 0x88, 0xFE, 0x39, 0x96, 0x57, 0x11, 0x63, 0x72, 0x9D, 0xFB,
+    0x8E, 0xF4, 0xD2, 0x35, 0x27, 0x98, 0x83, 0x72, 0x4D, 0x64, 0x6A, 0x50,
+    0x41, 0x5B, 0x94, 0xB8, 0x68, 0x1F, 0xF7, 0xAD, 0x3B, 0xDA, 0x05, 0x88,
+    0x14, 0xBD, 0x20, 0x93, 0xFC, 0x8F, 0xB5, 0xB0, 0x7B, 0x76, 0x51, 0x4A,
+    0x3F, 0x08, 0x25, 0x5F, 0xB5, 0x8A, 0x73, 0x04, 0xFB, 0xC5, 0xDD, 0x04,
+    0xC5, 0xC5, 0xC1, 0xA1, 0xFB, 0x5D, 0x91, 0xF6, 0xC7, 0x79, 0x0C, 0x8C,
+    0x17, 0xCB, 0x79, 0x2D, 0x10, 0x60, 0xAB, 0xB4, 0x98, 0x56, 0xE8, 0x1A,
+    0xFC, 0x98, 0x08, 0xA7, 0x1C, 0x74, 0x53, 0x9D, 0x74, 0x26, 0x7E, 0x5D,
+    0xB8, 0x48, 0xC4, 0xC1, 0x81, 0xF0, 0x5F, 0x1F, 0x36, 0xBE, 0x16, 0x5F,
+    0x92, 0x08, 0x7C, 0x04, 0x49, 0x0B, 0x8F, 0xB9, 0x5A, 0x76, 0xF7, 0xDB,
+    0x3E, 0x62, 0x07, 0x1B, 0xF8, 0xCA, 0x00, 0x9B, 0x90, 0x35, 0x87, 0x87,
+    0x0E, 0xC7, 0x81, 0x9A, 0x7C, 0x67, 0x9C, 0xEB, 0xB3, 0xF9, 0x7E, 0xF3,
+    0x40, 0xDD, 0x1D, 0x32, 0x4D, 0x41, 0x5D, 0xC9, 0xD5, 0x9B, 0x58, 0xD9,
+    0xB2, 0xF8, 0x2C, 0x56, 0x67, 0xB5, 0x6A, 0xA1, 0xB5, 0xF3, 0xE8, 0xD0,
+    0x10, 0x27, 0xF7, 0x53, 0x3B, 0xE2, 0x34, 0xED, 0x2D, 0xF4, 0xB1, 0xFB,
+    0xB0, 0x2B, 0xF0, 0x0B, 0x0A, 0x5C, 0x04, 0x53, 0xA3, 0x19, 0xCF, 0xF4,
+    0x47, 0x79, 0x7B, 0xA7, 0x46, 0x44, 0x8A, 0xA3, 0x4B, 0x31, 0x8C, 0x97,
+    0xDD, 0x35, 0x36, 0x13, 0xD1, 0x4F, 0x7B, 0x86, 0x50, 0x9C, 0x3B, 0xF8,
+    0xE9, 0x5E, 0x40, 0x91, 0x7F, 0xA8, 0x07, 0x90, 0x3F, 0x4E, 0xF5, 0xA3,
+    0xCF, 0x7C, 0x5F, 0x55, 0xFA, 0x11, 0x67, 0xCD, 0xA8, 0x08, 0x62, 0x1B,
+    0x0E, 0x9A, 0xE1, 0x1C, 0x8A, 0xB3, 0x43, 0x74, 0x7C, 0x8B, 0x20, 0x1C,
+    0xA1, 0xBF, 0x7E, 0x70, 0x28, 0xC9, 0xF7, 0xD9, 0xC2, 0x36, 0xE5, 0xD0,
+    0x3C, 0xB3, 0x45, 0x9B, 0x17, 0xA9, 0x72, 0xBF, 0x0C, 0x5A, 0x47, 0x1D,
+    0x7C, 0xAD, 0x77, 0x4D, 0x9B, 0xBD, 0x36, 0x82, 0xE4, 0x33, 0x99, 0x1A,
+    0xA2, 0x4F, 0x05, 0xE4, 0x35, 0xE6, 0x08, 0x43, 0xBB, 0x80, 0x64, 0x76,
+    0x70, 0xA6, 0x14, 0x2B, 0xE3, 0xFB, 0x6C, 0x90, 0x54, 0xAF, 0x25, 0x89,
+    0xE1, 0x37, 0x52, 0x7F, 0x9A, 0x0A, 0x63, 0x05, 0xCF, 0x89, 0xE6, 0x88,
+    0x52, 0x5C, 0x6C, 0x18, 0xF3, 0xF5, 0xF9, 0xA3, 0x25, 0xB9, 0x28, 0xAB,
+    0xDC, 0xF6, 0x15, 0xD8, 0xD5, 0xB5, 0x5B, 0x55, 0x8F, 0x0B, 0x60, 0xB6,
+    0x82, 0x60, 0xC0, 0x2E, 0x2C, 0x09, 0xB6, 0x04, 0x15, 0x2F, 0xE4, 0xF3,
+    0x33, 0x7D, 0x65, 0xB4, 0xD4, 0xA0, 0x7B, 0x2D, 0xB4, 0xC2, 0x32, 0xF4,
+    0x09, 0x06, 0x3C, 0xA4, 0x6B, 0xDC, 0x5C, 0x3C, 0xCF, 0x00, 0x4B, 0xAE,
+    0xC9, 0x40, 0x04, 0x63, 0xD7, 0x01, 0xC2, 0x6E, 0x8F, 0x86, 0xBB, 0x77,
+    0xBC, 0xBB, 0x0F, 0x33, 0x61, 0x34, 0x4D, 0x8C, 0xE5, 0x94, 0x06, 0x81,
+    0x1C, 0xEB, 0x35, 0x0B, 0x06, 0x72, 0xFE, 0x19, 0x04, 0x7F, 0xFB, 0xE5,
+    0x9F, 0x5B, 0xD7, 0x5C, 0xFD, 0xD9, 0x75, 0xC1, 0x75, 0x3C, 0xC4, 0x5B,
+    0x32, 0xE0, 0x28, 0x7E, 0xAC, 0xE6, 0xFD, 0x4F, 0x6B, 0x71, 0x79, 0xEC,
+    0x60, 0xA7, 0x90, 0xB7, 0xC3, 0xBF, 0x5D, 0x4B, 0x4F, 0xC2, 0xC1, 0xD8,
+    0x22, 0x83, 0xEE, 0xD4, 0xEB, 0x91, 0xD8, 0xF3, 0xD4, 0xE7, 0x5C, 0xBF,
+    0x31, 0x7C, 0xBA, 0x53, 0x93, 0x8B, 0x98, 0x89, 0xBC, 0x79, 0x6E, 0x35,
+    0x8A, 0xE6, 0xBF, 0xA9, 0xB8, 0x08, 0xB7, 0x34, 0x5A, 0x94, 0xAB, 0xA4,
+    0x8A, 0xB5, 0x9A, 0xC8, 0x73, 0x00, 0xBF, 0x7B, 0x12, 0xFB, 0x5D, 0xA9,
+    0x37, 0x3D, 0x7D, 0x86, 0x1F, 0x88, 0xB4, 0x15, 0xC6, 0xA0, 0x3D, 0xA9,
+    0x25, 0xAE, 0xED, 0x6C, 0xA2, 0x31, 0xAD, 0x8A, 0xB5, 0xFF, 0x58, 0xFA,
+    0x9D, 0xEA, 0x7F, 0x8E, 0x1F, 0xB5, 0xD9, 0xD9, 0x6E, 0x19, 0x7A, 0x51,
+    0x40, 0x95, 0x47, 0x5B, 0xD4, 0xF3, 0xBF, 0xE5, 0x43, 0x9A, 0xB0, 0x16,
+    0xE2, 0xC0, 0x66, 0x68, 0x9A, 0x56, 0xED, 0x69, 0x3C, 0x28, 0xF7, 0x3E,
+    0x94, 0x78, 0x26, 0xE5, 0xE7, 0x33, 0x92, 0xE9, 0xF0, 0xB9, 0x23, 0x96,
+    0xF3, 0xD8, 0x18, 0x3F, 0x02, 0x03, 0x01, 0x00, 0x01, 0x02, 0x82, 0x04,
+    0x00, 0x1C, 0xE6, 0x18, 0x4F, 0xEE, 0x74, 0x44, 0x20, 0xCC, 0x0B, 0x39,
+    0xAA, 0x9C, 0x3B, 0x1F, 0x34, 0x6E, 0x1E, 0x6A, 0x9C, 0xAE, 0x2A, 0xC0,
+    0x8B, 0xCF, 0x7E, 0xC4, 0xD0, 0x76, 0x7F, 0xE2, 0xB9, 0xA7, 0x8C, 0xDC,
+    0xD8, 0x07, 0xE2, 0xBD, 0x20, 0x25, 0x2E, 0xB8, 0x0F, 0x43, 0x35, 0x8F,
+    0x03, 0x7F, 0x63, 0x84, 0xC4, 0x14, 0xB1, 0xBB, 0x1D, 0x59, 0xD3, 0xC1,
+    0x12, 0x02, 0x80, 0xBE, 0x36, 0xEA, 0x9D, 0x35, 0x7A, 0xAC, 0xB8, 0xA3,
+    0xFE, 0x10, 0xB0, 0xB5, 0x21, 0x97, 0xD6, 0x85, 0x6A, 0xA1, 0xB8, 0x86,
+    0xD0, 0xA5, 0xF8, 0x82, 0xC8, 0xDC, 0xA6, 0xE2, 0xBC, 0x91, 0x90, 0xBA,
+    0xF4, 0x9D, 0x25, 0x66, 0xB7, 0x76, 0xA5, 0xB1, 0x23, 0x1E, 0x6B, 0xB0,
+    0x33, 0x2A, 0x17, 0x8E, 0x06, 0x78, 0x47, 0x55, 0xA7, 0x6A, 0x75, 0xE5,
+    0x88, 0x55, 0x9F, 0xDC, 0xAD, 0x7F, 0xFA, 0xEE, 0x23, 0x52, 0xF5, 0xA6,
+    0xA8, 0x95, 0xDB, 0xF0, 0x68, 0xAB, 0xFF, 0x4A, 0xEC, 0x78, 0x0D, 0x87,
+    0xA4, 0xBD, 0x4D, 0x36, 0x1A, 0xE1, 0x94, 0x82, 0x72, 0x03, 0xC9, 0xC7,
+    0xD3, 0x57, 0x60, 0x4B, 0x60, 0xBF, 0x24, 0xAB, 0xE4, 0x61, 0x3E, 0xF6,
+    0x97, 0x52, 0x35, 0x7D, 0x6C, 0x18, 0x10, 0x25, 0xE7, 0xEF, 0x4E, 0x97,
+    0x3E, 0x55, 0xC7, 0xB2, 0x13, 0xB9, 0x78, 0x61, 0xEE, 0x88, 0x4D, 0x5E,
+    0xA6, 0x0B, 0x7A, 0x1F, 0xD6, 0x49, 0x97, 0xEB, 0x24, 0xBE, 0x15, 0x7E,
+    0x30, 0x34, 0xF4, 0xAD, 0x9E, 0x0D, 0x6D, 0x7A, 0xA6, 0x22, 0x8B, 0xB7,
+    0xCC, 0x99, 0xB2, 0x9A, 0xFA, 0xFA, 0x46, 0x4D, 0x67, 0x4B, 0xEE, 0x07,
+    0x2A, 0x9E, 0xCE, 0x36, 0x34, 0xD8, 0x63, 0x58, 0x56, 0xD5, 0x10, 0x70,
+    0xD3, 0x16, 0xF6, 0x0D, 0x4B, 0x65, 0x53, 0x41, 0x62, 0xEE, 0x4A, 0xF2,
+    0xF7, 0xA1, 0x7F, 0x46, 0x07, 0xFD, 0xE0, 0xF0, 0x7D, 0xB6, 0xFB, 0x40,
+    0x9F, 0x89, 0x8D, 0xE8, 0xE4, 0xBB, 0x6E, 0x9D, 0xA8, 0xD5, 0x9D, 0xB8,
+    0x15, 0xC3, 0x0A, 0xAC, 0x6F, 0x64, 0x8B, 0xFC, 0xD2, 0xBF, 0xA5, 0x72,
+    0xEC, 0x16, 0xE0, 0xFB, 0xDE, 0x66, 0x66, 0xDE, 0x38, 0x08, 0x7E, 0xD4,
+    0xEE, 0xEB, 0xC7, 0x54, 0xD9, 0xFB, 0x50, 0x87, 0x56, 0x8B, 0x57, 0x5B,
+    0x51, 0x44, 0x8A, 0x5E, 0xE5, 0xCA, 0xFD, 0xB4, 0x15, 0x63, 0xC1, 0x91,
+    0x2B, 0x87, 0x87, 0x86, 0xBE, 0x55, 0x9C, 0xF6, 0xCE, 0x59, 0xE0, 0x19,
+    0x7C, 0xF5, 0xDF, 0x6E, 0x77, 0xE9, 0x5F, 0x6B, 0xC0, 0xD6, 0x53, 0x4E,
+    0xE7, 0xB8, 0x62, 0xCE, 0x15, 0xE8, 0xB3, 0xAE, 0xE0, 0x7B, 0xA1, 0xFB,
+    0xC7, 0xD7, 0x72, 0x61, 0x6B, 0xAC, 0x05, 0x73, 0xDD, 0xB8, 0xC5, 0x86,
+    0xD4, 0x47, 0x59, 0xE1, 0x56, 0xCB, 0xD8, 0x97, 0xA9, 0xC4, 0xB5, 0xBB,
+    0xFA, 0xD1, 0x7F, 0x08, 0xCE, 0xD3, 0xF1, 0x78, 0xFB, 0x52, 0xA5, 0x8A,
+    0x28, 0xF6, 0xAB, 0x3A, 0x48, 0x6C, 0x2B, 0x0F, 0x1B, 0xE1, 0x49, 0xCA,
+    0xCF, 0x11, 0x5A, 0x30, 0x1E, 0x4E, 0xAB, 0xF5, 0xB0, 0x43, 0x9F, 0xB6,
+    0x43, 0x64, 0x85, 0xB5, 0x03, 0xE2, 0x71, 0xD2, 0xA7, 0xC2, 0xE1, 0x07,
+    0x7A, 0x27, 0xB8, 0xBA, 0x14, 0x57, 0xD4, 0xCB, 0xF7, 0x90, 0x1F, 0x67,
+    0x91, 0xC8, 0xBC, 0x84, 0xC1, 0x38, 0x5B, 0xDD, 0x46, 0xE0, 0x5A, 0x67,
+    0x70, 0x9A, 0x33, 0x1F, 0x28, 0xF3, 0xE4, 0x75, 0x30, 0x87, 0x18, 0x85,
+    0x8D, 0xBC, 0x27, 0x65, 0x8F, 0x07, 0x5F, 0x39, 0x30, 0x85, 0x51, 0x56,
+    0x64, 0xDE, 0x01, 0x3B, 0x7B, 0xA6, 0x1E, 0xA7, 0x24, 0xF2, 0x1C, 0x2C,
+    0xF3, 0x5B, 0x18, 0xC0, 0xAD, 0x6F, 0xF0, 0xBB, 0x07, 0xC5, 0x23, 0xB5,
+    0xB1, 0x8E, 0xC3, 0xF4, 0x28, 0x3B, 0x0A, 0x5B, 0x63, 0x0E, 0x8A, 0x23,
+    0xC7, 0xB0, 0x0F, 0xAD, 0xD6, 0xD6, 0x39, 0xEE, 0xBA, 0x46, 0x83, 0x05,
+    0xD3, 0x2D, 0x1B, 0x3B, 0xCE, 0xD6, 0x8A, 0x48, 0xCC, 0x03, 0x07, 0x10,
+    0xBF, 0x82, 0xA1, 0xB1, 0x37, 0xB2, 0xEA, 0x47, 0xCC, 0xC2, 0x52, 0x5C,
+    0xB4, 0xF2, 0xDC, 0x2F, 0xB5, 0x11, 0xCD, 0xBA, 0xE1, 0xC1, 0x1A, 0x8F,
+    0xAB, 0x3B, 0xA9, 0x91, 0xD5, 0xE4, 0xAC, 0x3B, 0x68, 0xCD, 0x64, 0x74,
+    0x71, 0x47, 0xCE, 0x58, 0xF5, 0x55, 0x62, 0x02, 0x81, 0x05, 0x1E, 0x95,
+    0xAA, 0xBB, 0x17, 0xF1, 0x18, 0x43, 0x98, 0x1C, 0x8C, 0x6D, 0x4F, 0xE8,
+    0x93, 0x00, 0xFA, 0x33, 0x3D, 0x9A, 0xDD, 0x53, 0x65, 0x1D, 0x9D, 0xD1,
+    0x62, 0xCB, 0x33, 0x6A, 0xDD, 0x27, 0xFC, 0x1B, 0x4A, 0xF2, 0xEE, 0x5D,
+    0x94, 0x73, 0x8C, 0x72, 0x61, 0x5D, 0xED, 0x01, 0x2C, 0xDF, 0x2F, 0x72,
+    0xAF, 0x9D, 0xB2, 0x57, 0xB3, 0xC8, 0x35, 0x1A, 0xFE, 0xCE, 0xF3, 0x82,
+    0xD1, 0xE2, 0x46, 0x03, 0x3F, 0x7E, 0xA3, 0xAB, 0x4E, 0x94, 0xE0, 0xC4,
+    0x86, 0x1A, 0x41, 0x9A, 0xF8, 0x3F, 0xAB, 0xFB, 0x78, 0x3E, 0x93, 0x4D,
+    0xEE, 0x01, 0x51, 0x69, 0x02, 0x6F, 0x18, 0xEF, 0x6B, 0x1F, 0xD4, 0xC1,
+    0xD8, 0xCD, 0x91, 0xA7, 0x50, 0x49, 0x9E, 0xEA, 0x2F, 0x14, 0xC2, 0x66,
+    0x4D, 0x5B, 0x01, 0x51, 0xBD, 0x7F, 0x45, 0x60, 0xB5, 0x4B, 0x00, 0x6A,
+    0x3F, 0x86, 0x98, 0xBD, 0xEA, 0x5A, 0x30, 0x14, 0xDB, 0x5A, 0xE4, 0x14,
+    0x74, 0xEB, 0x03, 0xB9, 0x72, 0x51, 0xA3, 0xE2, 0x9F, 0x8D, 0x92, 0x6F,
+    0x70, 0x1B, 0xA1, 0x9D, 0x38, 0x32, 0x51, 0x89, 0x2A, 0x10, 0xA3, 0x7A,
+    0x86, 0x7D, 0x78, 0x31, 0x2A, 0x75, 0xB5, 0x1F, 0xD1, 0x25, 0xBC, 0xAD,
+    0x5C, 0xFD, 0x72, 0x94, 0x93, 0xFB, 0x97, 0xAA, 0x3F, 0x02, 0x28, 0x01,
+    0x22, 0x8E, 0x34, 0xFF, 0xA0, 0x27, 0xF9, 0x17, 0x1D, 0xC2, 0x65, 0xB2,
+    0x60, 0xCF, 0x26, 0x82, 0xCE, 0xB2, 0x7A, 0x2C, 0x09, 0x9D, 0x68, 0x2A,
+    0x57, 0x5C, 0x3E, 0xBF, 0x70, 0x9B, 0xF5, 0xE7, 0x0E, 0xAD, 0x0D, 0x8B,
+    0x8B, 0xB3, 0xE0, 0x7D, 0xE4, 0x68, 0x12, 0x90, 0x94, 0x36, 0x3E, 0x0C,
+    0xD0, 0x3F, 0x2A, 0xD0, 0x05, 0x1D, 0x6C, 0xCC, 0x53, 0x4A, 0x7B, 0x04,
+    0x72, 0xD3, 0x19, 0x44, 0xB9, 0x74, 0x11, 0x7B, 0xBA, 0x80, 0x3F, 0xF1,
+    0x6B, 0xA0, 0x1A, 0x56, 0x5D, 0xDA, 0x7C, 0x65, 0x27, 0x21, 0xE0, 0x04,
+    0xD9, 0xC2, 0x56, 0x62, 0x46, 0x7C, 0xBE, 0xFC, 0xC3, 0x2A, 0x87, 0x0B,
+    0x96, 0x27, 0x08, 0xF0, 0x50, 0xC0, 0x7C, 0x77, 0x83, 0x9C, 0x62, 0xBB,
+    0xA4, 0x80, 0x94, 0x7E, 0x74, 0x30, 0x54, 0x99, 0xE8, 0xEB, 0x8F, 0x94,
+    0xA1, 0xAA, 0x50, 0xD6, 0x57, 0x42, 0x38, 0xAD, 0xE4, 0x9B, 0x37, 0xD2,
+    0x46, 0xC2, 0x0D, 0xF4, 0x3F, 0xB2, 0x82, 0xED, 0xFC, 0xFE, 0xFA, 0xF7,
+    0x3D, 0xEF, 0xE5, 0x16, 0x03, 0x28, 0x47, 0x66, 0x8C, 0xB5, 0xAC, 0x1E,
+    0xFE, 0xC9, 0x9D, 0xB9, 0xFA, 0xD6, 0x75, 0x95, 0x6B, 0x4F, 0x67, 0xBE,
+    0xEF, 0x3F, 0x34, 0xFF, 0x34, 0x7C, 0xF5, 0xEF, 0x1A, 0x74, 0x60, 0x8B,
+    0x8D, 0x89, 0x97, 0xC1, 0x7C, 0x62, 0x53, 0x5C, 0x31, 0xDB, 0x51, 0x7F,
+    0x61, 0xCF, 0xE0, 0xFF, 0x23, 0x7B, 0xBE, 0x49, 0xF6, 0x3F, 0xD5, 0x6C,
+    0xA1, 0x19, 0x4A, 0xBD, 0x35, 0x8D, 0x57, 0x25, 0x32, 0xCF, 0xE0, 0x2E,
+    0x16, 0x2A, 0x91, 0x14, 0xB4, 0x06, 0x31, 0x35, 0xC4, 0xF2, 0x33, 0x6A,
+    0x1E, 0x57, 0x56, 0xFE, 0xF3, 0x91, 0xBF, 0x64, 0x1D, 0xB3, 0xE6, 0xD9,
+    0xED, 0x16, 0x11, 0x12, 0x6A, 0x48, 0xD3, 0xEC, 0xCF, 0x9B, 0x1C, 0xD7,
+    0x20, 0xAF, 0x91, 0xC9, 0xC1, 0x02, 0x82, 0x02, 0x01, 0x00, 0xE6, 0x72,
+    0x04, 0x8E, 0x85, 0x48, 0xCC, 0x09, 0x8F, 0x2F, 0xB8, 0x9E, 0x2A, 0xA8,
+    0xFC, 0x38, 0xC7, 0x10, 0xB9, 0xF8, 0x44, 0xE7, 0x83, 0x87, 0x0B, 0xF6,
+    0x93, 0x73, 0x56, 0x7D, 0x22, 0xE8, 0xB4, 0x83, 0x3A, 0x21, 0xF3, 0x91,
+    0xD2, 0x68, 0x28, 0xD6, 0x56, 0x9A, 0x3D, 0xA4, 0x6A, 0x48, 0xDE, 0xC2,
+    0xBA, 0x52, 0x6F, 0xB2, 0xF1, 0xC2, 0xDC, 0x9B, 0xD3, 0x78, 0x00, 0xB7,
+    0x5C, 0xA5, 0xC1, 0x3A, 0x21, 0x65, 0x38, 0xFB, 0x2B, 0x0B, 0x30, 0x0A,
+    0xB4, 0x17, 0xD3, 0x82, 0xDF, 0x96, 0xF9, 0xDC, 0x1B, 0x9C, 0xAF, 0x10,
+    0xBF, 0x41, 0xDA, 0x48, 0x43, 0xF0, 0xD9, 0x6A, 0x10, 0xB8, 0x34, 0xC5,
+    0xFD, 0xE1, 0x56, 0x1F, 0x11, 0xAA, 0x53, 0xBC, 0x3A, 0xBF, 0x69, 0x09,
+    0x34, 0xB9, 0x3B, 0x4D, 0x73, 0x29, 0x5F, 0xB7, 0x55, 0x65, 0x16, 0x0E,
+    0xBC, 0x5D, 0xB2, 0x38, 0xDA, 0xF5, 0x50, 0xD0, 0x36, 0x63, 0x49, 0x63,
+    0xC5, 0xA2, 0x29, 0x7C, 0x08, 0x34, 0x69, 0xAD, 0x3F, 0x14, 0x66, 0x95,
+    0x4B, 0xFB, 0x84, 0xEC, 0xB1, 0x6E, 0x5B, 0x3E, 0xAE, 0x0B, 0x9B, 0x55,
+    0xC7, 0xE9, 0x45, 0xAC, 0x64, 0x0D, 0xC0, 0x99, 0x6D, 0xC2, 0xD8, 0x41,
+    0xE3, 0xAD, 0x2F, 0xF9, 0x57, 0xD2, 0xF1, 0xE6, 0xAE, 0x13, 0x1E, 0x57,
+    0x1D, 0x46, 0xBB, 0x45, 0x49, 0x97, 0x8C, 0x0D, 0x75, 0xA8, 0x4C, 0x7A,
+    0x47, 0xC8, 0xD3, 0xF0, 0x8E, 0x1E, 0x39, 0xD9, 0xB0, 0x6D, 0x59, 0xC3,
+    0x29, 0x59, 0x92, 0x9E, 0xAD, 0x1C, 0x34, 0x48, 0xEE, 0x2C, 0x20, 0x96,
+    0xBE, 0x3C, 0x13, 0xA5, 0x95, 0xE4, 0xE5, 0xEB, 0x92, 0x3B, 0x4B, 0xA1,
+    0x99, 0x7B, 0x36, 0x29, 0xA2, 0x29, 0x63, 0x40, 0x7D, 0xFA, 0x1B, 0x2E,
+    0x0E, 0xC6, 0x0E, 0x60, 0xC5, 0xFB, 0xDB, 0xAC, 0xAF, 0x1B, 0xA5, 0x42,
+    0x60, 0xC0, 0xF4, 0x8F, 0x6C, 0xBF, 0xBF, 0x78, 0xB5, 0x8F, 0xC3, 0x62,
+    0x59, 0xD8, 0x99, 0x13, 0xD6, 0xC4, 0x90, 0xF3, 0x9E, 0x42, 0xAE, 0x39,
+    0xD4, 0xFD, 0x65, 0x91, 0x7F, 0x1B, 0xEF, 0xD2, 0xF2, 0x26, 0xB6, 0xE0,
+    0xEE, 0xD0, 0x82, 0x46, 0xCB, 0x11, 0x0A, 0xA0, 0xC9, 0xBE, 0x0B, 0xA6,
+    0x95, 0xE3, 0x09, 0xC4, 0x77, 0xCC, 0xFD, 0x44, 0x78, 0x4D, 0x55, 0x97,
+    0xFA, 0xCA, 0xE2, 0x1A, 0x62, 0xEB, 0xE4, 0x26, 0x26, 0xDB, 0x68, 0x39,
+    0xA8, 0x9C, 0xAF, 0x5F, 0x27, 0x60, 0xAF, 0x2F, 0x01, 0xD4, 0x98, 0x19,
+    0x71, 0x79, 0x99, 0x11, 0xBE, 0x51, 0x19, 0x8A, 0xF4, 0xEA, 0xFE, 0x5D,
+    0xE0, 0xEE, 0xD1, 0x4A, 0x94, 0x7F, 0x12, 0x7A, 0xBE, 0x98, 0xF1, 0xB0,
+    0xAC, 0x2F, 0x7F, 0xA6, 0x23, 0x87, 0xE7, 0xEC, 0x27, 0x4D, 0x93, 0xA2,
+    0x7F, 0xA6, 0xED, 0x88, 0x09, 0xC5, 0x80, 0x2E, 0x9F, 0x11, 0xE6, 0xAA,
+    0xC0, 0x6E, 0xEF, 0xAA, 0xBA, 0x0B, 0xE8, 0x1F, 0xD9, 0xC3, 0x9B, 0xB5,
+    0x56, 0x2C, 0x75, 0x99, 0x0A, 0xA5, 0xB9, 0xB3, 0x4E, 0x3A, 0x0A, 0xED,
+    0x7F, 0x7C, 0x1B, 0x27, 0xEC, 0xFF, 0xD4, 0x40, 0x30, 0x7C, 0x75, 0x87,
+    0x1D, 0xF5, 0x10, 0xD7, 0x2F, 0x7B, 0xCC, 0xB2, 0x0F, 0xD9, 0x64, 0x7F,
+    0xF7, 0x31, 0x89, 0x3C, 0x27, 0xD9, 0x69, 0x22, 0xE5, 0xEC, 0xC2, 0xCC,
+    0x85, 0x8A, 0xDA, 0x29, 0xDE, 0x54, 0xEC, 0x1A, 0x0D, 0x96, 0x32, 0x24,
+    0xBF, 0xE2, 0x6D, 0x1E, 0x71, 0x61, 0x5F, 0x30, 0x68, 0xBE, 0x9E, 0xB7,
+    0xDA, 0xC4, 0xB3, 0xCB, 0x63, 0x66, 0x2B, 0x72, 0xCC, 0x09, 0x4D, 0xF3,
+    0xAD, 0xCC, 0x55, 0xD5, 0x67, 0x29, 0x92, 0x43, 0x54, 0x4C, 0x64, 0xB3,
+    0x01, 0x7C, 0xC0, 0xC3, 0x8A, 0x68, 0x6C, 0xA1, 0x16, 0x3D, 0xED, 0x21,
+    0xBB, 0x7A, 0x3A, 0x9E, 0xCC, 0x71, 0x02, 0x82, 0x02, 0x01, 0x00, 0xE0,
+    0xD4, 0xA1, 0xD8, 0xCF, 0x50, 0x3B, 0xEC, 0xA0, 0x4D, 0x35, 0xB8, 0xC8,
+    0x07, 0x6C, 0x03, 0xD4, 0xF3, 0x1E, 0xEA, 0xBE, 0x21, 0xFA, 0x35, 0x45,
+    0x08, 0x41, 0xD6, 0x89, 0xCF, 0xE7, 0x67, 0x37, 0x2F, 0xAE, 0xC8, 0x22,
+    0x18, 0x8A, 0x74, 0x7E, 0xE2, 0xBE, 0x23, 0x26, 0x84, 0xBA, 0x1B, 0x83,
+    0xD8, 0xFC, 0x6E, 0x9E, 0x4B, 0xCB, 0x3A, 0x2E, 0xFF, 0x81, 0x18, 0x28,
+    0x8B, 0x4D, 0x93, 0x38, 0xA9, 0x88, 0x28, 0x2D, 0x80, 0x79, 0x04, 0x24,
+    0xBE, 0x67, 0xAE, 0x98, 0xC6, 0x9E, 0xFD, 0x4C, 0x0D, 0xC4, 0xEC, 0xB3,
+    0xF6, 0xD3, 0x12, 0x32, 0x29, 0xF7, 0x2C, 0xA6, 0xE3, 0xB7, 0xF3, 0x6F,
+    0x43, 0x48, 0x6B, 0x66, 0x89, 0xA2, 0x4A, 0xFF, 0x33, 0xD6, 0xDC, 0x3D,
+    0xCC, 0x74, 0x0B, 0xA8, 0x8C, 0x41, 0xBE, 0x0A, 0x53, 0x4B, 0xAF, 0xC9,
+    0x29, 0xE2, 0x19, 0x55, 0xE5, 0x7E, 0x39, 0x0B, 0xEA, 0xBF, 0xB5, 0x33,
+    0xE9, 0x69, 0xCD, 0x05, 0x4D, 0x76, 0x99, 0x60, 0x37, 0x38, 0x47, 0xAB,
+    0xC8, 0x32, 0xD3, 0x22, 0x07, 0xD2, 0x2A, 0x04, 0xBA, 0x04, 0xFB, 0x25,
+    0x8B, 0x85, 0x57, 0xA3, 0x7D, 0x15, 0x46, 0x5C, 0x80, 0x7F, 0x6E, 0x06,
+    0xA7, 0xC1, 0x14, 0xC2, 0x47, 0x04, 0x80, 0x72, 0xAF, 0xB3, 0x5C, 0xE9,
+    0x13, 0xEB, 0xA4, 0xE5, 0x95, 0x60, 0xD0, 0x0C, 0xA7, 0x7F, 0xE0, 0x7E,
+    0x47, 0xA9, 0x93, 0x2D, 0x39, 0xDD, 0xDD, 0xB4, 0x6F, 0xDF, 0xC5, 0x17,
+    0xE0, 0xF0, 0xFB, 0xAE, 0x4B, 0x4A, 0x0E, 0x15, 0xB5, 0x46, 0x1C, 0x6F,
+    0x69, 0x11, 0xBB, 0x2F, 0x08, 0x2D, 0x24, 0xCD, 0x9B, 0x0E, 0x79, 0x18,
+    0x73, 0xBE, 0x49, 0xF5, 0xBF, 0x9D, 0x6F, 0x07, 0x55, 0x9E, 0x0A, 0xE2,
+    0x4C, 0x18, 0xDA, 0x65, 0xCE, 0xC7, 0x6C, 0xB4, 0x79, 0x02, 0x3E, 0xA1,
+    0x5C, 0x63, 0x2F, 0x64, 0x98, 0xEA, 0x6A, 0xAB, 0x58, 0x78, 0x23, 0x89,
+    0xA3, 0x38, 0x5A, 0x16, 0xFB, 0xBE, 0x5C, 0xBA, 0x41, 0x6C, 0x6E, 0xEB,
+    0x7E, 0x55, 0xBC, 0x1B, 0x0E, 0x4A, 0xA9, 0xDC, 0x2D, 0xED, 0xB4, 0x38,
+    0xB7, 0x02, 0x23, 0x5D, 0x55, 0x69, 0xDD, 0xC9, 0x0A, 0xC8, 0x2C, 0xE3,
+    0x88, 0xA0, 0x73, 0x50, 0xE9, 0xEC, 0x3C, 0x8E, 0x54, 0x37, 0xC0, 0xAC,
+    0x48, 0x1E, 0x9D, 0x1E, 0x05, 0x68, 0xEE, 0x45, 0x2C, 0xB2, 0x7F, 0xF3,
+    0x33, 0xDC, 0x35, 0xAB, 0x50, 0xAD, 0x38, 0x7D, 0xFB, 0x75, 0x18, 0x75,
+    0x8D, 0x38, 0x22, 0x2E, 0xA8, 0x7A, 0xB2, 0x4A, 0xDC, 0xB9, 0x4B, 0x96,
+    0x91, 0x8D, 0x39, 0xCF, 0x91, 0xCC, 0x7A, 0x36, 0x12, 0xF0, 0x46, 0xA9,
+    0xC8, 0x2B, 0x03, 0x42, 0xED, 0xE2, 0xCD, 0xFC, 0xB5, 0xD6, 0x3D, 0x38,
+    0x78, 0xCC, 0xD3, 0x67, 0x20, 0x9A, 0x79, 0xE1, 0x85, 0xB0, 0x20, 0xC2,
+    0x6D, 0x7A, 0xF7, 0x63, 0x31, 0xE3, 0x0D, 0xE0, 0x31, 0x7A, 0x21, 0x26,
+    0xA6, 0x1E, 0x9F, 0x3B, 0x65, 0x77, 0x89, 0x91, 0x8D, 0xE9, 0xCB, 0x9C,
+    0x83, 0xA7, 0x14, 0xAE, 0x28, 0x89, 0xE1, 0x69, 0x37, 0x36, 0x8A, 0x3D,
+    0xEE, 0x93, 0xAD, 0x3A, 0x9D, 0x4C, 0xC8, 0xAD, 0xAE, 0x98, 0x6C, 0x3D,
+    0xDB, 0x34, 0x2F, 0x35, 0x7E, 0x28, 0xC0, 0x78, 0x08, 0x49, 0x8E, 0xF5,
+    0x2E, 0x85, 0xDB, 0x3C, 0xD5, 0xAD, 0x6A, 0xE7, 0xAB, 0x07, 0x4A, 0xDB,
+    0x67, 0x24, 0x52, 0xD8, 0x38, 0xCF, 0x69, 0x5B, 0xC6, 0xC0, 0xFC, 0x78,
+    0x4E, 0x79, 0x91, 0xAC, 0xD0, 0xE9, 0xE4, 0x9F, 0x3D, 0x1C, 0x2D, 0x97,
+    0x6D, 0x71, 0x4F, 0x45, 0x43, 0x3D, 0x8C, 0x60, 0x3F, 0x35, 0x2D, 0x79,
+    0x49, 0x0B, 0xB2, 0xD5, 0xFF, 0xC5, 0xEC, 0xD6, 0xEB, 0xD7, 0xAB, 0xF6,
+    0x1E, 0xB4, 0x48, 0xF7, 0x87, 0x47, 0xAF, 0x02, 0x82, 0x02, 0x01, 0x00,
+    0xC5, 0xF3, 0x9B, 0x46, 0x71, 0xE7, 0x9E, 0x9D, 0x77, 0x8A, 0x1E, 0xA4,
+    0x7F, 0x30, 0xB9, 0xB8, 0x6C, 0x07, 0x4A, 0x38, 0xA1, 0xB7, 0xDD, 0x9B,
+    0xDC, 0x02, 0xEB, 0x96, 0x5F, 0xED, 0x0E, 0x57, 0xA6, 0xF8, 0x32, 0xAF,
+    0x87, 0x72, 0xF3, 0xB2, 0xD5, 0xA1, 0x88, 0xB2, 0xE5, 0xD0, 0x9E, 0x1C,
+    0x0A, 0x7E, 0x6B, 0x5E, 0xF4, 0xE4, 0x5A, 0x18, 0x71, 0x38, 0xC9, 0xE6,
+    0x83, 0x76, 0xFE, 0xF6, 0xC3, 0x8D, 0x13, 0xB2, 0xC7, 0xC7, 0xB9, 0xA9,
+    0xDA, 0x92, 0xD7, 0x30, 0xC0, 0x57, 0xE3, 0x88, 0xE5, 0x08, 0xD6, 0x0F,
+    0x39, 0xB2, 0xC1, 0x17, 0xE8, 0x51, 0xBB, 0x4A, 0xE0, 0xF7, 0xE3, 0x74,
+    0xD8, 0xA0, 0x5A, 0xFD, 0x7D, 0xE5, 0x22, 0x5F, 0x95, 0x9E, 0x53, 0x38,
+    0xA9, 0x19, 0x67, 0x58, 0xD6, 0x40, 0x29, 0x74, 0x98, 0xEB, 0xFB, 0x46,
+    0xE2, 0x33, 0xB6, 0x4B, 0x26, 0x15, 0x00, 0xC1, 0x49, 0xB2, 0x11, 0x86,
+    0x28, 0x3C, 0xB4, 0x40, 0x20, 0x32, 0x93, 0x39, 0xB2, 0xAD, 0x47, 0x4A,
+    0x56, 0xF4, 0x58, 0x58, 0xAE, 0x4E, 0x43, 0xFB, 0xF0, 0x15, 0x5F, 0x9C,
+    0x48, 0xCA, 0xDE, 0xF6, 0xDB, 0x0A, 0xC2, 0xC7, 0xAD, 0x72, 0x1E, 0x7F,
+    0x09, 0x15, 0x50, 0x66, 0x2C, 0x97, 0x9B, 0x81, 0x70, 0x9A, 0x1F, 0x5D,
+    0xFC, 0xEA, 0x08, 0x14, 0x02, 0x39, 0xFA, 0x85, 0x5B, 0xA1, 0x14, 0x38,
+    0x85, 0xB9, 0x64, 0x80, 0x76, 0xCE, 0x64, 0xC6, 0x42, 0x1B, 0x65, 0x1A,
+    0x09, 0xC9, 0x43, 0x73, 0xD6, 0x26, 0xC7, 0xBD, 0x3A, 0x8C, 0x8B, 0x4B,
+    0x0C, 0x93, 0x70, 0xC6, 0x5A, 0x7A, 0x1A, 0xD0, 0x8D, 0x50, 0x56, 0x44,
+    0xE9, 0x2A, 0xDF, 0x94, 0x9F, 0x6A, 0x14, 0x0A, 0x49, 0x5F, 0xD4, 0xD7,
+    0x4B, 0x11, 0xBD, 0x4F, 0x14, 0x7A, 0xBC, 0x97, 0x24, 0x94, 0xA9, 0xB6,
+    0xAD, 0xB6, 0xDF, 0x35, 0xE0, 0xDE, 0x73, 0x24, 0x23, 0x6D, 0xA5, 0x48,
+    0xE1, 0x25, 0x52, 0xD8, 0x64, 0x66, 0x4E, 0x4E, 0x7B, 0xD5, 0x49, 0x55,
+    0x2E, 0x24, 0x2F, 0x79, 0x9C, 0x0D, 0xE7, 0x8A, 0x2F, 0xF0, 0x9C, 0x61,
+    0xF5, 0x26, 0x32, 0xFE, 0x99, 0x6A, 0x06, 0x75, 0x95, 0x13, 0x99, 0x38,
+    0xCE, 0xF9, 0x42, 0x37, 0xCC, 0xE4, 0x1F, 0xA4, 0xCE, 0xCA, 0x4A, 0x2C,
+    0xE4, 0x21, 0xB1, 0x25, 0x26, 0x24, 0x54, 0x65, 0x1D, 0x8E, 0x48, 0x42,
+    0xA0, 0xBD, 0x26, 0xC1, 0xB1, 0x43, 0xA3, 0xA7, 0xC1, 0xD4, 0x37, 0x56,
+    0x4F, 0x71, 0x4B, 0xB0, 0x90, 0x74, 0x55, 0x6F, 0x84, 0xE9, 0x80, 0x89,
+    0x7C, 0x07, 0x58, 0x78, 0xCC, 0xFF, 0xAB, 0x9F, 0x9C, 0x58, 0x23, 0xF1,
+    0x6D, 0x6B, 0xBD, 0xFC, 0xEF, 0x41, 0xDF, 0xB3, 0x96, 0xDD, 0x9C, 0xC5,
+    0x5E, 0xD4, 0x6F, 0xA3, 0x0C, 0xD7, 0x96, 0xCD, 0x38, 0xD6, 0xD3, 0x7D,
+    0xA5, 0x0F, 0x78, 0x4D, 0xD3, 0x42, 0x6C, 0x9E, 0x5D, 0xBF, 0x3E, 0x68,
+    0x71, 0x10, 0xCB, 0xFD, 0x54, 0xE7, 0x29, 0xE6, 0x42, 0x26, 0x6C, 0x44,
+    0x1F, 0xAE, 0xF3, 0x9B, 0xC0, 0x18, 0x03, 0xD5, 0x9E, 0x95, 0xA5, 0x10,
+    0xC4, 0x44, 0x54, 0xCF, 0x76, 0xAF, 0xE1, 0xF2, 0x0E, 0x5B, 0xC6, 0x91,
+    0x8F, 0x6A, 0xFD, 0x04, 0x68, 0x46, 0x6C, 0x54, 0xAD, 0xA3, 0x74, 0xAE,
+    0x74, 0x87, 0x0B, 0x0F, 0xC3, 0x67, 0xC3, 0xBC, 0x5F, 0x33, 0xE2, 0x07,
+    0xEA, 0xFA, 0xF6, 0x79, 0xA2, 0x12, 0x4C, 0x82, 0xC0, 0x29, 0xED, 0x50,
+    0x11, 0x37, 0x0D, 0x8D, 0x7A, 0x84, 0x73, 0xD6, 0x07, 0xEC, 0x8C, 0xA8,
+    0x51, 0x75, 0xC9, 0x0D, 0x85, 0x8D, 0xD3, 0x18, 0x3A, 0xB3, 0xEB, 0x6D,
+    0xD3, 0xF2, 0x90, 0x8C, 0x81, 0x69, 0x77, 0x33, 0x4C, 0x5C, 0xF3, 0xA6,
+    0x2E, 0x54, 0x93, 0x9E, 0xE3, 0x4C, 0x15, 0x81, 0x02, 0x82, 0x02, 0x01,
+    0x00, 0x8E, 0x0A, 0x47, 0xE5, 0xED, 0xB3, 0xC6, 0xE8, 0x0B, 0xAE, 0x3B,
+    0xCE, 0x6D, 0xB1, 0x22, 0xB0, 0x99, 0x0C, 0xAF, 0xEF, 0xA6, 0x07, 0x59,
+    0x47, 0xE6, 0x40, 0xFD, 0x37, 0x49, 0x01, 0xAC, 0x34, 0x2D, 0x4D, 0x56,
+    0xA2, 0xE1, 0xC7, 0x97, 0x51, 0x5A, 0x08, 0x6E, 0x0F, 0x4E, 0xFA, 0x73,
+    0x89, 0x86, 0x96, 0xC3, 0x84, 0x2F, 0x45, 0xBB, 0x33, 0x1B, 0x16, 0x18,
+    0xBC, 0xE6, 0x80, 0x7B, 0x96, 0x13, 0x2A, 0x27, 0xF7, 0x1A, 0x28, 0x1C,
+    0x4C, 0x5D, 0xDA, 0x5D, 0x2E, 0x95, 0x1E, 0x86, 0xBB, 0x88, 0x1C, 0xFA,
+    0xD8, 0x80, 0x29, 0xE3, 0xD7, 0x8F, 0x11, 0xAC, 0x32, 0xED, 0x8C, 0xD8,
+    0x5E, 0x57, 0x60, 0xAE, 0x94, 0x0B, 0xC7, 0xD0, 0x5C, 0x89, 0x36, 0x7A,
+    0xFB, 0xD1, 0x9F, 0x25, 0x81, 0x68, 0x0E, 0x94, 0x4A, 0x37, 0xC3, 0xC0,
+    0x01, 0x62, 0x99, 0xAF, 0x5A, 0x4A, 0x46, 0x1E, 0xA4, 0x73, 0xBE, 0xEF,
+    0x36, 0xCF, 0x81, 0x1B, 0x72, 0x87, 0x73, 0x15, 0x06, 0x79, 0x1E, 0xE9,
+    0xD3, 0x7D, 0xD7, 0x91, 0x24, 0x8A, 0x4F, 0x5E, 0x9B, 0x65, 0x39, 0x10,
+    0x84, 0x8A, 0x87, 0xC6, 0xCA, 0x43, 0x63, 0x76, 0xD9, 0x68, 0xFF, 0x55,
+    0x82, 0x71, 0x79, 0xF2, 0x25, 0xE7, 0x47, 0x6E, 0xB4, 0xA7, 0xC0, 0x11,
+    0x15, 0x15, 0xBB, 0x9C, 0x18, 0x25, 0x63, 0x66, 0x32, 0x8A, 0x8C, 0x17,
+    0xE2, 0x00, 0x65, 0xCD, 0xE0, 0x49, 0xA6, 0x51, 0x61, 0x0B, 0xE9, 0xD1,
+    0xF9, 0x76, 0xC8, 0x89, 0xF6, 0xB7, 0x7A, 0xA1, 0x62, 0x9C, 0x9C, 0x55,
+    0x9B, 0x09, 0x57, 0xDB, 0xF7, 0xE2, 0x12, 0xCC, 0x52, 0x80, 0x03, 0x01,
+    0xF5, 0xC7, 0x58, 0xF8, 0x53, 0x49, 0x8A, 0xB1, 0x2F, 0xBF, 0xF6, 0x7B,
+    0x4E, 0x6D, 0x01, 0x9E, 0x81, 0xFB, 0xE7, 0xD3, 0x5D, 0xFD, 0xF6, 0xA5,
+    0x50, 0x64, 0x29, 0x36, 0x10, 0x6F, 0x01, 0x9C, 0xB7, 0x9F, 0x60, 0xD9,
+    0x25, 0xBA, 0x82, 0xFF, 0xCB, 0x0A, 0xD2, 0x28, 0xC5, 0xF4, 0x75, 0xF8,
+    0xC7, 0x6A, 0xC7, 0xF9, 0xEA, 0x49, 0x3D, 0x92, 0x36, 0x16, 0x00, 0x7E,
+    0x38, 0x69, 0xCC, 0x54, 0xF1, 0x7A, 0xB9, 0xC7, 0x94, 0x72, 0xBA, 0xF9,
+    0x14, 0x42, 0xFB, 0xC2, 0x42, 0x98, 0x4F, 0xF1, 0x0B, 0xA0, 0xEF, 0xDB,
+    0xF9, 0x41, 0xDE, 0x9E, 0x58, 0xAC, 0xEA, 0xC6, 0x0C, 0x22, 0x6F, 0xC6,
+    0xA5, 0xC7, 0x44, 0x70, 0x4F, 0x07, 0xD8, 0x84, 0x57, 0x38, 0x60, 0x70,
+    0xED, 0xEE, 0xF6, 0x35, 0x0C, 0x83, 0x65, 0xB5, 0x7E, 0x86, 0x85, 0x44,
+    0x1B, 0x59, 0x18, 0xC3, 0x9C, 0x4E, 0x62, 0xD2, 0x48, 0x33, 0x79, 0x6B,
+    0x8B, 0x79, 0x20, 0x18, 0xEC, 0x8A, 0x90, 0x37, 0xC5, 0xE3, 0x6E, 0x0D,
+    0xD7, 0xC7, 0xA1, 0xA9, 0xE5, 0xB5, 0x35, 0x87, 0xE2, 0x90, 0x74, 0x21,
+    0x7D, 0xD0, 0xD7, 0xD1, 0xE4, 0x11, 0x2B, 0x27, 0x43, 0x50, 0xEC, 0x71,
+    0x38, 0x18, 0x6E, 0xC2, 0xD1, 0xDE, 0x78, 0x90, 0x38, 0xBD, 0x58, 0x66,
+    0xE8, 0x58, 0x0D, 0x64, 0xB5, 0x50, 0x02, 0x14, 0x79, 0xF0, 0x3B, 0x0D,
+    0x9D, 0xF0, 0xDA, 0x95, 0x39, 0xCF, 0xDA, 0x28, 0xF4, 0x6F, 0xA5, 0xEA,
+    0x6E, 0x17, 0xF6, 0x30, 0xD5, 0xD2, 0x79, 0xCD, 0xCD, 0x2B, 0x08, 0x31,
+    0x50, 0xBB, 0xDD, 0x94, 0x7B, 0x99, 0xC7, 0x75, 0x34, 0x21, 0x00, 0x90,
+    0x2E, 0xDE, 0xC6, 0x1E, 0xD0, 0xA8, 0x01, 0xDC, 0x27, 0xB7, 0xEF, 0xAD,
+    0x64, 0xD3, 0xAC, 0xE0, 0x69, 0x04, 0x41, 0x48, 0x43, 0x43, 0xC7, 0x1B,
+    0xD2, 0x41, 0xE4, 0xC6, 0xBD, 0x4A, 0x08, 0xDD, 0x0D, 0x9E, 0x90, 0xD0,
+    0x4B, 0xD6, 0x60, 0x2B, 0x9F, 0xE4, 0x4B, 0x1F, 0x04, 0x2E, 0x13, 0xF9,
+    0xC1, 0x8E, 0x50, 0x7F, 0x9D, 0xC9, 0xA4, 0x11, 0xC9, 0x02, 0x82, 0x02,
+    0x00, 0x7E, 0x95, 0x9A, 0xDC, 0xFA, 0x2F, 0xC9, 0x17, 0xD0, 0x9D, 0xC6,
+    0x70, 0x35, 0x99, 0x00, 0xD1, 0x93, 0xA6, 0x32, 0x67, 0xD6, 0xEE, 0xD0,
+    0x00, 0x92, 0x43, 0xF9, 0x06, 0xE2, 0xB6, 0x0B, 0xEA, 0xDC, 0xBF, 0x7F,
+    0xB1, 0xEE, 0x48, 0xAD, 0x10, 0x00, 0xC0, 0xAE, 0xC8, 0xA7, 0x06, 0x6D,
+    0x0D, 0x01, 0xFF, 0x8A, 0x5E, 0x9C, 0xA0, 0x6C, 0x9E, 0x81, 0x9E, 0xF1,
+    0xB3, 0xF8, 0xAA, 0x2D, 0xEA, 0x13, 0xAB, 0x19, 0x46, 0xCA, 0xC3, 0x4B,
+    0x28, 0xF9, 0x23, 0x13, 0x83, 0x71, 0x98, 0x9E, 0xAC, 0xED, 0x34, 0xF7,
+    0xC3, 0x24, 0x9A, 0xD4, 0xF7, 0xA8, 0x84, 0xD4, 0x02, 0x8B, 0x4B, 0xA2,
+    0x13, 0x5F, 0x95, 0x56, 0xE5, 0x60, 0xE8, 0x3B, 0xB6, 0xA7, 0x5A, 0x1F,
+    0x71, 0x94, 0x16, 0x3D, 0x95, 0x73, 0x43, 0x6A, 0xBA, 0xB5, 0x69, 0xFD,
+    0xEB, 0x23, 0x92, 0xD2, 0xCF, 0xBF, 0x45, 0xCF, 0x26, 0x27, 0xAC, 0x46,
+    0x2A, 0x8C, 0xAF, 0xA1, 0x78, 0x27, 0x44, 0xE4, 0x73, 0x21, 0x31, 0xDC,
+    0xF0, 0x2F, 0xDF, 0x72, 0xDB, 0xAF, 0xD9, 0xC3, 0xBA, 0x1F, 0xC5, 0x15,
+    0xD7, 0x16, 0x65, 0xA9, 0x2D, 0xF7, 0x97, 0xDB, 0x95, 0x1F, 0xE3, 0x11,
+    0x16, 0xC6, 0x24, 0xA2, 0x84, 0x83, 0xD7, 0x5B, 0xDD, 0xCF, 0xF5, 0x66,
+    0x6A, 0x3D, 0x3C, 0x24, 0x78, 0xD1, 0xD7, 0x0D, 0x91, 0xC2, 0x10, 0x10,
+    0xD5, 0xA6, 0x78, 0xB2, 0x5F, 0x16, 0xAA, 0xBA, 0x73, 0xA6, 0xEC, 0xF3,
+    0x2B, 0xC6, 0x66, 0x7F, 0xFA, 0x4C, 0x81, 0xC4, 0x2E, 0x43, 0xB2, 0x99,
+    0xD8, 0x10, 0x4F, 0xE5, 0x8F, 0x87, 0x48, 0x60, 0x55, 0x83, 0xE5, 0x27,
+    0xB3, 0x7E, 0xDF, 0xBB, 0xE4, 0xCA, 0x02, 0x8A, 0x5A, 0x84, 0xC1, 0x82,
+    0xDA, 0xA1, 0x1A, 0xC1, 0x46, 0x5C, 0xA0, 0xB8, 0x4E, 0xD3, 0x64, 0x8A,
+    0x7A, 0xF3, 0x7C, 0x5A, 0xCC, 0x9D, 0xE8, 0x6C, 0x46, 0x20, 0xEC, 0x22,
+    0x1D, 0xE6, 0xF8, 0xDF, 0x4D, 0x73, 0xCC, 0xD8, 0x97, 0x09, 0x62, 0x18,
+    0x9E, 0x56, 0x95, 0xDD, 0xEC, 0xD8, 0x8A, 0x38, 0x0A, 0xE3, 0x4A, 0x92,
+    0x9F, 0x92, 0x08, 0x69, 0xD3, 0xFB, 0x1E, 0x3A, 0x72, 0xFA, 0xBB, 0xD9,
+    0x36, 0xE9, 0x98, 0xDB, 0x93, 0x41, 0x2F, 0x64, 0xC4, 0x88, 0x41, 0x45,
+    0x15, 0xBB, 0xC6, 0x3F, 0xD4, 0xB6, 0x93, 0x8C, 0x08, 0xD8, 0xDE, 0xA5,
+    0x51, 0x0A, 0x56, 0x1F, 0x66, 0xB6, 0x11, 0xE2, 0x7F, 0x8D, 0x64, 0x8A,
+    0xA5, 0xCF, 0x50, 0x87, 0x70, 0x3A, 0x12, 0x45, 0x83, 0x5E, 0xC7, 0x92,
+    0xE6, 0x42, 0x11, 0xCB, 0x9A, 0xAF, 0x42, 0x2B, 0x0F, 0xE9, 0xCF, 0x0D,
+    0x24, 0xFD, 0x80, 0x0B, 0xD2, 0x67, 0xD8, 0x48, 0xAF, 0xB4, 0x9E, 0x53,
+    0xC0, 0x49, 0xF1, 0x88, 0xFA, 0x0A, 0xE4, 0x9F, 0xCD, 0x7A, 0x6B, 0x56,
+    0x83, 0xEA, 0x78, 0x3E, 0x5E, 0xCA, 0xAD, 0xD7, 0xFA, 0xCF, 0x98, 0x6A,
+    0x49, 0x69, 0xD3, 0xE6, 0xB0, 0x68, 0x5E, 0x1F, 0x98, 0xA9, 0x8C, 0x32,
+    0xA9, 0x7E, 0xA3, 0x46, 0x90, 0x69, 0x1A, 0x76, 0x79, 0x78, 0x6B, 0xE1,
+    0xFA, 0x7C, 0xA5, 0x9E, 0x74, 0xB5, 0x6C, 0x20, 0x71, 0x3B, 0x97, 0x25,
+    0x09, 0xD1, 0x25, 0x46, 0x52, 0xA9, 0xB0, 0xDF, 0x9F, 0xCF, 0x77, 0x20,
+    0x31, 0x22, 0x4F, 0xEF, 0xF8, 0x61, 0x6B, 0x81, 0x16, 0xA4, 0xE1, 0x0C,
+    0x43, 0x7E, 0x62, 0xF8, 0x05, 0xC1, 0x77, 0x12, 0xAF, 0x51, 0xFE, 0xAC,
+    0xA5, 0xE6, 0x74, 0x63, 0x29, 0x12, 0x67, 0xAD, 0x67, 0x7E, 0xD0, 0x92,
+    0xFE, 0x9C, 0x3B, 0x22, 0xDF, 0xC7, 0xAF, 0x9A, 0x75, 0x8A, 0x97, 0xBD,
+    0x71, 0x61, 0xF8, 0xE3, 0x90, 0x82, 0x73, 0x1F, 0x22, 0xE5, 0xB6, 0xB2,
+    0xB3, 0x58, 0x6B, 0xF1, 0x76, 0xC8, 0x42, 0x7E, 0x4C
+};
+
+static const byte rsa_8192_sig[] = {
+    0xCA, 0x31, 0x6A, 0x1C, 0x54, 0x74, 0x93, 0x5C, 0x0C, 0xA3, 0xB5, 0x96,
+    0xB6, 0x64, 0xC8, 0x55, 0x37, 0x93, 0x69, 0x4E, 0x90, 0x03, 0x3B, 0x54,
+    0x8F, 0x83, 0x42, 0x0F, 0x7E, 0xC5, 0x33, 0x8A, 0x0E, 0x98, 0xA2, 0xF4,
+    0x86, 0xE0, 0x44, 0x27, 0xF5, 0xA2, 0xB8, 0x46, 0xD2, 0x56, 0x8D, 0x41,
+    0x29, 0x80, 0x64, 0x4D, 0x7A, 0x0D, 0x9F, 0x0E, 0x92, 0xC0, 0xF2, 0xA3,
+    0xD8, 0x6E, 0xAD, 0xEB, 0xD3, 0x7B, 0x4B, 0x93, 0x66, 0x0D, 0xD3, 0x46,
+    0x8C, 0x05, 0x01, 0xE4, 0x86, 0x2F, 0x73, 0x46, 0x0F, 0x6E, 0xDF, 0xFC,
+    0x19, 0x85, 0xB6, 0x0A, 0xFC, 0x31, 0x3B, 0xD4, 0x23, 0xF7, 0x82, 0x67,
+    0x07, 0x82, 0x28, 0xF3, 0x29, 0x3A, 0xEC, 0xA5, 0xB2, 0xA7, 0x7C, 0x17,
+    0x47, 0xEE, 0x61, 0xF4, 0xA0, 0x33, 0xAD, 0xB5, 0x3A, 0x3B, 0xF9, 0xA7,
+    0x59, 0xC6, 0x98, 0x70, 0x08, 0x94, 0x57, 0xDF, 0xE1, 0xEC, 0x01, 0xC5,
+    0xA0, 0xA7, 0xA4, 0xCD, 0xBE, 0x88, 0x7B, 0x6B, 0xE0, 0x2F, 0xFB, 0xF7,
+    0xD7, 0x71, 0x33, 0x3B, 0x09, 0x12, 0x20, 0x3F, 0x79, 0x08, 0x6D, 0x21,
+    0x4E, 0xFE, 0xEE, 0x73, 0x5E, 0x7D, 0x84, 0x3E, 0x3F, 0x5D, 0x0E, 0xA1,
+    0x13, 0xC7, 0xC5, 0xD9, 0x4E, 0x86, 0x8E, 0x00, 0x80, 0x44, 0x63, 0xAD,
+    0xF8, 0xBD, 0x2C, 0xC2, 0x69, 0xD7, 0xC1, 0x78, 0x8A, 0xAD, 0x55, 0x6A,
+    0x0B, 0xB8, 0xEF, 0xAA, 0xC2, 0x3B, 0x31, 0x1B, 0x5D, 0xDF, 0x3E, 0x05,
+    0xC9, 0xB9, 0x44, 0x7C, 0x89, 0x7C, 0xC0, 0x01, 0x71, 0xFF, 0x73, 0x0C,
+    0xBF, 0x38, 0x8B, 0xCC, 0x52, 0xD8, 0x22, 0xF7, 0xB6, 0x87, 0xF9, 0x62,
+    0x14, 0x54, 0x7C, 0xF9, 0x77, 0x11, 0x62, 0xD1, 0x6C, 0x42, 0x55, 0x01,
+    0xF1, 0x38, 0xD3, 0xB8, 0xA0, 0x57, 0xD6, 0x13, 0x03, 0x47, 0x5B, 0x24,
+    0x58, 0xAC, 0x26, 0xC7, 0x7F, 0x0B, 0x84, 0x1A, 0xFF, 0x47, 0x54, 0xA2,
+    0x06, 0xFD, 0x96, 0x62, 0x79, 0x05, 0x25, 0x53, 0xF7, 0x23, 0xFC, 0x06,
+    0x42, 0xD4, 0x79, 0x25, 0x2C, 0x63, 0xE9, 0x10, 0x53, 0x1A, 0xA2, 0x40,
+    0x2D, 0x2E, 0xA8, 0x69, 0x88, 0x67, 0x0C, 0xFF, 0xA6, 0x3D, 0x27, 0x5D,
+    0xC3, 0xCD, 0x46, 0xF7, 0x3F, 0x33, 0x50, 0xC7, 0x73, 0x45, 0xC1, 0x84,
+    0x9A, 0x4A, 0xF6, 0x42, 0x9A, 0x18, 0x95, 0xBD, 0x25, 0x36, 0x16, 0xC6,
+    0x34, 0xB7, 0x9D, 0xE3, 0x60, 0x1B, 0xE4, 0x56, 0xA9, 0xE2, 0x5B, 0xA3,
+    0x65, 0x17, 0xE0, 0x62, 0xEC, 0x32, 0x47, 0xE1, 0xA5, 0x3E, 0xCD, 0x79,
+    0xFE, 0xE9, 0x7E, 0x51, 0x33, 0x7A, 0x65, 0x22, 0xE5, 0xDE, 0xF0, 0x14,
+    0x07, 0x19, 0x0D, 0x6F, 0xEA, 0xCE, 0x01, 0x7D, 0xD8, 0xDC, 0xDA, 0x67,
+    0x3D, 0xFA, 0x35, 0xDE, 0xF5, 0xB9, 0xAF, 0xD7, 0xF2, 0x3D, 0x27, 0x4A,
+    0xD4, 0x42, 0x9E, 0x5B, 0xA4, 0x73, 0xFD, 0x2F, 0x6B, 0x39, 0x7E, 0xDA,
+    0x5B, 0xCA, 0x5C, 0x9C, 0x68, 0x2F, 0xF7, 0xE2, 0xBA, 0x3A, 0xF3, 0x3A,
+    0x99, 0x62, 0x11, 0x5B, 0x1E, 0x64, 0x37, 0x2D, 0x50, 0x00, 0xEC, 0xB1,
+    0x38, 0xCC, 0x6B, 0x68, 0x56, 0x70, 0x79, 0x52, 0x1C, 0x18, 0xD4, 0x43,
+    0xE7, 0xD7, 0xE4, 0xA5, 0x9C, 0x3E, 0xDE, 0x6B, 0x49, 0x30, 0xCC, 0x3D,
+    0x85, 0xE0, 0xDB, 0x47, 0x57, 0x56, 0x98, 0xF2, 0x0C, 0x11, 0xC4, 0xDF,
+    0x24, 0x6B, 0xC7, 0xBF, 0x0E, 0x31, 0xC8, 0x32, 0x11, 0xA1, 0x57, 0x97,
+    0xCA, 0x0E, 0x7E, 0x11, 0x3A, 0xA3, 0x8E, 0x4A, 0x06, 0xA6, 0xA5, 0x68,
+    0x2B, 0xCA, 0x9D, 0x6A, 0x1D, 0x27, 0xCF, 0x35, 0x08, 0x66, 0x68, 0x98,
+    0xB3, 0x2A, 0x01, 0x04, 0xF9, 0xBE, 0x9F, 0xC7, 0x60, 0xB2, 0x22, 0xAB,
+    0x80, 0xB3, 0x88, 0xC5, 0x4A, 0xAE, 0xBF, 0xED, 0x61, 0x4D, 0xA2, 0x3B,
+    0x07, 0x0D, 0x34, 0xA7, 0x1B, 0xF3, 0x4F, 0xAF, 0x15, 0xF5, 0xA1, 0x7E,
+    0x1A, 0xBF, 0xA2, 0x12, 0x75, 0x84, 0xB2, 0x96, 0xB9, 0x49, 0x04, 0x59,
+    0xE3, 0x67, 0xA0, 0x50, 0xB7, 0x70, 0xAE, 0xDD, 0x80, 0x04, 0xFE, 0xCC,
+    0xAC, 0x5D, 0xEE, 0x50, 0x8E, 0x55, 0xAC, 0x1F, 0x5F, 0x97, 0xDF, 0xBA,
+    0x13, 0xCA, 0x28, 0xFA, 0x7C, 0xF3, 0xB0, 0xF7, 0x7C, 0x4B, 0xA3, 0x41,
+    0x5D, 0x5E, 0x31, 0xEA, 0x8C, 0xA7, 0x1E, 0xD8, 0x67, 0x67, 0xDB, 0x86,
+    0xF8, 0x79, 0x60, 0xA8, 0x50, 0x8F, 0xA7, 0x36, 0xF1, 0x2C, 0x42, 0xF1,
+    0x6D, 0x4B, 0x9A, 0xB4, 0xF5, 0xA0, 0x9A, 0xC1, 0x80, 0x8C, 0x85, 0x2B,
+    0xA0, 0x83, 0x05, 0x74, 0x35, 0x02, 0xDE, 0xAE, 0x84, 0x52, 0x25, 0x82,
+    0xE6, 0x3C, 0x10, 0xE1, 0xE9, 0xA2, 0xB2, 0xF6, 0xBB, 0x5C, 0x38, 0x3B,
+    0x5C, 0x29, 0xF7, 0x66, 0x6C, 0xD4, 0xD3, 0x5A, 0x3F, 0x10, 0x99, 0xC5,
+    0xF8, 0xB2, 0x4F, 0x90, 0x08, 0xAF, 0x8D, 0x9B, 0xA7, 0x4A, 0x0D, 0xFF,
+    0xDA, 0x47, 0xEC, 0xF3, 0xF2, 0xEC, 0x24, 0x4C, 0xD5, 0x3F, 0x8B, 0x5F,
+    0x61, 0x62, 0xB4, 0x78, 0x81, 0xC7, 0xDD, 0x15, 0x24, 0xDD, 0x13, 0x27,
+    0x2D, 0x9F, 0x6C, 0xB2, 0xCD, 0xA2, 0xD1, 0x93, 0x51, 0x54, 0x75, 0xF9,
+    0x18, 0xD9, 0xF3, 0xA3, 0x0D, 0xC2, 0x56, 0x00, 0x42, 0x90, 0xF4, 0x10,
+    0x6F, 0x04, 0x01, 0x40, 0xDD, 0xDD, 0x2A, 0x35, 0xEF, 0x53, 0xB9, 0x0D,
+    0x61, 0xA2, 0x49, 0xAB, 0xDF, 0x24, 0x25, 0xCF, 0x62, 0xDD, 0xF6, 0x9B,
+    0x60, 0x60, 0xD9, 0xFD, 0x39, 0xEA, 0x74, 0xC9, 0x0E, 0x41, 0x63, 0x5C,
+    0xE2, 0x7C, 0x48, 0x93, 0x4B, 0x9A, 0x82, 0x91, 0xE4, 0xB5, 0x56, 0x6E,
+    0xF1, 0x71, 0xEB, 0x02, 0xC2, 0x43, 0x9A, 0x31, 0x65, 0xF6, 0x8E, 0x6B,
+    0x5E, 0xA1, 0x23, 0x3B, 0x0A, 0x4F, 0x10, 0xAF, 0x75, 0xA6, 0xDC, 0x4D,
+    0x91, 0x7E, 0x06, 0xB3, 0xC6, 0x04, 0x40, 0xC4, 0x22, 0xFF, 0x6E, 0x43,
+    0x7E, 0x3F, 0xFC, 0x07, 0xA2, 0xD0, 0xF1, 0x48, 0x03, 0x16, 0x0F, 0xF4,
+    0xA7, 0xB8, 0x52, 0xBB, 0xA5, 0xA9, 0xFB, 0xEA, 0x42, 0x07, 0x60, 0xDA,
+    0x64, 0xF7, 0x61, 0xD9, 0xB4, 0x2A, 0x8C, 0x62, 0xFA, 0x9F, 0xAA, 0xDD,
+    0x2E, 0x52, 0x46, 0xA0, 0xE0, 0xD4, 0x8E, 0x20, 0xA3, 0x85, 0xD2, 0x92,
+    0xD5, 0x71, 0x08, 0x51, 0xF1, 0x59, 0xC5, 0x93, 0x36, 0x35, 0x6A, 0xCA,
+    0xEF, 0x84, 0xA0, 0x2A, 0x69, 0x98, 0x04, 0xD5, 0xEE, 0xCA, 0x51, 0xA2,
+    0x55, 0x35, 0xAA, 0xA3, 0xC1, 0x97, 0xBE, 0x1C, 0xA6, 0x35, 0x08, 0xC5,
+    0xB1, 0x52, 0x05, 0xB5, 0x13, 0xFA, 0xF1, 0x7E, 0xC1, 0x14, 0x64, 0xE3,
+    0xBA, 0xC8, 0x97, 0x81, 0x4F, 0xF6, 0xF5, 0x08, 0xE8, 0x0F, 0xD5, 0xE6,
+    0xD6, 0xEF, 0x8C, 0x7E, 0x59, 0x65, 0xCA, 0xA5, 0x8D, 0xAD, 0x6E, 0xEA,
+    0x6D, 0x96, 0xEC, 0x9D, 0x5E, 0xBC, 0x4B, 0x84, 0xCE, 0x22, 0xF5, 0x21,
+    0xAA, 0x40, 0xC5, 0xE8, 0x7A, 0x32, 0xB2, 0xC8, 0x77, 0x59, 0xCE, 0xAD,
+    0x49, 0xD6, 0x37, 0x39, 0x93, 0x99, 0x81, 0x1B, 0x51, 0x1B, 0x9D, 0x88,
+    0x8E, 0x18, 0xFB, 0x98, 0x82, 0x98, 0x81, 0xBF, 0x4E, 0x6F, 0x34, 0xFB,
+    0x9E, 0x53, 0x17, 0xD2, 0x70, 0xE0, 0xEB, 0x2D, 0x6D, 0xDD, 0xB7, 0xE2,
+    0x12, 0x8C, 0xF1, 0x85, 0x09, 0x8B, 0xA8, 0xD7, 0xF1, 0x8C, 0x12, 0x83,
+    0x52, 0xF0, 0x49, 0x53, 0xE6, 0x57, 0xD4, 0x61, 0xC6, 0x3D, 0x8B, 0x6A,
+    0x2B, 0x79, 0x77, 0x6C, 0x8F, 0xF9, 0x23, 0xCB, 0x67, 0x5F, 0x87, 0x60,
+    0x83, 0xFE, 0xE8, 0x6F, 0x57, 0x22, 0xF4, 0xB7, 0xC0, 0xD9, 0x8D, 0x72,
+    0x39, 0x65, 0x2D, 0x26
+};
+
+static int rsa_8192_test(WC_RNG* rng)
+{
+    int         ret;
+    RsaKey      key;
+    word32      idx = 0;
+    const char* inStr = "Everyone gets Friday off.";
+    word32      inLen = (word32)XSTRLEN(inStr);
+    byte*       sig;
+    word32      sigLen = (word32)sizeof(rsa_8192_sig);
+
+    sig = (byte*)XMALLOC(sizeof(rsa_8192_sig), HEAP_HINT,
+                                                       DYNAMIC_TYPE_TMP_BUFFER);
+    if (sig == NULL)
+        return -7919;
+
+    ret = wc_InitRsaKey_ex(&key, HEAP_HINT, devId);
+    if (ret != 0) {
+        XFREE(sig, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+        return -7920;
+    }
+    ret = wc_RsaPrivateKeyDecode(rsa_8192_key_der, &idx, &key,
+                                             (word32)sizeof(rsa_8192_key_der));
+    if (ret != 0)
+        ERROR_OUT(-7921, exit_rsa_8192);
+    if (wc_SignatureGetSize(WC_SIGNATURE_TYPE_RSA_W_ENC, &key,
+                                  sizeof(key)) != (int)sizeof(rsa_8192_sig)) {
+        ERROR_OUT(-7922, exit_rsa_8192);
+    }
+    ret = wc_SignatureGenerate(WC_HASH_TYPE_SHA256, WC_SIGNATURE_TYPE_RSA_W_ENC,
+                        (const byte*)inStr, inLen, sig, &sigLen, &key,
+                        sizeof(key), rng);
+    if (ret != 0)
+        ERROR_OUT(-7923, exit_rsa_8192);
+    if (sigLen != sizeof(rsa_8192_sig) ||
+                            XMEMCMP(sig, rsa_8192_sig, sigLen) != 0) {
+        ERROR_OUT(-7924, exit_rsa_8192);
+    }
+
+    ret = wc_SignatureVerify(WC_HASH_TYPE_SHA256, WC_SIGNATURE_TYPE_RSA_W_ENC,
+                        (const byte*)inStr, inLen, rsa_8192_sig,
+                        sizeof(rsa_8192_sig), &key, sizeof(key));
+    if (ret != 0)
+        ERROR_OUT(-7925, exit_rsa_8192);
+
+    sig[sizeof(rsa_8192_sig) / 2] ^= 0x01;
+    ret = wc_SignatureVerify(WC_HASH_TYPE_SHA256, WC_SIGNATURE_TYPE_RSA_W_ENC,
+                        (const byte*)inStr, inLen, sig, sigLen, &key,
+                        sizeof(key));
+    if (ret == 0)
+        ERROR_OUT(-7926, exit_rsa_8192);
+    ret = 0;
+
+exit_rsa_8192:
+    wc_FreeRsaKey(&key);
+    XFREE(sig, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+
+    return ret;
+}
+#endif /* WOLFSSL_SP_8192 && !NO_ASN && !NO_SIG_WRAPPER */
+
+#if defined(WC_RSA_BLINDING_CACHE) && defined(WOLFSSL_PUBLIC_MP) && \
+    !defined(NO_ASN) && !defined(HAVE_USER_RSA) && \
+    !defined(WOLFSSL_RSA_PUBLIC_ONLY) && !defined(WOLFSSL_RSA_VERIFY_ONLY)
+/* Cached blinding value is r^e - after the key is changed to another
+ * exponent pair with the same modulus, signatures must still verify. */
+static int rsa_blinding_exp_test(const byte* der, word32 derSz, WC_RNG* rng)
+{
+    int    ret;
+    int    sigSz;
+    word32 idx = 0;
+    RsaKey key;
+    mp_int p1, q1, phi;
+    const char* msg = "Everyone gets Friday off.";
+    byte   sig[RSA_TEST_BYTES];
+    byte   plain[RSA_TEST_BYTES];
+
+    XMEMSET(&key, 0, sizeof(key));
+    ret = mp_init_multi(&p1, &q1, &phi, NULL, NULL, NULL);
+    if (ret != MP_OKAY)
+        return -7927;
+    ret = wc_InitRsaKey_ex(&key, HEAP_HINT, devId);
+    if (ret != 0) {
+        mp_clear(&p1); mp_clear(&q1); mp_clear(&phi);
+        return -7928;
+    }
+    ret = wc_RsaPrivateKeyDecode(der, &idx, &key, derSz);
+    if (ret != 0)
+        ERROR_OUT(-7929, exit_rsa_blind);
+
+    /* fill the blinding cache */
+    ret = wc_RsaSSL_Sign((const byte*)msg, (word32)XSTRLEN(msg), sig,
+                         sizeof(sig), &key, rng);
+    if (ret <= 0)
+        ERROR_OUT(-7930, exit_rsa_blind);
+
+    /* e = 65539, d = 1/e mod (p-1)(q-1) */
+    ret = mp_sub_d(&key.p, 1, &p1);
+    if (ret == MP_OKAY)
+        ret = mp_sub_d(&key.q, 1, &q1);
+    if (ret == MP_OKAY)
+        ret = mp_mul(&p1, &q1, &phi);
+    if (ret == MP_OKAY)
+        ret = mp_set_int(&key.e, 65539);
+    if (ret == MP_OKAY)
+        ret = mp_invmod(&key.e, &phi, &key.d);
+    if (ret == MP_OKAY)
+        ret = mp_mod(&key.d, &p1, &key.dP);
+    if (ret == MP_OKAY)
+        ret = mp_mod(&key.d, &q1, &key.dQ);
+    if (ret != MP_OKAY)
+        ERROR_OUT(-7931, exit_rsa_blind);
+
+    ret = wc_RsaSSL_Sign((const byte*)msg, (word32)XSTRLEN(msg), sig,
+                         sizeof(sig), &key, rng);
+    if (ret <= 0)
+        ERROR_OUT(-7932, exit_rsa_blind);
+    sigSz = ret;
+    ret = wc_RsaSSL_Verify(sig, (word32)sigSz, plain, sizeof(plain), &key);
+    if (ret != (int)XSTRLEN(msg))
+        ERROR_OUT(-7933, exit_rsa_blind);
+    if (XMEMCMP(plain, msg, ret) != 0)
+        ERROR_OUT(-7934, exit_rsa_blind);
+    ret = 0;
+
+exit_rsa_blind:
+    wc_FreeRsaKey(&key);
+    mp_clear(&p1);
+    mp_clear(&q1);
+    mp_clear(&phi);
 
-    if (ret >= 0)
-        ret = 0;
     return ret;
 }
-#endif /* !NO_RSA && HAVE_ECC && WOLFSSL_CERT_GEN */
+#endif
 
 #ifdef WOLFSSL_KEY_GEN
 static int rsa_keygen_test(WC_RNG* rng)
@@ -12989,6 +14446,14 @@ int rsa_test(void)
         goto exit_rsa;
 #endif
 
+#if defined(WC_RSA_BLINDING_CACHE) && defined(WOLFSSL_PUBLIC_MP) && \
+    !defined(NO_ASN) && !defined(HAVE_USER_RSA) && \
+    !defined(WOLFSSL_RSA_PUBLIC_ONLY) && !defined(WOLFSSL_RSA_VERIFY_ONLY)
+    ret = rsa_blinding_exp_test(tmp, (word32)bytes, &rng);
+    if (ret != 0)
+        goto exit_rsa;
+#endif
+
 #ifdef WC_RSA_NONBLOCK
     ret = rsa_nb_test(&key, in, inLen, out, outSz, plain, plainSz, &rng);
     if (ret != 0)
@@ -13070,6 +14535,33 @@ int rsa_test(void)
     }
     TEST_SLEEP();
 
+#ifdef WC_RSA_BLINDING_CACHE
+    /* blinding values updated and regenerated - signature the same */
+    {
+        int i;
+        int sigSz = ret;
+
+        for (i = 0; i < 2 * WC_RSA_BLINDING_UPDATES + 1; i++) {
+            do {
+#if defined(WOLFSSL_ASYNC_CRYPT)
+                ret = wc_AsyncWait(ret, &key.asyncDev,
+                                                     WC_ASYNC_FLAG_CALL_AGAIN);
+#endif
+                if (ret >= 0) {
+                    ret = wc_RsaSSL_Sign(in, inLen, plain, plainSz, &key,
+                                                                         &rng);
+                }
+            } while (ret == WC_PENDING_E);
+            if (ret != sigSz) {
+                ERROR_OUT(-7835, exit_rsa);
+            }
+            if (XMEMCMP(plain, out, sigSz) != 0) {
+                ERROR_OUT(-7836, exit_rsa);
+            }
+        }
+    }
+#endif
+
 #elif defined(WOLFSSL_PUBLIC_MP)
     (void)outSz;
     (void)inLen;
@@ -13572,6 +15064,14 @@ int rsa_test(void)
         goto exit_rsa;
 #endif
 
+#if defined(WOLFSSL_SP_8192) && !defined(NO_ASN) && \
+    !defined(NO_SIG_WRAPPER) && !defined(WOLFSSL_RSA_PUBLIC_ONLY) && \
+    !defined(WOLFSSL_RSA_VERIFY_ONLY)
+    ret = rsa_8192_test(&rng);
+    if (ret != 0)
+        goto exit_rsa;
+#endif
+
 #ifdef WOLFSSL_CERT_GEN
     /* Make Cert / Sign example for RSA cert and RSA CA */
     ret = rsa_certgen_test(&key, &keypub, &rng, tmp);
@@ -14244,7 +15744,9 @@ static int dh_test_check_pubvalue(void)
 
 #if defined(HAVE_FFDHE)
 
-#ifdef HAVE_FFDHE_3072
+#if defined(HAVE_FFDHE_8192) && defined(WOLFSSL_SP_8192)
+    #define FFDHE_KEY_SIZE      (8192/8)
+#elif defined(HAVE_FFDHE_3072)
     #define FFDHE_KEY_SIZE      (3072/8)
 #else
     #define FFDHE_KEY_SIZE      (2048/8)
@@ -14324,6 +15826,38 @@ static int dh_test_ffdhe(WC_RNG *rng, const DhParams* params)
         ERROR_OUT(-7834, done);
     }
 
+    /* check public key against a generic calculation from private key */
+    ret = wc_DhCheckKeyPair(&key, pub, pubSz, priv, privSz);
+    if (ret != 0) {
+        ERROR_OUT(-7837, done);
+    }
+
+#ifdef HAVE_FFDHE_Q
+    /* safe prime group with q uses short private keys too */
+    wc_FreeDhKey(&key2);
+    ret = wc_InitDhKey_ex(&key2, HEAP_HINT, devId);
+    if (ret != 0) {
+        ERROR_OUT(-7838, done);
+    }
+    ret = wc_DhSetCheckKey(&key2, params->p, params->p_len, params->g,
+                           params->g_len, params->q, params->q_len, 1, rng);
+    if (ret != 0) {
+        ERROR_OUT(-7839, done);
+    }
+    privSz2 = (word32)sizeof(priv2);
+    ret = wc_DhGenerateKeyPair(&key2, rng, priv2, &privSz2, pub2, &pubSz2);
+#if defined(WOLFSSL_ASYNC_CRYPT)
+    ret = wc_AsyncWait(ret, &key2.asyncDev, WC_ASYNC_FLAG_NONE);
+#endif
+    if (ret != 0) {
+        ERROR_OUT(-7840, done);
+    }
+    ret = wc_DhCheckKeyPair(&key2, pub2, pubSz2, priv2, privSz2);
+    if (ret != 0) {
+        ERROR_OUT(-7841, done);
+    }
+#endif
+
 done:
     wc_FreeDhKey(&key);
     wc_FreeDhKey(&key2);
@@ -14514,6 +16048,13 @@ int dh_test(void)
             printf("error with FFDHE 3072\n");
     }
     #endif
+    #if defined(HAVE_FFDHE_8192) && defined(WOLFSSL_SP_8192)
+    if (ret == 0) {
+        ret = dh_test_ffdhe(&rng, wc_Dh_ffdhe8192_Get());
+        if (ret != 0)
+            printf("error with FFDHE 8192\n");
+    }
+    #endif
 
     wc_FreeDhKey(&key);
     keyInit = 0;
@@ -19981,6 +21522,233 @@ exit:
 }
 #endif
 
+#if defined(HAVE_ECC_SIGN) && defined(HAVE_ECC_VERIFY) && !defined(NO_ASN) && \
+    !defined(NO_ECC256) && !defined(WOLFSSL_ATECC508A) && \
+    !defined(WOLFSSL_ATECC608A)
+#define ECC_BATCH_KEYS  4
+#define ECC_BATCH_SIGS  20
+static int ecc_test_verify_batch(WC_RNG* rng)
+{
+    int         ret = 0;
+    int         i;
+    ecc_key*    keys;
+    ecc_key*    key[ECC_BATCH_SIGS];
+    byte*       sigs;
+    const byte* sig[ECC_BATCH_SIGS];
+    word32      sigLen[ECC_BATCH_SIGS];
+    byte        hashes[ECC_BATCH_SIGS][WC_SHA256_DIGEST_SIZE];
+    const byte* hash[ECC_BATCH_SIGS];
+    word32      hashLen[ECC_BATCH_SIGS];
+    int         res[ECC_BATCH_SIGS];
+
+    keys = (ecc_key*)XMALLOC(sizeof(ecc_key) * ECC_BATCH_KEYS, HEAP_HINT,
+                                                        DYNAMIC_TYPE_TMP_BUFFER);
+    sigs = (byte*)XMALLOC(ECC_MAX_SIG_SIZE * ECC_BATCH_SIGS, HEAP_HINT,
+                                                        DYNAMIC_TYPE_TMP_BUFFER);
+    if (keys == NULL || sigs == NULL) {
+        ret = -9752;
+        goto done;
+    }
+    XMEMSET(keys, 0, sizeof(ecc_key) * ECC_BATCH_KEYS);
+    for (i = 0; i < ECC_BATCH_KEYS; i++) {
+        ret = wc_ecc_init_ex(&keys[i], HEAP_HINT, devId);
+        if (ret != 0) {
+            ret = -9753;
+            goto done;
+        }
+    }
+    /* last key on another curve when available - verified on its own */
+    for (i = 0; i < ECC_BATCH_KEYS; i++) {
+    #if defined(HAVE_ECC384) || defined(HAVE_ALL_CURVES)
+        if (i == ECC_BATCH_KEYS - 1)
+            ret = wc_ecc_make_key(rng, 48, &keys[i]);
+        else
+    #endif
+            ret = wc_ecc_make_key(rng, 32, &keys[i]);
+    #if defined(WOLFSSL_ASYNC_CRYPT)
+        ret = wc_AsyncWait(ret, &keys[i].asyncDev, WC_ASYNC_FLAG_NONE);
+    #endif
+        if (ret != 0) {
+            ret = -9754;
+            goto done;
+        }
+    }
+
+    for (i = 0; i < ECC_BATCH_SIGS; i++) {
+        XMEMSET(hashes[i], (byte)i, sizeof(hashes[i]));
+        hash[i]    = hashes[i];
+        hashLen[i] = (word32)sizeof(hashes[i]);
+        key[i]     = &keys[i % ECC_BATCH_KEYS];
+        sig[i]     = sigs + i * ECC_MAX_SIG_SIZE;
+        sigLen[i]  = ECC_MAX_SIG_SIZE;
+        do {
+        #if defined(WOLFSSL_ASYNC_CRYPT)
+            ret = wc_AsyncWait(ret, &key[i]->asyncDev,
+                                                    WC_ASYNC_FLAG_CALL_AGAIN);
+        #endif
+            if (ret >= 0) {
+                ret = wc_ecc_sign_hash(hash[i], hashLen[i],
+                    sigs + i * ECC_MAX_SIG_SIZE, &sigLen[i], rng, key[i]);
+            }
+        } while (ret == WC_PENDING_E);
+        if (ret != 0) {
+            ret = -9755;
+            goto done;
+        }
+    }
+
+    ret = wc_ecc_verify_hash_batch(sig, sigLen, hash, hashLen, res, key,
+                                                               ECC_BATCH_SIGS);
+    if (ret != 0) {
+        ret = -9756;
+        goto done;
+    }
+    for (i = 0; i < ECC_BATCH_SIGS; i++) {
+        if (res[i] != 1) {
+            ret = -9757;
+            goto done;
+        }
+    }
+
+    /* wrong hash, changed r and the signature of another key */
+    hashes[3][0] ^= 0x01;
+    sigs[17 * ECC_MAX_SIG_SIZE + 10] ^= 0x01;
+    sig[6] = sig[5];
+    sigLen[6] = sigLen[5];
+    ret = wc_ecc_verify_hash_batch(sig, sigLen, hash, hashLen, res, key,
+                                                               ECC_BATCH_SIGS);
+    if (ret != 0) {
+        ret = -9758;
+        goto done;
+    }
+    for (i = 0; i < ECC_BATCH_SIGS; i++) {
+        if (res[i] != (i != 3 && i != 17 && i != 6)) {
+            ret = -9759;
+            goto done;
+        }
+    }
+
+    /* malformed DER - outer SEQUENCE tag broken */
+    sigs[9 * ECC_MAX_SIG_SIZE] ^= 0x01;
+    ret = wc_ecc_verify_hash_batch(sig, sigLen, hash, hashLen, res, key,
+                                                               ECC_BATCH_SIGS);
+    if (ret == 0) {
+        ret = -9771;
+        goto done;
+    }
+    for (i = 0; i < ECC_BATCH_SIGS; i++) {
+        if (res[i] != (i != 3 && i != 17 && i != 6 && i != 9)) {
+            ret = -9772;
+            goto done;
+        }
+    }
+    ret = 0;
+
+    if (wc_ecc_verify_hash_batch(NULL, sigLen, hash, hashLen, res, key,
+                                            ECC_BATCH_SIGS) != ECC_BAD_ARG_E) {
+        ret = -9760;
+        goto done;
+    }
+
+done:
+    if (keys != NULL) {
+        for (i = 0; i < ECC_BATCH_KEYS; i++)
+            wc_ecc_free(&keys[i]);
+        XFREE(keys, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    }
+    XFREE(sigs, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+
+    return ret;
+}
+#endif
+
+#if defined(WC_ECC_PRECOMP) && defined(HAVE_ECC_SIGN) && !defined(NO_ASN)
+#define ECC_PRECOMP_SIGS  8
+static int ecc_test_precompute_curve(WC_RNG* rng, int keySize)
+{
+    int     ret;
+    int     i, j;
+    int     verify;
+    const int bits[] = { ECC_PRECOMP_MIN_BITS, 5, ECC_PRECOMP_MAX_BITS };
+    ecc_key key;
+    byte    sig[ECC_PRECOMP_SIGS][ECC_MAX_SIG_SIZE];
+    word32  sigLen[ECC_PRECOMP_SIGS];
+    byte    hash[ECC_MAXSIZE];
+
+    ret = wc_ecc_init_ex(&key, HEAP_HINT, devId);
+    if (ret != 0)
+        return -9761;
+    ret = wc_ecc_make_key(rng, keySize, &key);
+    if (ret != 0)
+        ERROR_OUT(-9762, done);
+
+    for (i = 0; i < ECC_PRECOMP_SIGS; i++) {
+        XMEMSET(hash, (byte)i, sizeof(hash));
+        sigLen[i] = ECC_MAX_SIG_SIZE;
+        ret = wc_ecc_sign_hash(hash, keySize, sig[i], &sigLen[i], rng, &key);
+        if (ret != 0)
+            ERROR_OUT(-9763, done);
+    }
+
+    for (j = 0; j < (int)(sizeof(bits) / sizeof(*bits)); j++) {
+        ret = wc_ecc_set_precompute(&key, bits[j]);
+        if (ret != 0)
+            ERROR_OUT(-9764, done);
+        for (i = 0; i < ECC_PRECOMP_SIGS; i++) {
+            XMEMSET(hash, (byte)i, sizeof(hash));
+            ret = wc_ecc_verify_hash(sig[i], sigLen[i], hash, keySize, &verify,
+                                                                          &key);
+            if (ret != 0 || verify != 1)
+                ERROR_OUT(-9765, done);
+            hash[0] ^= 0x80;
+            ret = wc_ecc_verify_hash(sig[i], sigLen[i], hash, keySize, &verify,
+                                                                          &key);
+            if (ret != 0 || verify != 0)
+                ERROR_OUT(-9766, done);
+        }
+    }
+
+    /* new public key - the table is for the old one and is not used */
+    ret = wc_ecc_make_key(rng, keySize, &key);
+    if (ret != 0)
+        ERROR_OUT(-9767, done);
+    XMEMSET(hash, 0, sizeof(hash));
+    sigLen[0] = ECC_MAX_SIG_SIZE;
+    ret = wc_ecc_sign_hash(hash, keySize, sig[0], &sigLen[0], rng, &key);
+    if (ret == 0) {
+        ret = wc_ecc_verify_hash(sig[0], sigLen[0], hash, keySize, &verify,
+                                                                          &key);
+    }
+    if (ret != 0 || verify != 1)
+        ERROR_OUT(-9768, done);
+
+    if (wc_ecc_set_precompute(&key, ECC_PRECOMP_MAX_BITS + 1) != BAD_FUNC_ARG)
+        ERROR_OUT(-9769, done);
+    ret = wc_ecc_set_precompute(&key, 0);
+    if (ret != 0)
+        ERROR_OUT(-9770, done);
+
+done:
+    wc_ecc_free(&key);
+    return ret;
+}
+
+static int ecc_test_precompute(WC_RNG* rng)
+{
+    int ret = 0;
+
+#ifndef WOLFSSL_SP_NO_256
+    ret = ecc_test_precompute_curve(rng, 32);
+#endif
+#if defined(WOLFSSL_SP_384) && (defined(HAVE_ECC384) || defined(HAVE_ALL_CURVES))
+    if (ret == 0)
+        ret = ecc_test_precompute_curve(rng, 48);
+#endif
+
+    return ret;
+}
+#endif
+
 int ecc_test(void)
 {
     int ret;
@@ -20085,6 +21853,22 @@ int ecc_test(void)
     }
 #endif
 
+#if defined(HAVE_ECC_SIGN) && defined(HAVE_ECC_VERIFY) && !defined(NO_ASN) && \
+    !defined(NO_ECC256) && !defined(WOLFSSL_ATECC508A) && \
+    !defined(WOLFSSL_ATECC608A)
+    ret = ecc_test_verify_batch(&rng);
+    if (ret != 0) {
+        printf("ecc_test_verify_batch failed!: %d\n", ret);
+        goto done;
+    }
+#endif
+#if defined(WC_ECC_PRECOMP) && defined(HAVE_ECC_SIGN) && !defined(NO_ASN)
+    ret = ecc_test_precompute(&rng);
+    if (ret != 0) {
+        printf("ecc_test_precompute failed!: %d\n", ret);
+        goto done;
+    }
+#endif
 #if defined(HAVE_ECC_SIGN) && defined(WOLFSSL_ECDSA_SET_K)
     ret = ecc_test_sign_vectors(&rng);
     if (ret != 0) {
@@ -20845,6 +22629,20 @@ int curve25519_test(void)
     if (XMEMCMP(sharedA, sharedB, x))
         return -10322;
 
+    /* public key from private key matches known test vector */
+    if (wc_curve25519_import_private_raw(sa, sizeof(sa), pa, sizeof(pa), &userA)
+        != 0)
+        return -10350;
+    if (wc_curve25519_make_pub(32, sharedB, 32, userA.k.point) != 0)
+        return -10351;
+    if (XMEMCMP(sharedB, userA.p.point, 32))
+        return -10352;
+    /* private key not clamped */
+    userA.k.point[0] |= 1;
+    if (wc_curve25519_make_pub(32, sharedB, 32, userA.k.point) !=
+                                                                ECC_BAD_ARG_E)
+        return -10353;
+
     ret = curve25519_overflow_test();
     if (ret != 0)
         return ret;
@@ -21282,6 +23080,162 @@ static int ed25519ph_test(void)
 }
 #endif /* HAVE_ED25519_SIGN && HAVE_ED25519_KEY_EXPORT && HAVE_ED25519_KEY_IMPORT */
 
+#if defined(HAVE_ED25519_SIGN) && defined(HAVE_ED25519_VERIFY)
+#define ED25519_TEST_BATCH_CNT    40
+#define ED25519_TEST_BATCH_KEYS   3
+
+#ifdef HAVE_ED25519_KEY_IMPORT
+/* Public key from the seed 00..1f and the signature of "small order R" with
+ * R = rB + T, T of order 8: only valid with the cofactored equation. */
+static const byte ed25519SmallOrderPub[] = {
+    0x03, 0xa1, 0x07, 0xbf, 0xf3, 0xce, 0x10, 0xbe, 0x1d, 0x70, 0xdd, 0x18,
+    0xe7, 0x4b, 0xc0, 0x99, 0x67, 0xe4, 0xd6, 0x30, 0x9b, 0xa5, 0x0d, 0x5f,
+    0x1d, 0xdc, 0x86, 0x64, 0x12, 0x55, 0x31, 0xb8
+};
+static const byte ed25519SmallOrderSig[] = {
+    0x81, 0xc3, 0xb3, 0xb1, 0xde, 0x32, 0x6c, 0xc8, 0x1b, 0x5b, 0xef, 0x10,
+    0xe9, 0x07, 0x73, 0x29, 0xc1, 0x88, 0x38, 0xe2, 0xd5, 0x9d, 0xc1, 0x35,
+    0x9a, 0xd2, 0x4b, 0xe8, 0x87, 0xb3, 0x5f, 0xe4, 0xfb, 0x00, 0xbf, 0x2a,
+    0x65, 0x6e, 0x97, 0xc7, 0xe3, 0x80, 0xe6, 0x11, 0x26, 0xaf, 0xd4, 0x43,
+    0x6b, 0x23, 0xf8, 0x6c, 0xae, 0xea, 0x95, 0x2b, 0x0d, 0x8d, 0xdd, 0xc0,
+    0x3b, 0x86, 0xd4, 0x03
+};
+static const byte ed25519SmallOrderMsg[] = "small order R";
+#endif
+
+/* Verify more signatures than fit in one combined check, all valid and then
+ * with a few of them broken. */
+static int ed25519_test_verify_batch(WC_RNG* rng)
+{
+    int         ret = 0;
+    int         i;
+    ed25519_key key[ED25519_TEST_BATCH_KEYS];
+    ed25519_key* keys[ED25519_TEST_BATCH_CNT];
+    byte        msgData[ED25519_TEST_BATCH_CNT + 32];
+    byte        sigData[ED25519_TEST_BATCH_CNT][ED25519_SIG_SIZE];
+    const byte* sig[ED25519_TEST_BATCH_CNT];
+    word32      sigLen[ED25519_TEST_BATCH_CNT];
+    const byte* msg[ED25519_TEST_BATCH_CNT];
+    word32      msgLen[ED25519_TEST_BATCH_CNT];
+    int         res[ED25519_TEST_BATCH_CNT];
+    ed25519_key keyCopy;
+
+    for (i = 0; i < ED25519_TEST_BATCH_KEYS; i++)
+        wc_ed25519_init(&key[i]);
+    for (i = 0; i < ED25519_TEST_BATCH_KEYS; i++) {
+        if (wc_ed25519_make_key(rng, ED25519_KEY_SIZE, &key[i]) != 0)
+            ERROR_OUT(-10820, done);
+    }
+    /* signing and verifying only read the key */
+    XMEMCPY(&keyCopy, &key[0], sizeof(keyCopy));
+
+    for (i = 0; i < (int)sizeof(msgData); i++)
+        msgData[i] = (byte)i;
+    for (i = 0; i < ED25519_TEST_BATCH_CNT; i++) {
+        keys[i] = &key[i % ED25519_TEST_BATCH_KEYS];
+        msg[i] = msgData + i;
+        msgLen[i] = 16 + (i % 17);
+        sig[i] = sigData[i];
+        sigLen[i] = ED25519_SIG_SIZE;
+        if (wc_ed25519_sign_msg(msg[i], msgLen[i], sigData[i], &sigLen[i],
+                                                               keys[i]) != 0) {
+            ERROR_OUT(-10821, done);
+        }
+    }
+
+    if (wc_ed25519_verify_msg_batch(sig, sigLen, msg, msgLen, res, keys,
+                                               ED25519_TEST_BATCH_CNT) != 0) {
+        ERROR_OUT(-10822, done);
+    }
+    for (i = 0; i < ED25519_TEST_BATCH_CNT; i++) {
+        if (res[i] != 1)
+            ERROR_OUT(-10823, done);
+    }
+    if (XMEMCMP(&keyCopy, &key[0], sizeof(keyCopy)) != 0)
+        ERROR_OUT(-10831, done);
+
+    /* different message, changed S and signatures of two keys swapped */
+    msgLen[3]++;
+    sigData[35][ED25519_SIG_SIZE/2] ^= 1;
+    sig[10] = sigData[11];
+    sig[11] = sigData[10];
+    if (wc_ed25519_verify_msg_batch(sig, sigLen, msg, msgLen, res, keys,
+                                     ED25519_TEST_BATCH_CNT) != SIG_VERIFY_E) {
+        ERROR_OUT(-10824, done);
+    }
+    for (i = 0; i < ED25519_TEST_BATCH_CNT; i++) {
+        if (res[i] != (i != 3 && i != 10 && i != 11 && i != 35))
+            ERROR_OUT(-10825, done);
+    }
+
+#ifdef HAVE_ED25519_KEY_IMPORT
+    /* small order component in R: same result whatever else is in the batch
+     * - with a valid signature and then with a broken one */
+    {
+        ed25519_key soKey;
+        ed25519_key* soKeys[2];
+        const byte* soSig[2];
+        word32      soSigLen[2];
+        const byte* soMsg[2];
+        word32      soMsgLen[2];
+    #if !defined(FREESCALE_LTC_ECC) && !defined(ED25519_SMALL)
+        int         expect = 1;
+    #else
+        int         expect = 0;
+    #endif
+
+        wc_ed25519_init(&soKey);
+        if (wc_ed25519_import_public(ed25519SmallOrderPub,
+                                 sizeof(ed25519SmallOrderPub), &soKey) != 0) {
+            ret = -10828;
+        }
+        if (ret == 0) {
+            wc_ed25519_verify_msg(ed25519SmallOrderSig,
+                sizeof(ed25519SmallOrderSig), ed25519SmallOrderMsg,
+                sizeof(ed25519SmallOrderMsg) - 1, &res[0], &soKey);
+            if (res[0] != 0)
+                ret = -10829;
+        }
+        soKeys[0] = &soKey;
+        soSig[0] = ed25519SmallOrderSig;
+        soSigLen[0] = sizeof(ed25519SmallOrderSig);
+        soMsg[0] = ed25519SmallOrderMsg;
+        soMsgLen[0] = sizeof(ed25519SmallOrderMsg) - 1;
+        for (i = 0; ret == 0 && i < 2; i++) {
+            /* signature 0 is valid and signature 3 has a different message */
+            soKeys[1] = keys[i * 3];
+            soSig[1] = sig[i * 3];
+            soSigLen[1] = sigLen[i * 3];
+            soMsg[1] = msg[i * 3];
+            soMsgLen[1] = msgLen[i * 3];
+            wc_ed25519_verify_msg_batch(soSig, soSigLen, soMsg, soMsgLen, res,
+                                                                   soKeys, 2);
+            if (res[0] != expect || res[1] != (i == 0))
+                ret = -10830;
+        }
+        wc_ed25519_free(&soKey);
+        if (ret != 0)
+            goto done;
+    }
+#endif
+
+    if (wc_ed25519_verify_msg_batch(sig, sigLen, msg, NULL, res, keys,
+                                     ED25519_TEST_BATCH_CNT) != BAD_FUNC_ARG) {
+        ERROR_OUT(-10826, done);
+    }
+    if (wc_ed25519_verify_msg_batch(sig, sigLen, msg, msgLen, res, keys,
+                                                                    0) != 0) {
+        ERROR_OUT(-10827, done);
+    }
+
+done:
+    for (i = 0; i < ED25519_TEST_BATCH_KEYS; i++)
+        wc_ed25519_free(&key[i]);
+
+    return ret;
+}
+#endif /* HAVE_ED25519_SIGN && HAVE_ED25519_VERIFY */
+
 int ed25519_test(void)
 {
     int ret;
@@ -21748,6 +23702,12 @@ int ed25519_test(void)
     if (ret != 0)
         return ret;
 
+#ifdef HAVE_ED25519_VERIFY
+    ret = ed25519_test_verify_batch(&rng);
+    if (ret != 0)
+        return ret;
+#endif
+
 #ifndef NO_ASN
     /* Try ASN.1 encoded private-only key and public key. */
     idx = 0;
@@ -27731,6 +29691,117 @@ int prime_test(void)
 
 #endif /* WOLFSSL_PUBLIC_MP */
 
+#if defined(WOLFSSL_PUBLIC_MP) && !defined(WOLFSSL_SP_MATH)
+
+/* Check modular exponentiation against modular multiplication for odd moduli
+ * of sizes that are not handled by specific implementations. */
+int exptmod_test(void)
+{
+    static const int sizes[] = { 65, 125, 192, 320, 500, 768, 1000 };
+    mp_int p, g, e1, e2, r1, r2, r3;
+    byte*  buf;
+    int    ret, i, sz;
+    WC_RNG rng;
+
+    buf = (byte*)XMALLOC(1000, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (buf == NULL)
+        return -13000;
+    ret = wc_InitRng(&rng);
+    if (ret != 0) {
+        XFREE(buf, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+        return -13001;
+    }
+    ret = mp_init_multi(&p, &g, &e1, &e2, &r1, &r2);
+    if (ret == 0)
+        ret = mp_init(&r3);
+    if (ret != 0)
+        ret = -13002;
+
+    for (i = 0; ret == 0 && i < (int)(sizeof(sizes) / sizeof(*sizes)); i++) {
+        sz = sizes[i];
+    #ifdef USE_FAST_MATH
+        if (sz * 8 > FP_MAX_BITS / 2)
+            break;
+    #endif
+
+        /* Odd modulus with top bit set and base less than modulus. */
+        ret = wc_RNG_GenerateBlock(&rng, buf, sz);
+        if (ret == 0) {
+            buf[0] |= 0x80;
+            buf[sz - 1] |= 0x01;
+            ret = mp_read_unsigned_bin(&p, buf, sz);
+        }
+        if (ret == 0)
+            ret = wc_RNG_GenerateBlock(&rng, buf, sz);
+        if (ret == 0) {
+            buf[0] &= 0x7f;
+            ret = mp_read_unsigned_bin(&g, buf, sz);
+        }
+        if (ret == 0)
+            ret = wc_RNG_GenerateBlock(&rng, buf, sz);
+        if (ret == 0)
+            ret = mp_read_unsigned_bin(&e1, buf, sz);
+        if (ret == 0)
+            ret = wc_RNG_GenerateBlock(&rng, buf, sz);
+        if (ret == 0)
+            ret = mp_read_unsigned_bin(&e2, buf, sz);
+        if (ret != 0) {
+            ret = -13003;
+            break;
+        }
+
+        /* g^e1 * g^e2 = g^(e1 + e2) mod p */
+        ret = mp_exptmod(&g, &e1, &p, &r1);
+        if (ret == 0)
+            ret = mp_exptmod(&g, &e2, &p, &r2);
+        if (ret == 0)
+            ret = mp_mulmod(&r1, &r2, &p, &r3);
+        if (ret == 0)
+            ret = mp_add(&e1, &e2, &e1);
+        if (ret == 0)
+            ret = mp_exptmod(&g, &e1, &p, &r1);
+        if (ret != 0) {
+            ret = -13004;
+            break;
+        }
+        if (mp_cmp(&r1, &r3) != MP_EQ) {
+            ret = -13005;
+            break;
+        }
+
+        /* g^3 = g * g * g mod p */
+        ret = mp_set_int(&e1, 3);
+        if (ret == 0)
+            ret = mp_exptmod(&g, &e1, &p, &r1);
+        if (ret == 0)
+            ret = mp_mulmod(&g, &g, &p, &r2);
+        if (ret == 0)
+            ret = mp_mulmod(&r2, &g, &p, &r2);
+        if (ret != 0) {
+            ret = -13006;
+            break;
+        }
+        if (mp_cmp(&r1, &r2) != MP_EQ) {
+            ret = -13007;
+            break;
+        }
+    }
+
+    mp_clear(&r3);
+    mp_clear(&r2);
+    mp_clear(&r1);
+    mp_clear(&e2);
+    mp_clear(&e1);
+    mp_clear(&g);
+    mp_clear(&p);
+    wc_FreeRng(&rng);
+    XFREE(buf, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+
+    return ret;
+}
+
+#endif /* WOLFSSL_PUBLIC_MP && !WOLFSSL_SP_MATH */
+
 
 #if defined(ASN_BER_TO_DER) && \
     (defined(WOLFSSL_TEST_CERT) || defined(OPENSSL_EXTRA) || \
@@ -1113,8 +1113,13 @@ enum {
 
 
 #ifndef WOLFSSL_DTLS_WINDOW_WORDS
+    /* replay window of 32 bits per word, a power of 2, e.g. 32 words for 1024
+     * records when the peer's records can be reordered far */
     #define WOLFSSL_DTLS_WINDOW_WORDS 2
 #endif /* WOLFSSL_DTLS_WINDOW_WORDS */
+#if (WOLFSSL_DTLS_WINDOW_WORDS & (WOLFSSL_DTLS_WINDOW_WORDS - 1)) != 0
+    #error WOLFSSL_DTLS_WINDOW_WORDS must be a power of 2
+#endif
 #define DTLS_WORD_BITS (sizeof(word32) * CHAR_BIT)
 #define DTLS_SEQ_BITS  (WOLFSSL_DTLS_WINDOW_WORDS * DTLS_WORD_BITS)
 #define DTLS_SEQ_SZ    (sizeof(word32) * WOLFSSL_DTLS_WINDOW_WORDS)
@@ -1326,8 +1331,9 @@ enum Misc {
     DTLS_POOL_SZ             = 255,/* allowed number of list items in TX pool */
     DTLS_EXPORT_PRO          = 165,/* wolfSSL protocol for serialized session */
     DTLS_EXPORT_STATE_PRO    = 166,/* wolfSSL protocol for serialized state */
-    DTLS_EXPORT_VERSION      = 4,  /* wolfSSL version for serialized session */
+    DTLS_EXPORT_VERSION      = 5,  /* wolfSSL version for serialized session */
     DTLS_EXPORT_OPT_SZ       = 60, /* amount of bytes used from Options */
+    DTLS_EXPORT_VERSION_4    = 4,  /* wolfSSL version before ring window */
     DTLS_EXPORT_VERSION_3    = 3,  /* wolfSSL version before TLS 1.3 addition */
     DTLS_EXPORT_OPT_SZ_3     = 59, /* amount of bytes used from Options */
     DTLS_EXPORT_KEY_SZ       = 325 + (DTLS_SEQ_SZ * 2),
@@ -1717,6 +1723,8 @@ WOLFSSL_LOCAL int SNI_Callback(WOLFSSL* ssl);
 #ifdef WOLFSSL_TLS13
 WOLFSSL_LOCAL int  DecryptTls13(WOLFSSL* ssl, byte* output, const byte* input,
                                 word16 sz, const byte* aad, word16 aadSz);
+WOLFSSL_LOCAL int  DeriveTls13Keys(WOLFSSL* ssl, int secret, int side,
+                                   int store);
 WOLFSSL_LOCAL int  DoTls13HandShakeMsgType(WOLFSSL* ssl, byte* input,
                                            word32* inOutIdx, byte type,
                                            word32 size, word32 totalSz);
@@ -2065,22 +2073,77 @@ struct WOLFSSL_SOCKADDR {
     void*        sa; /* pointer to the sockaddr_in or sockaddr_in6 */
 };
 
+#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_SENDMMSG)
+    #ifndef WOLFSSL_DTLS_TX_BATCH
+        #define WOLFSSL_DTLS_TX_BATCH 16 /* max datagrams queued for send */
+    #endif
+#endif
+
 typedef struct WOLFSSL_DTLS_CTX {
     WOLFSSL_SOCKADDR peer;
     int rfd;
     int wfd;
+#ifdef WOLFSSL_DTLS_SENDMMSG
+    byte noGso;          /* socket refused UDP_SEGMENT, use sendmmsg only */
+#endif
 } WOLFSSL_DTLS_CTX;
 
 
+#if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_DEMUX) && \
+    defined(USE_WOLFSSL_IO)
+
+#ifndef WOLFSSL_DTLS_DEMUX_BATCH
+    #define WOLFSSL_DTLS_DEMUX_BATCH 16 /* max datagrams read per call */
+#endif
+#ifndef WOLFSSL_DTLS_DEMUX_QUEUE
+    #define WOLFSSL_DTLS_DEMUX_QUEUE 16 /* max datagrams queued per peer */
+#endif
+
+/* datagram waiting to be read by a peer's WOLFSSL */
+typedef struct DtlsDemuxMsg {
+    struct DtlsDemuxMsg* next;
+    byte*                buf;
+    word32               sz;
+} DtlsDemuxMsg;
+
+/* peer of a demultiplexed socket, WOLFSSL read context */
+typedef struct DtlsDemuxPeer {
+    struct DtlsDemuxPeer* next;         /* hash row list */
+    WOLFSSL*              ssl;
+    DtlsDemuxMsg*         head;         /* received datagrams, oldest first */
+    DtlsDemuxMsg*         tail;
+    word32                count;        /* queued datagrams */
+    word32                row;          /* hash row */
+    SOCKADDR_S            addr;
+    XSOCKLENT             addrSz;
+    byte                  ready;        /* in ready list of current read */
+} DtlsDemuxPeer;
+
+/* DTLS server demultiplexer for a single UDP socket */
+struct WOLFSSL_DEMUX {
+    WOLFSSL_CTX*    ctx;
+    void*           heap;
+    DtlsDemuxPeer** table;              /* peers hashed by address */
+    word32          rows;
+    word32          peers;
+    word32          maxPeers;
+    SOCKET_T        sfd;
+    byte*           rxBuf;              /* batch receive buffers */
+    byte            cookieSecret[COOKIE_SECRET_SZ];
+};
+
+#endif /* WOLFSSL_DTLS && WOLFSSL_DTLS_DEMUX && USE_WOLFSSL_IO */
+
+
 typedef struct WOLFSSL_DTLS_PEERSEQ {
     word32 window[WOLFSSL_DTLS_WINDOW_WORDS];
-                        /* Sliding window for current epoch    */
+                        /* Ring window for current epoch       */
     word16 nextEpoch;   /* Expected epoch in next record       */
     word16 nextSeq_hi;  /* Expected sequence in next record    */
     word32 nextSeq_lo;
 
     word32 prevWindow[WOLFSSL_DTLS_WINDOW_WORDS];
-                        /* Sliding window for old epoch        */
+                        /* Ring window for old epoch           */
     word32 prevSeq_lo;
     word16 prevSeq_hi;  /* Next sequence in allowed old epoch  */
 
@@ -2532,6 +2595,73 @@ WOLFSSL_LOCAL int TLSX_KeyShare_Empty(WOLFSSL* ssl);
 WOLFSSL_LOCAL int TLSX_KeyShare_Establish(WOLFSSL* ssl);
 WOLFSSL_LOCAL int TLSX_KeyShare_DeriveSecret(WOLFSSL* ssl);
 
+#ifdef WOLFSSL_KEY_SHARE_POOL
+#ifdef WOLFSSL_STATIC_MEMORY
+    #error Key share pool not supported with static memory
+#endif
+
+/* Refill threads need POSIX threads. */
+#if defined(WOLFSSL_PTHREADS) && !defined(WOLFSSL_NO_KEY_SHARE_POOL_THREADS)
+    #define WOLFSSL_KEY_SHARE_POOL_THREADS
+#endif
+/* Key pairs generated before fork() are not used by the child process. */
+#if defined(WOLFSSL_PTHREADS) && !defined(WOLFSSL_NO_KEY_SHARE_POOL_FORK_CHECK)
+    #define WOLFSSL_KEY_SHARE_POOL_FORK_CHECK
+    #include <sys/types.h>
+    #include <unistd.h>
+#endif
+
+#ifndef WOLFSSL_KEY_SHARE_POOL_GROUPS
+    #define WOLFSSL_KEY_SHARE_POOL_GROUPS      4
+#endif
+#ifndef WOLFSSL_KEY_SHARE_POOL_MAX_DEPTH
+    #define WOLFSSL_KEY_SHARE_POOL_MAX_DEPTH   1024
+#endif
+#ifndef WOLFSSL_KEY_SHARE_POOL_MAX_THREADS
+    #define WOLFSSL_KEY_SHARE_POOL_MAX_THREADS 8
+#endif
+
+/* Ring of pre-generated key pairs of a named group. */
+typedef struct KeySharePoolGroup {
+    KeyShareEntry* entries;   /* Key pairs - depth entries  */
+    word16         group;     /* NamedGroup                 */
+    word16         depth;     /* Number of key pairs to keep */
+    word16         head;      /* Index of oldest key pair   */
+    word16         count;     /* Key pairs available        */
+    word16         pending;   /* Key pairs being generated  */
+    word32         hits;      /* Key pairs taken            */
+    word32         misses;    /* Key pairs needed when empty */
+    word32         generated; /* Key pairs put into the ring */
+} KeySharePoolGroup;
+
+/* Per context pool of pre-generated key share key pairs. */
+typedef struct KeySharePool {
+    KeySharePoolGroup groups[WOLFSSL_KEY_SHARE_POOL_GROUPS];
+    wolfSSL_Mutex     lock;
+#ifdef WOLFSSL_KEY_SHARE_POOL_THREADS
+    pthread_cond_t    cond;       /* Wakes refill threads */
+    pthread_t         tid[WOLFSSL_KEY_SHARE_POOL_MAX_THREADS];
+#endif
+#ifdef WOLFSSL_KEY_SHARE_POOL_FORK_CHECK
+    pid_t             pid;        /* Process the key pairs belong to */
+#endif
+    void*             heap;
+    int               devId;
+    byte              numGroups;
+    byte              numThreads;
+    byte              running;    /* Refill threads still generating */
+    byte              stop;       /* Refill threads to exit */
+} KeySharePool;
+
+WOLFSSL_LOCAL int TLSX_KeySharePool_Use(WOLFSSL_CTX* ctx, word16 group,
+                                        int depth);
+WOLFSSL_LOCAL int TLSX_KeySharePool_SetThreads(WOLFSSL_CTX* ctx, int threads);
+WOLFSSL_LOCAL int TLSX_KeySharePool_Fill(WOLFSSL_CTX* ctx);
+WOLFSSL_LOCAL int TLSX_KeySharePool_Stats(WOLFSSL_CTX* ctx, word16 group,
+                                          WOLFSSL_KEY_SHARE_POOL_STATS* stats);
+WOLFSSL_LOCAL void TLSX_KeySharePool_Free(KeySharePool* pool);
+#endif /* WOLFSSL_KEY_SHARE_POOL */
+
 
 #if defined(HAVE_SESSION_TICKET) || !defined(NO_PSK)
 #ifndef WOLFSSL_TLS13_DRAFT_18
@@ -2773,6 +2903,9 @@ struct WOLFSSL_CTX {
     word16          group[WOLFSSL_MAX_GROUP_COUNT];
     byte            numGroups;
 #endif
+#ifdef WOLFSSL_KEY_SHARE_POOL
+    KeySharePool*   keySharePool;       /* Pre-generated key shares */
+#endif
 #ifdef WOLFSSL_EARLY_DATA
     word32          maxEarlyDataSz;
 #endif
@@ -3303,6 +3436,10 @@ typedef struct Buffers {
 #endif
 #ifdef WOLFSSL_DTLS
     WOLFSSL_DTLS_CTX dtlsCtx;              /* DTLS connection context */
+    #ifdef WOLFSSL_DTLS_SENDMMSG
+        word32       dtlsTxSz[WOLFSSL_DTLS_TX_BATCH]; /* queued datagrams */
+        byte         dtlsTxCount;          /* number of queued datagrams */
+    #endif /* WOLFSSL_DTLS_SENDMMSG */
     #ifndef NO_WOLFSSL_SERVER
         buffer       dtlsCookieSecret;     /* DTLS cookie secret */
     #endif /* NO_WOLFSSL_SERVER */
@@ -3740,22 +3877,22 @@ typedef struct DtlsRecordLayerHeader {
 } DtlsRecordLayerHeader;
 
 
-typedef struct DtlsFrag {
-    word32 begin;
-    word32 end;
-    struct DtlsFrag* next;
-} DtlsFrag;
-
+#ifndef DTLS_RX_MSG_RING_SZ
+    /* handshake messages reassembled at once, power of 2 */
+    #define DTLS_RX_MSG_RING_SZ 8
+#endif
 
 typedef struct DtlsMsg {
     struct DtlsMsg* next;
     byte*           buf;
     byte*           msg;
-    DtlsFrag*       fragList;
+    byte*           fragMap;   /* Bit per message byte received */
+    word32          bufSz;     /* Length of buf, for reuse     */
     word32          fragSz;    /* Length of fragments received */
     word32          seq;       /* Handshake sequence number    */
     word32          sz;        /* Length of whole message      */
     byte            type;
+    byte            used;      /* Receive ring slot in use     */
 } DtlsMsg;
 
 
@@ -4038,10 +4175,10 @@ struct WOLFSSL {
     int             dtls_timeout_max;   /* maximum timeout value */
     int             dtls_timeout;       /* current timeout value, changes */
     word32          dtls_tx_msg_list_sz;
-    word32          dtls_rx_msg_list_sz;
+    word32          dtls_rx_msg_sz;     /* receive ring slots in use */
     DtlsMsg*        dtls_tx_msg_list;
     DtlsMsg*        dtls_tx_msg;
-    DtlsMsg*        dtls_rx_msg_list;
+    DtlsMsg         dtls_rx_msg[DTLS_RX_MSG_RING_SZ]; /* by message_seq */
     void*           IOCB_CookieCtx;     /* gen cookie ctx */
     word32          dtls_expected_rx;
 #ifdef WOLFSSL_SESSION_EXPORT
@@ -4500,16 +4637,17 @@ WOLFSSL_LOCAL  int GrowInputBuffer(WOLFSSL* ssl, int size, int usedLength);
     WOLFSSL_LOCAL void DtlsMsgListDelete(DtlsMsg*, void*);
     WOLFSSL_LOCAL int  DtlsMsgSet(DtlsMsg*, word32, const byte*, byte,
                                                        word32, word32, void*);
-    WOLFSSL_LOCAL DtlsMsg* DtlsMsgFind(DtlsMsg*, word32);
+    WOLFSSL_LOCAL DtlsMsg* DtlsMsgFind(WOLFSSL*, word32);
     WOLFSSL_LOCAL void DtlsMsgStore(WOLFSSL*, word32, const byte*, word32,
                                                 byte, word32, word32, void*);
-    WOLFSSL_LOCAL DtlsMsg* DtlsMsgInsert(DtlsMsg*, DtlsMsg*);
+    WOLFSSL_LOCAL void DtlsMsgRingFree(WOLFSSL*);
 
     WOLFSSL_LOCAL int  DtlsMsgPoolSave(WOLFSSL*, const byte*, word32);
     WOLFSSL_LOCAL int  DtlsMsgPoolTimeout(WOLFSSL*);
     WOLFSSL_LOCAL int  VerifyForDtlsMsgPoolSend(WOLFSSL*, byte, word32);
     WOLFSSL_LOCAL void DtlsMsgPoolReset(WOLFSSL*);
     WOLFSSL_LOCAL int  DtlsMsgPoolSend(WOLFSSL*, int);
+    WOLFSSL_LOCAL int  DtlsQueueBuffered(WOLFSSL*);
 #endif /* WOLFSSL_DTLS */
 
 #ifndef NO_TLS
@@ -43,6 +43,8 @@
 
 /* @param typeK: (formerly keyType) was shadowing a global declaration in
  *                wolfssl/wolfcrypt/asn.h line 175
+ * @param keyFile: may be NULL to watch a server whose sessions are decoded
+ *                 only with secrets from a key log
  */
 WOLFSSL_API
 SSL_SNIFFER_API int ssl_SetPrivateKey(const char* address, int port,
@@ -213,6 +215,44 @@ SSL_SNIFFER_API int ssl_DecodePacketWithChainSessionInfoStoreData(
         void* vChain, unsigned int chainSz, void* ctx, SSLInfo* sslInfo,
         char* error);
 
+
+/*
+ * Session secrets in NSS key log (SSLKEYLOGFILE) format. Sessions with
+ * secrets in the key log are decoded without the server's private key, this
+ * includes ephemeral key exchanges and TLS v1.3.
+ */
+
+/* ssl_AddKeyLogSecret types, named after the key log labels */
+enum {
+    SNIFFER_SECRET_CLIENT_RANDOM = 0,           /* TLS v1.2 master secret */
+    SNIFFER_SECRET_CLIENT_HANDSHAKE_TRAFFIC = 1,
+    SNIFFER_SECRET_SERVER_HANDSHAKE_TRAFFIC = 2,
+    SNIFFER_SECRET_CLIENT_TRAFFIC_0 = 3,
+    SNIFFER_SECRET_SERVER_TRAFFIC_0 = 4,
+};
+
+/* Called when no secrets are known for clientRandom, the callback may add
+ * them with ssl_AddKeyLog() or ssl_AddKeyLogSecret() before returning. */
+typedef int (*SSLKeyLogCb)(const unsigned char* clientRandom,
+                           unsigned int clientRandomSz, void* ctx);
+
+WOLFSSL_API
+SSL_SNIFFER_API int ssl_LoadKeyLogFile(const char* keyLogFile, char* error);
+
+WOLFSSL_API
+SSL_SNIFFER_API int ssl_AddKeyLog(const char* keyLog, int keyLogSz,
+                                  char* error);
+
+WOLFSSL_API
+SSL_SNIFFER_API int ssl_AddKeyLogSecret(const unsigned char* clientRandom,
+                                        unsigned int clientRandomSz, int type,
+                                        const unsigned char* secret,
+                                        unsigned int secretSz, char* error);
+
+WOLFSSL_API
+SSL_SNIFFER_API int ssl_SetKeyLogCallback(SSLKeyLogCb cb, void* ctx,
+                                          char* error);
+
 #ifdef __cplusplus
     }  /* extern "C" */
 #endif
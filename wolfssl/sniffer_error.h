@@ -130,6 +130,14 @@
 #define NO_DATA_DEST_STR 91
 #define STORE_DATA_FAIL_STR 92
 #define CHAIN_INPUT_STR 93
+#define KEYLOG_FILE_STR 94
+#define KEYLOG_PARSE_STR 95
+
+#define KEYLOG_MISSING_STR 96
+#define GOT_KEYLOG_SECRET_STR 97
+#define GOT_ENC_EXT_STR 98
+#define GOT_KEY_UPDATE_STR 99
+#define TLS13_DERIVE_STR 100
 /* !!!! also add to msgTable in sniffer.c and .rc file !!!! */
 
 
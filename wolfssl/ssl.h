@@ -884,6 +884,27 @@ WOLFSSL_API int  wolfSSL_CTX_set_groups(WOLFSSL_CTX* ctx, int* groups,
                                         int count);
 WOLFSSL_API int  wolfSSL_set_groups(WOLFSSL* ssl, int* groups, int count);
 
+#ifdef WOLFSSL_KEY_SHARE_POOL
+/* Statistics of a named group in a context's key share pool. */
+typedef struct WOLFSSL_KEY_SHARE_POOL_STATS {
+    word32 depth;      /* Number of key pairs to keep generated */
+    word32 available;  /* Key pairs ready to use */
+    word32 hits;       /* Key shares that used a pooled key pair */
+    word32 misses;     /* Key shares generated when the pool was empty */
+    word32 generated;  /* Key pairs generated into the pool */
+    word32 threads;    /* Number of refill threads generating */
+} WOLFSSL_KEY_SHARE_POOL_STATS;
+
+WOLFSSL_API int  wolfSSL_CTX_UseKeySharePool(WOLFSSL_CTX* ctx, word16 group,
+                                             int depth);
+WOLFSSL_API int  wolfSSL_CTX_SetKeySharePoolThreads(WOLFSSL_CTX* ctx,
+                                                    int threads);
+WOLFSSL_API int  wolfSSL_CTX_FillKeySharePool(WOLFSSL_CTX* ctx);
+WOLFSSL_API int  wolfSSL_CTX_GetKeySharePoolStats(WOLFSSL_CTX* ctx,
+                                    word16 group,
+                                    WOLFSSL_KEY_SHARE_POOL_STATS* stats);
+#endif /* WOLFSSL_KEY_SHARE_POOL */
+
 WOLFSSL_API int  wolfSSL_connect_TLSv13(WOLFSSL*);
 WOLFSSL_API int  wolfSSL_accept_TLSv13(WOLFSSL*);
 
@@ -411,6 +411,12 @@ WOLFSSL_API int wc_AesXtsEncryptSector(XtsAes* aes, byte* out,
 WOLFSSL_API int wc_AesXtsDecryptSector(XtsAes* aes, byte* out,
          const byte* in, word32 sz, word64 sector);
 
+WOLFSSL_API int wc_AesXtsEncryptConsecutiveSectors(XtsAes* aes, byte* out,
+         const byte* in, word32 sz, word64 sector, word32 sectorSz);
+
+WOLFSSL_API int wc_AesXtsDecryptConsecutiveSectors(XtsAes* aes, byte* out,
+         const byte* in, word32 sz, word64 sector, word32 sectorSz);
+
 WOLFSSL_API int wc_AesXtsEncrypt(XtsAes* aes, byte* out,
          const byte* in, word32 sz, const byte* i, word32 iSz);
 
@@ -294,7 +294,9 @@ enum Misc_ASN {
     MIN_DATE_SIZE       =  13,
     MAX_DATE_SIZE       =  32,
     ASN_GEN_TIME_SZ     =  15,     /* 7 numbers * 2 + Zulu tag */
-#ifndef NO_RSA
+#if !defined(NO_RSA) && defined(WOLFSSL_SP_8192)
+    MAX_ENCODED_SIG_SZ  = 1024,    /* RSA_MAX_SIZE / 8 */
+#elif !defined(NO_RSA)
     MAX_ENCODED_SIG_SZ  = 512,
 #elif defined(HAVE_ECC)
     MAX_ENCODED_SIG_SZ  = 140,
@@ -87,7 +87,7 @@
     byte  personal[BLAKE2S_PERSONALBYTES];  /* 32 */
   } blake2s_param;
 
-  ALIGN( 32 ) typedef struct __blake2s_state
+  typedef struct __blake2s_state
   {
     word32 h[8];
     word32 t[2];
@@ -112,7 +112,7 @@
     byte  personal[BLAKE2B_PERSONALBYTES];  /* 64 */
   } blake2b_param;
 
-  ALIGN( 64 ) typedef struct __blake2b_state
+  typedef struct __blake2b_state
   {
     word64 h[8];
     word64 t[2];
@@ -122,11 +122,12 @@
     byte  last_node;
   } blake2b_state;
 
+  /* buf holds a stripe of one block per leaf and the blocks after it */
   typedef struct __blake2sp_state
   {
     blake2s_state S[8][1];
     blake2s_state R[1];
-    byte buf[8 * BLAKE2S_BLOCKBYTES];
+    byte buf[2 * 8 * BLAKE2S_BLOCKBYTES];
     word32 buflen;
   } blake2sp_state;
 
@@ -134,7 +135,7 @@
   {
     blake2b_state S[4][1];
     blake2b_state R[1];
-    byte buf[4 * BLAKE2B_BLOCKBYTES];
+    byte buf[2 * 4 * BLAKE2B_BLOCKBYTES];
     word64 buflen;
   } blake2bp_state;
 #pragma pack(pop)
@@ -42,6 +42,13 @@
     #define CPUID_AESNI  0x0020
     #define CPUID_ADX    0x0040   /* ADCX, ADOX */
     #define CPUID_MOVBE  0x0080   /* Move and byte swap */
+    #define CPUID_AVX512F  0x0100
+    #define CPUID_AVX512BW 0x0200 /* AVX-512 byte and word operations */
+    #define CPUID_VAES     0x0400 /* AES instructions on YMM and ZMM */
+    #define CPUID_VPCLMULQDQ 0x0800 /* PCLMULQDQ on YMM and ZMM */
+    #define CPUID_SHA      0x1000 /* SHA-1 and SHA-256 instructions */
+    #define CPUID_AVX512VL 0x2000 /* AVX-512 on XMM and YMM */
+    #define CPUID_AVX512IFMA 0x4000 /* 52-bit integer multiply-add */
 
     #define IS_INTEL_AVX1(f)    ((f) & CPUID_AVX1)
     #define IS_INTEL_AVX2(f)    ((f) & CPUID_AVX2)
@@ -51,9 +58,17 @@
     #define IS_INTEL_AESNI(f)   ((f) & CPUID_AESNI)
     #define IS_INTEL_ADX(f)     ((f) & CPUID_ADX)
     #define IS_INTEL_MOVBE(f)   ((f) & CPUID_MOVBE)
+    #define IS_INTEL_AVX512F(f) ((f) & CPUID_AVX512F)
+    #define IS_INTEL_AVX512BW(f) ((f) & CPUID_AVX512BW)
+    #define IS_INTEL_VAES(f)    ((f) & CPUID_VAES)
+    #define IS_INTEL_VPCLMULQDQ(f) ((f) & CPUID_VPCLMULQDQ)
+    #define IS_INTEL_SHA(f)     ((f) & CPUID_SHA)
+    #define IS_INTEL_AVX512VL(f) ((f) & CPUID_AVX512VL)
+    #define IS_INTEL_AVX512IFMA(f) ((f) & CPUID_AVX512IFMA)
 
     void cpuid_set_flags(void);
-    word32 cpuid_get_flags(void);
+    WOLFSSL_API word32 cpuid_get_flags(void);
+    WOLFSSL_API void cpuid_select_flags(word32 flags);
 #endif
 
 #ifdef __cplusplus
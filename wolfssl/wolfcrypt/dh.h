@@ -45,6 +45,13 @@
 #ifdef WOLFSSL_ASYNC_CRYPT
     #include <wolfssl/wolfcrypt/async.h>
 #endif
+
+/* Shared tables of powers of 2 to speed up key generation with FFDHE groups */
+#if defined(WOLFSSL_HAVE_SP_DH) && defined(WOLFSSL_SP_X86_64_ASM) && \
+    !defined(WC_NO_RNG) && !defined(WOLFSSL_NO_DH_PRECOMP)
+    #define WC_DH_PRECOMP
+#endif
+
 typedef struct DhParams {
     #ifdef HAVE_FFDHE_Q
     const byte* q;
@@ -128,6 +135,10 @@ WOLFSSL_API int wc_DhCheckKeyPair(DhKey* key, const byte* pub, word32 pubSz,
 WOLFSSL_API int wc_DhGenerateParams(WC_RNG *rng, int modSz, DhKey *dh);
 WOLFSSL_API int wc_DhExportParamsRaw(DhKey* dh, byte* p, word32* pSz,
                        byte* q, word32* qSz, byte* g, word32* gSz);
+#ifdef WC_DH_PRECOMP
+WOLFSSL_LOCAL int wc_DhPrecompInit(void);
+WOLFSSL_LOCAL void wc_DhPrecompFree(void);
+#endif
 
 
 #ifdef __cplusplus
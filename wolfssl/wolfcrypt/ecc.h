@@ -113,6 +113,12 @@
     #define ECC_MAX_PAD_SZ 2
 #endif
 
+/* Tables of public key points to speed up verification */
+#if defined(WOLFSSL_HAVE_SP_ECC) && defined(WOLFSSL_SP_X86_64_ASM) && \
+    defined(HAVE_ECC_VERIFY) && !defined(WOLFSSL_NO_ECC_PRECOMP)
+    #define WC_ECC_PRECOMP
+#endif
+
 enum {
     ECC_PUBLICKEY       = 1,
     ECC_PRIVATEKEY      = 2,
@@ -147,6 +153,12 @@ enum {
     /* Shamir's dual add constants */
     SHAMIR_PRECOMP_SZ = 16,
 
+#ifdef WC_ECC_PRECOMP
+    /* Bits of scalar per public key table index - table has 2^bits points */
+    ECC_PRECOMP_MIN_BITS = 2,
+    ECC_PRECOMP_MAX_BITS = 8,
+#endif
+
 #ifdef HAVE_PKCS11
     ECC_MAX_ID_LEN    = 32,
 #endif
@@ -399,6 +411,9 @@ struct ecc_key {
 #ifdef WOLFSSL_ECDSA_SET_K
     mp_int *sign_k;
 #endif
+#ifdef WC_ECC_PRECOMP
+    void* precomp;    /* table of public key points for verify */
+#endif
 
 #ifdef WOLFSSL_SMALL_STACK_CACHE
     mp_int* t1;
@@ -501,6 +516,14 @@ int wc_ecc_verify_hash(const byte* sig, word32 siglen, const byte* hash,
 WOLFSSL_API
 int wc_ecc_verify_hash_ex(mp_int *r, mp_int *s, const byte* hash,
                           word32 hashlen, int* stat, ecc_key* key);
+WOLFSSL_API
+int wc_ecc_verify_hash_batch(const byte** sig, const word32* siglen,
+                             const byte** hash, const word32* hashlen,
+                             int* stat, ecc_key** key, word32 count);
+#ifdef WC_ECC_PRECOMP
+WOLFSSL_API
+int wc_ecc_set_precompute(ecc_key* key, int bits);
+#endif
 #endif /* HAVE_ECC_VERIFY */
 
 WOLFSSL_API
@@ -74,6 +74,13 @@ enum {
     #define WC_ED25519KEY_TYPE_DEFINED
 #endif
 
+/* Keep the expanded private key and decoded public key in the key.
+ * Filled when the key is made or imported - signing and verifying only read
+ * the key. */
+#ifndef WC_ED25519_NO_KEY_CACHE
+    #define WC_ED25519_KEY_CACHE
+#endif
+
 /* An ED25519 Key */
 struct ed25519_key {
     byte    p[ED25519_PUB_KEY_SIZE]; /* compressed public key */
@@ -82,11 +89,22 @@ struct ed25519_key {
     /* uncompressed point coordinates */
     byte pointX[ED25519_KEY_SIZE]; /* recovered X coordinate */
     byte pointY[ED25519_KEY_SIZE]; /* Y coordinate is the public key with The most significant bit of the final octet always zero. */
+#endif
+#ifdef WC_ED25519_KEY_CACHE
+    byte    az[ED25519_PRV_KEY_SIZE]; /* clamped scalar -- prefix, from k */
+#ifndef FREESCALE_LTC_ECC
+    ge_p3   negA;                     /* public key point negated, from p */
+#endif
 #endif
     word16 pubKeySet:1;
+#ifdef WC_ED25519_KEY_CACHE
+    word16 azSet:1;
+    word16 negASet:1;
+#endif
 #ifdef WOLFSSL_ASYNC_CRYPT
     WC_ASYNC_DEV asyncDev;
 #endif
+    void*  heap;
 };
 
 
@@ -126,8 +144,14 @@ int wc_ed25519ph_verify_msg(const byte* sig, word32 sigLen, const byte* msg,
                             word32 msgLen, int* stat, ed25519_key* key,
                             const byte* context, byte contextLen);
 WOLFSSL_API
+int wc_ed25519_verify_msg_batch(const byte** sig, const word32* sigLen,
+                                const byte** msg, const word32* msgLen,
+                                int* stat, ed25519_key** key, word32 count);
+WOLFSSL_API
 int wc_ed25519_init(ed25519_key* key);
 WOLFSSL_API
+int wc_ed25519_init_ex(ed25519_key* key, void* heap, int devId);
+WOLFSSL_API
 void wc_ed25519_free(ed25519_key* key);
 WOLFSSL_API
 int wc_ed25519_import_public(const byte* in, word32 inLen, ed25519_key* key);
@@ -73,6 +73,13 @@ enum {
     #define WC_ED448KEY_TYPE_DEFINED
 #endif
 
+/* Keep the expanded private key and decoded public key in the key.
+ * Filled when the key is made or imported - signing and verifying only read
+ * the key. */
+#ifndef WC_ED448_NO_KEY_CACHE
+    #define WC_ED448_KEY_CACHE
+#endif
+
 /* An ED448 Key */
 struct ed448_key {
     byte    p[ED448_PUB_KEY_SIZE]; /* compressed public key */
@@ -81,8 +88,16 @@ struct ed448_key {
     /* uncompressed point coordinates */
     byte pointX[ED448_KEY_SIZE]; /* recovered X coordinate */
     byte pointY[ED448_KEY_SIZE]; /* Y coordinate is the public key with The most significant bit of the final octet always zero. */
+#endif
+#ifdef WC_ED448_KEY_CACHE
+    byte     az[ED448_PRV_KEY_SIZE]; /* clamped scalar -- prefix, from k */
+    ge448_p2 negA;                   /* public key point negated, from p */
 #endif
     word16 pubKeySet:1;
+#ifdef WC_ED448_KEY_CACHE
+    word16 azSet:1;
+    word16 negASet:1;
+#endif
 #ifdef WOLFSSL_ASYNC_CRYPT
     WC_ASYNC_DEV asyncDev;
 #endif
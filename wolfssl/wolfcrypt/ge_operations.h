@@ -83,6 +83,10 @@ WOLFSSL_LOCAL void sc_muladd(byte* s, const byte* a, const byte* b,
                              const byte* c);
 WOLFSSL_LOCAL void ge_tobytes(unsigned char *,const ge_p2 *);
 WOLFSSL_LOCAL void ge_p3_tobytes(unsigned char *,const ge_p3 *);
+#ifndef ED25519_SMALL
+WOLFSSL_LOCAL int  ge_multi_scalarmult_vartime(ge_p2 *,const unsigned char *,
+                                const unsigned char *,const ge_p3 *,int,void *);
+#endif
 
 
 #ifndef ED25519_SMALL
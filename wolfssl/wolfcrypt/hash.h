@@ -210,6 +210,9 @@ WOLFSSL_API int wc_Sha3_224Hash(const byte*, word32, byte*);
 WOLFSSL_API int wc_Sha3_256Hash(const byte*, word32, byte*);
 WOLFSSL_API int wc_Sha3_384Hash(const byte*, word32, byte*);
 WOLFSSL_API int wc_Sha3_512Hash(const byte*, word32, byte*);
+#ifdef WOLFSSL_SHAKE128
+WOLFSSL_API int wc_Shake128Hash(const byte*, word32, byte*, word32);
+#endif
 #ifdef WOLFSSL_SHAKE256
 WOLFSSL_API int wc_Shake256Hash(const byte*, word32, byte*, word32);
 #endif
@@ -29,6 +29,10 @@
 #define WOLF_CRYPT_HMAC_H
 
 #include <wolfssl/wolfcrypt/hash.h>
+#if !defined(NO_AES) && defined(HAVE_AES_CBC) && !defined(HAVE_FIPS) && \
+    !defined(HAVE_SELFTEST)
+    #include <wolfssl/wolfcrypt/aes.h>
+#endif
 
 #if defined(HAVE_FIPS) && \
 	(!defined(HAVE_FIPS_VERSION) || (HAVE_FIPS_VERSION < 2))
@@ -180,6 +184,15 @@ WOLFSSL_API void wc_HmacFree(Hmac*);
 
 WOLFSSL_API int wolfSSL_GetHmacMaxSize(void);
 
+#if !defined(NO_AES) && defined(HAVE_AES_CBC) && !defined(HAVE_FIPS) && \
+    !defined(HAVE_SELFTEST)
+/* HMAC update and AES-CBC encryption in one pass over the data */
+WOLFSSL_API int wc_HmacUpdate_AesCbcEncrypt(Hmac* hmac, Aes* aes, byte* out,
+                                            const byte* in, word32 sz);
+WOLFSSL_API int wc_AesCbcEncrypt_HmacUpdate(Aes* aes, Hmac* hmac, byte* out,
+                                            const byte* in, word32 sz);
+#endif
+
 WOLFSSL_LOCAL int _InitHmac(Hmac* hmac, int type, void* heap);
 
 #ifdef HAVE_HKDF
@@ -90,7 +90,11 @@
 
 enum {
     RSA_MIN_SIZE = 512,
+#ifdef WOLFSSL_SP_8192
+    RSA_MAX_SIZE = 8192,
+#else
     RSA_MAX_SIZE = 4096,
+#endif
 };
 
 /* avoid redefinition of structs */
@@ -140,6 +144,18 @@ enum {
 #endif
 };
 
+/* Keep the blinding values in the key and update them by squaring. */
+#if defined(WC_RSA_BLINDING) && !defined(WC_NO_RNG) && \
+    !defined(WOLFSSL_RSA_PUBLIC_ONLY) && !defined(WOLFSSL_SP_MATH) && \
+    !defined(HAVE_FIPS) && !defined(HAVE_SELFTEST) && \
+    !defined(WC_RSA_NO_BLINDING_CACHE)
+    #define WC_RSA_BLINDING_CACHE
+    #ifndef WC_RSA_BLINDING_UPDATES
+        /* Number of private operations before new blinding values. */
+        #define WC_RSA_BLINDING_UPDATES 32
+    #endif
+#endif
+
 #ifdef WC_RSA_NONBLOCK
 typedef struct RsaNb {
     exptModNb_t exptmod; /* non-block expt_mod */
@@ -164,6 +180,16 @@ struct RsaKey {
 #ifdef WC_RSA_BLINDING
     WC_RNG* rng;                              /* for PrivateDecrypt blinding */
 #endif
+#ifdef WC_RSA_BLINDING_CACHE
+    mp_int blind;                             /* next blinding value r^e */
+    mp_int blindInv;                          /* next unblinding value 1/r */
+    mp_int blindMod;                          /* modulus values are for */
+    mp_int blindExp;                          /* public exponent of r^e */
+    int    blindCnt;                          /* updates left before new */
+#ifndef SINGLE_THREADED
+    wolfSSL_Mutex blindMutex;
+#endif
+#endif
 #ifdef WOLF_CRYPTO_CB
     int   devId;
 #endif
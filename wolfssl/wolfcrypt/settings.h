@@ -1881,7 +1881,9 @@ extern void uITRON4_free(void *p) ;
 /* if desktop type system and fastmath increase default max bits */
 #ifdef WOLFSSL_X86_64_BUILD
     #if defined(USE_FAST_MATH) && !defined(FP_MAX_BITS)
-        #if MIN_FFDHE_FP_MAX_BITS <= 8192
+        #if defined(WOLFSSL_SP_8192)
+            #define FP_MAX_BITS 16384
+        #elif MIN_FFDHE_FP_MAX_BITS <= 8192
             #define FP_MAX_BITS 8192
         #else
             #define FP_MAX_BITS MIN_FFDHE_FP_MAX_BITS
@@ -2205,6 +2207,11 @@ extern void uITRON4_free(void *p) ;
     #error TLS 1.3 requires the Signature Algorithms extension to be enabled
 #endif
 
+/* The key share pool holds TLS 1.3 key shares */
+#if defined(WOLFSSL_KEY_SHARE_POOL) && !defined(WOLFSSL_TLS13)
+    #undef WOLFSSL_KEY_SHARE_POOL
+#endif
+
 #ifndef NO_WOLFSSL_BASE64_DECODE
     #define WOLFSSL_BASE64_DECODE
 #endif
@@ -192,6 +192,9 @@ WOLFSSL_API void wc_Sha256Free(wc_Sha256*);
 
 WOLFSSL_API int wc_Sha256GetHash(wc_Sha256*, byte*);
 WOLFSSL_API int wc_Sha256Copy(wc_Sha256* src, wc_Sha256* dst);
+WOLFSSL_API int wc_Sha256MultiBuffer(const byte* const* data,
+                                     const word32* sz, byte* const* hash,
+                                     word32 cnt);
 
 #ifdef WOLFSSL_PIC32MZ_HASH
 WOLFSSL_API void wc_Sha256SizeSet(wc_Sha256*, word32);
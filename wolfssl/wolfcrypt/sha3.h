@@ -58,6 +58,9 @@ enum {
     WC_SHA3_512_DIGEST_SIZE  = 64,
     WC_SHA3_512_COUNT        =  9,
 
+    /* SHAKE128 has a 168 byte block, SHAKE256 is the same as SHA3-256 */
+    WC_SHA3_128_COUNT        = 21,
+
 #ifndef HAVE_SELFTEST
     /* These values are used for HMAC, not SHA-3 directly.
      * They come from from FIPS PUB 202. */
@@ -145,6 +148,16 @@ WOLFSSL_API void wc_Sha3_512_Free(wc_Sha3*);
 WOLFSSL_API int wc_Sha3_512_GetHash(wc_Sha3*, byte*);
 WOLFSSL_API int wc_Sha3_512_Copy(wc_Sha3* src, wc_Sha3* dst);
 
+WOLFSSL_API int wc_Sha3_256_MultiBuffer(const byte* const* data,
+                                        const word32* sz, byte* const* hash,
+                                        word32 cnt);
+
+WOLFSSL_API int wc_InitShake128(wc_Shake*, void*, int);
+WOLFSSL_API int wc_Shake128_Update(wc_Shake*, const byte*, word32);
+WOLFSSL_API int wc_Shake128_Final(wc_Shake*, byte*, word32);
+WOLFSSL_API void wc_Shake128_Free(wc_Shake*);
+WOLFSSL_API int wc_Shake128_Copy(wc_Shake* src, wc_Sha3* dst);
+
 WOLFSSL_API int wc_InitShake256(wc_Shake*, void*, int);
 WOLFSSL_API int wc_Shake256_Update(wc_Shake*, const byte*, word32);
 WOLFSSL_API int wc_Shake256_Final(wc_Shake*, byte*, word32);
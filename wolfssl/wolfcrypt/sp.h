@@ -34,6 +34,7 @@
 #include <wolfssl/wolfcrypt/sp_int.h>
 
 #include <wolfssl/wolfcrypt/ecc.h>
+#include <wolfssl/wolfcrypt/dh.h>
 
 #if defined(_MSC_VER)
     #define SP_NOINLINE __declspec(noinline)
@@ -68,6 +69,12 @@ WOLFSSL_LOCAL int sp_RsaPrivate_4096(const byte* in, word32 inLen,
     mp_int* dm, mp_int* pm, mp_int* qm, mp_int* dpm, mp_int* dqm, mp_int* qim,
     mp_int* mm, byte* out, word32* outLen);
 
+WOLFSSL_LOCAL int sp_RsaPublic_8192(const byte* in, word32 inLen,
+    mp_int* em, mp_int* mm, byte* out, word32* outLen);
+WOLFSSL_LOCAL int sp_RsaPrivate_8192(const byte* in, word32 inLen,
+    mp_int* dm, mp_int* pm, mp_int* qm, mp_int* dpm, mp_int* dqm, mp_int* qim,
+    mp_int* mm, byte* out, word32* outLen);
+
 #endif /* WOLFSSL_HAVE_SP_RSA */
 
 #if defined(WOLFSSL_HAVE_SP_DH) || defined(WOLFSSL_HAVE_SP_RSA)
@@ -82,6 +89,8 @@ WOLFSSL_LOCAL int sp_ModExp_3072(mp_int* base, mp_int* exp, mp_int* mod,
     mp_int* res);
 WOLFSSL_LOCAL int sp_ModExp_4096(mp_int* base, mp_int* exp, mp_int* mod,
     mp_int* res);
+WOLFSSL_LOCAL int sp_ModExp_8192(mp_int* base, mp_int* exp, mp_int* mod,
+    mp_int* res);
 
 #endif
 
@@ -93,6 +102,31 @@ WOLFSSL_LOCAL int sp_DhExp_3072(mp_int* base, const byte* exp, word32 expLen,
     mp_int* mod, byte* out, word32* outLen);
 WOLFSSL_LOCAL int sp_DhExp_4096(mp_int* base, const byte* exp, word32 expLen,
     mp_int* mod, byte* out, word32* outLen);
+WOLFSSL_LOCAL int sp_DhExp_8192(mp_int* base, const byte* exp, word32 expLen,
+    mp_int* mod, byte* out, word32* outLen);
+
+#ifdef WC_DH_PRECOMP
+/* Bits of exponent per comb table index - table has 2^bits numbers */
+#ifndef SP_DH_COMB_BITS
+    #define SP_DH_COMB_BITS 6
+#endif
+WOLFSSL_LOCAL int sp_DhPrecomp_2048(const byte* mod, word32 modSz, int bits,
+    void** table, void* heap);
+WOLFSSL_LOCAL int sp_DhExp_precomp_2048(const void* table, const byte* exp,
+    word32 expLen, mp_int* mod, byte* out, word32* outLen);
+WOLFSSL_LOCAL int sp_DhPrecomp_3072(const byte* mod, word32 modSz, int bits,
+    void** table, void* heap);
+WOLFSSL_LOCAL int sp_DhExp_precomp_3072(const void* table, const byte* exp,
+    word32 expLen, mp_int* mod, byte* out, word32* outLen);
+WOLFSSL_LOCAL int sp_DhPrecomp_4096(const byte* mod, word32 modSz, int bits,
+    void** table, void* heap);
+WOLFSSL_LOCAL int sp_DhExp_precomp_4096(const void* table, const byte* exp,
+    word32 expLen, mp_int* mod, byte* out, word32* outLen);
+WOLFSSL_LOCAL int sp_DhPrecomp_8192(const byte* mod, word32 modSz, int bits,
+    void** table, void* heap);
+WOLFSSL_LOCAL int sp_DhExp_precomp_8192(const void* table, const byte* exp,
+    word32 expLen, mp_int* mod, byte* out, word32* outLen);
+#endif /* WC_DH_PRECOMP */
 
 #endif /* WOLFSSL_HAVE_SP_DH */
 
@@ -109,6 +143,23 @@ int sp_ecc_sign_256(const byte* hash, word32 hashLen, WC_RNG* rng, mp_int* priv,
                     mp_int* rm, mp_int* sm, mp_int* km, void* heap);
 int sp_ecc_verify_256(const byte* hash, word32 hashLen, mp_int* pX, mp_int* pY,
                       mp_int* pZ, mp_int* r, mp_int* sm, int* res, void* heap);
+#if defined(WOLFSSL_SP_X86_64_ASM) && !defined(WOLFSSL_SP_NO_256) && \
+    defined(HAVE_ECC_VERIFY)
+/* Maximum number of signatures verified together, sharing an inversion */
+#ifndef SP_ECC_VERIFY_BATCH
+    #define SP_ECC_VERIFY_BATCH 16
+#endif
+int sp_ecc_verify_256_batch(const byte** hash, const word32* hashLen,
+                            mp_int** pX, mp_int** pY, mp_int** pZ, mp_int** r,
+                            mp_int** sm, int* res, int cnt, void* heap);
+#endif
+#ifdef WC_ECC_PRECOMP
+int sp_ecc_precomp_256(mp_int* pX, mp_int* pY, mp_int* pZ, int bits,
+                       void** table, void* heap);
+int sp_ecc_verify_precomp_256(const byte* hash, word32 hashLen, mp_int* pX,
+                              mp_int* pY, mp_int* pZ, mp_int* r, mp_int* sm,
+                              const void* table, int* res, void* heap);
+#endif
 int sp_ecc_is_point_256(mp_int* pX, mp_int* pY);
 int sp_ecc_check_key_256(mp_int* pX, mp_int* pY, mp_int* privm, void* heap);
 int sp_ecc_proj_add_point_256(mp_int* pX, mp_int* pY, mp_int* pZ,
@@ -131,6 +182,13 @@ int sp_ecc_sign_384(const byte* hash, word32 hashLen, WC_RNG* rng, mp_int* priv,
                     mp_int* rm, mp_int* sm, mp_int* km, void* heap);
 int sp_ecc_verify_384(const byte* hash, word32 hashLen, mp_int* pX, mp_int* pY,
                       mp_int* pZ, mp_int* r, mp_int* sm, int* res, void* heap);
+#ifdef WC_ECC_PRECOMP
+int sp_ecc_precomp_384(mp_int* pX, mp_int* pY, mp_int* pZ, int bits,
+                       void** table, void* heap);
+int sp_ecc_verify_precomp_384(const byte* hash, word32 hashLen, mp_int* pX,
+                              mp_int* pY, mp_int* pZ, mp_int* r, mp_int* sm,
+                              const void* table, int* res, void* heap);
+#endif
 int sp_ecc_is_point_384(mp_int* pX, mp_int* pY);
 int sp_ecc_check_key_384(mp_int* pX, mp_int* pY, mp_int* privm, void* heap);
 int sp_ecc_proj_add_point_384(mp_int* pX, mp_int* pY, mp_int* pZ,
@@ -141,6 +199,28 @@ int sp_ecc_proj_dbl_point_384(mp_int* pX, mp_int* pY, mp_int* pZ,
 int sp_ecc_map_384(mp_int* pX, mp_int* pY, mp_int* pZ);
 int sp_ecc_uncompress_384(mp_int* xm, int odd, mp_int* ym);
 
+
+int sp_ecc_mulmod_521(mp_int* km, ecc_point* gm, ecc_point* rm, int map,
+                      void* heap);
+int sp_ecc_mulmod_base_521(mp_int* km, ecc_point* rm, int map, void* heap);
+
+int sp_ecc_make_key_521(WC_RNG* rng, mp_int* priv, ecc_point* pub, void* heap);
+int sp_ecc_secret_gen_521(mp_int* priv, ecc_point* pub, byte* out,
+                          word32* outlen, void* heap);
+int sp_ecc_sign_521(const byte* hash, word32 hashLen, WC_RNG* rng, mp_int* priv,
+                    mp_int* rm, mp_int* sm, mp_int* km, void* heap);
+int sp_ecc_verify_521(const byte* hash, word32 hashLen, mp_int* pX, mp_int* pY,
+                      mp_int* pZ, mp_int* r, mp_int* sm, int* res, void* heap);
+int sp_ecc_is_point_521(mp_int* pX, mp_int* pY);
+int sp_ecc_check_key_521(mp_int* pX, mp_int* pY, mp_int* privm, void* heap);
+int sp_ecc_proj_add_point_521(mp_int* pX, mp_int* pY, mp_int* pZ,
+                              mp_int* qX, mp_int* qY, mp_int* qZ,
+                              mp_int* rX, mp_int* rY, mp_int* rZ);
+int sp_ecc_proj_dbl_point_521(mp_int* pX, mp_int* pY, mp_int* pZ,
+                              mp_int* rX, mp_int* rY, mp_int* rZ);
+int sp_ecc_map_521(mp_int* pX, mp_int* pY, mp_int* pZ);
+int sp_ecc_uncompress_521(mp_int* xm, int odd, mp_int* ym);
+
 #endif /*ifdef WOLFSSL_HAVE_SP_ECC */
 
 
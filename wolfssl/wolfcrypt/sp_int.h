@@ -108,13 +108,21 @@
 #include <wolfssl/wolfcrypt/random.h>
 
 #if !defined(WOLFSSL_HAVE_SP_RSA) && !defined(WOLFSSL_HAVE_SP_DH)
-    #if !defined(NO_PWDBASED) && defined(WOLFSSL_SHA512)
+    #if defined(WOLFSSL_SP_521)
+        #define SP_INT_DIGITS        ((521 + SP_WORD_SIZE) / SP_WORD_SIZE)
+    #elif !defined(NO_PWDBASED) && defined(WOLFSSL_SHA512)
         #define SP_INT_DIGITS        ((512 + SP_WORD_SIZE) / SP_WORD_SIZE)
     #elif defined(WOLFSSL_SP_384)
         #define SP_INT_DIGITS        ((384 + SP_WORD_SIZE) / SP_WORD_SIZE)
     #else
         #define SP_INT_DIGITS        ((256 + SP_WORD_SIZE) / SP_WORD_SIZE)
     #endif
+#elif defined(WOLFSSL_SP_8192)
+    #if defined(WOLFSSL_HAVE_SP_DH)
+        #define SP_INT_DIGITS        ((16384 + SP_WORD_SIZE) / SP_WORD_SIZE)
+    #else
+        #define SP_INT_DIGITS        ((8192 + SP_WORD_SIZE) / SP_WORD_SIZE)
+    #endif
 #elif defined(WOLFSSL_SP_4096)
     #if defined(WOLFSSL_HAVE_SP_DH)
         #define SP_INT_DIGITS        ((8192 + SP_WORD_SIZE) / SP_WORD_SIZE)
@@ -66,6 +66,23 @@ enum {
 WOLFSSL_API int wc_export_int(mp_int* mp, byte* buf, word32* len,
     word32 keySz, int encType);
 
+/* Montgomery exponentiation with 52-bit words using AVX-512 IFMA */
+#if defined(USE_INTEL_SPEEDUP) && defined(__x86_64__) && \
+    !defined(NO_AVX2_SUPPORT) && !defined(NO_AVX512_SUPPORT) && \
+    !defined(WOLFSSL_SP_MATH) && !defined(WOLFSSL_NO_MALLOC) && \
+    !defined(WOLFSSL_NO_MONT52)
+    #define WOLFSSL_MONT52
+
+    /* Smallest modulus, in bits, to use the IFMA code with */
+    #ifndef WOLFSSL_MONT52_MIN_BITS
+        #define WOLFSSL_MONT52_MIN_BITS    512
+    #endif
+
+    MP_API int mp_mont52_supported(mp_int* m);
+    MP_API int mp_exptmod_mont52(mp_int* G, mp_int* X, int bits, mp_int* P,
+                                 mp_int* Y);
+#endif
+
 #ifdef HAVE_WOLF_BIGINT
     #if !defined(WOLF_BIGINT_DEFINED)
         /* raw big integer */
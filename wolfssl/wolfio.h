@@ -389,6 +389,10 @@ WOLFSSL_API int BioReceive(WOLFSSL* ssl, char* buf, int sz, void* ctx);
     #ifdef WOLFSSL_DTLS
         WOLFSSL_API int EmbedReceiveFrom(WOLFSSL* ssl, char* buf, int sz, void*);
         WOLFSSL_API int EmbedSendTo(WOLFSSL* ssl, char* buf, int sz, void* ctx);
+        #ifdef WOLFSSL_DTLS_SENDMMSG
+            WOLFSSL_LOCAL int EmbedSendToBatch(WOLFSSL* ssl, char* buf,
+                                   const word32* sz, int count, void* ctx);
+        #endif /* WOLFSSL_DTLS_SENDMMSG */
         WOLFSSL_API int EmbedGenerateCookie(WOLFSSL* ssl, unsigned char* buf,
                                            int sz, void*);
         #ifdef WOLFSSL_MULTICAST
@@ -401,6 +405,19 @@ WOLFSSL_API int BioReceive(WOLFSSL* ssl, char* buf, int sz, void* ctx);
             WOLFSSL_API int EmbedSetPeer(WOLFSSL* ssl, char* ip, int ipSz,
                                                   unsigned short port, int fam);
         #endif /* WOLFSSL_SESSION_EXPORT */
+        #ifdef WOLFSSL_DTLS_DEMUX
+            /* server peers of one UDP socket, one WOLFSSL per peer */
+            typedef struct WOLFSSL_DEMUX WOLFSSL_DEMUX;
+
+            WOLFSSL_API WOLFSSL_DEMUX* wolfSSL_dtls_demux_new(
+                                   WOLFSSL_CTX* ctx, SOCKET_T sfd, int maxPeers);
+            WOLFSSL_API void wolfSSL_dtls_demux_free(WOLFSSL_DEMUX* demux);
+            WOLFSSL_API int  wolfSSL_dtls_demux_read(WOLFSSL_DEMUX* demux,
+                                                WOLFSSL** ready, int readySz);
+            WOLFSSL_API int  wolfSSL_dtls_demux_remove(
+                                    WOLFSSL_DEMUX* demux, WOLFSSL* ssl);
+            WOLFSSL_API int  wolfSSL_dtls_demux_peers(WOLFSSL_DEMUX* demux);
+        #endif /* WOLFSSL_DTLS_DEMUX */
     #endif /* WOLFSSL_DTLS */
 #endif /* USE_WOLFSSL_IO */
 